@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Core.h"
+
+#include "AI/AIProvider.h"
+
+#pragma region typedefs
+
+#define AI_CONVERSATION_DEFAULT_TOKEN_BUDGET 4096
+#define AI_CONVERSATION_DEFAULT_SUMMARY_TOKEN_BUDGET 512
+
+// Tokens a message costs besides its content, for its role and the separators around it
+#define AI_CONVERSATION_MESSAGE_TOKENS 4
+
+/// @brief Message history of a chat, sent whole with every request. Messages are written for the provider once, when they are appended,
+/// and kept in an append only arena, so a request only copies the written messages. When the history goes over its token budget the oldest
+/// messages are dropped, and a line of each is kept in a summary message while the summary fits its own budget. Tokens are estimated locally,
+/// without the tokenizer of the model. Shouldn't be used without helper functions.
+typedef struct AIConversation AIConversation;
+
+#pragma endregion typedefs
+
+/// @brief Creates an empty conversation.
+/// @param provider Provider the messages are written for. Not copied, must outlive the conversation.
+/// @param systemPrompt System prompt sent first with every request, never dropped. Can be NULL.
+/// @param tokenBudget Tokens the messages of a request can take at most, the system prompt and the summary included.
+/// @param summaryTokenBudget Tokens the summary of the dropped messages can take at most, 0 to drop messages without a summary.
+/// @return Pointer to the created conversation.
+AIConversation *AIConversation_Create(const AIProvider *provider, const string systemPrompt, size_t tokenBudget, size_t summaryTokenBudget);
+
+/// @brief Destroys a conversation and frees its resources.
+/// @param conversation The conversation to destroy.
+void AIConversation_Destroy(AIConversation *conversation);
+
+/// @brief Appends a message, then drops the oldest messages until the conversation fits its budget. The appended message is never dropped.
+/// @param conversation The conversation.
+/// @param role Role of the message, "user" or "assistant".
+/// @param content Content of the message.
+void AIConversation_Append(AIConversation *conversation, const string role, const string content);
+
+/// @brief Removes the latest message, for a request which got no answer.
+/// @param conversation The conversation.
+/// @return True if a message was removed.
+bool AIConversation_RemoveLast(AIConversation *conversation);
+
+/// @brief Removes every message and the summary, keeping the system prompt.
+/// @param conversation The conversation.
+void AIConversation_Clear(AIConversation *conversation);
+
+/// @brief Changes the budgets, dropping the oldest messages if the conversation no longer fits.
+/// @param conversation The conversation.
+/// @param tokenBudget Tokens the messages of a request can take at most.
+/// @param summaryTokenBudget Tokens the summary can take at most, 0 to drop messages without a summary.
+void AIConversation_SetTokenBudget(AIConversation *conversation, size_t tokenBudget, size_t summaryTokenBudget);
+
+/// @brief Builds the body of a request of the whole conversation.
+/// @param conversation The conversation.
+/// @param model Model to ask.
+/// @param isStreaming True to ask for the answer as a stream of events.
+/// @param size Pointer to write the size of the body to.
+/// @return The body, owned by the conversation and valid until it changes.
+const char *AIConversation_BuildRequest(AIConversation *conversation, const string model, bool isStreaming, size_t *size);
+
+/// @brief Gets the estimated tokens of the messages of the next request, the system prompt and the summary included.
+/// @param conversation The conversation.
+/// @return The estimated tokens.
+size_t AIConversation_GetTokenCount(const AIConversation *conversation);
+
+/// @brief Gets the count of the kept messages, without the system prompt and the summary.
+/// @param conversation The conversation.
+/// @return The count.
+size_t AIConversation_GetMessageCount(const AIConversation *conversation);
+
+/// @brief Estimates the tokens of a text for a byte pair tokenizer: a token per 4 characters of a word, and a token per punctuation mark.
+/// Close enough for English text to keep a budget, with a single pass over the text.
+/// @param text The text.
+/// @param length Length of the text.
+/// @return The estimated tokens.
+size_t AIConversation_EstimateTokens(const char *text, size_t length);
@@ -2,15 +2,37 @@
 
 #include "Core.h"
 
-#pragma region typedefs
+#include "AI/AIProvider.h"
+#include "AI/AIResponseCache.h"
 
-#define AI_MANAGER_MAX_QUERY_LENGTH 1024
+#pragma region typedefs
 
 typedef struct AIChat AIChat;
 
+/// @brief Called with each new part of an answer as it arrives, so it can be shown before the whole answer is received.
+/// A streamed answer comes in many parts, any other answer in a single part.
+/// Called on the thread of AIChat_SendAndReceive while it blocks, anything shown from it must be drawn and presented from the callback.
+/// @param text The new part, not null terminated. Valid only during the call.
+/// @param length Length of the part.
+/// @param userData User data given with the callback.
+typedef void (*AIChatTextCallback)(const char *text, size_t length, void *userData);
+
+/// @brief Counters and timing of the requests of an AI Chat, for latency and throughput.
+typedef struct AIChatStatistics
+{
+    size_t requestCount; // remote requests sent, failed ones included
+    size_t failedCount;
+    size_t cachedCount;  // messages answered from the response cache, without a request
+    time_t firstTextNanoseconds; // of the last request, from sending to the first text of the answer. The whole time for a response not streamed.
+    time_t totalNanoseconds;     // of the last request
+    size_t requestBytes;         // of the last request, 0 when answered from the response cache
+    size_t responseBytes;        // of the last response
+    size_t promptTokens;         // of the last request, estimated, the system prompt and the history included
+} AIChatStatistics;
+
 #pragma endregion typedefs
 
-/// @brief Creates a new ready to use AI Chat.
+/// @brief Creates a new ready to use AI Chat, sending to an OpenAI compatible API without streaming.
 /// @param title Name of the AI Chat. Used to identify the AI Chat in the system.
 /// @param model Model of the AI Chat.
 /// @param apiUrl API endpoint for the AI Chat.
@@ -19,12 +41,57 @@ typedef struct AIChat AIChat;
 /// @return Pointer to the created AI Chat.
 AIChat *AIChat_Create(const string title, const string model, const string apiUrl, const string apiKey, const string systemPrompt);
 
+/// @brief Creates a new ready to use AI Chat sending through a provider.
+/// @param title Name of the AI Chat. Used to identify the AI Chat in the system.
+/// @param model Model of the AI Chat.
+/// @param apiUrl API endpoint for the AI Chat.
+/// @param apiKey API key for authenticating requests to the AI Chat.
+/// @param systemPrompt System prompt for the AI Chat. Can be NULL.
+/// @param provider API shape of the endpoint, like AI_PROVIDER_OPENAI. Not copied, must outlive the chat.
+/// @param isStreaming True to receive the answers as streams, the first text of an answer arrives sooner.
+/// @return Pointer to the created AI Chat.
+AIChat *AIChat_CreateWithProvider(const string title, const string model, const string apiUrl, const string apiKey, const string systemPrompt, const AIProvider *provider, bool isStreaming);
+
+/// @brief Creates a new ready to use AI Chat answered on the device by a local model, as a fallback without network.
+/// @param title Name of the AI Chat. Used to identify the AI Chat in the system.
+/// @param modelPath Path of the model file, see LocalModel.h for its layout.
+/// @param systemPrompt System prompt for the AI Chat, put before every message. Can be NULL.
+/// @return Pointer to the created AI Chat, or NULL if the model file cannot be loaded.
+AIChat *AIChat_CreateLocal(const string title, const string modelPath, const string systemPrompt);
+
 /// @brief Destroys the AI Chat and frees its resources.
 /// @param chat Pointer to the AI Chat to destroy.
 void AIChat_Destroy(AIChat *chat);
 
-/// @brief Sends a message to the AI Chat and receives the response.
+/// @brief Sends a message to the AI Chat and receives the response. A remote chat sends the message with the conversation before it,
+/// and keeps the message and the answer in the conversation for the next requests.
 /// @param chat Pointer to the AI Chat to use.
 /// @param message Message to send to the AI Chat.
-/// @return Response from the AI Chat. The response is allocated on the heap and must be freed by the caller.
-stringHeap AIChat_SendAndReceive(const AIChat *chat, const string message);
+/// @return Response from the AI Chat, or NULL if the request fails or the response cannot be read. The response is allocated on the heap and must be freed by the caller.
+stringHeap AIChat_SendAndReceive(AIChat *chat, const string message);
+
+/// @brief Sets the callback receiving the parts of the answers of an AI Chat as they arrive.
+/// @param chat Pointer to the AI Chat.
+/// @param callback The callback, NULL for none.
+/// @param userData Data passed to the callback. Can be NULL.
+void AIChat_SetTextCallback(AIChat *chat, AIChatTextCallback callback, void *userData);
+
+/// @brief Gets the counters and the timing of the requests of an AI Chat.
+/// @param chat Pointer to the AI Chat.
+/// @return The statistics.
+AIChatStatistics AIChat_GetStatistics(const AIChat *chat);
+
+/// @brief Changes how much of the conversation a remote AI Chat sends, the oldest messages over the budget are summarized then dropped.
+/// @param chat Pointer to the AI Chat.
+/// @param tokenBudget Tokens a request can take at most, AI_CONVERSATION_DEFAULT_TOKEN_BUDGET by default.
+/// @param summaryTokenBudget Tokens the summary of the dropped messages can take at most, 0 to drop them without a summary.
+void AIChat_SetTokenBudget(AIChat *chat, size_t tokenBudget, size_t summaryTokenBudget);
+
+/// @brief Forgets the conversation of an AI Chat, the system prompt is kept.
+/// @param chat Pointer to the AI Chat.
+void AIChat_ClearHistory(AIChat *chat);
+
+/// @brief Sets the response cache of a remote AI Chat, a message repeated with the same conversation before it is then answered without a request.
+/// @param chat Pointer to the AI Chat.
+/// @param cache The cache, NULL for none. Not owned, can be shared by chats and must outlive them.
+void AIChat_SetResponseCache(AIChat *chat, AIResponseCache *cache);
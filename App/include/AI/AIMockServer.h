@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Core.h"
+
+#pragma region typedefs
+
+/// @brief How a mock server paces its responses.
+typedef struct AIMockServerSettings
+{
+    time_t latencyNanoseconds; // wait before the first byte of a response, the time the model takes to start answering
+    size_t bytesPerSecond;     // pace of the response body, 0 sends it at once
+    size_t chunkSize;          // bytes per write, a streamed response arrives in chunks of it
+} AIMockServerSettings;
+
+/// @brief An HTTP server on the loopback interface replaying recorded responses of an AI service in turn, so the whole chat pipeline,
+/// requests included, can be measured offline. Serves one connection at a time on a thread of its own. Shouldn't be used without helper functions.
+/// @note Not supported on Windows, AIMockServer_Start fails there.
+typedef struct AIMockServer AIMockServer;
+
+#pragma endregion typedefs
+
+/// @brief Creates a mock server, it serves after AIMockServer_Start.
+/// @param settings How to pace the responses.
+/// @return Pointer to the created server.
+AIMockServer *AIMockServer_Create(AIMockServerSettings settings);
+
+/// @brief Stops a mock server if it is serving and frees its resources.
+/// @param server The server to destroy.
+void AIMockServer_Destroy(AIMockServer *server);
+
+/// @brief Adds a recorded response, the responses are replayed in the order they are added and start over after the last one.
+/// A body starting with "data:" is sent as a stream of server sent events, any other body as JSON. Can only be used before start.
+/// @param server The server.
+/// @param status HTTP status of the response, 200 for an answer, an error status to replay a failed request.
+/// @param body The body, copied.
+void AIMockServer_AddResponse(AIMockServer *server, int status, const string body);
+
+/// @brief Starts serving on a free port of the loopback interface.
+/// @param server The server, with at least a response.
+/// @return True if the server is serving.
+bool AIMockServer_Start(AIMockServer *server);
+
+/// @brief Gets the URL to send the requests to.
+/// @param server The server.
+/// @return The URL, valid while the server lives. Empty before start.
+const char *AIMockServer_GetUrl(const AIMockServer *server);
+
+/// @brief Gets the count of the requests answered.
+/// @param server The server.
+/// @return The count.
+size_t AIMockServer_GetRequestCount(const AIMockServer *server);
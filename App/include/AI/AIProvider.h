@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Core.h"
+
+#pragma region typedefs
+
+/// @brief A message of a conversation, as sent to a provider.
+typedef struct AIMessage
+{
+    string role; // "system", "user" or "assistant"
+    string content;
+} AIMessage;
+
+/// @brief A growable text buffer, kept null terminated. Can be used with helper functions.
+typedef struct AIBuffer
+{
+    stringHeap data; // NULL until the first append
+    size_t length;
+    size_t capacity;
+} AIBuffer;
+
+/// @brief The API shape of an AI service: how a request is written and how a response or a streamed response is read.
+/// AIChat sends through a provider, so another API only needs another provider. Requests are JSON with the messages in an array,
+/// written in parts so a conversation can keep its written messages and only write the new ones. Can be used with helper functions.
+typedef struct AIProvider
+{
+    string name;
+    string authorizationHeader; // header key carrying the API key
+    string authorizationPrefix; // put before the API key in the header value, can be empty
+
+    /// @brief Writes the start of a request, up to the opening of the messages array.
+    void (*writeRequestStart)(AIBuffer *buffer, const string model);
+
+    /// @brief Writes a message as an element of the messages array, without a separator.
+    void (*writeMessage)(AIBuffer *buffer, const AIMessage *message);
+
+    /// @brief Writes the end of a request, from the closing of the messages array.
+    /// @param isStreaming True to ask for the answer as a stream of events.
+    void (*writeRequestEnd)(AIBuffer *buffer, bool isStreaming);
+
+    /// @brief Reads the answer from the body of a whole response.
+    /// @return The answer allocated on the heap, or NULL if the body is not a valid response.
+    stringHeap (*parseResponse)(const string body, size_t size);
+
+    /// @brief Reads the part of the answer in the data of a streamed event.
+    /// @param data Data of the event, null terminated.
+    /// @param isDone Pointer to set to true when the event ends the stream.
+    /// @return The part of the answer allocated on the heap, or NULL if the event has none.
+    stringHeap (*parseStreamEvent)(const string data, bool *isDone);
+} AIProvider;
+
+/// @brief Splits a streamed response into server sent events as its chunks arrive, and gathers the answer from them with a provider.
+/// Chunks can split events anywhere. Shouldn't be used without helper functions.
+typedef struct AIProviderStream AIProviderStream;
+
+/// @brief The chat completions API of OpenAI, also served by most local and hosted model servers.
+extern const AIProvider AI_PROVIDER_OPENAI;
+
+#pragma endregion typedefs
+
+#pragma region AIBuffer
+
+/// @brief Appends data to a buffer, growing it as needed.
+/// @param buffer The buffer.
+/// @param data The data.
+/// @param size Size of the data.
+void AIBuffer_Append(AIBuffer *buffer, const char *data, size_t size);
+
+/// @brief Appends text to a buffer as a JSON string, quoted and escaped.
+/// @param buffer The buffer.
+/// @param text The text, UTF-8.
+/// @param length Length of the text.
+void AIBuffer_AppendJsonString(AIBuffer *buffer, const char *text, size_t length);
+
+/// @brief Empties a buffer, keeping its memory for reuse.
+/// @param buffer The buffer.
+void AIBuffer_Clear(AIBuffer *buffer);
+
+/// @brief Frees the memory of a buffer, it can be appended to again after.
+/// @param buffer The buffer.
+void AIBuffer_Free(AIBuffer *buffer);
+
+#pragma endregion AIBuffer
+
+/// @brief Builds a whole request of messages at once.
+/// @param provider Provider of the request.
+/// @param model Model to ask.
+/// @param messages Messages of the conversation, oldest first.
+/// @param messageCount Count of the messages.
+/// @param isStreaming True to ask for the answer as a stream of events.
+/// @param size Pointer to write the size of the body to.
+/// @return The body, allocated on the heap.
+stringHeap AIProvider_BuildRequest(const AIProvider *provider, const string model, const AIMessage *messages, size_t messageCount, bool isStreaming, size_t *size);
+
+/// @brief Creates a stream reader for a response.
+/// @param provider Provider of the events.
+/// @return Pointer to the created stream.
+AIProviderStream *AIProviderStream_Create(const AIProvider *provider);
+
+/// @brief Destroys a stream and frees its resources.
+/// @param stream The stream to destroy.
+void AIProviderStream_Destroy(AIProviderStream *stream);
+
+/// @brief Feeds a chunk of a response to a stream. Can be used directly from a NetworkResponseChunkCallback.
+/// @param stream The stream.
+/// @param data The chunk, not null terminated.
+/// @param size Size of the chunk.
+/// @return Count of the characters the chunk added to the answer.
+size_t AIProviderStream_Feed(AIProviderStream *stream, const char *data, size_t size);
+
+/// @brief Gets the answer gathered so far.
+/// @param stream The stream.
+/// @param length Pointer to write the length of the answer to. Can be NULL.
+/// @return The answer, null terminated. Valid until the next feed.
+const char *AIProviderStream_GetText(const AIProviderStream *stream, size_t *length);
+
+/// @brief Checks if a stream received its end event.
+/// @param stream The stream.
+/// @return True if the stream ended.
+bool AIProviderStream_IsDone(const AIProviderStream *stream);
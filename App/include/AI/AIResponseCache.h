@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Core.h"
+
+#include <stdint.h>
+
+#pragma region typedefs
+
+#define AI_RESPONSE_CACHE_DEFAULT_MEMORY_CAPACITY 256
+#define AI_RESPONSE_CACHE_DEFAULT_DISK_SLOT_COUNT 4096 // rounded up to a power of 2
+#define AI_RESPONSE_CACHE_DEFAULT_DISK_SLOT_SIZE 4096  // bytes per answer on disk, its header included
+#define AI_RESPONSE_CACHE_DEFAULT_TIME_TO_LIVE 3600    // seconds
+
+/// @brief Identifies a request: a hash of it, a second hash of another function and its size. The whole key is compared on a lookup,
+/// so two requests only share an answer if both of their hashes collide.
+typedef struct AIResponseCacheKey
+{
+    uint64_t hash;  // finds the slot of the request
+    uint64_t check; // verifies the request found
+    uint64_t size;
+} AIResponseCacheKey;
+
+/// @brief Where and how long a cache keeps answers.
+typedef struct AIResponseCacheSettings
+{
+    size_t memoryCapacity; // answers kept in memory, the least recently used is evicted first
+    const char *diskPath;  // file of the disk tier, kept between runs. NULL for a memory only cache.
+    size_t diskSlotCount;  // answers kept on disk
+    size_t diskSlotSize;   // bytes per answer on disk, longer answers are only kept in memory
+    time_t timeToLive;     // seconds an answer is valid after it is stored, 0 to keep answers until they are evicted
+} AIResponseCacheSettings;
+
+/// @brief Counters of a cache, for its hit rate.
+typedef struct AIResponseCacheStatistics
+{
+    size_t lookups;
+    size_t memoryHits;
+    size_t diskHits; // found on disk only, then moved to memory
+    size_t misses;   // expired answers included
+    size_t expired;
+    size_t stores;
+    size_t evictions; // from memory, to make room
+    size_t diskSkips; // answers too long for a disk slot
+} AIResponseCacheStatistics;
+
+/// @brief Answers of an AI service by request, so a repeated request is answered without sending it. A least recently used list in memory,
+/// in front of an optional file mapped to memory with a slot per answer, which keeps answers between runs. Not thread safe, and a disk
+/// file shouldn't be shared by two processes at once. Shouldn't be used without helper functions.
+/// @note The disk tier is not supported on Windows, the cache is memory only there.
+typedef struct AIResponseCache AIResponseCache;
+
+#pragma endregion typedefs
+
+/// @brief Gets the default settings, a memory only cache.
+/// @return The settings.
+AIResponseCacheSettings AIResponseCache_GetDefaultSettings();
+
+/// @brief Creates a cache. A disk file which cannot be opened leaves the cache memory only, a file of other settings is started over.
+/// @param settings Where and how long to keep answers. The disk path is copied.
+/// @return Pointer to the created cache.
+AIResponseCache *AIResponseCache_Create(AIResponseCacheSettings settings);
+
+/// @brief Destroys a cache and frees its resources. The disk file is kept.
+/// @param cache The cache to destroy.
+void AIResponseCache_Destroy(AIResponseCache *cache);
+
+/// @brief Creates the key of a request.
+/// @param apiUrl Endpoint the request is sent to.
+/// @param request Body of the request, which carries the model, the system prompt and the conversation.
+/// @param size Size of the body.
+/// @return The key.
+AIResponseCacheKey AIResponseCache_CreateKey(const string apiUrl, const void *request, size_t size);
+
+/// @brief Gets the answer of a request, from memory or else from disk.
+/// @param cache The cache.
+/// @param key Key of the request.
+/// @return A copy of the answer allocated on the heap, or NULL if there is no valid answer.
+stringHeap AIResponseCache_Get(AIResponseCache *cache, AIResponseCacheKey key);
+
+/// @brief Stores the answer of a request in memory and on disk, replacing an answer of the same request.
+/// @param cache The cache.
+/// @param key Key of the request.
+/// @param answer The answer, copied.
+void AIResponseCache_Put(AIResponseCache *cache, AIResponseCacheKey key, const string answer);
+
+/// @brief Removes every answer, from disk too.
+/// @param cache The cache.
+void AIResponseCache_Clear(AIResponseCache *cache);
+
+/// @brief Gets the counters of a cache.
+/// @param cache The cache.
+/// @return The statistics.
+AIResponseCacheStatistics AIResponseCache_GetStatistics(const AIResponseCache *cache);
+
+/// @brief Gets the share of the lookups answered from memory or disk.
+/// @param cache The cache.
+/// @return The hit rate between 0 and 1, 0 without lookups.
+double AIResponseCache_GetHitRate(const AIResponseCache *cache);
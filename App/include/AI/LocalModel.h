@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Utils/WorkerPool.h"
+
+#include <stdint.h>
+
+#pragma region typedefs
+
+// Magic of a model file, "CCLM" read as a little endian uint32
+#define LOCAL_MODEL_MAGIC 0x4D4C4343
+#define LOCAL_MODEL_VERSION 1
+
+// Alignment of the sections of a model file, so the mapped weights can be read in place
+#define LOCAL_MODEL_FILE_ALIGNMENT 64
+
+#define LOCAL_MODEL_DEFAULT_MAX_TOKENS 256
+
+/// @brief Header at the start of a model file, every field a little endian uint32.
+/// A model file is laid out as:
+/// - This header.
+/// - The tokenizer, vocabularySize entries of a float merge score, a uint32 byte length and the bytes. Tokens 0 to 255 are the single bytes.
+/// - Padding to LOCAL_MODEL_FILE_ALIGNMENT, then float norm weights: attention of every layer, feed forward of every layer, final, dimension floats each.
+/// - Quantized matrices, each as its values then its group scales, each part padded to LOCAL_MODEL_FILE_ALIGNMENT. Values are row major, int8 or two
+///   4 bit values per byte as in SimdKernels quantized4Dot, scales are a float per group of groupSize values of a row.
+///   The token embedding (vocabularySize x dimension), then per layer query (dimension x dimension), key and value ((dimension / headCount * keyValueHeadCount) x dimension),
+///   output (dimension x dimension), gate and up (hiddenDimension x dimension), down (dimension x hiddenDimension), then the classifier (vocabularySize x dimension).
+typedef struct LocalModelHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vocabularySize;
+    uint32_t dimension;
+    uint32_t hiddenDimension;
+    uint32_t layerCount;
+    uint32_t headCount;
+    uint32_t keyValueHeadCount; // heads sharing a key and value head are headCount / keyValueHeadCount
+    uint32_t maxSequenceLength;
+    uint32_t quantizationBits; // 8 or 4
+    uint32_t groupSize;        // a multiple of 32 dividing dimension and hiddenDimension
+    uint32_t beginToken;
+    uint32_t endToken;
+} LocalModelHeader;
+
+/// @brief How the next token is picked from the scores of the model.
+typedef struct LocalModelSampling
+{
+    float temperature; // 0 picks the most likely token every time
+    size_t topK;       // tokens the pick is made among, 0 or 1 is greedy too
+    size_t maxTokens;  // tokens generated at most for a prompt
+    uint64_t seed;     // seed of the random picks, the same seed and prompt give the same answer
+} LocalModelSampling;
+
+/// @brief Timing of the last generation of a model.
+typedef struct LocalModelStatistics
+{
+    size_t promptTokens;
+    size_t generatedTokens;
+    time_t promptNanoseconds;
+    time_t generationNanoseconds;
+} LocalModelStatistics;
+
+/// @brief A small decoder only transformer answering prompts on the device, loaded from a quantized model file mapped to memory.
+/// Matrices are multiplied with the quantized SIMD kernels, keys and values of the processed tokens are cached. Shouldn't be used without helper functions.
+/// @note Not thread safe, a model should be used from one thread at a time.
+typedef struct LocalModel LocalModel;
+
+#pragma endregion typedefs
+
+/// @brief Loads a model from a file. The file is mapped to memory and read in place, so loading is fast and the weights are paged in on use.
+/// @param path Path of the model file.
+/// @param pool Pool to run the rows of the matrix products on. Can be NULL to run on the calling thread.
+/// @return Pointer to the loaded model, or NULL if the file cannot be read or is not a valid model file.
+LocalModel *LocalModel_Load(const string path, WorkerPool *pool);
+
+/// @brief Unmaps the file of a model and frees its resources.
+/// @param model The model to destroy.
+void LocalModel_Destroy(LocalModel *model);
+
+/// @brief Gets the default sampling, greedy with LOCAL_MODEL_DEFAULT_MAX_TOKENS tokens.
+/// @return The default sampling.
+LocalModelSampling LocalModel_GetDefaultSampling();
+
+/// @brief Generates the answer to a prompt. The cache starts empty, so every prompt is answered on its own.
+/// @param model The model.
+/// @param prompt The prompt, as text.
+/// @param sampling How to pick the tokens.
+/// @return The generated text, without the prompt. The text is allocated on the heap and must be freed by the caller.
+stringHeap LocalModel_Generate(LocalModel *model, const string prompt, const LocalModelSampling *sampling);
+
+/// @brief Splits text into tokens by merging bytes with the best scored merges of the vocabulary.
+/// @param model The model.
+/// @param text The text.
+/// @param tokens Array to write the tokens to.
+/// @param capacity Capacity of the tokens array, the text is cut at it.
+/// @return Count of the written tokens.
+size_t LocalModel_Encode(const LocalModel *model, const string text, uint32_t *tokens, size_t capacity);
+
+/// @brief Gets the timing of the last generation, for tokens per second.
+/// @param model The model.
+/// @return The statistics.
+LocalModelStatistics LocalModel_GetStatistics(const LocalModel *model);
+
+/// @brief Gets the header of a model.
+/// @param model The model.
+/// @return Pointer to the header inside the mapped file.
+const LocalModelHeader *LocalModel_GetHeader(const LocalModel *model);
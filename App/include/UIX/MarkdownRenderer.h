@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Modules/RenderManager.h"
+
+#pragma region typedefs
+
+#define MARKDOWN_RENDERER_MAX_LINE_WIDTH 256
+#define MARKDOWN_RENDERER_INITIAL_SOURCE_CAPACITY 1024
+#define MARKDOWN_RENDERER_INITIAL_LINE_CAPACITY 64
+
+/// @brief Styles a laid out markdown character can carry.
+/// @note Values can be combined using bitwise OR operations.
+typedef enum MarkdownStyle
+{
+    MarkdownStyle_Plain = 0,             // Plain paragraph text.
+    MarkdownStyle_Heading = (1U << 0),   // Text of a '#' heading line.
+    MarkdownStyle_Strong = (1U << 1),    // Text between '**' or '__' markers.
+    MarkdownStyle_Emphasis = (1U << 2),  // Text between '*' markers.
+    MarkdownStyle_Code = (1U << 3),      // Text between '`' markers.
+    MarkdownStyle_CodeBlock = (1U << 4), // Lines inside a '```' fenced block.
+    MarkdownStyle_ListMarker = (1U << 5) // The bullet or number of a list item.
+} MarkdownStyle;
+
+/// @brief Count of all possible MarkdownStyle combinations. Used to size per style lookup tables.
+#define MARKDOWN_STYLE_COMBINATION_COUNT (1U << 6)
+
+/// @brief Incremental markdown to attributed text renderer. Consumes streamed chunks and lays out only the paragraph that is still changing.
+typedef struct MarkdownRenderer MarkdownRenderer;
+
+#pragma endregion typedefs
+
+/// @brief Creates a markdown renderer which lays out text for the given width.
+/// @param title Title of the renderer. Used for debugging.
+/// @param width Count of columns a laid out line can use. Clamped to MARKDOWN_RENDERER_MAX_LINE_WIDTH.
+/// @return Pointer to the created markdown renderer.
+MarkdownRenderer *MarkdownRenderer_Create(const string title, int width);
+
+/// @brief Destroys the markdown renderer. The text attributes it uses are not destroyed, they are interned and owned by the renderer manager.
+/// @param renderer Markdown renderer to destroy.
+void MarkdownRenderer_Destroy(MarkdownRenderer *renderer);
+
+/// @brief Appends a chunk of markdown source. Only the tail paragraph that is not finished yet is laid out again.
+/// @param renderer Markdown renderer to append to.
+/// @param chunk Chunk of markdown source. Does not have to be null terminated.
+/// @param chunkSize Size of the chunk in bytes.
+/// @note Chunks can split lines, words and markers anywhere. Can be used directly from a NetworkResponseChunkCallback.
+void MarkdownRenderer_Append(MarkdownRenderer *renderer, const char *chunk, size_t chunkSize);
+
+/// @brief Deletes all source and laid out lines. Next draw clears the previously drawn lines.
+/// @param renderer Markdown renderer to clear.
+void MarkdownRenderer_Clear(MarkdownRenderer *renderer);
+
+/// @brief Changes the layout width. Lays out the whole source again.
+/// @param renderer Markdown renderer to change width of.
+/// @param width New count of columns a laid out line can use.
+void MarkdownRenderer_SetWidth(MarkdownRenderer *renderer, int width);
+
+/// @brief Marks all lines as changed so the next draw redraws everything. Should be used after the target window is cleared.
+/// @param renderer Markdown renderer to invalidate.
+void MarkdownRenderer_Invalidate(MarkdownRenderer *renderer);
+
+/// @brief Draws the lines changed since the last draw to the window. Shows the last lines if the text is taller than the window.
+/// @param renderer Markdown renderer to draw.
+/// @param window Window to draw into.
+/// @param position Top left position of the text in the window.
+void MarkdownRenderer_Draw(MarkdownRenderer *renderer, const RendererWindow *window, Vector2Int position);
+
+/// @brief Gets the count of laid out lines.
+/// @param renderer Markdown renderer to get the line count of.
+/// @return Count of laid out lines.
+size_t MarkdownRenderer_GetLineCount(const MarkdownRenderer *renderer);
@@ -5,10 +5,42 @@
 #include "Modules/RenderManager.h"
 #include "Modules/InputManager.h"
 
+/// @brief Initializes the tiling layout. Windows are placed again in a single pass when the terminal is resized.
+void WindowExplorer_Initialize();
+
+/// @brief Stops the tiling layout and frees the layout tree. Windows are not destroyed, they are owned by the app.
+void WindowExplorer_Terminate();
+
+/// @brief Adds a window to the layout. The first window fills the screen, others split the focused pane on its longer side.
+/// @param window Window to add. Its parent should be the main window.
+/// @note The added window gets the focus.
 void WindowExplorer_AddWindow(RendererWindow *window);
 
+/// @brief Removes a window from the layout. Its sibling pane takes the freed space.
+/// @param window Window to remove. It is not destroyed.
+void WindowExplorer_RemoveWindow(RendererWindow *window);
+
+/// @brief Focuses the pane of the window. New windows split the focused pane.
+/// @param window Window to focus. Should be added to the layout.
 void WindowExplorer_SetFocus(RendererWindow *window);
 
+/// @brief Gets the window of the focused pane.
+/// @return The focused window. NULL if the layout is empty.
+RendererWindow *WindowExplorer_GetFocus();
+
+/// @brief Splits the focused pane side by side. The window is placed on the right half and gets the focus.
+/// @param window Window to place. Its parent should be the main window.
 void WindowExplorer_SplitHorizontal(RendererWindow *window);
 
+/// @brief Splits the focused pane into top and bottom. The window is placed on the bottom half and gets the focus.
+/// @param window Window to place. Its parent should be the main window.
 void WindowExplorer_SplitVertical(RendererWindow *window);
+
+/// @brief Sets the share of the window's pane in the split it belongs to.
+/// @param window Window of the pane.
+/// @param ratio Share of the pane, between 0 and 1. Split panes are 0.5 by default.
+void WindowExplorer_SetSplitRatio(RendererWindow *window, float ratio);
+
+/// @brief Computes the geometry of every pane and applies it to the changed windows, then refreshes them.
+/// @note Called on terminal resize and after every layout change, apps do not need to call it.
+void WindowExplorer_Relayout();
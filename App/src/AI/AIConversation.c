@@ -0,0 +1,417 @@
+#include "AI/AIConversation.h"
+
+#include "Utils/Arena.h"
+
+#pragma region Source Only
+
+#define AI_CONVERSATION_INITIAL_ARENA_CAPACITY 65536
+#define AI_CONVERSATION_INITIAL_MESSAGE_CAPACITY 32
+#define AI_CONVERSATION_SUMMARY_LINE_LENGTH 160 // characters of a dropped message kept in the summary
+#define AI_CONVERSATION_SUMMARY_TITLE "Summary of the earlier conversation:\n"
+
+typedef struct AIConversationMessage
+{
+    const char *role;    // in the arena
+    const char *content; // in the arena
+    const char *json;    // the message as the provider writes it, in the arena
+    size_t jsonLength;
+    size_t tokens;
+} AIConversationMessage;
+
+typedef struct AIConversation
+{
+    const AIProvider *provider;
+    size_t tokenBudget;
+    size_t summaryTokenBudget;
+
+    // Messages from first to count are kept, the ones before first are dropped and their bytes reclaimed when the arena is compacted
+    Arena *arena;
+    AIConversationMessage *messages;
+    size_t first;
+    size_t count;
+    size_t capacity;
+    size_t messageTokens; // of the kept messages
+
+    AIBuffer systemJson; // empty without a system prompt
+    size_t systemTokens;
+
+    AIBuffer summary;     // lines of the dropped messages, without the title
+    AIBuffer summaryJson; // empty without a summary
+    size_t summaryTokens;
+
+    AIBuffer scratch; // a message written for the provider, before it is copied to the arena
+    AIBuffer body;    // the last built request, reused
+} AIConversation;
+
+/// @brief Moves the kept messages to a new arena large enough for them and the bytes to come. The dropped bytes are left behind.
+void AIConversation_Compact(AIConversation *conversation, size_t comingSize)
+{
+    size_t keptSize = 0;
+    for (size_t i = conversation->first; i < conversation->count; i++)
+    {
+        const AIConversationMessage *message = &conversation->messages[i];
+        keptSize += strlen(message->role) + strlen(message->content) + message->jsonLength + 3;
+    }
+
+    // Twice the needed size, so compactions are rare while the history grows
+    size_t capacity = Arena_GetCapacity(conversation->arena);
+    while (capacity < 2 * (keptSize + comingSize))
+    {
+        capacity *= 2;
+    }
+
+    Arena *arena = Arena_Create(capacity);
+    for (size_t i = conversation->first; i < conversation->count; i++)
+    {
+        AIConversationMessage *message = &conversation->messages[i];
+        const char *parts[] = {message->role, message->content, message->json};
+        size_t sizes[] = {strlen(message->role) + 1, strlen(message->content) + 1, message->jsonLength + 1};
+        char *copies[3];
+        for (size_t j = 0; j < 3; j++)
+        {
+            copies[j] = (char *)Arena_Allocate(arena, sizes[j], 1);
+            memcpy(copies[j], parts[j], sizes[j]);
+        }
+
+        message->role = copies[0];
+        message->content = copies[1];
+        message->json = copies[2];
+    }
+
+    Arena_Destroy(conversation->arena);
+    conversation->arena = arena;
+}
+
+/// @brief Copies text with its terminator into the arena, which must have the room.
+const char *AIConversation_Store(AIConversation *conversation, const char *text, size_t length)
+{
+    char *copy = (char *)Arena_Allocate(conversation->arena, length + 1, 1);
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    return copy;
+}
+
+/// @brief Writes the summary message from the summary lines, after dropping the oldest lines over the summary budget.
+void AIConversation_WriteSummary(AIConversation *conversation)
+{
+    AIBuffer *summary = &conversation->summary;
+    size_t titleTokens = AIConversation_EstimateTokens(AI_CONVERSATION_SUMMARY_TITLE, strlen(AI_CONVERSATION_SUMMARY_TITLE)) + AI_CONVERSATION_MESSAGE_TOKENS;
+
+    size_t lineTokens = AIConversation_EstimateTokens(summary->data, summary->length);
+    while (summary->length > 0 && titleTokens + lineTokens > conversation->summaryTokenBudget)
+    {
+        const char *lineEnd = (const char *)memchr(summary->data, '\n', summary->length);
+        size_t lineSize = lineEnd == NULL ? summary->length : (size_t)(lineEnd - summary->data) + 1;
+
+        lineTokens -= AIConversation_EstimateTokens(summary->data, lineSize);
+        memmove(summary->data, summary->data + lineSize, summary->length - lineSize + 1);
+        summary->length -= lineSize;
+    }
+
+    AIBuffer_Clear(&conversation->summaryJson);
+    conversation->summaryTokens = 0;
+    if (summary->length == 0)
+    {
+        return;
+    }
+
+    AIBuffer content = {NULL, 0, 0};
+    AIBuffer_Append(&content, AI_CONVERSATION_SUMMARY_TITLE, strlen(AI_CONVERSATION_SUMMARY_TITLE));
+    AIBuffer_Append(&content, summary->data, summary->length);
+
+    AIMessage message = {"system", content.data};
+    conversation->provider->writeMessage(&conversation->summaryJson, &message);
+    conversation->summaryTokens = titleTokens + lineTokens;
+
+    AIBuffer_Free(&content);
+}
+
+/// @brief Adds a line of a dropped message to the summary lines, its start up to a sentence end or AI_CONVERSATION_SUMMARY_LINE_LENGTH characters.
+void AIConversation_Summarize(AIConversation *conversation, const AIConversationMessage *message)
+{
+    AIBuffer *summary = &conversation->summary;
+    AIBuffer_Append(summary, "- ", 2);
+    AIBuffer_Append(summary, message->role, strlen(message->role));
+    AIBuffer_Append(summary, ": ", 2);
+
+    size_t length = 0;
+    bool isSentence = false;
+    const char *content = message->content;
+    while (content[length] != '\0' && length < AI_CONVERSATION_SUMMARY_LINE_LENGTH && !isSentence)
+    {
+        char letter = content[length++];
+        isSentence = (letter == '.' || letter == '?' || letter == '!') && (content[length] == ' ' || content[length] == '\n' || content[length] == '\0');
+    }
+
+    // New lines separate the summary lines, so the ones of the content become spaces
+    size_t start = summary->length;
+    AIBuffer_Append(summary, content, length);
+    for (size_t i = start; i < summary->length; i++)
+    {
+        summary->data[i] = summary->data[i] == '\n' || summary->data[i] == '\r' ? ' ' : summary->data[i];
+    }
+
+    if (!isSentence && content[length] != '\0')
+    {
+        AIBuffer_Append(summary, "...", 3);
+    }
+    AIBuffer_Append(summary, "\n", 1);
+}
+
+/// @brief Drops the oldest messages until the conversation fits its budget, keeping the latest message.
+void AIConversation_Trim(AIConversation *conversation)
+{
+    size_t droppedCount = 0;
+    while (conversation->count - conversation->first > 1 &&
+           conversation->systemTokens + conversation->summaryTokens + conversation->messageTokens > conversation->tokenBudget)
+    {
+        const AIConversationMessage *message = &conversation->messages[conversation->first++];
+        conversation->messageTokens -= message->tokens;
+        droppedCount++;
+
+        if (conversation->summaryTokenBudget > 0)
+        {
+            AIConversation_Summarize(conversation, message);
+            AIConversation_WriteSummary(conversation);
+        }
+    }
+
+    if (conversation->systemTokens + conversation->summaryTokens + conversation->messageTokens > conversation->tokenBudget)
+    {
+        DebugWarning("AI conversation is over its budget of %zu tokens with a single message.", conversation->tokenBudget);
+    }
+
+    if (droppedCount > 0)
+    {
+        DebugInfo("AI conversation dropped %zu messages to fit its budget of %zu tokens.", droppedCount, conversation->tokenBudget);
+    }
+}
+
+#pragma endregion Source Only
+
+AIConversation *AIConversation_Create(const AIProvider *provider, const string systemPrompt, size_t tokenBudget, size_t summaryTokenBudget)
+{
+    DebugAssert(provider != NULL, "Null pointer passed as parameter. Provider cannot be NULL.");
+
+    AIConversation *conversation = (AIConversation *)calloc(1, sizeof(AIConversation));
+    DebugAssert(conversation != NULL, "Memory allocation failed for AI conversation.");
+
+    conversation->provider = provider;
+    conversation->tokenBudget = tokenBudget;
+    conversation->summaryTokenBudget = summaryTokenBudget;
+    conversation->arena = Arena_Create(AI_CONVERSATION_INITIAL_ARENA_CAPACITY);
+    conversation->capacity = AI_CONVERSATION_INITIAL_MESSAGE_CAPACITY;
+    conversation->messages = (AIConversationMessage *)malloc(conversation->capacity * sizeof(AIConversationMessage));
+    DebugAssert(conversation->messages != NULL, "Memory allocation failed for AI conversation messages.");
+
+    if (systemPrompt != NULL && systemPrompt[0] != '\0')
+    {
+        AIMessage message = {"system", systemPrompt};
+        provider->writeMessage(&conversation->systemJson, &message);
+        conversation->systemTokens = AIConversation_EstimateTokens(systemPrompt, strlen(systemPrompt)) + AI_CONVERSATION_MESSAGE_TOKENS;
+    }
+
+    DebugInfo("AI conversation created with a budget of %zu tokens.", tokenBudget);
+    return conversation;
+}
+
+void AIConversation_Destroy(AIConversation *conversation)
+{
+    DebugAssert(conversation != NULL, "Null pointer passed as parameter. Conversation cannot be NULL.");
+
+    Arena_Destroy(conversation->arena);
+    conversation->arena = NULL;
+
+    free(conversation->messages);
+    conversation->messages = NULL;
+
+    AIBuffer_Free(&conversation->systemJson);
+    AIBuffer_Free(&conversation->summary);
+    AIBuffer_Free(&conversation->summaryJson);
+    AIBuffer_Free(&conversation->scratch);
+    AIBuffer_Free(&conversation->body);
+
+    free(conversation);
+    conversation = NULL;
+
+    DebugInfo("AI conversation destroyed.");
+}
+
+void AIConversation_Append(AIConversation *conversation, const string role, const string content)
+{
+    DebugAssert(conversation != NULL, "Null pointer passed as parameter. Conversation cannot be NULL.");
+    DebugAssert(role != NULL, "Null pointer passed as parameter. Role cannot be NULL.");
+    DebugAssert(content != NULL, "Null pointer passed as parameter. Content cannot be NULL.");
+
+    if (conversation->count == conversation->capacity)
+    {
+        if (conversation->first > 0)
+        {
+            conversation->count -= conversation->first;
+            memmove(conversation->messages, conversation->messages + conversation->first, conversation->count * sizeof(AIConversationMessage));
+            conversation->first = 0;
+        }
+
+        if (conversation->count == conversation->capacity)
+        {
+            conversation->capacity *= 2;
+            conversation->messages = (AIConversationMessage *)realloc(conversation->messages, conversation->capacity * sizeof(AIConversationMessage));
+            DebugAssert(conversation->messages != NULL, "Memory allocation failed for AI conversation messages.");
+        }
+    }
+
+    AIMessage written = {role, content};
+    AIBuffer_Clear(&conversation->scratch);
+    conversation->provider->writeMessage(&conversation->scratch, &written);
+
+    size_t roleLength = strlen(role);
+    size_t contentLength = strlen(content);
+    size_t size = roleLength + contentLength + conversation->scratch.length + 3;
+    if (Arena_GetCapacity(conversation->arena) - Arena_GetUsed(conversation->arena) < size)
+    {
+        AIConversation_Compact(conversation, size);
+    }
+
+    AIConversationMessage *message = &conversation->messages[conversation->count++];
+    message->role = AIConversation_Store(conversation, role, roleLength);
+    message->content = AIConversation_Store(conversation, content, contentLength);
+    message->json = AIConversation_Store(conversation, conversation->scratch.data, conversation->scratch.length);
+    message->jsonLength = conversation->scratch.length;
+    message->tokens = AIConversation_EstimateTokens(content, contentLength) + AI_CONVERSATION_MESSAGE_TOKENS;
+    conversation->messageTokens += message->tokens;
+
+    AIConversation_Trim(conversation);
+}
+
+bool AIConversation_RemoveLast(AIConversation *conversation)
+{
+    DebugAssert(conversation != NULL, "Null pointer passed as parameter. Conversation cannot be NULL.");
+
+    if (conversation->count == conversation->first)
+    {
+        return false;
+    }
+
+    // The bytes stay in the arena until it is compacted
+    conversation->messageTokens -= conversation->messages[--conversation->count].tokens;
+    return true;
+}
+
+void AIConversation_Clear(AIConversation *conversation)
+{
+    DebugAssert(conversation != NULL, "Null pointer passed as parameter. Conversation cannot be NULL.");
+
+    conversation->first = 0;
+    conversation->count = 0;
+    conversation->messageTokens = 0;
+    Arena_Reset(conversation->arena);
+
+    AIBuffer_Clear(&conversation->summary);
+    AIBuffer_Clear(&conversation->summaryJson);
+    conversation->summaryTokens = 0;
+}
+
+void AIConversation_SetTokenBudget(AIConversation *conversation, size_t tokenBudget, size_t summaryTokenBudget)
+{
+    DebugAssert(conversation != NULL, "Null pointer passed as parameter. Conversation cannot be NULL.");
+
+    conversation->tokenBudget = tokenBudget;
+    conversation->summaryTokenBudget = summaryTokenBudget;
+
+    if (summaryTokenBudget > 0)
+    {
+        AIConversation_WriteSummary(conversation);
+    }
+    else
+    {
+        AIBuffer_Clear(&conversation->summary);
+        AIBuffer_Clear(&conversation->summaryJson);
+        conversation->summaryTokens = 0;
+    }
+
+    AIConversation_Trim(conversation);
+}
+
+const char *AIConversation_BuildRequest(AIConversation *conversation, const string model, bool isStreaming, size_t *size)
+{
+    DebugAssert(conversation != NULL, "Null pointer passed as parameter. Conversation cannot be NULL.");
+    DebugAssert(model != NULL, "Null pointer passed as parameter. Model cannot be NULL.");
+    DebugAssert(size != NULL, "Null pointer passed as parameter. Size cannot be NULL.");
+
+    AIBuffer *body = &conversation->body;
+    AIBuffer_Clear(body);
+    conversation->provider->writeRequestStart(body, model);
+
+    bool isFirst = true;
+    const AIBuffer *fixedParts[] = {&conversation->systemJson, &conversation->summaryJson};
+    for (size_t i = 0; i < sizeof(fixedParts) / sizeof(fixedParts[0]); i++)
+    {
+        if (fixedParts[i]->length > 0)
+        {
+            if (!isFirst)
+            {
+                AIBuffer_Append(body, ",", 1);
+            }
+            AIBuffer_Append(body, fixedParts[i]->data, fixedParts[i]->length);
+            isFirst = false;
+        }
+    }
+
+    for (size_t i = conversation->first; i < conversation->count; i++)
+    {
+        if (!isFirst)
+        {
+            AIBuffer_Append(body, ",", 1);
+        }
+        AIBuffer_Append(body, conversation->messages[i].json, conversation->messages[i].jsonLength);
+        isFirst = false;
+    }
+
+    conversation->provider->writeRequestEnd(body, isStreaming);
+
+    *size = body->length;
+    return body->data;
+}
+
+size_t AIConversation_GetTokenCount(const AIConversation *conversation)
+{
+    DebugAssert(conversation != NULL, "Null pointer passed as parameter. Conversation cannot be NULL.");
+
+    return conversation->systemTokens + conversation->summaryTokens + conversation->messageTokens;
+}
+
+size_t AIConversation_GetMessageCount(const AIConversation *conversation)
+{
+    DebugAssert(conversation != NULL, "Null pointer passed as parameter. Conversation cannot be NULL.");
+
+    return conversation->count - conversation->first;
+}
+
+size_t AIConversation_EstimateTokens(const char *text, size_t length)
+{
+    DebugAssert(text != NULL || length == 0, "Null pointer passed as parameter. Text cannot be NULL.");
+
+    size_t tokens = 0;
+    size_t wordLength = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        unsigned char letter = (unsigned char)text[i];
+
+        // Letters, digits and the bytes of UTF-8 characters make words
+        if ((letter >= 'a' && letter <= 'z') || (letter >= 'A' && letter <= 'Z') || (letter >= '0' && letter <= '9') || letter >= 0x80)
+        {
+            wordLength++;
+            continue;
+        }
+
+        tokens += (wordLength + 3) / 4;
+        wordLength = 0;
+
+        if (letter > ' ')
+        {
+            tokens++;
+        }
+    }
+
+    return tokens + (wordLength + 3) / 4;
+}
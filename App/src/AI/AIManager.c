@@ -1,7 +1,9 @@
 #include "AI/AIManager.h"
 
+#include "AI/AIConversation.h"
+#include "AI/LocalModel.h"
 #include "Modules/NetworkManager.h"
-#include "Utils/cJSON.h"
+#include "Utils/Timer.h"
 
 #pragma region Source Only
 
@@ -10,21 +12,98 @@ typedef struct AIChat
 {
     stringHeap title;
     stringHeap model;
-    stringHeap apiUrl;
-    stringHeap apiKey;
+    stringHeap apiUrl;       // NULL for a local chat
+    stringHeap apiKey;       // NULL for a local chat
     stringHeap systemPrompt; // Can be NULL
+    LocalModel *localModel;  // NULL for a remote chat
+    const AIProvider *provider;
+    AIConversation *conversation; // messages sent with every request, NULL for a local chat
+    AIResponseCache *cache;       // not owned, NULL without a cache
+    bool isStreaming;
+    AIChatTextCallback textCallback; // NULL without a callback
+    void *textCallbackData;
+    AIChatStatistics statistics;
 } AIChat;
 
+/// @brief The request in flight, for the chunk callback of the Network Manager which has no context of its own.
+typedef struct AIChatRequest
+{
+    const AIChat *chat;
+    AIProviderStream *stream; // NULL for a whole response
+    TimePoint startTime;
+    time_t firstTextNanoseconds; // 0 until the first text arrives
+} AIChatRequest;
+
+AIChatRequest *CURRENT_REQUEST = NULL;
+
+/// @brief Gets the nanoseconds passed since a time point.
+time_t AIChat_GetElapsedNanoseconds(const TimePoint *start)
+{
+    TimePoint now;
+    TimePoint_Update(&now);
+    return (now.seconds - start->seconds) * 1000000000 + (now.nanoseconds - start->nanoseconds);
+}
+
+/// @brief Feeds a chunk of a streamed response to the stream of a request, and passes the text it added to the text callback of the chat.
+void AIChat_FeedStream(AIChatRequest *request, const char *data, size_t dataSize)
+{
+    size_t addedLength = AIProviderStream_Feed(request->stream, data, dataSize);
+    if (addedLength == 0)
+    {
+        return;
+    }
+
+    if (request->firstTextNanoseconds == 0)
+    {
+        request->firstTextNanoseconds = AIChat_GetElapsedNanoseconds(&request->startTime);
+    }
+
+    if (request->chat->textCallback != NULL)
+    {
+        size_t textLength;
+        const char *text = AIProviderStream_GetText(request->stream, &textLength);
+        request->chat->textCallback(text + textLength - addedLength, addedLength, request->chat->textCallbackData);
+    }
+}
+
+/// @brief Passes a whole answer to the text callback of the chat, for answers which are not streamed.
+void AIChat_NotifyText(const AIChat *chat, const char *answer)
+{
+    if (chat->textCallback != NULL && answer != NULL)
+    {
+        chat->textCallback(answer, strlen(answer), chat->textCallbackData);
+    }
+}
+
+/// @brief Feeds the chunks of a streamed response to the stream of the request in flight.
+void AIChat_ChunkCallback(void *data, size_t dataSize, void *userData)
+{
+    (void)userData;
+
+    if (CURRENT_REQUEST == NULL || CURRENT_REQUEST->stream == NULL)
+    {
+        return;
+    }
+
+    AIChat_FeedStream(CURRENT_REQUEST, (const char *)data, dataSize);
+}
+
 #pragma endregion Source Only
 
 AIChat *AIChat_Create(const string title, const string model, const string apiUrl, const string apiKey, const string systemPrompt)
+{
+    return AIChat_CreateWithProvider(title, model, apiUrl, apiKey, systemPrompt, &AI_PROVIDER_OPENAI, false);
+}
+
+AIChat *AIChat_CreateWithProvider(const string title, const string model, const string apiUrl, const string apiKey, const string systemPrompt, const AIProvider *provider, bool isStreaming)
 {
     DebugAssert(title != NULL, "Null pointer passed as parameter. Title cannot be NULL.");
     DebugAssert(model != NULL, "Null pointer passed as parameter. Model cannot be NULL.");
     DebugAssert(apiUrl != NULL, "Null pointer passed as parameter. API URL cannot be NULL.");
     DebugAssert(apiKey != NULL, "Null pointer passed as parameter. API Key cannot be NULL.");
+    DebugAssert(provider != NULL, "Null pointer passed as parameter. Provider cannot be NULL.");
 
-    AIChat *chat = (AIChat *)malloc(sizeof(AIChat));
+    AIChat *chat = (AIChat *)calloc(1, sizeof(AIChat));
     DebugAssert(chat != NULL, "Memory allocation failed for AI Chat.");
 
     chat->title = StringDuplicate(title);
@@ -32,8 +111,47 @@ AIChat *AIChat_Create(const string title, const string model, const string apiUr
     chat->apiUrl = StringDuplicate(apiUrl);
     chat->apiKey = StringDuplicate(apiKey);
     chat->systemPrompt = systemPrompt == NULL ? NULL : StringDuplicate(systemPrompt);
+    chat->localModel = NULL;
+    chat->provider = provider;
+    chat->isStreaming = isStreaming;
+    chat->textCallback = NULL;
+    chat->textCallbackData = NULL;
+    chat->cache = NULL;
+    chat->conversation = AIConversation_Create(provider, systemPrompt, AI_CONVERSATION_DEFAULT_TOKEN_BUDGET, AI_CONVERSATION_DEFAULT_SUMMARY_TOKEN_BUDGET);
+
+    DebugInfo("AI Chat created successfully with title '%s', model '%s', API URL '%s', provider '%s'.", chat->title, chat->model, chat->apiUrl, provider->name);
+    return chat;
+}
+
+AIChat *AIChat_CreateLocal(const string title, const string modelPath, const string systemPrompt)
+{
+    DebugAssert(title != NULL, "Null pointer passed as parameter. Title cannot be NULL.");
+    DebugAssert(modelPath != NULL, "Null pointer passed as parameter. Model path cannot be NULL.");
+
+    LocalModel *localModel = LocalModel_Load(modelPath, NULL);
+    if (localModel == NULL)
+    {
+        DebugError("Failed to load local model '%s' for AI Chat '%s'. Returning NULL.", modelPath, title);
+        return NULL;
+    }
+
+    AIChat *chat = (AIChat *)calloc(1, sizeof(AIChat));
+    DebugAssert(chat != NULL, "Memory allocation failed for AI Chat.");
+
+    chat->title = StringDuplicate(title);
+    chat->model = StringDuplicate(modelPath);
+    chat->apiUrl = NULL;
+    chat->apiKey = NULL;
+    chat->systemPrompt = systemPrompt == NULL ? NULL : StringDuplicate(systemPrompt);
+    chat->localModel = localModel;
+    chat->provider = NULL;
+    chat->conversation = NULL;
+    chat->cache = NULL;
+    chat->isStreaming = false;
+    chat->textCallback = NULL;
+    chat->textCallbackData = NULL;
 
-    DebugInfo("AI Chat created successfully with title '%s', model '%s', API URL '%s'.", chat->title, chat->model, chat->apiUrl);
+    DebugInfo("AI Chat created successfully with title '%s', local model '%s'.", chat->title, chat->model);
     return chat;
 }
 
@@ -46,19 +164,39 @@ void AIChat_Destroy(AIChat *chat)
 
     free(chat->title);
     free(chat->model);
-    free(chat->apiUrl);
-    free(chat->apiKey);
+
+    if (chat->apiUrl != NULL)
+    {
+        free(chat->apiUrl);
+    }
+
+    if (chat->apiKey != NULL)
+    {
+        free(chat->apiKey);
+    }
 
     if (chat->systemPrompt != NULL)
     {
         free(chat->systemPrompt);
     }
 
+    if (chat->localModel != NULL)
+    {
+        LocalModel_Destroy(chat->localModel);
+    }
+
+    if (chat->conversation != NULL)
+    {
+        AIConversation_Destroy(chat->conversation);
+    }
+
     chat->title = NULL;
     chat->model = NULL;
     chat->apiUrl = NULL;
     chat->apiKey = NULL;
     chat->systemPrompt = NULL;
+    chat->localModel = NULL;
+    chat->conversation = NULL;
 
     free(chat);
     chat = NULL;
@@ -66,50 +204,185 @@ void AIChat_Destroy(AIChat *chat)
     DebugInfo("AI Chat %s destroyed successfully.", tempTitle);
 }
 
-stringHeap AIChat_SendAndReceive(const AIChat *chat, const string message)
+stringHeap AIChat_SendAndReceive(AIChat *chat, const string message)
 {
     DebugAssert(chat != NULL, "Null pointer passed as parameter. Chat cannot be NULL.");
     DebugAssert(message != NULL, "Null pointer passed as parameter. Message cannot be NULL.");
 
-    char query[AI_MANAGER_MAX_QUERY_LENGTH];
-    snprintf(query, sizeof(query), "{\"model\": \"%s\",\"messages\": [{\"role\": \"user\", \"content\": \"%s\"}]}", chat->model, message);
+    if (chat->localModel != NULL)
+    {
+        size_t systemPromptLength = chat->systemPrompt == NULL ? 0 : strlen(chat->systemPrompt);
+        char prompt[systemPromptLength + strlen(message) + 2];
+        snprintf(prompt, sizeof(prompt), "%s%s%s", systemPromptLength > 0 ? chat->systemPrompt : "", systemPromptLength > 0 ? "\n" : "", message);
 
-    char bearerToken[256];
-    snprintf(bearerToken, sizeof(bearerToken), "Bearer %s", chat->apiKey);
+        LocalModelSampling sampling = LocalModel_GetDefaultSampling();
+        stringHeap answer = LocalModel_Generate(chat->localModel, prompt, &sampling);
+
+        AIChat_NotifyText(chat, answer);
+
+        DebugInfo("Message answered by local model of AI Chat '%s', %zu tokens generated.", chat->title, LocalModel_GetStatistics(chat->localModel).generatedTokens);
+        return answer;
+    }
+
+    // The whole conversation is sent, the model keeps no state between requests
+    AIConversation_Append(chat->conversation, "user", message);
+    size_t querySize;
+    const char *query = AIConversation_BuildRequest(chat->conversation, chat->model, chat->isStreaming, &querySize);
+
+    AIResponseCacheKey cacheKey = {0, 0, 0};
+    if (chat->cache != NULL)
+    {
+        TimePoint lookupStart;
+        TimePoint_Update(&lookupStart);
+
+        cacheKey = AIResponseCache_CreateKey(chat->apiUrl, query, querySize);
+        stringHeap cachedAnswer = AIResponseCache_Get(chat->cache, cacheKey);
+        if (cachedAnswer != NULL)
+        {
+            chat->statistics.cachedCount++;
+            chat->statistics.requestBytes = 0;
+            chat->statistics.responseBytes = strlen(cachedAnswer);
+            chat->statistics.promptTokens = AIConversation_GetTokenCount(chat->conversation);
+            chat->statistics.totalNanoseconds = AIChat_GetElapsedNanoseconds(&lookupStart);
+            chat->statistics.firstTextNanoseconds = chat->statistics.totalNanoseconds;
+
+            AIConversation_Append(chat->conversation, "assistant", cachedAnswer);
+            AIChat_NotifyText(chat, cachedAnswer);
+
+            DebugInfo("Message sent to AI Chat '%s' answered from the response cache.", chat->title);
+            return cachedAnswer;
+        }
+    }
+
+    char authorization[256];
+    snprintf(authorization, sizeof(authorization), "%s%s", chat->provider->authorizationPrefix, chat->apiKey);
 
     NetworkRequestHeader headers[] = {
-        {"Authorization", bearerToken},
+        {chat->provider->authorizationHeader, authorization},
         {"Content-Type", "application/json"}};
 
-    NetworkRequest *request = NetworkRequest_Create(NetworkRequestType_POST, chat->apiUrl, query, strlen(query), false, headers, sizeof(headers) / sizeof(NetworkRequestHeader));
-
-    NetworkResponse *response = NetworkRequest_Request(request, NULL, NULL);
+    NetworkRequest *request = NetworkRequest_Create(NetworkRequestType_POST, chat->apiUrl, query, querySize, false, headers, sizeof(headers) / sizeof(NetworkRequestHeader));
 
-    stringHeap responseString = StringDuplicate(response->body);
+    AIChatRequest current = {chat, chat->isStreaming ? AIProviderStream_Create(chat->provider) : NULL, TIMEPOINT_KOLPA, 0};
+    TimePoint_Update(&current.startTime);
+    CURRENT_REQUEST = &current;
 
-    NetworkResponse_Destroy(response);
+    NetworkResponse *response = NetworkRequest_Request(request, NULL, chat->isStreaming ? AIChat_ChunkCallback : NULL);
     NetworkRequest_Destroy(request);
+    CURRENT_REQUEST = NULL;
 
-    cJSON *jsonResponse = cJSON_Parse(responseString);
-    DebugAssert(jsonResponse != NULL, "Failed to parse JSON response from AI Chat : '%s'", cJSON_GetErrorPtr());
+    chat->statistics.requestCount++;
+    chat->statistics.requestBytes = querySize;
+    chat->statistics.promptTokens = AIConversation_GetTokenCount(chat->conversation);
+    chat->statistics.responseBytes = response != NULL ? response->bodySize : 0;
+    chat->statistics.totalNanoseconds = AIChat_GetElapsedNanoseconds(&current.startTime);
+    chat->statistics.firstTextNanoseconds = current.firstTextNanoseconds > 0 ? current.firstTextNanoseconds : chat->statistics.totalNanoseconds;
 
-    cJSON *choices = cJSON_GetObjectItemCaseSensitive(jsonResponse, "choices");
-    DebugAssert(cJSON_IsArray(choices), "Expected 'choices' to be an array.");
+    stringHeap responseString = NULL;
+    if (response != NULL && (response->statusCode < 200 || response->statusCode >= 300))
+    {
+        // An error of the service comes with a JSON body, not with an answer
+        DebugWarning("AI Chat '%s' got HTTP status %ld. Response body : '%s'", chat->title, response->statusCode, response->body);
+    }
+    else if (response != NULL && current.stream != NULL)
+    {
+        AIChat_FeedStream(&current, "\n", 1); // ends a last line without a new line
 
-    cJSON *choice = cJSON_GetArrayItem(choices, 0);
-    DebugAssert(choice != NULL, "No choices found in the response from AI Chat.");
+        // A stream cut before its end event has only a part of the answer, a stream without events has none
+        size_t textLength = 0;
+        const char *text = AIProviderStream_GetText(current.stream, &textLength);
+        if (AIProviderStream_IsDone(current.stream) && textLength > 0)
+        {
+            responseString = StringDuplicate((string)text);
+        }
+        else
+        {
+            DebugWarning("Streamed response of AI Chat '%s' ended without %s.", chat->title, textLength > 0 ? "its end event" : "an answer");
+        }
+    }
+    else if (response != NULL)
+    {
+        responseString = chat->provider->parseResponse(response->body, response->bodySize);
+        AIChat_NotifyText(chat, responseString);
+    }
 
-    cJSON *messageItem = cJSON_GetObjectItemCaseSensitive(choice, "message");
-    DebugAssert(messageItem != NULL, "No message found in the choice from AI Chat.");
+    if (current.stream != NULL)
+    {
+        AIProviderStream_Destroy(current.stream);
+    }
 
-    cJSON *content = cJSON_GetObjectItemCaseSensitive(messageItem, "content");
-    DebugAssert(content != NULL, "No content found in the message from AI Chat.");
+    if (response != NULL)
+    {
+        NetworkResponse_Destroy(response);
+    }
 
-    free(responseString);
-    responseString = StringDuplicate(cJSON_GetStringValue(content));
+    if (responseString == NULL)
+    {
+        // Taken back, so the message can be sent again without being in the conversation twice
+        AIConversation_RemoveLast(chat->conversation);
+        chat->statistics.failedCount++;
+        DebugWarning("Message sent to AI Chat '%s' got no answer. Returning NULL.", chat->title);
+        return NULL;
+    }
 
-    cJSON_Delete(jsonResponse);
+    // Only a whole answer is kept, an empty one would be replayed for the time to live of the cache
+    if (chat->cache != NULL && responseString[0] != '\0')
+    {
+        AIResponseCache_Put(chat->cache, cacheKey, responseString);
+    }
+    AIConversation_Append(chat->conversation, "assistant", responseString);
 
     DebugInfo("Message sent to AI Chat '%s'. Response received.", chat->title);
     return responseString;
-}
\ No newline at end of file
+}
+
+void AIChat_SetTextCallback(AIChat *chat, AIChatTextCallback callback, void *userData)
+{
+    DebugAssert(chat != NULL, "Null pointer passed as parameter. Chat cannot be NULL.");
+
+    chat->textCallback = callback;
+    chat->textCallbackData = userData;
+}
+
+AIChatStatistics AIChat_GetStatistics(const AIChat *chat)
+{
+    DebugAssert(chat != NULL, "Null pointer passed as parameter. Chat cannot be NULL.");
+
+    return chat->statistics;
+}
+
+void AIChat_SetTokenBudget(AIChat *chat, size_t tokenBudget, size_t summaryTokenBudget)
+{
+    DebugAssert(chat != NULL, "Null pointer passed as parameter. Chat cannot be NULL.");
+
+    if (chat->conversation == NULL)
+    {
+        DebugWarning("AI Chat '%s' answers locally and keeps no conversation, token budget ignored.", chat->title);
+        return;
+    }
+
+    AIConversation_SetTokenBudget(chat->conversation, tokenBudget, summaryTokenBudget);
+}
+
+void AIChat_ClearHistory(AIChat *chat)
+{
+    DebugAssert(chat != NULL, "Null pointer passed as parameter. Chat cannot be NULL.");
+
+    if (chat->conversation != NULL)
+    {
+        AIConversation_Clear(chat->conversation);
+    }
+}
+
+void AIChat_SetResponseCache(AIChat *chat, AIResponseCache *cache)
+{
+    DebugAssert(chat != NULL, "Null pointer passed as parameter. Chat cannot be NULL.");
+
+    if (chat->conversation == NULL && cache != NULL)
+    {
+        DebugWarning("AI Chat '%s' answers locally, response cache ignored.", chat->title);
+        return;
+    }
+
+    chat->cache = cache;
+}
@@ -0,0 +1,370 @@
+#include "AI/AIMockServer.h"
+
+#if !PLATFORM_WINDOWS
+#include <arpa/inet.h>
+#include <ctype.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#endif
+
+#pragma region Source Only
+
+#define AI_MOCK_SERVER_INITIAL_RESPONSE_CAPACITY 8
+#define AI_MOCK_SERVER_REQUEST_CAPACITY 4096
+#define AI_MOCK_SERVER_DEFAULT_CHUNK_SIZE 1024
+
+typedef struct AIMockServerResponse
+{
+    int status;
+    stringHeap body;
+} AIMockServerResponse;
+
+typedef struct AIMockServer
+{
+    AIMockServerSettings settings;
+    AIMockServerResponse *responses;
+    size_t responseCount;
+    size_t responseCapacity;
+    char url[64];
+
+#if !PLATFORM_WINDOWS
+    int listener; // -1 when not serving
+    pthread_t thread;
+    _Atomic size_t requestCount;
+#else
+    size_t requestCount;
+#endif
+} AIMockServer;
+
+#if !PLATFORM_WINDOWS
+
+/// @brief Sleeps for a duration, resuming after signals.
+void AIMockServer_Sleep(time_t nanoseconds)
+{
+    struct timespec duration = {nanoseconds / 1000000000, nanoseconds % 1000000000};
+    while (nanosleep(&duration, &duration) != 0)
+    {
+    }
+}
+
+/// @brief Gets a monotonic time in nanoseconds, for pacing.
+time_t AIMockServer_Now()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+/// @brief Sends all of the data, the connection closing halfway is not an error of the server.
+/// @return True if all of the data is sent.
+bool AIMockServer_Send(int connection, const char *data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t sent = send(connection, data, size, MSG_NOSIGNAL);
+        if (sent <= 0)
+        {
+            return false;
+        }
+
+        data += sent;
+        size -= (size_t)sent;
+    }
+
+    return true;
+}
+
+/// @brief Reads a request until its headers and the body their Content-Length tells end. The request itself is not used, every request gets the next response.
+/// @return True if the whole request is read.
+bool AIMockServer_ReadRequest(int connection)
+{
+    char request[AI_MOCK_SERVER_REQUEST_CAPACITY];
+    size_t length = 0;
+    size_t bodyLeft = 0;
+    bool hasHeaders = false;
+
+    while (!hasHeaders || bodyLeft > 0)
+    {
+        // Bytes of a body not fitting in the buffer are read over the buffer, only the headers have to fit
+        size_t space = hasHeaders ? (bodyLeft < sizeof(request) ? bodyLeft : sizeof(request)) : sizeof(request) - 1 - length;
+        ssize_t received = recv(connection, hasHeaders ? request : request + length, space, 0);
+        if (received <= 0)
+        {
+            return false;
+        }
+
+        if (hasHeaders)
+        {
+            bodyLeft -= (size_t)received;
+            continue;
+        }
+
+        length += (size_t)received;
+        request[length] = '\0';
+
+        char *headersEnd = strstr(request, "\r\n\r\n");
+        if (headersEnd == NULL)
+        {
+            if (length == sizeof(request) - 1)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        hasHeaders = true;
+        for (char *letter = request; letter < headersEnd; letter++)
+        {
+            *letter = (char)tolower((unsigned char)*letter);
+        }
+
+        char *contentLength = strstr(request, "content-length:");
+        size_t bodySize = contentLength != NULL && contentLength < headersEnd ? (size_t)strtoull(contentLength + 15, NULL, 10) : 0;
+        size_t bodyReceived = length - (size_t)(headersEnd + 4 - request);
+        bodyLeft = bodySize > bodyReceived ? bodySize - bodyReceived : 0;
+    }
+
+    return true;
+}
+
+/// @brief Gets the reason phrase of an HTTP status, clients only read the status itself.
+const char *AIMockServer_GetReason(int status)
+{
+    switch (status)
+    {
+    case 200:
+        return "OK";
+    case 400:
+        return "Bad Request";
+    case 401:
+        return "Unauthorized";
+    case 429:
+        return "Too Many Requests";
+    case 500:
+        return "Internal Server Error";
+    case 503:
+        return "Service Unavailable";
+    default:
+        return status >= 200 && status < 300 ? "OK" : "Error";
+    }
+}
+
+/// @brief Answers a connection with the next response, paced by the settings.
+void AIMockServer_Serve(AIMockServer *server, int connection)
+{
+    if (!AIMockServer_ReadRequest(connection))
+    {
+        return;
+    }
+
+    size_t index = atomic_fetch_add_explicit(&server->requestCount, 1, memory_order_relaxed) % server->responseCount;
+    const AIMockServerResponse *response = &server->responses[index];
+    const char *body = response->body;
+    size_t bodySize = strlen(body);
+    bool isStream = strncmp(body, "data:", 5) == 0;
+
+    if (server->settings.latencyNanoseconds > 0)
+    {
+        AIMockServer_Sleep(server->settings.latencyNanoseconds);
+    }
+
+    char headers[256];
+    int headersLength = snprintf(headers, sizeof(headers),
+                                 "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+                                 response->status, AIMockServer_GetReason(response->status), isStream ? "text/event-stream" : "application/json", bodySize);
+    if (!AIMockServer_Send(connection, headers, (size_t)headersLength))
+    {
+        return;
+    }
+
+    size_t chunkSize = server->settings.chunkSize > 0 ? server->settings.chunkSize : AI_MOCK_SERVER_DEFAULT_CHUNK_SIZE;
+    time_t start = AIMockServer_Now();
+    for (size_t sent = 0; sent < bodySize;)
+    {
+        size_t size = bodySize - sent < chunkSize ? bodySize - sent : chunkSize;
+        if (!AIMockServer_Send(connection, body + sent, size))
+        {
+            return;
+        }
+        sent += size;
+
+        // Waits until the time the sent bytes take at the pace
+        if (server->settings.bytesPerSecond > 0 && sent < bodySize)
+        {
+            time_t due = start + (time_t)((double)sent * 1e9 / (double)server->settings.bytesPerSecond);
+            time_t now = AIMockServer_Now();
+            if (due > now)
+            {
+                AIMockServer_Sleep(due - now);
+            }
+        }
+    }
+}
+
+/// @brief Thread function of the server, accepts connections until the listener is shut down.
+void *AIMockServer_Run(void *argument)
+{
+    AIMockServer *server = (AIMockServer *)argument;
+
+    while (true)
+    {
+        int connection = accept(server->listener, NULL, NULL);
+        if (connection < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+            {
+                continue;
+            }
+            break;
+        }
+
+        AIMockServer_Serve(server, connection);
+        close(connection);
+    }
+
+    return NULL;
+}
+
+#endif
+
+#pragma endregion Source Only
+
+AIMockServer *AIMockServer_Create(AIMockServerSettings settings)
+{
+    AIMockServer *server = (AIMockServer *)malloc(sizeof(AIMockServer));
+    DebugAssert(server != NULL, "Memory allocation failed for AI mock server.");
+
+    server->settings = settings;
+    server->responseCount = 0;
+    server->responseCapacity = AI_MOCK_SERVER_INITIAL_RESPONSE_CAPACITY;
+    server->responses = (AIMockServerResponse *)malloc(server->responseCapacity * sizeof(AIMockServerResponse));
+    DebugAssert(server->responses != NULL, "Memory allocation failed for AI mock server responses.");
+    server->url[0] = '\0';
+    server->requestCount = 0;
+
+#if !PLATFORM_WINDOWS
+    server->listener = -1;
+#endif
+
+    DebugInfo("AI mock server created.");
+    return server;
+}
+
+void AIMockServer_Destroy(AIMockServer *server)
+{
+    DebugAssert(server != NULL, "Null pointer passed as parameter. Server cannot be NULL.");
+
+#if !PLATFORM_WINDOWS
+    if (server->listener >= 0)
+    {
+        // Shutting the listener down wakes the thread from accept
+        shutdown(server->listener, SHUT_RDWR);
+        pthread_join(server->thread, NULL);
+        close(server->listener);
+        server->listener = -1;
+    }
+#endif
+
+    for (size_t i = 0; i < server->responseCount; i++)
+    {
+        free(server->responses[i].body);
+    }
+    free(server->responses);
+    server->responses = NULL;
+
+    free(server);
+    server = NULL;
+
+    DebugInfo("AI mock server destroyed.");
+}
+
+void AIMockServer_AddResponse(AIMockServer *server, int status, const string body)
+{
+    DebugAssert(server != NULL, "Null pointer passed as parameter. Server cannot be NULL.");
+    DebugAssert(body != NULL, "Null pointer passed as parameter. Body cannot be NULL.");
+    DebugAssert(status >= 100 && status <= 599, "AI mock server response status must be an HTTP status.");
+    DebugAssert(server->url[0] == '\0', "Responses cannot be added to a started AI mock server.");
+
+    if (server->responseCount == server->responseCapacity)
+    {
+        server->responseCapacity *= 2;
+        server->responses = (AIMockServerResponse *)realloc(server->responses, server->responseCapacity * sizeof(AIMockServerResponse));
+        DebugAssert(server->responses != NULL, "Memory allocation failed for AI mock server responses.");
+    }
+
+    server->responses[server->responseCount].status = status;
+    server->responses[server->responseCount].body = StringDuplicate(body);
+    server->responseCount++;
+}
+
+bool AIMockServer_Start(AIMockServer *server)
+{
+    DebugAssert(server != NULL, "Null pointer passed as parameter. Server cannot be NULL.");
+    DebugAssert(server->responseCount > 0, "AI mock server cannot start without a response.");
+
+#if !PLATFORM_WINDOWS
+    if (server->listener >= 0)
+    {
+        DebugWarning("AI mock server is already serving at '%s'.", server->url);
+        return true;
+    }
+
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener < 0)
+    {
+        DebugError("Failed to create a socket for AI mock server.");
+        return false;
+    }
+
+    // Port 0 lets the system pick a free port, read back after bind
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t addressSize = sizeof(address);
+
+    if (bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+        listen(listener, SOMAXCONN) != 0 ||
+        getsockname(listener, (struct sockaddr *)&address, &addressSize) != 0)
+    {
+        close(listener);
+        DebugError("Failed to listen on the loopback interface for AI mock server.");
+        return false;
+    }
+
+    server->listener = listener;
+    if (pthread_create(&server->thread, NULL, AIMockServer_Run, server) != 0)
+    {
+        close(listener);
+        server->listener = -1;
+        DebugError("Failed to start the thread of AI mock server.");
+        return false;
+    }
+
+    snprintf(server->url, sizeof(server->url), "http://127.0.0.1:%u/v1/chat/completions", (unsigned int)ntohs(address.sin_port));
+
+    DebugInfo("AI mock server serving %zu responses at '%s'.", server->responseCount, server->url);
+    return true;
+#else
+    DebugError("AI mock server is not supported on Windows.");
+    return false;
+#endif
+}
+
+const char *AIMockServer_GetUrl(const AIMockServer *server)
+{
+    DebugAssert(server != NULL, "Null pointer passed as parameter. Server cannot be NULL.");
+
+    return server->url;
+}
+
+size_t AIMockServer_GetRequestCount(const AIMockServer *server)
+{
+    DebugAssert(server != NULL, "Null pointer passed as parameter. Server cannot be NULL.");
+
+    return server->requestCount;
+}
@@ -0,0 +1,330 @@
+#include "AI/AIProvider.h"
+
+#include "Utils/cJSON.h"
+
+#pragma region Source Only
+
+#define AI_BUFFER_INITIAL_CAPACITY 256
+
+typedef struct AIProviderStream
+{
+    const AIProvider *provider;
+    AIBuffer line; // the line not ended yet, chunks can split it
+    AIBuffer text; // the answer gathered so far
+    bool isDone;
+} AIProviderStream;
+
+/// @brief Handles a whole line of a stream, only the data lines of the events carry the answer.
+/// @return Count of the characters the line added to the answer.
+size_t AIProviderStream_HandleLine(AIProviderStream *stream)
+{
+    AIBuffer *line = &stream->line;
+    if (line->length > 0 && line->data[line->length - 1] == '\r')
+    {
+        line->data[--line->length] = '\0';
+    }
+
+    if (stream->isDone || line->length < 5 || strncmp(line->data, "data:", 5) != 0)
+    {
+        return 0;
+    }
+
+    string data = line->data + 5;
+    data += data[0] == ' ' ? 1 : 0;
+
+    stringHeap part = stream->provider->parseStreamEvent(data, &stream->isDone);
+    if (part == NULL)
+    {
+        return 0;
+    }
+
+    size_t partLength = strlen(part);
+    AIBuffer_Append(&stream->text, part, partLength);
+    free(part);
+
+    return partLength;
+}
+
+/// @brief Gets the content of the first choice of an OpenAI response, from its message or from its delta for a streamed event.
+/// @return The content allocated on the heap, or NULL if there is none.
+stringHeap AIProvider_OpenAIContent(const cJSON *json, const string field)
+{
+    cJSON *choices = cJSON_GetObjectItemCaseSensitive(json, "choices");
+    cJSON *choice = cJSON_IsArray(choices) ? cJSON_GetArrayItem(choices, 0) : NULL;
+    cJSON *message = choice != NULL ? cJSON_GetObjectItemCaseSensitive(choice, field) : NULL;
+    cJSON *content = message != NULL ? cJSON_GetObjectItemCaseSensitive(message, "content") : NULL;
+
+    return cJSON_IsString(content) ? StringDuplicate(cJSON_GetStringValue(content)) : NULL;
+}
+
+void AIProvider_OpenAIWriteRequestStart(AIBuffer *buffer, const string model)
+{
+    AIBuffer_Append(buffer, "{\"model\":", 9);
+    AIBuffer_AppendJsonString(buffer, model, strlen(model));
+    AIBuffer_Append(buffer, ",\"messages\":[", 13);
+}
+
+void AIProvider_OpenAIWriteMessage(AIBuffer *buffer, const AIMessage *message)
+{
+    AIBuffer_Append(buffer, "{\"role\":", 8);
+    AIBuffer_AppendJsonString(buffer, message->role, strlen(message->role));
+    AIBuffer_Append(buffer, ",\"content\":", 11);
+    AIBuffer_AppendJsonString(buffer, message->content, strlen(message->content));
+    AIBuffer_Append(buffer, "}", 1);
+}
+
+void AIProvider_OpenAIWriteRequestEnd(AIBuffer *buffer, bool isStreaming)
+{
+    if (isStreaming)
+    {
+        AIBuffer_Append(buffer, "],\"stream\":true}", 16);
+    }
+    else
+    {
+        AIBuffer_Append(buffer, "]}", 2);
+    }
+}
+
+stringHeap AIProvider_OpenAIParseResponse(const string body, size_t size)
+{
+    cJSON *json = cJSON_ParseWithLength(body, size);
+    if (json == NULL)
+    {
+        DebugError("Failed to parse JSON response from OpenAI provider : '%s'", cJSON_GetErrorPtr());
+        return NULL;
+    }
+
+    stringHeap content = AIProvider_OpenAIContent(json, "message");
+    cJSON_Delete(json);
+
+    return content;
+}
+
+stringHeap AIProvider_OpenAIParseStreamEvent(const string data, bool *isDone)
+{
+    if (strcmp(data, "[DONE]") == 0)
+    {
+        *isDone = true;
+        return NULL;
+    }
+
+    cJSON *json = cJSON_Parse(data);
+    if (json == NULL)
+    {
+        DebugWarning("Skipped a streamed event of OpenAI provider which is not JSON : '%s'", data);
+        return NULL;
+    }
+
+    stringHeap content = AIProvider_OpenAIContent(json, "delta");
+    cJSON_Delete(json);
+
+    return content;
+}
+
+#pragma endregion Source Only
+
+const AIProvider AI_PROVIDER_OPENAI = {
+    "OpenAI",
+    "Authorization",
+    "Bearer ",
+    AIProvider_OpenAIWriteRequestStart,
+    AIProvider_OpenAIWriteMessage,
+    AIProvider_OpenAIWriteRequestEnd,
+    AIProvider_OpenAIParseResponse,
+    AIProvider_OpenAIParseStreamEvent};
+
+void AIBuffer_Append(AIBuffer *buffer, const char *data, size_t size)
+{
+    DebugAssert(buffer != NULL, "Null pointer passed as parameter. Buffer cannot be NULL.");
+    DebugAssert(data != NULL || size == 0, "Null pointer passed as parameter. Data cannot be NULL.");
+
+    if (buffer->length + size + 1 > buffer->capacity)
+    {
+        size_t capacity = buffer->capacity > 0 ? buffer->capacity : AI_BUFFER_INITIAL_CAPACITY;
+        while (buffer->length + size + 1 > capacity)
+        {
+            capacity *= 2;
+        }
+
+        buffer->data = (stringHeap)realloc(buffer->data, capacity);
+        DebugAssert(buffer->data != NULL, "Memory allocation failed for AI buffer.");
+        buffer->capacity = capacity;
+    }
+
+    if (size > 0)
+    {
+        memcpy(buffer->data + buffer->length, data, size);
+    }
+    buffer->length += size;
+    buffer->data[buffer->length] = '\0';
+}
+
+void AIBuffer_AppendJsonString(AIBuffer *buffer, const char *text, size_t length)
+{
+    DebugAssert(text != NULL || length == 0, "Null pointer passed as parameter. Text cannot be NULL.");
+
+    AIBuffer_Append(buffer, "\"", 1);
+
+    // Runs of characters needing no escape are copied at once, most of a text is a single run
+    size_t runStart = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        unsigned char letter = (unsigned char)text[i];
+        if (letter >= 0x20 && letter != '"' && letter != '\\')
+        {
+            continue;
+        }
+
+        AIBuffer_Append(buffer, text + runStart, i - runStart);
+        runStart = i + 1;
+
+        char escape[8];
+        switch (letter)
+        {
+        case '"':
+            AIBuffer_Append(buffer, "\\\"", 2);
+            break;
+        case '\\':
+            AIBuffer_Append(buffer, "\\\\", 2);
+            break;
+        case '\n':
+            AIBuffer_Append(buffer, "\\n", 2);
+            break;
+        case '\r':
+            AIBuffer_Append(buffer, "\\r", 2);
+            break;
+        case '\t':
+            AIBuffer_Append(buffer, "\\t", 2);
+            break;
+        default:
+            snprintf(escape, sizeof(escape), "\\u%04x", letter);
+            AIBuffer_Append(buffer, escape, 6);
+            break;
+        }
+    }
+
+    AIBuffer_Append(buffer, text + runStart, length - runStart);
+    AIBuffer_Append(buffer, "\"", 1);
+}
+
+void AIBuffer_Clear(AIBuffer *buffer)
+{
+    DebugAssert(buffer != NULL, "Null pointer passed as parameter. Buffer cannot be NULL.");
+
+    buffer->length = 0;
+    if (buffer->data != NULL)
+    {
+        buffer->data[0] = '\0';
+    }
+}
+
+void AIBuffer_Free(AIBuffer *buffer)
+{
+    DebugAssert(buffer != NULL, "Null pointer passed as parameter. Buffer cannot be NULL.");
+
+    free(buffer->data);
+    buffer->data = NULL;
+    buffer->length = 0;
+    buffer->capacity = 0;
+}
+
+stringHeap AIProvider_BuildRequest(const AIProvider *provider, const string model, const AIMessage *messages, size_t messageCount, bool isStreaming, size_t *size)
+{
+    DebugAssert(provider != NULL, "Null pointer passed as parameter. Provider cannot be NULL.");
+    DebugAssert(model != NULL, "Null pointer passed as parameter. Model cannot be NULL.");
+    DebugAssert(messages != NULL || messageCount == 0, "Null pointer passed as parameter. Messages cannot be NULL.");
+    DebugAssert(size != NULL, "Null pointer passed as parameter. Size cannot be NULL.");
+
+    AIBuffer body = {NULL, 0, 0};
+    provider->writeRequestStart(&body, model);
+    for (size_t i = 0; i < messageCount; i++)
+    {
+        if (i > 0)
+        {
+            AIBuffer_Append(&body, ",", 1);
+        }
+        provider->writeMessage(&body, &messages[i]);
+    }
+    provider->writeRequestEnd(&body, isStreaming);
+
+    *size = body.length;
+    return body.data;
+}
+
+AIProviderStream *AIProviderStream_Create(const AIProvider *provider)
+{
+    DebugAssert(provider != NULL, "Null pointer passed as parameter. Provider cannot be NULL.");
+
+    AIProviderStream *stream = (AIProviderStream *)malloc(sizeof(AIProviderStream));
+    DebugAssert(stream != NULL, "Memory allocation failed for AI provider stream.");
+
+    stream->provider = provider;
+    stream->line = (AIBuffer){NULL, 0, 0};
+    stream->text = (AIBuffer){NULL, 0, 0};
+    stream->isDone = false;
+
+    // Allocated up front, so the text is an empty string even if no event carries any
+    AIBuffer_Append(&stream->line, "", 0);
+    AIBuffer_Append(&stream->text, "", 0);
+
+    return stream;
+}
+
+void AIProviderStream_Destroy(AIProviderStream *stream)
+{
+    DebugAssert(stream != NULL, "Null pointer passed as parameter. Stream cannot be NULL.");
+
+    free(stream->line.data);
+    stream->line.data = NULL;
+    free(stream->text.data);
+    stream->text.data = NULL;
+
+    free(stream);
+    stream = NULL;
+}
+
+size_t AIProviderStream_Feed(AIProviderStream *stream, const char *data, size_t size)
+{
+    DebugAssert(stream != NULL, "Null pointer passed as parameter. Stream cannot be NULL.");
+    DebugAssert(data != NULL || size == 0, "Null pointer passed as parameter. Data cannot be NULL.");
+
+    size_t addedLength = 0;
+    while (size > 0)
+    {
+        const char *lineEnd = (const char *)memchr(data, '\n', size);
+        size_t partSize = lineEnd == NULL ? size : (size_t)(lineEnd - data);
+
+        AIBuffer_Append(&stream->line, data, partSize);
+        if (lineEnd == NULL)
+        {
+            break;
+        }
+
+        addedLength += AIProviderStream_HandleLine(stream);
+        AIBuffer_Clear(&stream->line);
+
+        data += partSize + 1;
+        size -= partSize + 1;
+    }
+
+    return addedLength;
+}
+
+const char *AIProviderStream_GetText(const AIProviderStream *stream, size_t *length)
+{
+    DebugAssert(stream != NULL, "Null pointer passed as parameter. Stream cannot be NULL.");
+
+    if (length != NULL)
+    {
+        *length = stream->text.length;
+    }
+
+    return stream->text.data;
+}
+
+bool AIProviderStream_IsDone(const AIProviderStream *stream)
+{
+    DebugAssert(stream != NULL, "Null pointer passed as parameter. Stream cannot be NULL.");
+
+    return stream->isDone;
+}
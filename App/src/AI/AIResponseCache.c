@@ -0,0 +1,537 @@
+#include "AI/AIResponseCache.h"
+
+#include "Utils/HashMap.h"
+
+#if !PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#pragma region Source Only
+
+#define AI_RESPONSE_CACHE_NONE SIZE_MAX
+#define AI_RESPONSE_CACHE_DISK_PROBES 8 // slots after the home slot of a key where its answer can be
+#define AI_RESPONSE_CACHE_DISK_MAGIC "CCAICAC2" // files of keys without a check start over
+
+/// @brief An answer in memory, in the least recently used list.
+typedef struct AIResponseCacheEntry
+{
+    AIResponseCacheKey key;
+    stringHeap answer;
+    time_t expiry;   // 0 never expires
+    size_t previous; // more recently used
+    size_t next;     // less recently used
+} AIResponseCacheEntry;
+
+/// @brief Start of the disk file, the settings it was made with.
+typedef struct AIResponseCacheDiskHeader
+{
+    char magic[8];
+    uint64_t slotCount;
+    uint64_t slotSize;
+    uint64_t reserved;
+} AIResponseCacheDiskHeader;
+
+/// @brief Start of a slot of the disk file, the answer follows it. A slot of size 0 is empty.
+typedef struct AIResponseCacheDiskSlot
+{
+    AIResponseCacheKey key;
+    int64_t expiry; // 0 never expires
+    uint64_t length;
+} AIResponseCacheDiskSlot;
+
+typedef struct AIResponseCache
+{
+    AIResponseCacheSettings settings;
+    stringHeap diskPath; // NULL for a memory only cache
+
+    AIResponseCacheEntry *entries;
+    size_t entryCount;
+    size_t head;      // most recently used
+    size_t tail;      // least recently used, evicted first
+    HashMap *indices; // key to entry index
+
+    unsigned char *disk; // mapped file, NULL without a disk tier
+    size_t diskSize;
+
+    AIResponseCacheStatistics statistics;
+} AIResponseCache;
+
+/// @brief Mixes the bits of a word, the finalizer of MurmurHash3.
+uint64_t AIResponseCache_Mix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+/// @brief Hashes bytes a word at a time, independent of the FNV-1a hash of HashMap_HashBytes, for the check of a key.
+uint64_t AIResponseCache_CheckBytes(const void *data, size_t size, uint64_t seed)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    uint64_t hash = seed ^ ((uint64_t)size * 0x9E3779B97F4A7C15ULL);
+
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ AIResponseCache_Mix(word)) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    uint64_t last = 0;
+    memcpy(&last, bytes + i, size - i);
+    hash = (hash ^ AIResponseCache_Mix(last)) * 0x9E3779B97F4A7C15ULL;
+
+    return AIResponseCache_Mix(hash);
+}
+
+/// @brief Checks if an answer expired.
+bool AIResponseCache_IsExpired(time_t expiry, time_t now)
+{
+    return expiry != 0 && expiry <= now;
+}
+
+/// @brief Takes an entry out of the least recently used list.
+void AIResponseCache_Unlink(AIResponseCache *cache, size_t index)
+{
+    AIResponseCacheEntry *entry = &cache->entries[index];
+
+    if (entry->previous != AI_RESPONSE_CACHE_NONE)
+    {
+        cache->entries[entry->previous].next = entry->next;
+    }
+    else
+    {
+        cache->head = entry->next;
+    }
+
+    if (entry->next != AI_RESPONSE_CACHE_NONE)
+    {
+        cache->entries[entry->next].previous = entry->previous;
+    }
+    else
+    {
+        cache->tail = entry->previous;
+    }
+}
+
+/// @brief Puts an entry at the front of the least recently used list.
+void AIResponseCache_LinkFront(AIResponseCache *cache, size_t index)
+{
+    AIResponseCacheEntry *entry = &cache->entries[index];
+    entry->previous = AI_RESPONSE_CACHE_NONE;
+    entry->next = cache->head;
+
+    if (cache->head != AI_RESPONSE_CACHE_NONE)
+    {
+        cache->entries[cache->head].previous = index;
+    }
+    cache->head = index;
+
+    if (cache->tail == AI_RESPONSE_CACHE_NONE)
+    {
+        cache->tail = index;
+    }
+}
+
+/// @brief Removes an entry from memory. The last entry is moved into its place, so the entries stay packed.
+void AIResponseCache_RemoveEntry(AIResponseCache *cache, size_t index)
+{
+    AIResponseCache_Unlink(cache, index);
+    HashMap_Remove(cache->indices, &cache->entries[index].key);
+    free(cache->entries[index].answer);
+
+    size_t last = --cache->entryCount;
+    if (index == last)
+    {
+        return;
+    }
+
+    cache->entries[index] = cache->entries[last];
+    AIResponseCacheEntry *moved = &cache->entries[index];
+
+    if (moved->previous != AI_RESPONSE_CACHE_NONE)
+    {
+        cache->entries[moved->previous].next = index;
+    }
+    else
+    {
+        cache->head = index;
+    }
+
+    if (moved->next != AI_RESPONSE_CACHE_NONE)
+    {
+        cache->entries[moved->next].previous = index;
+    }
+    else
+    {
+        cache->tail = index;
+    }
+
+    HashMap_Set(cache->indices, &moved->key, &index);
+}
+
+/// @brief Stores an answer in memory, evicting the least recently used answer when memory is full.
+void AIResponseCache_PutMemory(AIResponseCache *cache, AIResponseCacheKey key, const char *answer, size_t length, time_t expiry)
+{
+    if (cache->settings.memoryCapacity == 0)
+    {
+        return;
+    }
+
+    size_t *found = (size_t *)HashMap_Get(cache->indices, &key);
+    if (found != NULL)
+    {
+        AIResponseCache_RemoveEntry(cache, *found);
+    }
+    else if (cache->entryCount == cache->settings.memoryCapacity)
+    {
+        AIResponseCache_RemoveEntry(cache, cache->tail);
+        cache->statistics.evictions++;
+    }
+
+    size_t index = cache->entryCount++;
+    AIResponseCacheEntry *entry = &cache->entries[index];
+    entry->key = key;
+    entry->expiry = expiry;
+    entry->answer = (stringHeap)malloc(length + 1);
+    DebugAssert(entry->answer != NULL, "Memory allocation failed for AI response cache answer.");
+    memcpy(entry->answer, answer, length);
+    entry->answer[length] = '\0';
+
+    AIResponseCache_LinkFront(cache, index);
+    HashMap_Set(cache->indices, &key, &index);
+}
+
+/// @brief Gets a slot of the disk file.
+AIResponseCacheDiskSlot *AIResponseCache_GetDiskSlot(const AIResponseCache *cache, size_t index)
+{
+    return (AIResponseCacheDiskSlot *)(cache->disk + sizeof(AIResponseCacheDiskHeader) + index * cache->settings.diskSlotSize);
+}
+
+/// @brief Finds the slot of a key on disk.
+/// @return The slot, or NULL if the key is not on disk.
+AIResponseCacheDiskSlot *AIResponseCache_FindDiskSlot(const AIResponseCache *cache, AIResponseCacheKey key)
+{
+    size_t mask = cache->settings.diskSlotCount - 1;
+    for (size_t probe = 0; probe < AI_RESPONSE_CACHE_DISK_PROBES; probe++)
+    {
+        AIResponseCacheDiskSlot *slot = AIResponseCache_GetDiskSlot(cache, ((size_t)key.hash + probe) & mask);
+        if (slot->key.size != 0 && slot->key.hash == key.hash && slot->key.check == key.check && slot->key.size == key.size)
+        {
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+/// @brief Stores an answer on disk, in the slot of its key, else an empty or expired slot, else the slot expiring first.
+void AIResponseCache_PutDisk(AIResponseCache *cache, AIResponseCacheKey key, const char *answer, size_t length, time_t expiry, time_t now)
+{
+    if (length > cache->settings.diskSlotSize - sizeof(AIResponseCacheDiskSlot))
+    {
+        cache->statistics.diskSkips++;
+        return;
+    }
+
+    AIResponseCacheDiskSlot *slot = AIResponseCache_FindDiskSlot(cache, key);
+    size_t mask = cache->settings.diskSlotCount - 1;
+    for (size_t probe = 0; probe < AI_RESPONSE_CACHE_DISK_PROBES && slot == NULL; probe++)
+    {
+        AIResponseCacheDiskSlot *candidate = AIResponseCache_GetDiskSlot(cache, ((size_t)key.hash + probe) & mask);
+        if (candidate->key.size == 0 || AIResponseCache_IsExpired((time_t)candidate->expiry, now))
+        {
+            slot = candidate;
+        }
+    }
+
+    if (slot == NULL)
+    {
+        // Answers which never expire are replaced last
+        slot = AIResponseCache_GetDiskSlot(cache, (size_t)key.hash & mask);
+        for (size_t probe = 1; probe < AI_RESPONSE_CACHE_DISK_PROBES; probe++)
+        {
+            AIResponseCacheDiskSlot *candidate = AIResponseCache_GetDiskSlot(cache, ((size_t)key.hash + probe) & mask);
+            if (candidate->expiry != 0 && (slot->expiry == 0 || candidate->expiry < slot->expiry))
+            {
+                slot = candidate;
+            }
+        }
+    }
+
+    // Emptied first, so a run stopped in the middle leaves an empty slot rather than a wrong answer
+    slot->key.size = 0;
+    memcpy((unsigned char *)slot + sizeof(AIResponseCacheDiskSlot), answer, length);
+    slot->expiry = (int64_t)expiry;
+    slot->length = length;
+    slot->key = key;
+}
+
+/// @brief Maps the disk file to memory, starting it over if it was made with other settings.
+bool AIResponseCache_OpenDisk(AIResponseCache *cache)
+{
+#if !PLATFORM_WINDOWS
+    int fileDescriptor = open(cache->diskPath, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    size_t size = sizeof(AIResponseCacheDiskHeader) + cache->settings.diskSlotCount * cache->settings.diskSlotSize;
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0 || ((size_t)fileStatus.st_size != size && ftruncate(fileDescriptor, (off_t)size) != 0))
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    void *mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    close(fileDescriptor); // the mapping keeps the file open
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    cache->disk = (unsigned char *)mapping;
+    cache->diskSize = size;
+
+    AIResponseCacheDiskHeader *header = (AIResponseCacheDiskHeader *)cache->disk;
+    if (memcmp(header->magic, AI_RESPONSE_CACHE_DISK_MAGIC, sizeof(header->magic)) != 0 ||
+        header->slotCount != cache->settings.diskSlotCount || header->slotSize != cache->settings.diskSlotSize)
+    {
+        DebugInfo("AI response cache file '%s' is new or of other settings, started over.", cache->diskPath);
+        memset(cache->disk, 0, size);
+        memcpy(header->magic, AI_RESPONSE_CACHE_DISK_MAGIC, sizeof(header->magic));
+        header->slotCount = cache->settings.diskSlotCount;
+        header->slotSize = cache->settings.diskSlotSize;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+#pragma endregion Source Only
+
+AIResponseCacheSettings AIResponseCache_GetDefaultSettings()
+{
+    AIResponseCacheSettings settings = {
+        AI_RESPONSE_CACHE_DEFAULT_MEMORY_CAPACITY,
+        NULL,
+        AI_RESPONSE_CACHE_DEFAULT_DISK_SLOT_COUNT,
+        AI_RESPONSE_CACHE_DEFAULT_DISK_SLOT_SIZE,
+        AI_RESPONSE_CACHE_DEFAULT_TIME_TO_LIVE};
+
+    return settings;
+}
+
+AIResponseCache *AIResponseCache_Create(AIResponseCacheSettings settings)
+{
+    AIResponseCache *cache = (AIResponseCache *)calloc(1, sizeof(AIResponseCache));
+    DebugAssert(cache != NULL, "Memory allocation failed for AI response cache.");
+
+    cache->settings = settings;
+    cache->settings.diskPath = NULL;
+    cache->head = AI_RESPONSE_CACHE_NONE;
+    cache->tail = AI_RESPONSE_CACHE_NONE;
+    cache->entries = (AIResponseCacheEntry *)malloc((settings.memoryCapacity > 0 ? settings.memoryCapacity : 1) * sizeof(AIResponseCacheEntry));
+    DebugAssert(cache->entries != NULL, "Memory allocation failed for AI response cache entries.");
+    cache->indices = HashMap_Create(sizeof(AIResponseCacheKey), sizeof(size_t), settings.memoryCapacity > 0 ? settings.memoryCapacity : 1);
+
+    if (settings.diskPath != NULL)
+    {
+        // A power of 2 of slots, so a slot is found with a mask. Slots are 8 byte aligned, with room for an answer after their header.
+        size_t slotCount = AI_RESPONSE_CACHE_DISK_PROBES;
+        while (slotCount < settings.diskSlotCount)
+        {
+            slotCount *= 2;
+        }
+        size_t slotSize = settings.diskSlotSize > sizeof(AIResponseCacheDiskSlot) + 8 ? settings.diskSlotSize : sizeof(AIResponseCacheDiskSlot) + 8;
+        cache->settings.diskSlotCount = slotCount;
+        cache->settings.diskSlotSize = (slotSize + 7) & ~(size_t)7;
+        cache->diskPath = StringDuplicate(settings.diskPath);
+        cache->settings.diskPath = cache->diskPath;
+
+        if (!AIResponseCache_OpenDisk(cache))
+        {
+            DebugWarning("Failed to open AI response cache file '%s', the cache is memory only.", cache->diskPath);
+            free(cache->diskPath);
+            cache->diskPath = NULL;
+            cache->settings.diskPath = NULL;
+        }
+    }
+
+    DebugInfo("AI response cache created with %zu answers in memory%s.", settings.memoryCapacity, cache->disk != NULL ? " and a disk file" : "");
+    return cache;
+}
+
+void AIResponseCache_Destroy(AIResponseCache *cache)
+{
+    DebugAssert(cache != NULL, "Null pointer passed as parameter. Cache cannot be NULL.");
+
+    for (size_t i = 0; i < cache->entryCount; i++)
+    {
+        free(cache->entries[i].answer);
+    }
+    free(cache->entries);
+    cache->entries = NULL;
+
+    HashMap_Destroy(cache->indices);
+    cache->indices = NULL;
+
+#if !PLATFORM_WINDOWS
+    if (cache->disk != NULL)
+    {
+        munmap(cache->disk, cache->diskSize);
+    }
+#endif
+    cache->disk = NULL;
+
+    free(cache->diskPath);
+    cache->diskPath = NULL;
+
+    free(cache);
+    cache = NULL;
+
+    DebugInfo("AI response cache destroyed.");
+}
+
+AIResponseCacheKey AIResponseCache_CreateKey(const string apiUrl, const void *request, size_t size)
+{
+    DebugAssert(apiUrl != NULL, "Null pointer passed as parameter. API URL cannot be NULL.");
+    DebugAssert(request != NULL, "Null pointer passed as parameter. Request cannot be NULL.");
+
+    // The endpoint is mixed in, so the same model name on two services gets two keys
+    size_t apiUrlLength = strlen(apiUrl);
+    uint64_t hash = (uint64_t)HashMap_HashBytes(request, size) ^ ((uint64_t)HashMap_HashBytes(apiUrl, apiUrlLength) * 0x9E3779B97F4A7C15ULL);
+    uint64_t check = AIResponseCache_CheckBytes(request, size, AIResponseCache_CheckBytes(apiUrl, apiUrlLength, 0));
+    AIResponseCacheKey key = {hash, check, (uint64_t)size};
+
+    return key;
+}
+
+stringHeap AIResponseCache_Get(AIResponseCache *cache, AIResponseCacheKey key)
+{
+    DebugAssert(cache != NULL, "Null pointer passed as parameter. Cache cannot be NULL.");
+
+    cache->statistics.lookups++;
+    time_t now = time(NULL);
+
+    size_t *found = (size_t *)HashMap_Get(cache->indices, &key);
+    if (found != NULL)
+    {
+        size_t index = *found;
+        if (!AIResponseCache_IsExpired(cache->entries[index].expiry, now))
+        {
+            AIResponseCache_Unlink(cache, index);
+            AIResponseCache_LinkFront(cache, index);
+            cache->statistics.memoryHits++;
+            return StringDuplicate(cache->entries[index].answer);
+        }
+
+        // The disk has the same expiry, it is not looked up
+        AIResponseCache_RemoveEntry(cache, index);
+        cache->statistics.expired++;
+        cache->statistics.misses++;
+        return NULL;
+    }
+
+    AIResponseCacheDiskSlot *slot = cache->disk != NULL ? AIResponseCache_FindDiskSlot(cache, key) : NULL;
+    if (slot == NULL)
+    {
+        cache->statistics.misses++;
+        return NULL;
+    }
+
+    // The file is kept between runs and may be damaged, a length past the slot would read the next slots or past the mapping
+    if (slot->length > cache->settings.diskSlotSize - sizeof(AIResponseCacheDiskSlot))
+    {
+        DebugWarning("AI response cache disk slot has an invalid length '%llu', the slot is emptied.", (unsigned long long)slot->length);
+        slot->key.size = 0;
+        cache->statistics.misses++;
+        return NULL;
+    }
+
+    if (AIResponseCache_IsExpired((time_t)slot->expiry, now))
+    {
+        slot->key.size = 0;
+        cache->statistics.expired++;
+        cache->statistics.misses++;
+        return NULL;
+    }
+
+    size_t length = (size_t)slot->length;
+    const char *answer = (const char *)slot + sizeof(AIResponseCacheDiskSlot);
+    AIResponseCache_PutMemory(cache, key, answer, length, (time_t)slot->expiry);
+    cache->statistics.diskHits++;
+
+    stringHeap copy = (stringHeap)malloc(length + 1);
+    DebugAssert(copy != NULL, "Memory allocation failed for AI response cache answer.");
+    memcpy(copy, answer, length);
+    copy[length] = '\0';
+
+    return copy;
+}
+
+void AIResponseCache_Put(AIResponseCache *cache, AIResponseCacheKey key, const string answer)
+{
+    DebugAssert(cache != NULL, "Null pointer passed as parameter. Cache cannot be NULL.");
+    DebugAssert(answer != NULL, "Null pointer passed as parameter. Answer cannot be NULL.");
+
+    time_t now = time(NULL);
+    time_t expiry = cache->settings.timeToLive > 0 ? now + cache->settings.timeToLive : 0;
+    size_t length = strlen(answer);
+
+    AIResponseCache_PutMemory(cache, key, answer, length, expiry);
+    if (cache->disk != NULL)
+    {
+        AIResponseCache_PutDisk(cache, key, answer, length, expiry, now);
+    }
+    cache->statistics.stores++;
+}
+
+void AIResponseCache_Clear(AIResponseCache *cache)
+{
+    DebugAssert(cache != NULL, "Null pointer passed as parameter. Cache cannot be NULL.");
+
+    for (size_t i = 0; i < cache->entryCount; i++)
+    {
+        free(cache->entries[i].answer);
+    }
+    cache->entryCount = 0;
+    cache->head = AI_RESPONSE_CACHE_NONE;
+    cache->tail = AI_RESPONSE_CACHE_NONE;
+    HashMap_Clear(cache->indices);
+
+    for (size_t i = 0; cache->disk != NULL && i < cache->settings.diskSlotCount; i++)
+    {
+        AIResponseCache_GetDiskSlot(cache, i)->key.size = 0;
+    }
+}
+
+AIResponseCacheStatistics AIResponseCache_GetStatistics(const AIResponseCache *cache)
+{
+    DebugAssert(cache != NULL, "Null pointer passed as parameter. Cache cannot be NULL.");
+
+    return cache->statistics;
+}
+
+double AIResponseCache_GetHitRate(const AIResponseCache *cache)
+{
+    DebugAssert(cache != NULL, "Null pointer passed as parameter. Cache cannot be NULL.");
+
+    if (cache->statistics.lookups == 0)
+    {
+        return 0.0;
+    }
+
+    return (double)(cache->statistics.memoryHits + cache->statistics.diskHits) / (double)cache->statistics.lookups;
+}
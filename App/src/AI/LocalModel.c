@@ -0,0 +1,877 @@
+#include "AI/LocalModel.h"
+
+#include "Maths/Simd.h"
+#include "Utils/HashMap.h"
+#include "Utils/Timer.h"
+
+#include <math.h>
+
+#if !PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#pragma region Source Only
+
+#define LOCAL_MODEL_NORM_EPSILON 1e-5f
+#define LOCAL_MODEL_ROPE_THETA 10000.0f
+
+// Rows of a matrix per task of the worker pool, and the size of a matrix below which waking the threads up costs more than they save
+#define LOCAL_MODEL_ROW_BLOCK 32
+#define LOCAL_MODEL_PARALLEL_MIN_WEIGHTS (128 * 1024)
+
+#define LOCAL_MODEL_INITIAL_OUTPUT_CAPACITY 256
+
+/// @brief A quantized matrix inside the mapped file.
+typedef struct LocalModelMatrix
+{
+    const void *values; // int8_t, or uint8_t of two 4 bit values
+    const float *scales;
+    size_t rows;
+    size_t columns;
+} LocalModelMatrix;
+
+typedef struct LocalModelLayer
+{
+    const float *attentionNorm;
+    const float *feedForwardNorm;
+    LocalModelMatrix query;
+    LocalModelMatrix key;
+    LocalModelMatrix value;
+    LocalModelMatrix output;
+    LocalModelMatrix gate;
+    LocalModelMatrix up;
+    LocalModelMatrix down;
+} LocalModelLayer;
+
+typedef struct LocalModelToken
+{
+    const char *bytes; // inside the mapped file, not null terminated
+    uint32_t length;
+    float score;
+} LocalModelToken;
+
+typedef struct LocalModel
+{
+    const unsigned char *file;
+    size_t fileSize;
+    const LocalModelHeader *header;
+    WorkerPool *pool; // Can be NULL
+
+    LocalModelToken *vocabulary;
+    HashMap *merges; // (left << 32 | right) token pair to the token of both, uint64_t to uint32_t
+
+    const float *finalNorm;
+    LocalModelMatrix embedding;
+    LocalModelMatrix classifier;
+    LocalModelLayer *layers;
+
+    size_t headSize;
+    size_t keyValueDimension;
+
+    // Buffers of a forward pass, allocated once
+    float *state;     // dimension, the residual stream
+    float *normalized; // dimension
+    float *query;      // dimension
+    float *mixed;      // dimension, attention output of all heads
+    float *gate;       // hiddenDimension
+    float *up;         // hiddenDimension
+    float *scores;     // maxSequenceLength, attention scores of a head
+    float *logits;     // vocabularySize
+    float *ropeCosines; // headSize / 2, of the current position
+    float *ropeSines;   // headSize / 2
+    int8_t *quantized;      // max(dimension, hiddenDimension), the input of a product
+    float *quantizedScales; // a scale per group of quantized
+    float *keyCache;   // layerCount x maxSequenceLength x keyValueDimension
+    float *valueCache; // layerCount x maxSequenceLength x keyValueDimension
+    uint32_t *candidates; // vocabularySize, top k of the sampling
+    uint32_t *tokens;     // maxSequenceLength, the prompt
+
+    LocalModelStatistics statistics;
+} LocalModel;
+
+/// @brief Rows of a product run by LocalModel_ProductRows.
+typedef struct LocalModelProduct
+{
+    const SimdKernels *kernels;
+    const LocalModelMatrix *matrix;
+    const int8_t *values;
+    const float *scales;
+    float *result;
+    size_t groupSize;
+    bool isFourBit;
+} LocalModelProduct;
+
+/// @brief Rounds a file offset up to LOCAL_MODEL_FILE_ALIGNMENT.
+size_t LocalModel_Align(size_t offset)
+{
+    return (offset + LOCAL_MODEL_FILE_ALIGNMENT - 1) / LOCAL_MODEL_FILE_ALIGNMENT * LOCAL_MODEL_FILE_ALIGNMENT;
+}
+
+/// @brief Takes a part of the file at an offset and moves the offset past it.
+/// @return Pointer to the part inside the file, or NULL if the file is too short.
+const void *LocalModel_Take(const LocalModel *model, size_t *offset, size_t size)
+{
+    if (*offset > model->fileSize || size > model->fileSize - *offset)
+    {
+        return NULL;
+    }
+
+    const void *part = model->file + *offset;
+    *offset += size;
+    return part;
+}
+
+/// @brief Takes a quantized matrix, its values then its scales, each padded to LOCAL_MODEL_FILE_ALIGNMENT.
+bool LocalModel_TakeMatrix(const LocalModel *model, size_t *offset, size_t rows, size_t columns, LocalModelMatrix *matrix)
+{
+    size_t count = rows * columns;
+    size_t valuesSize = model->header->quantizationBits == 4 ? count / 2 : count;
+
+    matrix->rows = rows;
+    matrix->columns = columns;
+    matrix->values = LocalModel_Take(model, offset, valuesSize);
+    *offset = LocalModel_Align(*offset);
+    matrix->scales = (const float *)LocalModel_Take(model, offset, count / model->header->groupSize * sizeof(float));
+    *offset = LocalModel_Align(*offset);
+
+    return matrix->values != NULL && matrix->scales != NULL;
+}
+
+/// @brief Checks the sizes of a header, so the forward pass can rely on them.
+bool LocalModel_IsHeaderValid(const LocalModelHeader *header)
+{
+    return header->magic == LOCAL_MODEL_MAGIC &&
+           header->version == LOCAL_MODEL_VERSION &&
+           (header->quantizationBits == 8 || header->quantizationBits == 4) &&
+           header->vocabularySize >= 256 && header->dimension > 0 && header->hiddenDimension > 0 &&
+           header->layerCount > 0 && header->maxSequenceLength > 1 &&
+           header->groupSize > 0 && header->groupSize % 32 == 0 &&
+           header->dimension % header->groupSize == 0 && header->hiddenDimension % header->groupSize == 0 &&
+           header->headCount > 0 && header->dimension % header->headCount == 0 && (header->dimension / header->headCount) % 2 == 0 &&
+           header->keyValueHeadCount > 0 && header->headCount % header->keyValueHeadCount == 0 &&
+           header->beginToken < header->vocabularySize && header->endToken < header->vocabularySize;
+}
+
+/// @brief Reads the vocabulary and finds the pair of tokens every longer token merges.
+bool LocalModel_ReadVocabulary(LocalModel *model, size_t *offset)
+{
+    size_t vocabularySize = model->header->vocabularySize;
+    model->vocabulary = (LocalModelToken *)malloc(vocabularySize * sizeof(LocalModelToken));
+    DebugAssert(model->vocabulary != NULL, "Memory allocation failed for local model vocabulary.");
+
+    for (size_t i = 0; i < vocabularySize; i++)
+    {
+        // Entries are packed, so the score and the length are copied out instead of read in place
+        const void *score = LocalModel_Take(model, offset, sizeof(float));
+        const void *length = LocalModel_Take(model, offset, sizeof(uint32_t));
+        if (score == NULL || length == NULL)
+        {
+            return false;
+        }
+
+        LocalModelToken *token = &model->vocabulary[i];
+        memcpy(&token->score, score, sizeof(float));
+        memcpy(&token->length, length, sizeof(uint32_t));
+        token->bytes = (const char *)LocalModel_Take(model, offset, token->length);
+        if (token->bytes == NULL || token->length == 0 || (i < 256 && (token->length != 1 || (unsigned char)token->bytes[0] != i)))
+        {
+            return false;
+        }
+    }
+
+    // Bytes of a token to the token, by the hash of the bytes. A hash shared by two tokens keeps the first one, the other one is never merged into.
+    HashMap *lookup = HashMap_Create(sizeof(unsigned long long), sizeof(uint32_t), vocabularySize * 2);
+    for (uint32_t i = 0; i < vocabularySize; i++)
+    {
+        unsigned long long hash = HashMap_HashBytes(model->vocabulary[i].bytes, model->vocabulary[i].length);
+        if (HashMap_Get(lookup, &hash) == NULL)
+        {
+            HashMap_Set(lookup, &hash, &i);
+        }
+    }
+
+    model->merges = HashMap_Create(sizeof(uint64_t), sizeof(uint32_t), vocabularySize * 2);
+    for (uint32_t i = 256; i < vocabularySize; i++)
+    {
+        const LocalModelToken *token = &model->vocabulary[i];
+        for (uint32_t split = 1; split < token->length; split++)
+        {
+            unsigned long long leftHash = HashMap_HashBytes(token->bytes, split);
+            unsigned long long rightHash = HashMap_HashBytes(token->bytes + split, token->length - split);
+            uint32_t *left = (uint32_t *)HashMap_Get(lookup, &leftHash);
+            uint32_t *right = (uint32_t *)HashMap_Get(lookup, &rightHash);
+            if (left == NULL || right == NULL ||
+                model->vocabulary[*left].length != split || memcmp(model->vocabulary[*left].bytes, token->bytes, split) != 0 ||
+                model->vocabulary[*right].length != token->length - split || memcmp(model->vocabulary[*right].bytes, token->bytes + split, token->length - split) != 0)
+            {
+                continue;
+            }
+
+            uint64_t pair = (uint64_t)*left << 32 | *right;
+            HashMap_Set(model->merges, &pair, &i);
+        }
+    }
+
+    HashMap_Destroy(lookup);
+    return true;
+}
+
+/// @brief Reads the norm weights and the matrices after the vocabulary.
+bool LocalModel_ReadWeights(LocalModel *model, size_t *offset)
+{
+    const LocalModelHeader *header = model->header;
+    size_t dimension = header->dimension;
+
+    *offset = LocalModel_Align(*offset);
+    const float *norms = (const float *)LocalModel_Take(model, offset, (2 * header->layerCount + 1) * dimension * sizeof(float));
+    *offset = LocalModel_Align(*offset);
+    if (norms == NULL)
+    {
+        return false;
+    }
+
+    model->layers = (LocalModelLayer *)malloc(header->layerCount * sizeof(LocalModelLayer));
+    DebugAssert(model->layers != NULL, "Memory allocation failed for local model layers.");
+
+    for (size_t i = 0; i < header->layerCount; i++)
+    {
+        model->layers[i].attentionNorm = norms + i * dimension;
+        model->layers[i].feedForwardNorm = norms + (header->layerCount + i) * dimension;
+    }
+    model->finalNorm = norms + 2 * header->layerCount * dimension;
+
+    bool isRead = LocalModel_TakeMatrix(model, offset, header->vocabularySize, dimension, &model->embedding);
+    for (size_t i = 0; i < header->layerCount && isRead; i++)
+    {
+        LocalModelLayer *layer = &model->layers[i];
+        isRead = LocalModel_TakeMatrix(model, offset, dimension, dimension, &layer->query) &&
+                 LocalModel_TakeMatrix(model, offset, model->keyValueDimension, dimension, &layer->key) &&
+                 LocalModel_TakeMatrix(model, offset, model->keyValueDimension, dimension, &layer->value) &&
+                 LocalModel_TakeMatrix(model, offset, dimension, dimension, &layer->output) &&
+                 LocalModel_TakeMatrix(model, offset, header->hiddenDimension, dimension, &layer->gate) &&
+                 LocalModel_TakeMatrix(model, offset, header->hiddenDimension, dimension, &layer->up) &&
+                 LocalModel_TakeMatrix(model, offset, dimension, header->hiddenDimension, &layer->down);
+    }
+
+    return isRead && LocalModel_TakeMatrix(model, offset, header->vocabularySize, dimension, &model->classifier);
+}
+
+/// @brief Allocates the buffers of the forward pass.
+void LocalModel_AllocateBuffers(LocalModel *model)
+{
+    const LocalModelHeader *header = model->header;
+    size_t largest = header->dimension > header->hiddenDimension ? header->dimension : header->hiddenDimension;
+    size_t cacheCount = (size_t)header->layerCount * header->maxSequenceLength * model->keyValueDimension;
+
+    model->state = Simd_AllocateFloats(header->dimension);
+    model->normalized = Simd_AllocateFloats(header->dimension);
+    model->query = Simd_AllocateFloats(header->dimension);
+    model->mixed = Simd_AllocateFloats(header->dimension);
+    model->gate = Simd_AllocateFloats(header->hiddenDimension);
+    model->up = Simd_AllocateFloats(header->hiddenDimension);
+    model->scores = Simd_AllocateFloats(header->maxSequenceLength);
+    model->logits = Simd_AllocateFloats(header->vocabularySize);
+    model->ropeCosines = Simd_AllocateFloats(model->headSize / 2);
+    model->ropeSines = Simd_AllocateFloats(model->headSize / 2);
+    model->quantizedScales = Simd_AllocateFloats(largest / header->groupSize);
+    model->keyCache = Simd_AllocateFloats(cacheCount);
+    model->valueCache = Simd_AllocateFloats(cacheCount);
+
+    model->quantized = (int8_t *)malloc(largest);
+    model->candidates = (uint32_t *)malloc(header->vocabularySize * sizeof(uint32_t));
+    model->tokens = (uint32_t *)malloc(header->maxSequenceLength * sizeof(uint32_t));
+    DebugAssert(model->quantized != NULL && model->candidates != NULL && model->tokens != NULL, "Memory allocation failed for local model buffers.");
+}
+
+/// @brief Unmaps or frees the file of a model.
+void LocalModel_CloseFile(LocalModel *model)
+{
+    if (model->file == NULL)
+    {
+        return;
+    }
+
+#if !PLATFORM_WINDOWS
+    munmap((void *)model->file, model->fileSize);
+#else
+    free((void *)model->file);
+#endif
+    model->file = NULL;
+}
+
+/// @brief Maps a file to memory for reading, or reads it whole where mapping is not supported.
+bool LocalModel_OpenFile(LocalModel *model, const string path)
+{
+#if !PLATFORM_WINDOWS
+    int fileDescriptor = open(path, O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0)
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    void *mapping = mmap(NULL, (size_t)fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor); // the mapping keeps the file open
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    model->file = (const unsigned char *)mapping;
+    model->fileSize = (size_t)fileStatus.st_size;
+#else
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    unsigned char *contents = size > 0 ? (unsigned char *)malloc((size_t)size) : NULL;
+    if (contents == NULL || fread(contents, 1, (size_t)size, file) != (size_t)size)
+    {
+        free(contents);
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+
+    model->file = contents;
+    model->fileSize = (size_t)size;
+#endif
+
+    return true;
+}
+
+/// @brief Quantizes values to int8 with a scale per group, the input of the quantized kernels.
+void LocalModel_Quantize(const float *values, size_t count, size_t groupSize, int8_t *quantized, float *scales)
+{
+    for (size_t group = 0; group * groupSize < count; group++)
+    {
+        const float *groupValues = values + group * groupSize;
+
+        float largest = 0.0f;
+        for (size_t i = 0; i < groupSize; i++)
+        {
+            float magnitude = fabsf(groupValues[i]);
+            largest = magnitude > largest ? magnitude : largest;
+        }
+
+        scales[group] = largest / 127.0f;
+        float inverse = largest > 0.0f ? 127.0f / largest : 0.0f;
+        for (size_t i = 0; i < groupSize; i++)
+        {
+            quantized[group * groupSize + i] = (int8_t)roundf(groupValues[i] * inverse);
+        }
+    }
+}
+
+/// @brief Task of the worker pool, a block of rows of a product.
+void LocalModel_ProductRows(void *context, size_t index)
+{
+    const LocalModelProduct *product = (const LocalModelProduct *)context;
+    const LocalModelMatrix *matrix = product->matrix;
+
+    size_t start = index * LOCAL_MODEL_ROW_BLOCK;
+    size_t end = start + LOCAL_MODEL_ROW_BLOCK < matrix->rows ? start + LOCAL_MODEL_ROW_BLOCK : matrix->rows;
+    size_t groupsPerRow = matrix->columns / product->groupSize;
+
+    for (size_t row = start; row < end; row++)
+    {
+        const float *rowScales = matrix->scales + row * groupsPerRow;
+        if (product->isFourBit)
+        {
+            const uint8_t *rowValues = (const uint8_t *)matrix->values + row * matrix->columns / 2;
+            product->result[row] = product->kernels->quantized4Dot(rowValues, rowScales, product->values, product->scales, product->groupSize, matrix->columns);
+        }
+        else
+        {
+            const int8_t *rowValues = (const int8_t *)matrix->values + row * matrix->columns;
+            product->result[row] = product->kernels->quantizedDot(rowValues, rowScales, product->values, product->scales, product->groupSize, matrix->columns);
+        }
+    }
+}
+
+/// @brief Multiplies a quantized matrix with the quantized buffer of the model.
+void LocalModel_Product(LocalModel *model, const LocalModelMatrix *matrix, float *result)
+{
+    LocalModelProduct product = {
+        Simd_GetKernels(),
+        matrix,
+        model->quantized,
+        model->quantizedScales,
+        result,
+        model->header->groupSize,
+        model->header->quantizationBits == 4};
+
+    WorkerPool *pool = matrix->rows * matrix->columns >= LOCAL_MODEL_PARALLEL_MIN_WEIGHTS ? model->pool : NULL;
+    WorkerPool_ParallelFor(pool, (matrix->rows + LOCAL_MODEL_ROW_BLOCK - 1) / LOCAL_MODEL_ROW_BLOCK, LocalModel_ProductRows, &product);
+}
+
+/// @brief Normalizes values by their root mean square and scales them by weights.
+void LocalModel_Norm(const float *values, const float *weights, size_t count, float *result)
+{
+    float sum = 0.0f;
+    for (size_t i = 0; i < count; i++)
+    {
+        sum += values[i] * values[i];
+    }
+
+    float scale = 1.0f / sqrtf(sum / (float)count + LOCAL_MODEL_NORM_EPSILON);
+    for (size_t i = 0; i < count; i++)
+    {
+        result[i] = values[i] * scale * weights[i];
+    }
+}
+
+/// @brief Rotates pairs of a head by the angles of the current position, the rotary position embedding.
+void LocalModel_Rotate(const LocalModel *model, float *head)
+{
+    for (size_t i = 0; i < model->headSize / 2; i++)
+    {
+        float x = head[2 * i];
+        float y = head[2 * i + 1];
+        head[2 * i] = x * model->ropeCosines[i] - y * model->ropeSines[i];
+        head[2 * i + 1] = x * model->ropeSines[i] + y * model->ropeCosines[i];
+    }
+}
+
+/// @brief Turns scores into probabilities in place.
+void LocalModel_Softmax(float *values, size_t count)
+{
+    float largest = values[0];
+    for (size_t i = 1; i < count; i++)
+    {
+        largest = values[i] > largest ? values[i] : largest;
+    }
+
+    float sum = 0.0f;
+    for (size_t i = 0; i < count; i++)
+    {
+        values[i] = expf(values[i] - largest);
+        sum += values[i];
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        values[i] /= sum;
+    }
+}
+
+/// @brief Runs a token through the model at a position, caching its keys and values.
+/// @param hasLogits False to skip the classifier, for the prompt tokens before the last one.
+void LocalModel_Forward(LocalModel *model, uint32_t token, size_t position, bool hasLogits)
+{
+    const LocalModelHeader *header = model->header;
+    size_t dimension = header->dimension;
+    size_t groupSize = header->groupSize;
+    size_t headSize = model->headSize;
+    size_t keyValueDimension = model->keyValueDimension;
+    size_t headsPerKeyValue = header->headCount / header->keyValueHeadCount;
+
+    // Embedding row of the token, dequantized
+    const float *embeddingScales = model->embedding.scales + token * (dimension / groupSize);
+    for (size_t i = 0; i < dimension; i++)
+    {
+        float value;
+        if (header->quantizationBits == 4)
+        {
+            uint8_t byte = ((const uint8_t *)model->embedding.values)[token * dimension / 2 + (i / groupSize) * groupSize / 2 + (i % groupSize) % (groupSize / 2)];
+            value = (float)((i % groupSize < groupSize / 2 ? byte & 0x0F : byte >> 4) - 8);
+        }
+        else
+        {
+            value = (float)((const int8_t *)model->embedding.values)[token * dimension + i];
+        }
+        model->state[i] = value * embeddingScales[i / groupSize];
+    }
+
+    for (size_t i = 0; i < headSize / 2; i++)
+    {
+        float angle = (float)position * powf(LOCAL_MODEL_ROPE_THETA, -2.0f * (float)i / (float)headSize);
+        model->ropeCosines[i] = cosf(angle);
+        model->ropeSines[i] = sinf(angle);
+    }
+
+    float inverseScale = 1.0f / sqrtf((float)headSize);
+    for (size_t l = 0; l < header->layerCount; l++)
+    {
+        const LocalModelLayer *layer = &model->layers[l];
+        float *keys = model->keyCache + l * header->maxSequenceLength * keyValueDimension;
+        float *values = model->valueCache + l * header->maxSequenceLength * keyValueDimension;
+
+        // Attention, the key and the value of the token go straight into the cache
+        LocalModel_Norm(model->state, layer->attentionNorm, dimension, model->normalized);
+        LocalModel_Quantize(model->normalized, dimension, groupSize, model->quantized, model->quantizedScales);
+        LocalModel_Product(model, &layer->query, model->query);
+        LocalModel_Product(model, &layer->key, keys + position * keyValueDimension);
+        LocalModel_Product(model, &layer->value, values + position * keyValueDimension);
+
+        for (size_t h = 0; h < header->headCount; h++)
+        {
+            LocalModel_Rotate(model, model->query + h * headSize);
+        }
+        for (size_t h = 0; h < header->keyValueHeadCount; h++)
+        {
+            LocalModel_Rotate(model, keys + position * keyValueDimension + h * headSize);
+        }
+
+        for (size_t h = 0; h < header->headCount; h++)
+        {
+            const float *query = model->query + h * headSize;
+            size_t keyValueOffset = h / headsPerKeyValue * headSize;
+
+            for (size_t t = 0; t <= position; t++)
+            {
+                const float *key = keys + t * keyValueDimension + keyValueOffset;
+                float score = 0.0f;
+                for (size_t i = 0; i < headSize; i++)
+                {
+                    score += query[i] * key[i];
+                }
+                model->scores[t] = score * inverseScale;
+            }
+            LocalModel_Softmax(model->scores, position + 1);
+
+            float *mixed = model->mixed + h * headSize;
+            memset(mixed, 0, headSize * sizeof(float));
+            for (size_t t = 0; t <= position; t++)
+            {
+                const float *value = values + t * keyValueDimension + keyValueOffset;
+                for (size_t i = 0; i < headSize; i++)
+                {
+                    mixed[i] += model->scores[t] * value[i];
+                }
+            }
+        }
+
+        LocalModel_Quantize(model->mixed, dimension, groupSize, model->quantized, model->quantizedScales);
+        LocalModel_Product(model, &layer->output, model->normalized);
+        for (size_t i = 0; i < dimension; i++)
+        {
+            model->state[i] += model->normalized[i];
+        }
+
+        // Feed forward, SiLU of the gate times the up projection
+        LocalModel_Norm(model->state, layer->feedForwardNorm, dimension, model->normalized);
+        LocalModel_Quantize(model->normalized, dimension, groupSize, model->quantized, model->quantizedScales);
+        LocalModel_Product(model, &layer->gate, model->gate);
+        LocalModel_Product(model, &layer->up, model->up);
+        for (size_t i = 0; i < header->hiddenDimension; i++)
+        {
+            model->gate[i] = model->gate[i] / (1.0f + expf(-model->gate[i])) * model->up[i];
+        }
+
+        LocalModel_Quantize(model->gate, header->hiddenDimension, groupSize, model->quantized, model->quantizedScales);
+        LocalModel_Product(model, &layer->down, model->normalized);
+        for (size_t i = 0; i < dimension; i++)
+        {
+            model->state[i] += model->normalized[i];
+        }
+    }
+
+    if (hasLogits)
+    {
+        LocalModel_Norm(model->state, model->finalNorm, dimension, model->normalized);
+        LocalModel_Quantize(model->normalized, dimension, groupSize, model->quantized, model->quantizedScales);
+        LocalModel_Product(model, &model->classifier, model->logits);
+    }
+}
+
+/// @brief Gets the next random number of a xorshift generator.
+uint64_t LocalModel_Random(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+/// @brief Picks the next token from the logits.
+uint32_t LocalModel_Sample(LocalModel *model, const LocalModelSampling *sampling, uint64_t *randomState)
+{
+    size_t vocabularySize = model->header->vocabularySize;
+    size_t topK = sampling->topK < vocabularySize ? sampling->topK : vocabularySize;
+
+    if (sampling->temperature <= 0.0f || topK <= 1)
+    {
+        uint32_t best = 0;
+        for (uint32_t i = 1; i < vocabularySize; i++)
+        {
+            best = model->logits[i] > model->logits[best] ? i : best;
+        }
+        return best;
+    }
+
+    // The k best tokens by insertion, k is small against the vocabulary
+    size_t count = 0;
+    for (uint32_t i = 0; i < vocabularySize; i++)
+    {
+        if (count == topK && model->logits[i] <= model->logits[model->candidates[count - 1]])
+        {
+            continue;
+        }
+
+        size_t slot = count < topK ? count++ : count - 1;
+        while (slot > 0 && model->logits[model->candidates[slot - 1]] < model->logits[i])
+        {
+            model->candidates[slot] = model->candidates[slot - 1];
+            slot--;
+        }
+        model->candidates[slot] = i;
+    }
+
+    // Probabilities of the candidates at the temperature, the scores buffer is free between forward passes
+    float *probabilities = model->scores;
+    for (size_t i = 0; i < count; i++)
+    {
+        probabilities[i] = model->logits[model->candidates[i]] / sampling->temperature;
+    }
+    LocalModel_Softmax(probabilities, count);
+
+    float pick = (float)(LocalModel_Random(randomState) >> 40) / (float)(1ULL << 24);
+    float cumulative = 0.0f;
+    for (size_t i = 0; i < count; i++)
+    {
+        cumulative += probabilities[i];
+        if (pick < cumulative)
+        {
+            return model->candidates[i];
+        }
+    }
+
+    return model->candidates[count - 1];
+}
+
+#pragma endregion Source Only
+
+LocalModel *LocalModel_Load(const string path, WorkerPool *pool)
+{
+    DebugAssert(path != NULL, "Null pointer passed as parameter. Path cannot be NULL.");
+
+    LocalModel *model = (LocalModel *)calloc(1, sizeof(LocalModel));
+    DebugAssert(model != NULL, "Memory allocation failed for local model.");
+    model->pool = pool;
+
+    if (!LocalModel_OpenFile(model, path))
+    {
+        DebugError("Failed to open local model file '%s'. Returning NULL.", path);
+        free(model);
+        return NULL;
+    }
+
+    size_t offset = 0;
+    model->header = (const LocalModelHeader *)LocalModel_Take(model, &offset, sizeof(LocalModelHeader));
+    if (model->header == NULL || !LocalModel_IsHeaderValid(model->header))
+    {
+        DebugError("Local model file '%s' has an invalid header. Returning NULL.", path);
+        LocalModel_CloseFile(model);
+        free(model);
+        return NULL;
+    }
+
+    model->headSize = model->header->dimension / model->header->headCount;
+    model->keyValueDimension = model->headSize * model->header->keyValueHeadCount;
+
+    if (!LocalModel_ReadVocabulary(model, &offset) || !LocalModel_ReadWeights(model, &offset))
+    {
+        DebugError("Local model file '%s' is shorter than its header tells. Returning NULL.", path);
+        if (model->merges != NULL)
+        {
+            HashMap_Destroy(model->merges);
+        }
+        free(model->layers);
+        free(model->vocabulary);
+        LocalModel_CloseFile(model);
+        free(model);
+        return NULL;
+    }
+
+    LocalModel_AllocateBuffers(model);
+
+    DebugInfo("Local model '%s' loaded, %u layers of %u, %u bit weights.", path, model->header->layerCount, model->header->dimension, model->header->quantizationBits);
+    return model;
+}
+
+void LocalModel_Destroy(LocalModel *model)
+{
+    DebugAssert(model != NULL, "Null pointer passed as parameter. Model cannot be NULL.");
+
+    Simd_Free(model->state);
+    Simd_Free(model->normalized);
+    Simd_Free(model->query);
+    Simd_Free(model->mixed);
+    Simd_Free(model->gate);
+    Simd_Free(model->up);
+    Simd_Free(model->scores);
+    Simd_Free(model->logits);
+    Simd_Free(model->ropeCosines);
+    Simd_Free(model->ropeSines);
+    Simd_Free(model->quantizedScales);
+    Simd_Free(model->keyCache);
+    Simd_Free(model->valueCache);
+    free(model->quantized);
+    free(model->candidates);
+    free(model->tokens);
+
+    HashMap_Destroy(model->merges);
+    free(model->layers);
+    free(model->vocabulary);
+    LocalModel_CloseFile(model);
+
+    free(model);
+    model = NULL;
+
+    DebugInfo("Local model destroyed.");
+}
+
+LocalModelSampling LocalModel_GetDefaultSampling()
+{
+    return (LocalModelSampling){0.0f, 1, LOCAL_MODEL_DEFAULT_MAX_TOKENS, 0x9E3779B97F4A7C15ULL};
+}
+
+stringHeap LocalModel_Generate(LocalModel *model, const string prompt, const LocalModelSampling *sampling)
+{
+    DebugAssert(model != NULL, "Null pointer passed as parameter. Model cannot be NULL.");
+    DebugAssert(prompt != NULL, "Null pointer passed as parameter. Prompt cannot be NULL.");
+    DebugAssert(sampling != NULL, "Null pointer passed as parameter. Sampling cannot be NULL.");
+
+    const LocalModelHeader *header = model->header;
+    uint64_t randomState = sampling->seed != 0 ? sampling->seed : 1;
+
+    // The begin token, then the prompt, leaving a position for at least one generated token
+    model->tokens[0] = header->beginToken;
+    size_t promptCount = 1 + LocalModel_Encode(model, prompt, model->tokens + 1, header->maxSequenceLength - 2);
+
+    Timer timer = Timer_CreateStack("Local model prompt");
+    Timer_Start(&timer);
+    for (size_t i = 0; i < promptCount; i++)
+    {
+        LocalModel_Forward(model, model->tokens[i], i, i + 1 == promptCount);
+    }
+    Timer_Stop(&timer);
+    model->statistics.promptTokens = promptCount;
+    model->statistics.promptNanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    size_t capacity = LOCAL_MODEL_INITIAL_OUTPUT_CAPACITY;
+    size_t length = 0;
+    stringHeap output = (stringHeap)malloc(capacity);
+    DebugAssert(output != NULL, "Memory allocation failed for local model output.");
+
+    size_t generatedCount = 0;
+    size_t position = promptCount;
+    timer = Timer_CreateStack("Local model generation");
+    Timer_Start(&timer);
+    while (generatedCount < sampling->maxTokens)
+    {
+        uint32_t token = LocalModel_Sample(model, sampling, &randomState);
+        if (token == header->endToken)
+        {
+            break;
+        }
+
+        const LocalModelToken *entry = &model->vocabulary[token];
+        if (length + entry->length + 1 > capacity)
+        {
+            while (length + entry->length + 1 > capacity)
+            {
+                capacity *= 2;
+            }
+            output = (stringHeap)realloc(output, capacity);
+            DebugAssert(output != NULL, "Memory allocation failed for local model output.");
+        }
+        memcpy(output + length, entry->bytes, entry->length);
+        length += entry->length;
+        generatedCount++;
+
+        if (position >= header->maxSequenceLength)
+        {
+            break;
+        }
+        LocalModel_Forward(model, token, position++, true);
+    }
+    Timer_Stop(&timer);
+    output[length] = '\0';
+
+    model->statistics.generatedTokens = generatedCount;
+    model->statistics.generationNanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    return output;
+}
+
+size_t LocalModel_Encode(const LocalModel *model, const string text, uint32_t *tokens, size_t capacity)
+{
+    DebugAssert(model != NULL, "Null pointer passed as parameter. Model cannot be NULL.");
+    DebugAssert(text != NULL, "Null pointer passed as parameter. Text cannot be NULL.");
+    DebugAssert(tokens != NULL || capacity == 0, "Null pointer passed as parameter. Tokens cannot be NULL.");
+
+    size_t length = strlen(text);
+    uint32_t *work = (uint32_t *)malloc((length > 0 ? length : 1) * sizeof(uint32_t));
+    DebugAssert(work != NULL, "Memory allocation failed for local model tokens.");
+
+    size_t count = length;
+    for (size_t i = 0; i < length; i++)
+    {
+        work[i] = (unsigned char)text[i];
+    }
+
+    // Merges the pair of the best scored merged token until no pair merges
+    while (count > 1)
+    {
+        float bestScore = -INFINITY;
+        size_t bestIndex = SIZE_MAX;
+        uint32_t bestToken = 0;
+        for (size_t i = 0; i + 1 < count; i++)
+        {
+            uint64_t pair = (uint64_t)work[i] << 32 | work[i + 1];
+            uint32_t *merged = (uint32_t *)HashMap_Get(model->merges, &pair);
+            if (merged != NULL && model->vocabulary[*merged].score > bestScore)
+            {
+                bestScore = model->vocabulary[*merged].score;
+                bestIndex = i;
+                bestToken = *merged;
+            }
+        }
+
+        if (bestIndex == SIZE_MAX)
+        {
+            break;
+        }
+
+        work[bestIndex] = bestToken;
+        memmove(work + bestIndex + 1, work + bestIndex + 2, (count - bestIndex - 2) * sizeof(uint32_t));
+        count--;
+    }
+
+    count = count < capacity ? count : capacity;
+    memcpy(tokens, work, count * sizeof(uint32_t));
+    free(work);
+
+    return count;
+}
+
+LocalModelStatistics LocalModel_GetStatistics(const LocalModel *model)
+{
+    DebugAssert(model != NULL, "Null pointer passed as parameter. Model cannot be NULL.");
+
+    return model->statistics;
+}
+
+const LocalModelHeader *LocalModel_GetHeader(const LocalModel *model)
+{
+    DebugAssert(model != NULL, "Null pointer passed as parameter. Model cannot be NULL.");
+
+    return model->header;
+}
@@ -1,8 +1,12 @@
 #include "App.h"
 #include "Modules/InputManager.h"
+#include "Modules/RenderBackend.h"
 #include "Modules/RenderManager.h"
 #include "AI/AIManager.h"
+#include "UIX/MarkdownRenderer.h"
+#include "UIX/WindowExplorer.h"
 #include "Utils/ResourceManager.h"
+#include "Utils/Timer.h"
 
 #if PLATFORM_WINDOWS
 #define NETWORK_MANAGER_ENV_FILE "C:\\Users\\omruyr\\Documents\\Programming\\Code-Charlie\\.env"
@@ -10,22 +14,58 @@
 #define NETWORK_MANAGER_ENV_FILE "/home/omruyr/Projects/Code-Charlie/.env"
 #endif
 
+#define APP_RESPONSE_DRAW_INTERVAL 16 // milliseconds between two draws of a streaming answer, a frame at 60 Hz
+
 char OPEN_AI_API_KEY[256];
 Vector2Int terminalSize;
 RendererWindow *rightWindow;
 RendererWindow *leftTopWindow;
 RendererWindow *leftBottomWindow;
 AIChat *chat;
+MarkdownRenderer *responseRenderer;
 stringHeap response;
 stringHeap query;
+int responseWidth;
+time_t responseDrawTime;
+
+/// @brief Appends a part of the answer as it streams in, only the paragraph it changes is laid out again.
+/// The request blocks the loop until the whole answer is received, so the answer is drawn and presented from here, once per frame at most.
+void App_ResponseTextCallback(const char *text, size_t length, void *userData)
+{
+    MarkdownRenderer *renderer = (MarkdownRenderer *)userData;
+    MarkdownRenderer_Append(renderer, text, length);
+
+    TimePoint now;
+    TimePoint_Update(&now);
+    time_t milliseconds = TimePoint_ToMilliseconds(&now);
+    if (milliseconds - responseDrawTime < APP_RESPONSE_DRAW_INTERVAL && milliseconds >= responseDrawTime)
+    {
+        return;
+    }
+    responseDrawTime = milliseconds;
+
+    MarkdownRenderer_Draw(renderer, leftBottomWindow, NewVector2Int(2, 1));
+    RendererManager_Present();
+}
 
 void App_Start()
 {
     terminalSize = RendererWindow_GetWindowSize(RENDERER_MAIN_WINDOW);
 
-    rightWindow = RendererWindow_Create("test right", NewVector2Int(terminalSize.x * 3 / 4, 0), NewVector2Int(terminalSize.x / 4, terminalSize.y), RENDERER_MAIN_WINDOW);
-    leftTopWindow = RendererWindow_Create("test left top", NewVector2Int(0, 0), NewVector2Int(terminalSize.x * 3 / 4, terminalSize.y / 2), RENDERER_MAIN_WINDOW);
-    leftBottomWindow = RendererWindow_Create("test left bottom", NewVector2Int(0, terminalSize.y / 2), NewVector2Int(terminalSize.x * 3 / 4, terminalSize.y / 2), RENDERER_MAIN_WINDOW);
+    // Created full screen, the layout places them. Right pane is a quarter, left one is split in half.
+    leftTopWindow = RendererWindow_Create("test left top", NewVector2Int(0, 0), terminalSize, RENDERER_MAIN_WINDOW);
+    rightWindow = RendererWindow_Create("test right", NewVector2Int(0, 0), terminalSize, RENDERER_MAIN_WINDOW);
+    leftBottomWindow = RendererWindow_Create("test left bottom", NewVector2Int(0, 0), terminalSize, RENDERER_MAIN_WINDOW);
+
+    WindowExplorer_Initialize();
+    WindowExplorer_AddWindow(leftTopWindow);
+    WindowExplorer_SplitHorizontal(rightWindow);
+    WindowExplorer_SetSplitRatio(rightWindow, 0.25f);
+    WindowExplorer_SetFocus(leftTopWindow);
+    WindowExplorer_SplitVertical(leftBottomWindow);
+
+    responseWidth = RendererWindow_GetWindowSize(leftBottomWindow).x - 3;
+    responseRenderer = MarkdownRenderer_Create("AI Response", responseWidth);
 }
 
 void App_StartLate()
@@ -34,7 +74,8 @@ void App_StartLate()
 
     stringStack chatUrl = "https://api.openai.com/v1/chat/completions";
 
-    chat = AIChat_Create("My Test Chat", "gpt-3.5-turbo", chatUrl, OPEN_AI_API_KEY, NULL);
+    chat = AIChat_CreateWithProvider("My Test Chat", "gpt-3.5-turbo", chatUrl, OPEN_AI_API_KEY, NULL, &AI_PROVIDER_OPENAI, true);
+    AIChat_SetTextCallback(chat, App_ResponseTextCallback, responseRenderer);
 
     RendererWindow_PutCharToPosition(rightWindow, NewVector2Int(1, 1), RENDERER_DEFAULT_TEXT_ATTRIBUTE, '>');
     RendererWindow_PutCharToPosition(leftBottomWindow, NewVector2Int(1, 1), RENDERER_DEFAULT_TEXT_ATTRIBUTE, '>');
@@ -43,20 +84,30 @@ void App_StartLate()
 void App_Update()
 {
     query = RendererManager_GetStringAtPositionWrap(rightWindow, NewVector2Int(2, 1));
-    response = AIChat_SendAndReceive(chat, query);
-
-    // response = "hey there, Im a fake AI assistant";
 
     RendererWindow_Clear(rightWindow);
     RendererWindow_PutCharToPosition(rightWindow, NewVector2Int(1, 1), RENDERER_DEFAULT_TEXT_ATTRIBUTE, '>');
 
-    RendererWindow_Clear(leftBottomWindow);
-    RendererWindow_PutCharToPosition(leftBottomWindow, NewVector2Int(1, 1), RENDERER_DEFAULT_TEXT_ATTRIBUTE, '>');
+    // Laid out again only when the terminal is resized
+    int width = RendererWindow_GetWindowSize(leftBottomWindow).x - 3;
+    if (width != responseWidth && width > 0)
+    {
+        responseWidth = width;
+        MarkdownRenderer_SetWidth(responseRenderer, responseWidth);
+    }
 
-    RendererWindow_PutStringToPositionWrap(leftBottomWindow, NewVector2Int(2, 1), NULL, "AI Response: %s", response);
+    if (query != NULL && query[strspn(query, " ")] != '\0')
+    {
+        // The parts of the answer are appended and drawn by the text callback as they stream in, the draw erases only the lines of the previous answer
+        MarkdownRenderer_Clear(responseRenderer);
+        responseDrawTime = 0;
+        response = AIChat_SendAndReceive(chat, query);
+        free(response);
+        response = NULL;
+    }
+    MarkdownRenderer_Draw(responseRenderer, leftBottomWindow, NewVector2Int(2, 1));
 
     free(query);
-    free(response);
 }
 
 void App_UpdateLate()
@@ -70,5 +121,8 @@ void App_UpdateLate()
 
 void App_Stop(int exitCode)
 {
+    MarkdownRenderer_Destroy(responseRenderer);
+    WindowExplorer_Terminate();
+
     Core_Terminate(exitCode);
 }
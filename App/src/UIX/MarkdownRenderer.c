@@ -0,0 +1,753 @@
+#include "UIX/MarkdownRenderer.h"
+
+#include <ctype.h>
+
+#pragma region Source Only
+
+#define MARKDOWN_RENDERER_MAX_MARKER_LENGTH 16
+#define MARKDOWN_RENDERER_CODE_BLOCK_INDENT 2
+
+/// @brief Kind of a markdown source line. Decides how the line affects the open block.
+typedef enum MarkdownLineKind
+{
+    MarkdownLineKind_Paragraph,
+    MarkdownLineKind_Blank,
+    MarkdownLineKind_Heading,
+    MarkdownLineKind_ListItem,
+    MarkdownLineKind_Rule,
+    MarkdownLineKind_Fence,
+    MarkdownLineKind_Code
+} MarkdownLineKind;
+
+/// @brief A laid out line. Every character has its own style.
+typedef struct MarkdownLine
+{
+    char text[MARKDOWN_RENDERER_MAX_LINE_WIDTH + 1];
+    unsigned char styles[MARKDOWN_RENDERER_MAX_LINE_WIDTH];
+    int length;
+} MarkdownLine;
+
+typedef struct MarkdownRenderer
+{
+    stringHeap title;
+    int width;
+
+    char *source;
+    size_t sourceSize;
+    size_t sourceCapacity;
+
+    MarkdownLine *lines;
+    size_t lineCount;
+    size_t lineCapacity;
+
+    size_t tailSourceOffset; // Source offset of the first block which may still change.
+    size_t tailLineIndex;    // Index of the first line laid out from the tail.
+    bool tailInCodeBlock;    // Parser state at the tail source offset.
+
+    char *blockText; // Raw text of the open paragraph or list item, lines joined with spaces.
+    size_t blockSize;
+    size_t blockCapacity;
+    bool blockOpen;
+    int blockIndent;
+    char blockMarker[MARKDOWN_RENDERER_MAX_MARKER_LENGTH];
+    MarkdownStyle blockStyle;
+
+    char *styledText; // Scratch buffers for the inline parsed block before wrapping.
+    unsigned char *styledStyles;
+    size_t styledCapacity;
+
+    size_t firstDirtyLine; // First line changed since the last draw.
+    size_t drawnFirstLine; // First visible line in the last draw.
+    size_t drawnLineCount; // Count of lines drawn in the last draw.
+
+    RendererTextAttributeId attributeIds[MARKDOWN_STYLE_COMBINATION_COUNT]; // Interned attributes of the styles, Kolpa until first use.
+} MarkdownRenderer;
+
+/// @brief Grows a buffer to hold at least the required size. Doubles the capacity to keep appends amortized.
+/// @param buffer Buffer to grow.
+/// @param capacity Current capacity in items. Updated to new capacity.
+/// @param required Required capacity in items.
+/// @param sizeOfItem Size of a single item in bytes.
+void MarkdownRenderer_Reserve(void **buffer, size_t *capacity, size_t required, size_t sizeOfItem)
+{
+    if (required <= *capacity)
+    {
+        return;
+    }
+
+    size_t newCapacity = *capacity == 0 ? 16 : *capacity;
+    while (newCapacity < required)
+    {
+        newCapacity *= 2;
+    }
+
+    void *newBuffer = realloc(*buffer, newCapacity * sizeOfItem);
+    DebugAssert(newBuffer != NULL, "Memory allocation failed for markdown renderer buffer.");
+
+    *buffer = newBuffer;
+    *capacity = newCapacity;
+}
+
+/// @brief Gets the text attribute for a style combination. Interns it on first use.
+/// @param renderer Renderer to get the attribute from.
+/// @param style Style combination of the characters.
+/// @return Text attribute of the style or NULL for plain text, so window default is used.
+const RendererTextAttribute *MarkdownRenderer_GetAttribute(MarkdownRenderer *renderer, unsigned char style)
+{
+    if (style == MarkdownStyle_Plain)
+    {
+        return NULL;
+    }
+
+    if (renderer->attributeIds[style] == RENDERER_TEXT_ATTRIBUTE_ID_KOLPA)
+    {
+        RendererTextAttributeMask mask = RendererTextAttributeMask_Normal;
+        mask |= (style & MarkdownStyle_Heading) ? RendererTextAttributeMask_Bold | RendererTextAttributeMask_Underline : 0;
+        mask |= (style & MarkdownStyle_Strong) ? RendererTextAttributeMask_Bold : 0;
+        mask |= (style & MarkdownStyle_Emphasis) ? RendererTextAttributeMask_Underline : 0;
+        mask |= (style & MarkdownStyle_Code) ? RendererTextAttributeMask_Reversed : 0;
+        mask |= (style & MarkdownStyle_CodeBlock) ? RendererTextAttributeMask_Dim : 0;
+        mask |= (style & MarkdownStyle_ListMarker) ? RendererTextAttributeMask_Bold : 0;
+
+        renderer->attributeIds[style] = RendererTextAttribute_Intern(mask, (RendererColorPair){RendererColor_White, RendererColor_Black});
+    }
+
+    return RendererTextAttribute_GetInterned(renderer->attributeIds[style]);
+}
+
+/// @brief Adds a laid out line to the renderer.
+/// @param renderer Renderer to add the line to.
+/// @param indent Count of spaces before the text.
+/// @param text Text of the line. Not null terminated.
+/// @param styles Styles of the text characters. If NULL, style is used for all characters.
+/// @param style Style used when styles is NULL.
+/// @param length Length of the text.
+void MarkdownRenderer_EmitLine(MarkdownRenderer *renderer, int indent, const char *text, const unsigned char *styles, MarkdownStyle style, int length)
+{
+    MarkdownRenderer_Reserve((void **)&renderer->lines, &renderer->lineCapacity, renderer->lineCount + 1, sizeof(MarkdownLine));
+
+    MarkdownLine *line = &renderer->lines[renderer->lineCount++];
+    line->length = 0;
+
+    for (int i = 0; i < indent && line->length < renderer->width; i++)
+    {
+        line->text[line->length] = ' ';
+        line->styles[line->length] = MarkdownStyle_Plain;
+        line->length++;
+    }
+
+    for (int i = 0; i < length && line->length < renderer->width; i++)
+    {
+        line->text[line->length] = text[i];
+        line->styles[line->length] = styles != NULL ? styles[i] : (unsigned char)style;
+        line->length++;
+    }
+
+    line->text[line->length] = '\0';
+}
+
+/// @brief Word wraps styled text to the renderer width and adds the resulting lines.
+/// @param renderer Renderer to add the lines to.
+/// @param text Text to wrap.
+/// @param styles Styles of the text characters.
+/// @param length Length of the text.
+/// @param firstIndent Indent of the first line.
+/// @param restIndent Indent of the continuation lines.
+void MarkdownRenderer_Wrap(MarkdownRenderer *renderer, const char *text, const unsigned char *styles, size_t length, int firstIndent, int restIndent)
+{
+    size_t position = 0;
+    int indent = firstIndent;
+
+    do
+    {
+        if (position > 0)
+        {
+            while (position < length && text[position] == ' ')
+            {
+                position++;
+            }
+
+            if (position >= length)
+            {
+                break;
+            }
+        }
+
+        size_t available = renderer->width - indent < 1 ? 1 : (size_t)(renderer->width - indent);
+        size_t remaining = length - position;
+        size_t take = remaining;
+        size_t next = length;
+
+        if (remaining > available)
+        {
+            take = available;
+            next = position + available;
+
+            for (size_t i = position + available; i > position; i--)
+            {
+                if (text[i] == ' ')
+                {
+                    take = i - position;
+                    next = i + 1;
+                    break;
+                }
+            }
+        }
+
+        MarkdownRenderer_EmitLine(renderer, indent, text + position, styles + position, MarkdownStyle_Plain, (int)take);
+
+        position = next;
+        indent = restIndent;
+    } while (position < length);
+}
+
+/// @brief Parses inline markers of the open block and lays it out.
+/// @param renderer Renderer holding the open block.
+void MarkdownRenderer_FlushBlock(MarkdownRenderer *renderer)
+{
+    if (!renderer->blockOpen)
+    {
+        return;
+    }
+
+    renderer->blockOpen = false;
+
+    size_t markerLength = strlen(renderer->blockMarker);
+    size_t required = markerLength + renderer->blockSize + 1;
+    size_t styledCapacity = renderer->styledCapacity;
+
+    MarkdownRenderer_Reserve((void **)&renderer->styledText, &renderer->styledCapacity, required, sizeof(char));
+    MarkdownRenderer_Reserve((void **)&renderer->styledStyles, &styledCapacity, required, sizeof(unsigned char));
+
+    size_t length = 0;
+
+    for (size_t i = 0; i < markerLength; i++)
+    {
+        renderer->styledText[length] = renderer->blockMarker[i];
+        renderer->styledStyles[length] = MarkdownStyle_ListMarker;
+        length++;
+    }
+
+    const char *raw = renderer->blockText;
+    size_t rawSize = renderer->blockSize;
+    unsigned char style = (unsigned char)renderer->blockStyle;
+
+    for (size_t i = 0; i < rawSize; i++)
+    {
+        char character = raw[i];
+
+        if (character == '`')
+        {
+            style ^= MarkdownStyle_Code;
+            continue;
+        }
+
+        if (!(style & MarkdownStyle_Code))
+        {
+            if (character == '\\' && i + 1 < rawSize && ispunct((unsigned char)raw[i + 1]))
+            {
+                character = raw[++i];
+            }
+            else if ((character == '*' || character == '_') && i + 1 < rawSize && raw[i + 1] == character)
+            {
+                style ^= MarkdownStyle_Strong;
+                i++;
+                continue;
+            }
+            else if (character == '*')
+            {
+                // A lonely '*' surrounded by spaces is an operator, not an emphasis marker.
+                bool opening = !(style & MarkdownStyle_Emphasis);
+                bool attached = opening ? (i + 1 < rawSize && raw[i + 1] != ' ') : (i > 0 && raw[i - 1] != ' ');
+
+                if (attached)
+                {
+                    style ^= MarkdownStyle_Emphasis;
+                    continue;
+                }
+            }
+        }
+
+        renderer->styledText[length] = character;
+        renderer->styledStyles[length] = style;
+        length++;
+    }
+
+    MarkdownRenderer_Wrap(renderer, renderer->styledText, renderer->styledStyles, length, renderer->blockIndent, renderer->blockIndent + (int)markerLength);
+
+    renderer->blockSize = 0;
+}
+
+/// @brief Opens a new block or continues the open one with the given text.
+/// @param renderer Renderer to add the block text to.
+/// @param text Text to add. Not null terminated.
+/// @param length Length of the text.
+void MarkdownRenderer_AppendBlockText(MarkdownRenderer *renderer, const char *text, size_t length)
+{
+    MarkdownRenderer_Reserve((void **)&renderer->blockText, &renderer->blockCapacity, renderer->blockSize + length + 1, sizeof(char));
+
+    if (renderer->blockSize > 0)
+    {
+        renderer->blockText[renderer->blockSize++] = ' ';
+    }
+
+    memcpy(renderer->blockText + renderer->blockSize, text, length);
+    renderer->blockSize += length;
+}
+
+/// @brief Opens a new block. Flushes the previously open block.
+/// @param renderer Renderer to open the block in.
+/// @param indent Indent of the block.
+/// @param marker List marker of the block. Empty string for paragraphs.
+/// @param style Base style of the block text.
+void MarkdownRenderer_OpenBlock(MarkdownRenderer *renderer, int indent, const char *marker, MarkdownStyle style)
+{
+    MarkdownRenderer_FlushBlock(renderer);
+
+    renderer->blockOpen = true;
+    renderer->blockSize = 0;
+    renderer->blockIndent = indent;
+    renderer->blockStyle = style;
+    snprintf(renderer->blockMarker, sizeof(renderer->blockMarker), "%s", marker);
+}
+
+/// @brief Classifies a source line.
+/// @param line Line to classify. Not null terminated, without the new line character.
+/// @param length Length of the line.
+/// @param inCodeBlock Whether the line is inside a fenced code block.
+/// @param contentStart Set to the offset of the line content after the block marker.
+/// @return Kind of the line.
+MarkdownLineKind MarkdownRenderer_ClassifyLine(const char *line, size_t length, bool inCodeBlock, size_t *contentStart)
+{
+    size_t start = 0;
+    while (start < length && line[start] == ' ')
+    {
+        start++;
+    }
+
+    *contentStart = start;
+
+    if (length - start >= 3 && strncmp(line + start, "```", 3) == 0)
+    {
+        return MarkdownLineKind_Fence;
+    }
+
+    if (inCodeBlock)
+    {
+        *contentStart = 0;
+        return MarkdownLineKind_Code;
+    }
+
+    if (start == length)
+    {
+        return MarkdownLineKind_Blank;
+    }
+
+    char first = line[start];
+
+    if (first == '#')
+    {
+        size_t hashes = start;
+        while (hashes < length && line[hashes] == '#')
+        {
+            hashes++;
+        }
+
+        if (hashes - start <= 6 && (hashes == length || line[hashes] == ' '))
+        {
+            *contentStart = hashes;
+            return MarkdownLineKind_Heading;
+        }
+    }
+
+    if (first == '-' || first == '*' || first == '_')
+    {
+        size_t markerCount = 0;
+        bool onlyMarkers = true;
+
+        for (size_t i = start; i < length; i++)
+        {
+            if (line[i] == first)
+            {
+                markerCount++;
+            }
+            else if (line[i] != ' ')
+            {
+                onlyMarkers = false;
+                break;
+            }
+        }
+
+        if (onlyMarkers && markerCount >= 3)
+        {
+            return MarkdownLineKind_Rule;
+        }
+    }
+
+    if ((first == '-' || first == '*' || first == '+') && start + 1 < length && line[start + 1] == ' ')
+    {
+        return MarkdownLineKind_ListItem;
+    }
+
+    size_t digits = start;
+    while (digits < length && isdigit((unsigned char)line[digits]))
+    {
+        digits++;
+    }
+
+    if (digits > start && digits - start < 10 && digits + 1 < length && (line[digits] == '.' || line[digits] == ')') && line[digits + 1] == ' ')
+    {
+        return MarkdownLineKind_ListItem;
+    }
+
+    return MarkdownLineKind_Paragraph;
+}
+
+/// @brief Lays out a single source line. Changes the open block and code block state.
+/// @param renderer Renderer to lay out the line in.
+/// @param line Line to lay out. Not null terminated, without the new line character.
+/// @param length Length of the line.
+/// @param kind Kind of the line.
+/// @param contentStart Offset of the line content after the block marker.
+/// @param inCodeBlock Code block state. Toggled by fence lines.
+void MarkdownRenderer_LayoutLine(MarkdownRenderer *renderer, const char *line, size_t length, MarkdownLineKind kind, size_t contentStart, bool *inCodeBlock)
+{
+    const char *content = line + contentStart;
+    size_t contentLength = length - contentStart;
+
+    while (contentLength > 0 && content[0] == ' ' && kind != MarkdownLineKind_Code)
+    {
+        content++;
+        contentLength--;
+    }
+
+    switch (kind)
+    {
+    case MarkdownLineKind_Fence:
+        MarkdownRenderer_FlushBlock(renderer);
+        *inCodeBlock = !*inCodeBlock;
+        break;
+
+    case MarkdownLineKind_Code:
+    {
+        size_t available = renderer->width - MARKDOWN_RENDERER_CODE_BLOCK_INDENT < 1 ? 1 : (size_t)(renderer->width - MARKDOWN_RENDERER_CODE_BLOCK_INDENT);
+        size_t position = 0;
+
+        do
+        {
+            size_t take = length - position > available ? available : length - position;
+            MarkdownRenderer_EmitLine(renderer, MARKDOWN_RENDERER_CODE_BLOCK_INDENT, line + position, NULL, MarkdownStyle_CodeBlock, (int)take);
+            position += take;
+        } while (position < length);
+        break;
+    }
+
+    case MarkdownLineKind_Blank:
+        MarkdownRenderer_FlushBlock(renderer);
+        if (renderer->lineCount > 0 && renderer->lines[renderer->lineCount - 1].length > 0)
+        {
+            MarkdownRenderer_EmitLine(renderer, 0, NULL, NULL, MarkdownStyle_Plain, 0);
+        }
+        break;
+
+    case MarkdownLineKind_Heading:
+        MarkdownRenderer_OpenBlock(renderer, 0, "", MarkdownStyle_Heading);
+        MarkdownRenderer_AppendBlockText(renderer, content, contentLength);
+        MarkdownRenderer_FlushBlock(renderer);
+        break;
+
+    case MarkdownLineKind_Rule:
+    {
+        MarkdownRenderer_FlushBlock(renderer);
+        char rule[MARKDOWN_RENDERER_MAX_LINE_WIDTH];
+        memset(rule, '-', sizeof(rule));
+        MarkdownRenderer_EmitLine(renderer, 0, rule, NULL, MarkdownStyle_Plain, renderer->width);
+        break;
+    }
+
+    case MarkdownLineKind_ListItem:
+    {
+        size_t markerEnd = contentStart;
+        while (markerEnd < length && line[markerEnd] != ' ')
+        {
+            markerEnd++;
+        }
+
+        char marker[MARKDOWN_RENDERER_MAX_MARKER_LENGTH];
+        if (line[contentStart] == '-' || line[contentStart] == '*' || line[contentStart] == '+')
+        {
+            snprintf(marker, sizeof(marker), "* ");
+        }
+        else
+        {
+            snprintf(marker, sizeof(marker), "%.*s ", (int)(markerEnd - contentStart), line + contentStart);
+        }
+
+        MarkdownRenderer_OpenBlock(renderer, (int)contentStart, marker, MarkdownStyle_Plain);
+        content = line + markerEnd;
+        contentLength = length - markerEnd;
+
+        while (contentLength > 0 && content[0] == ' ')
+        {
+            content++;
+            contentLength--;
+        }
+
+        MarkdownRenderer_AppendBlockText(renderer, content, contentLength);
+        break;
+    }
+
+    case MarkdownLineKind_Paragraph:
+    default:
+        if (!renderer->blockOpen)
+        {
+            MarkdownRenderer_OpenBlock(renderer, 0, "", MarkdownStyle_Plain);
+        }
+        MarkdownRenderer_AppendBlockText(renderer, content, contentLength);
+        break;
+    }
+}
+
+/// @brief Marks everything before the source offset as finished. Finished lines are never laid out again.
+/// @param renderer Renderer to commit.
+/// @param sourceOffset Source offset of the first unfinished line.
+/// @param inCodeBlock Code block state at the source offset.
+void MarkdownRenderer_Commit(MarkdownRenderer *renderer, size_t sourceOffset, bool inCodeBlock)
+{
+    renderer->tailSourceOffset = sourceOffset;
+    renderer->tailLineIndex = renderer->lineCount;
+    renderer->tailInCodeBlock = inCodeBlock;
+}
+
+/// @brief Lays out the source from the tail offset. Lines before the tail are kept as they are.
+/// @param renderer Renderer to lay out.
+void MarkdownRenderer_LayoutTail(MarkdownRenderer *renderer)
+{
+    renderer->lineCount = renderer->tailLineIndex;
+    renderer->blockOpen = false;
+    renderer->blockSize = 0;
+
+    if (renderer->firstDirtyLine > renderer->tailLineIndex)
+    {
+        renderer->firstDirtyLine = renderer->tailLineIndex;
+    }
+
+    size_t offset = renderer->tailSourceOffset;
+    bool inCodeBlock = renderer->tailInCodeBlock;
+
+    while (offset < renderer->sourceSize)
+    {
+        const char *line = renderer->source + offset;
+        const char *newLine = memchr(line, '\n', renderer->sourceSize - offset);
+        bool complete = newLine != NULL;
+        size_t length = complete ? (size_t)(newLine - line) : renderer->sourceSize - offset;
+        size_t nextOffset = offset + length + (complete ? 1 : 0);
+
+        if (length > 0 && line[length - 1] == '\r')
+        {
+            length--;
+        }
+
+        size_t contentStart = 0;
+        MarkdownLineKind kind = MarkdownRenderer_ClassifyLine(line, length, inCodeBlock, &contentStart);
+
+        // A complete line starting a new block finishes the open one, so it can be committed before this line.
+        if (complete && renderer->blockOpen && kind != MarkdownLineKind_Paragraph)
+        {
+            MarkdownRenderer_FlushBlock(renderer);
+            MarkdownRenderer_Commit(renderer, offset, inCodeBlock);
+        }
+
+        MarkdownRenderer_LayoutLine(renderer, line, length, kind, contentStart, &inCodeBlock);
+
+        offset = nextOffset;
+
+        if (complete && !renderer->blockOpen)
+        {
+            MarkdownRenderer_Commit(renderer, offset, inCodeBlock);
+        }
+    }
+
+    MarkdownRenderer_FlushBlock(renderer);
+}
+
+#pragma endregion Source Only
+
+MarkdownRenderer *MarkdownRenderer_Create(const string title, int width)
+{
+    DebugAssert(title != NULL, "Null pointer passed as parameter. Title cannot be NULL.");
+    DebugAssert(width > 0, "Invalid width %d passed. Width must be positive.", width);
+
+    MarkdownRenderer *renderer = (MarkdownRenderer *)calloc(1, sizeof(MarkdownRenderer));
+    DebugAssert(renderer != NULL, "Memory allocation failed for markdown renderer.");
+
+    renderer->title = StringDuplicate(title);
+    renderer->width = width > MARKDOWN_RENDERER_MAX_LINE_WIDTH ? MARKDOWN_RENDERER_MAX_LINE_WIDTH : width;
+
+    for (size_t i = 0; i < MARKDOWN_STYLE_COMBINATION_COUNT; i++)
+    {
+        renderer->attributeIds[i] = RENDERER_TEXT_ATTRIBUTE_ID_KOLPA;
+    }
+
+    MarkdownRenderer_Reserve((void **)&renderer->source, &renderer->sourceCapacity, MARKDOWN_RENDERER_INITIAL_SOURCE_CAPACITY, sizeof(char));
+    MarkdownRenderer_Reserve((void **)&renderer->lines, &renderer->lineCapacity, MARKDOWN_RENDERER_INITIAL_LINE_CAPACITY, sizeof(MarkdownLine));
+
+    DebugInfo("Markdown renderer '%s' created successfully with width %d.", renderer->title, renderer->width);
+    return renderer;
+}
+
+void MarkdownRenderer_Destroy(MarkdownRenderer *renderer)
+{
+    DebugAssert(renderer != NULL, "Null pointer passed as parameter. Markdown renderer cannot be NULL.");
+
+    char tempTitle[strlen(renderer->title) + 1];
+    strcpy(tempTitle, renderer->title);
+
+    free(renderer->title);
+    free(renderer->source);
+    free(renderer->lines);
+    free(renderer->blockText);
+    free(renderer->styledText);
+    free(renderer->styledStyles);
+    renderer->title = NULL;
+    renderer->source = NULL;
+    renderer->lines = NULL;
+    renderer->blockText = NULL;
+    renderer->styledText = NULL;
+    renderer->styledStyles = NULL;
+
+    free(renderer);
+    renderer = NULL;
+
+    DebugInfo("Markdown renderer '%s' destroyed successfully.", tempTitle);
+}
+
+void MarkdownRenderer_Append(MarkdownRenderer *renderer, const char *chunk, size_t chunkSize)
+{
+    DebugAssert(renderer != NULL, "Null pointer passed as parameter. Markdown renderer cannot be NULL.");
+    DebugAssert(chunk != NULL || chunkSize == 0, "Null pointer passed as parameter. Chunk cannot be NULL.");
+
+    if (chunkSize == 0)
+    {
+        return;
+    }
+
+    MarkdownRenderer_Reserve((void **)&renderer->source, &renderer->sourceCapacity, renderer->sourceSize + chunkSize, sizeof(char));
+    memcpy(renderer->source + renderer->sourceSize, chunk, chunkSize);
+    renderer->sourceSize += chunkSize;
+
+    MarkdownRenderer_LayoutTail(renderer);
+}
+
+void MarkdownRenderer_Clear(MarkdownRenderer *renderer)
+{
+    DebugAssert(renderer != NULL, "Null pointer passed as parameter. Markdown renderer cannot be NULL.");
+
+    renderer->sourceSize = 0;
+    renderer->lineCount = 0;
+    renderer->firstDirtyLine = 0;
+    MarkdownRenderer_Commit(renderer, 0, false);
+}
+
+void MarkdownRenderer_SetWidth(MarkdownRenderer *renderer, int width)
+{
+    DebugAssert(renderer != NULL, "Null pointer passed as parameter. Markdown renderer cannot be NULL.");
+    DebugAssert(width > 0, "Invalid width %d passed. Width must be positive.", width);
+
+    renderer->width = width > MARKDOWN_RENDERER_MAX_LINE_WIDTH ? MARKDOWN_RENDERER_MAX_LINE_WIDTH : width;
+    renderer->lineCount = 0;
+    renderer->firstDirtyLine = 0;
+    MarkdownRenderer_Commit(renderer, 0, false);
+    MarkdownRenderer_LayoutTail(renderer);
+
+    DebugInfo("Markdown renderer '%s' width set to %d.", renderer->title, renderer->width);
+}
+
+void MarkdownRenderer_Invalidate(MarkdownRenderer *renderer)
+{
+    DebugAssert(renderer != NULL, "Null pointer passed as parameter. Markdown renderer cannot be NULL.");
+
+    renderer->firstDirtyLine = 0;
+    renderer->drawnLineCount = 0;
+}
+
+void MarkdownRenderer_Draw(MarkdownRenderer *renderer, const RendererWindow *window, Vector2Int position)
+{
+    DebugAssert(renderer != NULL, "Null pointer passed as parameter. Markdown renderer cannot be NULL.");
+    DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
+
+    Vector2Int windowSize = RendererWindow_GetWindowSize(window);
+    int visibleRows = windowSize.y - position.y - 1;
+    int visibleColumns = windowSize.x - position.x - 1;
+
+    if (visibleRows <= 0 || visibleColumns <= 0)
+    {
+        DebugWarning("Markdown renderer '%s' has no space to draw in window.", renderer->title);
+        return;
+    }
+
+    size_t firstVisible = renderer->lineCount > (size_t)visibleRows ? renderer->lineCount - visibleRows : 0;
+
+    if (firstVisible != renderer->drawnFirstLine)
+    {
+        renderer->firstDirtyLine = 0;
+    }
+
+    size_t start = renderer->firstDirtyLine > firstVisible ? renderer->firstDirtyLine : firstVisible;
+    size_t end = renderer->lineCount;
+
+    if (renderer->drawnFirstLine + renderer->drawnLineCount > end)
+    {
+        end = renderer->drawnFirstLine + renderer->drawnLineCount;
+    }
+
+    if (end > firstVisible + visibleRows)
+    {
+        end = firstVisible + visibleRows;
+    }
+
+    int clearLength = renderer->width < visibleColumns ? renderer->width : visibleColumns;
+    char run[MARKDOWN_RENDERER_MAX_LINE_WIDTH + 1];
+
+    for (size_t i = start; i < end; i++)
+    {
+        Vector2Int rowPosition = NewVector2Int(position.x, position.y + (int)(i - firstVisible));
+        RendererWindow_DeleteRangeInPosition(window, rowPosition, clearLength);
+
+        if (i >= renderer->lineCount)
+        {
+            continue;
+        }
+
+        const MarkdownLine *line = &renderer->lines[i];
+        int runStart = 0;
+
+        while (runStart < line->length && runStart < clearLength)
+        {
+            int runEnd = runStart;
+            while (runEnd < line->length && runEnd < clearLength && line->styles[runEnd] == line->styles[runStart])
+            {
+                runEnd++;
+            }
+
+            memcpy(run, line->text + runStart, runEnd - runStart);
+            run[runEnd - runStart] = '\0';
+
+            RendererWindow_PutStringToPosition(window, NewVector2Int(rowPosition.x + runStart, rowPosition.y), MarkdownRenderer_GetAttribute(renderer, line->styles[runStart]), "%s", run);
+
+            runStart = runEnd;
+        }
+    }
+
+    size_t shownLines = renderer->lineCount - firstVisible;
+    renderer->drawnFirstLine = firstVisible;
+    renderer->drawnLineCount = shownLines < (size_t)visibleRows ? shownLines : (size_t)visibleRows;
+    renderer->firstDirtyLine = renderer->lineCount;
+}
+
+size_t MarkdownRenderer_GetLineCount(const MarkdownRenderer *renderer)
+{
+    DebugAssert(renderer != NULL, "Null pointer passed as parameter. Markdown renderer cannot be NULL.");
+
+    return renderer->lineCount;
+}
@@ -1 +1,344 @@
-#include <UIX/WindowExplorer.h>
+#include "UIX/WindowExplorer.h"
+
+#pragma region Source Only
+
+/// @brief Kind of a layout node. Leaves hold a window, splits divide their area between two children.
+typedef enum WindowExplorerSplit
+{
+    WindowExplorerSplit_None,       // Leaf pane holding a window.
+    WindowExplorerSplit_Horizontal, // Children side by side.
+    WindowExplorerSplit_Vertical    // Children on top of each other.
+} WindowExplorerSplit;
+
+typedef struct WindowExplorerNode
+{
+    WindowExplorerSplit split;
+    float ratio; // Share of the first child in a split.
+
+    RendererWindow *window; // Leaves only.
+    Vector2Int appliedPosition;
+    Vector2Int appliedSize; // Geometry last set to the window, unchanged windows are skipped on relayout.
+
+    Vector2Int position;
+    Vector2Int size;
+
+    struct WindowExplorerNode *parent;
+    struct WindowExplorerNode *first;
+    struct WindowExplorerNode *second;
+} WindowExplorerNode;
+
+WindowExplorerNode *WINDOW_EXPLORER_ROOT = NULL;
+WindowExplorerNode *WINDOW_EXPLORER_FOCUS = NULL;
+
+/// @brief Creates a leaf node for the window.
+/// @param window Window of the leaf.
+/// @return The created node.
+WindowExplorerNode *WindowExplorerNode_CreateLeaf(RendererWindow *window)
+{
+    WindowExplorerNode *node = (WindowExplorerNode *)calloc(1, sizeof(WindowExplorerNode));
+    DebugAssert(node != NULL, "Memory allocation failed for window explorer node.");
+
+    node->split = WindowExplorerSplit_None;
+    node->ratio = 0.5f;
+    node->window = window;
+    node->appliedPosition = NewVector2Int(-1, -1);
+    node->appliedSize = NewVector2Int(-1, -1);
+
+    return node;
+}
+
+/// @brief Destroys the node and all of its children.
+/// @param node Node to destroy.
+void WindowExplorerNode_Destroy(WindowExplorerNode *node)
+{
+    if (node == NULL)
+    {
+        return;
+    }
+
+    WindowExplorerNode_Destroy(node->first);
+    WindowExplorerNode_Destroy(node->second);
+    free(node);
+}
+
+/// @brief Finds the leaf of the window.
+/// @param node Node to search in.
+/// @param window Window to find.
+/// @return The leaf or NULL if the window is not in the layout.
+WindowExplorerNode *WindowExplorerNode_Find(WindowExplorerNode *node, const RendererWindow *window)
+{
+    if (node == NULL)
+    {
+        return NULL;
+    }
+
+    if (node->split == WindowExplorerSplit_None)
+    {
+        return node->window == window ? node : NULL;
+    }
+
+    WindowExplorerNode *found = WindowExplorerNode_Find(node->first, window);
+    return found != NULL ? found : WindowExplorerNode_Find(node->second, window);
+}
+
+/// @brief Computes the geometry of the node and its children. Only arithmetic, windows are not touched.
+/// @param node Node to lay out.
+/// @param position Position of the node area.
+/// @param size Size of the node area.
+void WindowExplorerNode_Layout(WindowExplorerNode *node, Vector2Int position, Vector2Int size)
+{
+    node->position = position;
+    node->size = size;
+
+    if (node->split == WindowExplorerSplit_None)
+    {
+        return;
+    }
+
+    bool horizontal = node->split == WindowExplorerSplit_Horizontal;
+    int total = horizontal ? size.x : size.y;
+
+    // Both children keep at least a cell. On a screen too small to split, they overlap instead of getting empty.
+    int firstLength = total;
+    int secondOffset = 0;
+    if (total > 1)
+    {
+        firstLength = (int)((float)total * node->ratio + 0.5f);
+        firstLength = firstLength < 1 ? 1 : (firstLength > total - 1 ? total - 1 : firstLength);
+        secondOffset = firstLength;
+    }
+
+    int secondLength = total - secondOffset;
+
+    if (horizontal)
+    {
+        WindowExplorerNode_Layout(node->first, position, NewVector2Int(firstLength, size.y));
+        WindowExplorerNode_Layout(node->second, NewVector2Int(position.x + secondOffset, position.y), NewVector2Int(secondLength, size.y));
+    }
+    else
+    {
+        WindowExplorerNode_Layout(node->first, position, NewVector2Int(size.x, firstLength));
+        WindowExplorerNode_Layout(node->second, NewVector2Int(position.x, position.y + secondOffset), NewVector2Int(size.x, secondLength));
+    }
+}
+
+/// @brief Sets the computed geometry to the windows of the changed leaves.
+/// @param node Node to apply.
+/// @param refresh If false, only the geometry is set. If true, changed windows are refreshed and marked as applied.
+void WindowExplorerNode_Apply(WindowExplorerNode *node, bool refresh)
+{
+    if (node == NULL)
+    {
+        return;
+    }
+
+    if (node->split != WindowExplorerSplit_None)
+    {
+        WindowExplorerNode_Apply(node->first, refresh);
+        WindowExplorerNode_Apply(node->second, refresh);
+        return;
+    }
+
+    if (node->appliedPosition.x == node->position.x && node->appliedPosition.y == node->position.y &&
+        node->appliedSize.x == node->size.x && node->appliedSize.y == node->size.y)
+    {
+        return;
+    }
+
+    if (!refresh)
+    {
+        RendererWindow_SetGeometry(node->window, node->position, node->size);
+        return;
+    }
+
+    RendererWindow_UpdateContent(node->window);
+    node->appliedPosition = node->position;
+    node->appliedSize = node->size;
+}
+
+/// @brief Splits the focused pane and places the window in the second half.
+/// @param window Window to place.
+/// @param split Direction of the split. Not used for the first window, it fills the screen.
+void WindowExplorer_SplitFocus(RendererWindow *window, WindowExplorerSplit split)
+{
+    DebugAssert(window != NULL, "Null pointer passed as parameter. Window cannot be NULL.");
+    DebugAssert(WindowExplorerNode_Find(WINDOW_EXPLORER_ROOT, window) == NULL, "Window is already in the layout.");
+
+    WindowExplorerNode *leaf = WindowExplorerNode_CreateLeaf(window);
+
+    if (WINDOW_EXPLORER_FOCUS == NULL)
+    {
+        WINDOW_EXPLORER_ROOT = leaf;
+        WINDOW_EXPLORER_FOCUS = leaf;
+        WindowExplorer_Relayout();
+        return;
+    }
+
+    // The focused leaf becomes a split, its window moves to a new first child so parent links stay valid.
+    WindowExplorerNode *focus = WINDOW_EXPLORER_FOCUS;
+    WindowExplorerNode *moved = WindowExplorerNode_CreateLeaf(focus->window);
+    moved->appliedPosition = focus->appliedPosition;
+    moved->appliedSize = focus->appliedSize;
+
+    focus->split = split;
+    focus->ratio = 0.5f;
+    focus->window = NULL;
+    focus->first = moved;
+    focus->second = leaf;
+    moved->parent = focus;
+    leaf->parent = focus;
+
+    WINDOW_EXPLORER_FOCUS = leaf;
+    WindowExplorer_Relayout();
+}
+
+#pragma endregion Source Only
+
+void WindowExplorer_Initialize()
+{
+    WINDOW_EXPLORER_ROOT = NULL;
+    WINDOW_EXPLORER_FOCUS = NULL;
+
+    RendererManager_SetResizeCallback(WindowExplorer_Relayout);
+
+    DebugInfo("Window explorer initialized successfully.");
+}
+
+void WindowExplorer_Terminate()
+{
+    RendererManager_SetResizeCallback(NULL);
+
+    WindowExplorerNode_Destroy(WINDOW_EXPLORER_ROOT);
+    WINDOW_EXPLORER_ROOT = NULL;
+    WINDOW_EXPLORER_FOCUS = NULL;
+
+    DebugInfo("Window explorer terminated successfully.");
+}
+
+void WindowExplorer_AddWindow(RendererWindow *window)
+{
+    if (WINDOW_EXPLORER_FOCUS == NULL)
+    {
+        WindowExplorer_SplitFocus(window, WindowExplorerSplit_None);
+        return;
+    }
+
+    // Terminal cells are about twice as tall as wide, so a pane twice as wide as tall looks square.
+    Vector2Int size = WINDOW_EXPLORER_FOCUS->size;
+    WindowExplorer_SplitFocus(window, size.x >= size.y * 2 ? WindowExplorerSplit_Horizontal : WindowExplorerSplit_Vertical);
+}
+
+void WindowExplorer_RemoveWindow(RendererWindow *window)
+{
+    WindowExplorerNode *leaf = WindowExplorerNode_Find(WINDOW_EXPLORER_ROOT, window);
+    if (leaf == NULL)
+    {
+        DebugWarning("Window is not in the layout.");
+        return;
+    }
+
+    WindowExplorerNode *parent = leaf->parent;
+
+    if (parent == NULL)
+    {
+        free(leaf);
+        WINDOW_EXPLORER_ROOT = NULL;
+        WINDOW_EXPLORER_FOCUS = NULL;
+        return;
+    }
+
+    // The sibling takes the place of the parent split.
+    WindowExplorerNode *sibling = parent->first == leaf ? parent->second : parent->first;
+    WindowExplorerNode *grandParent = parent->parent;
+
+    sibling->parent = grandParent;
+    if (grandParent == NULL)
+    {
+        WINDOW_EXPLORER_ROOT = sibling;
+    }
+    else if (grandParent->first == parent)
+    {
+        grandParent->first = sibling;
+    }
+    else
+    {
+        grandParent->second = sibling;
+    }
+
+    if (WINDOW_EXPLORER_FOCUS == leaf)
+    {
+        WindowExplorerNode *focus = sibling;
+        while (focus->split != WindowExplorerSplit_None)
+        {
+            focus = focus->first;
+        }
+
+        WINDOW_EXPLORER_FOCUS = focus;
+    }
+
+    free(leaf);
+    free(parent);
+
+    WindowExplorer_Relayout();
+}
+
+void WindowExplorer_SetFocus(RendererWindow *window)
+{
+    WindowExplorerNode *leaf = WindowExplorerNode_Find(WINDOW_EXPLORER_ROOT, window);
+    if (leaf == NULL)
+    {
+        DebugWarning("Window is not in the layout.");
+        return;
+    }
+
+    WINDOW_EXPLORER_FOCUS = leaf;
+}
+
+RendererWindow *WindowExplorer_GetFocus()
+{
+    return WINDOW_EXPLORER_FOCUS != NULL ? WINDOW_EXPLORER_FOCUS->window : NULL;
+}
+
+void WindowExplorer_SplitHorizontal(RendererWindow *window)
+{
+    WindowExplorer_SplitFocus(window, WindowExplorerSplit_Horizontal);
+}
+
+void WindowExplorer_SplitVertical(RendererWindow *window)
+{
+    WindowExplorer_SplitFocus(window, WindowExplorerSplit_Vertical);
+}
+
+void WindowExplorer_SetSplitRatio(RendererWindow *window, float ratio)
+{
+    DebugAssert(ratio > 0.0f && ratio < 1.0f, "Invalid split ratio %f passed.", ratio);
+
+    WindowExplorerNode *leaf = WindowExplorerNode_Find(WINDOW_EXPLORER_ROOT, window);
+    if (leaf == NULL)
+    {
+        DebugWarning("Window is not in the layout.");
+        return;
+    }
+
+    if (leaf->parent == NULL)
+    {
+        return;
+    }
+
+    leaf->parent->ratio = leaf->parent->first == leaf ? ratio : 1.0f - ratio;
+    WindowExplorer_Relayout();
+}
+
+void WindowExplorer_Relayout()
+{
+    if (WINDOW_EXPLORER_ROOT == NULL)
+    {
+        return;
+    }
+
+    WindowExplorerNode_Layout(WINDOW_EXPLORER_ROOT, NewVector2Int(0, 0), RendererWindow_GetWindowSize(RENDERER_MAIN_WINDOW));
+
+    // Every window gets its geometry before any is refreshed, so no window is drawn over a neighbour that has not moved yet.
+    WindowExplorerNode_Apply(WINDOW_EXPLORER_ROOT, false);
+    WindowExplorerNode_Apply(WINDOW_EXPLORER_ROOT, true);
+}
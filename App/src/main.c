@@ -1,5 +1,6 @@
 #include "App.h"
 #include "Core.h"
+#include "Modules.h"
 
 int main()
 {
@@ -12,6 +13,8 @@ int main()
     // SPI path : /dev/spidev2
     // GPIOChip *myChip = GPIOChip_Create("/dev/gpiochip8");
     // GPIOPin *myPin = GPIOPin_ConsumeAsOutput(myChip, 9, "Servo Signal", ACTIVE_LOW, LOW);
+    // SPIDevice *mySensor = SPIDevice_Open("/dev/spidev2.0", SPIMode_0, 1000000, 8);
+    // I2CBus *myBus = I2CBus_Open("/dev/i2c-1");
 
     // DebugInfo("Starting application...");
     // DebugWarning("This is a warning message, please check the application logs for more details.");
@@ -19,6 +22,14 @@ int main()
     // DebugAssert(true, "This is an assertion message, please check the application logs for more details.");
     // DebugAssert(false, "This assertion should fail, please check the application logs for more details.");
 
+#if !PLATFORM_WINDOWS
+    const char *renderer = getenv("CODE_CHARLIE_RENDERER");
+    if (renderer != NULL && strcmp(renderer, "ansi") == 0)
+    {
+        RendererManager_SelectBackend(RendererBackend_GetAnsi());
+    }
+#endif
+
     Core_Run(App_Start, App_StartLate, App_Update, App_UpdateLate);
 
     return 0;
@@ -0,0 +1,275 @@
+#include "Core.h"
+
+#include "AI/AIManager.h"
+#include "AI/AIMockServer.h"
+#include "AI/AIProvider.h"
+#include "Modules/NetworkManager.h"
+#include "Utils/Timer.h"
+#include "Utils/cJSON.h"
+
+// Measures the AIChat pipeline offline against AIMockServer replaying recorded OpenAI responses: the provider parsing alone, then whole
+// and streamed answers end to end over the loopback interface, unpaced and at the latency and pace of a remote model. Failed requests
+// are checked too: error statuses and cut streams must give no answer and count as failed.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./AIChatBenchmark [answer length] [requests]
+
+#define AI_CHAT_BENCHMARK_DEFAULT_ANSWER_LENGTH 2048
+#define AI_CHAT_BENCHMARK_MAXIMUM_ANSWER_LENGTH 1048576
+#define AI_CHAT_BENCHMARK_DEFAULT_REQUESTS 200
+#define AI_CHAT_BENCHMARK_PARSE_ROUNDS 2000
+#define AI_CHAT_BENCHMARK_TOKEN_LENGTH 4             // characters of the answer per streamed event
+#define AI_CHAT_BENCHMARK_PACED_REQUESTS 5           // requests of the paced scenarios, they take the latency each
+#define AI_CHAT_BENCHMARK_LATENCY 200000000          // nanoseconds before the first byte of a paced response
+#define AI_CHAT_BENCHMARK_BYTES_PER_SECOND 100000    // pace of a paced response
+#define AI_CHAT_BENCHMARK_CHUNK_SIZE 256             // bytes per write of a paced response
+
+/// @brief Result of a benchmark scenario.
+typedef struct AIChatBenchmarkResult
+{
+    const char *title;
+    const char *method;
+    size_t runs;
+    size_t failures;
+    time_t nanoseconds;          // all of the runs
+    time_t firstTextNanoseconds; // all of the runs, 0 when not measured
+} AIChatBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile char benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+void AIChatBenchmark_Print(const AIChatBenchmarkResult *result)
+{
+    double perRun = (double)result->nanoseconds / (double)result->runs;
+
+    printf("%-10s %-10s %6zu %6zu %14.1f %14.1f %12.1f\n",
+           result->title,
+           result->method,
+           result->runs,
+           result->failures,
+           perRun / 1000.0,
+           (double)result->firstTextNanoseconds / (double)result->runs / 1000.0,
+           perRun > 0.0 ? 1e9 / perRun : 0.0);
+}
+
+/// @brief Builds an answer of markdown lines, with quotes and new lines to escape.
+stringHeap AIChatBenchmark_CreateAnswer(size_t length)
+{
+    const char *line = "- The \"sensor\" reads **21.5 C** at the door,\tthe fan runs at `40%`.\n";
+    size_t lineLength = strlen(line);
+
+    stringHeap answer = (stringHeap)malloc(length + 1);
+    for (size_t i = 0; i < length; i++)
+    {
+        answer[i] = line[i % lineLength];
+    }
+    answer[length] = '\0';
+
+    return answer;
+}
+
+/// @brief Records a whole OpenAI response of an answer.
+stringHeap AIChatBenchmark_RecordResponse(const char *answer)
+{
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddStringToObject(json, "id", "chatcmpl-mock");
+    cJSON_AddStringToObject(json, "object", "chat.completion");
+
+    cJSON *choice = cJSON_CreateObject();
+    cJSON_AddNumberToObject(choice, "index", 0);
+    cJSON *message = cJSON_AddObjectToObject(choice, "message");
+    cJSON_AddStringToObject(message, "role", "assistant");
+    cJSON_AddStringToObject(message, "content", answer);
+    cJSON_AddStringToObject(choice, "finish_reason", "stop");
+    cJSON_AddItemToArray(cJSON_AddArrayToObject(json, "choices"), choice);
+
+    stringHeap body = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+
+    return body;
+}
+
+/// @brief Records a streamed OpenAI response of an answer, an event per few characters as models stream tokens.
+stringHeap AIChatBenchmark_RecordStream(const char *answer)
+{
+    size_t answerLength = strlen(answer);
+    size_t capacity = 256 + answerLength * 32;
+    size_t length = 0;
+    stringHeap body = (stringHeap)malloc(capacity);
+
+    for (size_t i = 0; i < answerLength; i += AI_CHAT_BENCHMARK_TOKEN_LENGTH)
+    {
+        char token[AI_CHAT_BENCHMARK_TOKEN_LENGTH + 1] = {0};
+        strncpy(token, answer + i, AI_CHAT_BENCHMARK_TOKEN_LENGTH);
+
+        cJSON *json = cJSON_CreateObject();
+        cJSON *choice = cJSON_CreateObject();
+        cJSON_AddNumberToObject(choice, "index", 0);
+        cJSON_AddStringToObject(cJSON_AddObjectToObject(choice, "delta"), "content", token);
+        cJSON_AddItemToArray(cJSON_AddArrayToObject(json, "choices"), choice);
+
+        stringHeap event = cJSON_PrintUnformatted(json);
+        length += (size_t)snprintf(body + length, capacity - length, "data: %s\n\n", event);
+        free(event);
+        cJSON_Delete(json);
+    }
+    snprintf(body + length, capacity - length, "data: [DONE]\n\n");
+
+    return body;
+}
+
+/// @brief Measures the provider parsing alone, without network.
+void AIChatBenchmark_RunParsing(const char *answer, const char *response, const char *stream)
+{
+    size_t failures = 0;
+    Timer timer = Timer_CreateStack("Parse");
+    Timer_Start(&timer);
+    for (size_t i = 0; i < AI_CHAT_BENCHMARK_PARSE_ROUNDS; i++)
+    {
+        stringHeap text = AI_PROVIDER_OPENAI.parseResponse((string)response, strlen(response));
+        failures += text == NULL || strcmp(text, answer) != 0;
+        benchmarkSink = text != NULL ? text[0] : 0;
+        free(text);
+    }
+    Timer_Stop(&timer);
+    AIChatBenchmarkResult whole = {"Parse", "Whole", AI_CHAT_BENCHMARK_PARSE_ROUNDS, failures, Timer_GetElapsedNanoseconds(&timer), 0};
+    AIChatBenchmark_Print(&whole);
+
+    // Fed in chunks of a network read, which split the events anywhere
+    size_t streamLength = strlen(stream);
+    failures = 0;
+    timer = Timer_CreateStack("Parse stream");
+    Timer_Start(&timer);
+    for (size_t i = 0; i < AI_CHAT_BENCHMARK_PARSE_ROUNDS; i++)
+    {
+        AIProviderStream *providerStream = AIProviderStream_Create(&AI_PROVIDER_OPENAI);
+        for (size_t offset = 0; offset < streamLength; offset += AI_CHAT_BENCHMARK_CHUNK_SIZE)
+        {
+            size_t size = streamLength - offset < AI_CHAT_BENCHMARK_CHUNK_SIZE ? streamLength - offset : AI_CHAT_BENCHMARK_CHUNK_SIZE;
+            AIProviderStream_Feed(providerStream, stream + offset, size);
+        }
+
+        const char *text = AIProviderStream_GetText(providerStream, NULL);
+        failures += !AIProviderStream_IsDone(providerStream) || strcmp(text, answer) != 0;
+        benchmarkSink = text[0];
+        AIProviderStream_Destroy(providerStream);
+    }
+    Timer_Stop(&timer);
+    AIChatBenchmarkResult streamed = {"Parse", "Streamed", AI_CHAT_BENCHMARK_PARSE_ROUNDS, failures, Timer_GetElapsedNanoseconds(&timer), 0};
+    AIChatBenchmark_Print(&streamed);
+}
+
+/// @brief Measures requests end to end against a mock server replaying a response.
+void AIChatBenchmark_RunRequests(const char *title, const char *answer, const char *response, bool isStreaming, AIMockServerSettings settings, size_t requests)
+{
+    AIMockServer *server = AIMockServer_Create(settings);
+    AIMockServer_AddResponse(server, 200, (string)response);
+    if (!AIMockServer_Start(server))
+    {
+        printf("Failed to start the mock server\n");
+        AIMockServer_Destroy(server);
+        return;
+    }
+
+    AIChat *chat = AIChat_CreateWithProvider("Benchmark", "mock-model", (string)AIMockServer_GetUrl(server), "mock-key", NULL, &AI_PROVIDER_OPENAI, isStreaming);
+
+    AIChatBenchmarkResult result = {title, isStreaming ? "Streamed" : "Whole", requests, 0, 0, 0};
+    for (size_t i = 0; i < requests; i++)
+    {
+        // A single turn each, the growth of the conversation is measured by AIConversationBenchmark
+        AIChat_ClearHistory(chat);
+        stringHeap text = AIChat_SendAndReceive(chat, "How warm is it at the door?");
+        result.failures += text == NULL || strcmp(text, answer) != 0;
+        benchmarkSink = text != NULL ? text[0] : 0;
+        free(text);
+
+        AIChatStatistics statistics = AIChat_GetStatistics(chat);
+        result.nanoseconds += statistics.totalNanoseconds;
+        result.firstTextNanoseconds += statistics.firstTextNanoseconds;
+    }
+    AIChatBenchmark_Print(&result);
+
+    AIChat_Destroy(chat);
+    AIMockServer_Destroy(server);
+}
+
+/// @brief Checks that requests failing in every way give no answer and count as failed, then that the chat answers again.
+/// A failure of the scenario is a failed request taken as an answer, or an answer after them missing.
+void AIChatBenchmark_RunFailures(const char *answer, const char *stream)
+{
+    const char *errorBody = "{\"error\":{\"message\":\"Rate limit reached\",\"type\":\"requests\",\"code\":\"rate_limit_exceeded\"}}";
+    const char *cutStream = "data: {\"choices\":[{\"index\":0,\"delta\":{\"content\":\"The sensor\"}}]}\n\n";
+    const char *emptyStream = "data: [DONE]\n\n";
+
+    AIMockServerSettings unpaced = {0, 0, 0};
+    AIMockServer *server = AIMockServer_Create(unpaced);
+    AIMockServer_AddResponse(server, 429, (string)errorBody);
+    AIMockServer_AddResponse(server, 500, (string)stream); // an error status fails even with an answer in the body
+    AIMockServer_AddResponse(server, 200, (string)cutStream);
+    AIMockServer_AddResponse(server, 200, (string)emptyStream);
+    AIMockServer_AddResponse(server, 200, (string)stream);
+    if (!AIMockServer_Start(server))
+    {
+        printf("Failed to start the mock server\n");
+        AIMockServer_Destroy(server);
+        return;
+    }
+
+    AIChat *chat = AIChat_CreateWithProvider("Benchmark", "mock-model", (string)AIMockServer_GetUrl(server), "mock-key", NULL, &AI_PROVIDER_OPENAI, true);
+
+    size_t failingRequests = 4;
+    AIChatBenchmarkResult result = {"Failing", "Streamed", failingRequests + 1, 0, 0, 0};
+    for (size_t i = 0; i < failingRequests; i++)
+    {
+        stringHeap text = AIChat_SendAndReceive(chat, "How warm is it at the door?");
+        result.failures += text != NULL || AIChat_GetStatistics(chat).failedCount != i + 1;
+        free(text);
+        result.nanoseconds += AIChat_GetStatistics(chat).totalNanoseconds;
+    }
+
+    // The failed messages were taken back, so the same message is sent as the first of the conversation
+    stringHeap text = AIChat_SendAndReceive(chat, "How warm is it at the door?");
+    result.failures += text == NULL || strcmp(text, answer) != 0 || AIChat_GetStatistics(chat).failedCount != failingRequests;
+    free(text);
+    result.nanoseconds += AIChat_GetStatistics(chat).totalNanoseconds;
+    AIChatBenchmark_Print(&result);
+
+    AIChat_Destroy(chat);
+    AIMockServer_Destroy(server);
+}
+
+int main(int argc, char **argv)
+{
+    int answerLength = argc > 1 ? atoi(argv[1]) : AI_CHAT_BENCHMARK_DEFAULT_ANSWER_LENGTH;
+    int requests = argc > 2 ? atoi(argv[2]) : AI_CHAT_BENCHMARK_DEFAULT_REQUESTS;
+    answerLength = answerLength > 0 && answerLength <= AI_CHAT_BENCHMARK_MAXIMUM_ANSWER_LENGTH ? answerLength : AI_CHAT_BENCHMARK_DEFAULT_ANSWER_LENGTH;
+    requests = requests > 0 ? requests : AI_CHAT_BENCHMARK_DEFAULT_REQUESTS;
+
+    NetworkManager_Initialize();
+
+    stringHeap answer = AIChatBenchmark_CreateAnswer((size_t)answerLength);
+    stringHeap response = AIChatBenchmark_RecordResponse(answer);
+    stringHeap stream = AIChatBenchmark_RecordStream(answer);
+
+    printf("AIChat benchmark, %d characters per answer, %zu bytes whole, %zu bytes streamed\n", answerLength, strlen(response), strlen(stream));
+    printf("%-10s %-10s %6s %6s %14s %14s %12s\n", "Scenario", "Method", "Runs", "Failed", "Time (us)", "First (us)", "Per second");
+
+    AIChatBenchmark_RunParsing(answer, response, stream);
+
+    AIMockServerSettings unpaced = {0, 0, 0};
+    AIChatBenchmark_RunRequests("Loopback", answer, response, false, unpaced, (size_t)requests);
+    AIChatBenchmark_RunRequests("Loopback", answer, stream, true, unpaced, (size_t)requests);
+
+    AIMockServerSettings paced = {AI_CHAT_BENCHMARK_LATENCY, AI_CHAT_BENCHMARK_BYTES_PER_SECOND, AI_CHAT_BENCHMARK_CHUNK_SIZE};
+    AIChatBenchmark_RunRequests("Paced", answer, response, false, paced, AI_CHAT_BENCHMARK_PACED_REQUESTS);
+    AIChatBenchmark_RunRequests("Paced", answer, stream, true, paced, AI_CHAT_BENCHMARK_PACED_REQUESTS);
+
+    AIChatBenchmark_RunFailures(answer, stream);
+
+    free(stream);
+    free(response);
+    free(answer);
+
+    NetworkManager_Terminate();
+
+    return 0;
+}
@@ -0,0 +1,278 @@
+#include "Core.h"
+
+#include "AI/AIConversation.h"
+#include "AI/AIProvider.h"
+#include "Utils/Timer.h"
+#include "Utils/cJSON.h"
+
+#include <stdint.h>
+
+// Measures building the requests of a growing conversation: the whole history written again every turn with cJSON and with the
+// provider, against AIConversation writing each message once. Then the cost of keeping a conversation within a token budget,
+// and the speed of the token estimate.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./AIConversationBenchmark [turns] [answer length]
+
+#define AI_CONVERSATION_BENCHMARK_DEFAULT_TURNS 200
+#define AI_CONVERSATION_BENCHMARK_MAXIMUM_TURNS 100000
+#define AI_CONVERSATION_BENCHMARK_DEFAULT_ANSWER_LENGTH 1024
+#define AI_CONVERSATION_BENCHMARK_MAXIMUM_ANSWER_LENGTH 65536
+#define AI_CONVERSATION_BENCHMARK_ESTIMATE_ROUNDS 200
+#define AI_CONVERSATION_BENCHMARK_SYSTEM_PROMPT "You are the assistant of a greenhouse controller. Answer shortly, with \"units\" on every value."
+
+/// @brief Result of a benchmark scenario.
+typedef struct AIConversationBenchmarkResult
+{
+    const char *title;
+    const char *method;
+    size_t turns;
+    size_t messages;    // sent with the last request, the system prompt and the summary included
+    size_t tokens;      // estimated, of the last request
+    size_t bytes;       // of the last request
+    size_t totalBytes;  // of all of the requests
+    time_t nanoseconds; // all of the turns
+    const char *same;   // if the requests match the ones of the reference method
+} AIConversationBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile char benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+void AIConversationBenchmark_Print(const AIConversationBenchmarkResult *result)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-12s %-12s %6zu %8zu %8zu %10zu %14.2f %10.1f %5s\n",
+           result->title,
+           result->method,
+           result->turns,
+           result->messages,
+           result->tokens,
+           result->bytes,
+           (double)result->nanoseconds / (double)result->turns / 1000.0,
+           seconds > 0.0 ? (double)result->totalBytes / seconds / 1e6 : 0.0,
+           result->same);
+}
+
+/// @brief Builds the text of a turn, markdown lines with quotes and new lines to escape, different for every turn.
+stringHeap AIConversationBenchmark_CreateText(size_t turn, size_t length)
+{
+    const char *line = "- Turn %zu: the \"sensor\" reads **21.5 C** at the door,\tthe fan runs at `40%%`.\n";
+
+    stringHeap text = (stringHeap)malloc(length + 1);
+    size_t written = 0;
+    while (written < length)
+    {
+        char formatted[128];
+        int formattedLength = snprintf(formatted, sizeof(formatted), line, turn);
+        size_t copied = length - written < (size_t)formattedLength ? length - written : (size_t)formattedLength;
+        memcpy(text + written, formatted, copied);
+        written += copied;
+    }
+    text[length] = '\0';
+
+    return text;
+}
+
+/// @brief Writes every request of the conversation with cJSON, the whole history every turn.
+AIConversationBenchmarkResult AIConversationBenchmark_RunCJSON(stringHeap *questions, stringHeap *answers, size_t turns)
+{
+    AIConversationBenchmarkResult result = {"Unbounded", "cJSON", turns, 0, 0, 0, 0, 0, "-"};
+
+    Timer timer = Timer_CreateStack("cJSON");
+    Timer_Start(&timer);
+    for (size_t turn = 0; turn < turns; turn++)
+    {
+        cJSON *json = cJSON_CreateObject();
+        cJSON_AddStringToObject(json, "model", "mock-model");
+        cJSON *messages = cJSON_AddArrayToObject(json, "messages");
+
+        cJSON *system = cJSON_CreateObject();
+        cJSON_AddStringToObject(system, "role", "system");
+        cJSON_AddStringToObject(system, "content", AI_CONVERSATION_BENCHMARK_SYSTEM_PROMPT);
+        cJSON_AddItemToArray(messages, system);
+
+        for (size_t i = 0; i <= turn; i++)
+        {
+            cJSON *question = cJSON_CreateObject();
+            cJSON_AddStringToObject(question, "role", "user");
+            cJSON_AddStringToObject(question, "content", questions[i]);
+            cJSON_AddItemToArray(messages, question);
+
+            if (i < turn)
+            {
+                cJSON *answer = cJSON_CreateObject();
+                cJSON_AddStringToObject(answer, "role", "assistant");
+                cJSON_AddStringToObject(answer, "content", answers[i]);
+                cJSON_AddItemToArray(messages, answer);
+            }
+        }
+
+        stringHeap body = cJSON_PrintUnformatted(json);
+        result.bytes = strlen(body);
+        result.totalBytes += result.bytes;
+        result.messages = (size_t)cJSON_GetArraySize(messages);
+        benchmarkSink = body[result.bytes / 2];
+
+        free(body);
+        cJSON_Delete(json);
+    }
+    Timer_Stop(&timer);
+    result.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    return result;
+}
+
+/// @brief Writes every request of the conversation with the provider, the whole history every turn.
+/// @param lastBody Pointer to write the last request to, allocated on the heap.
+AIConversationBenchmarkResult AIConversationBenchmark_RunRebuild(stringHeap *questions, stringHeap *answers, size_t turns, stringHeap *lastBody)
+{
+    AIConversationBenchmarkResult result = {"Unbounded", "Rebuild", turns, 0, 0, 0, 0, 0, "-"};
+    AIMessage *messages = (AIMessage *)malloc((2 * turns + 1) * sizeof(AIMessage));
+    messages[0] = (AIMessage){"system", AI_CONVERSATION_BENCHMARK_SYSTEM_PROMPT};
+
+    *lastBody = NULL;
+    Timer timer = Timer_CreateStack("Rebuild");
+    Timer_Start(&timer);
+    for (size_t turn = 0; turn < turns; turn++)
+    {
+        size_t count = 1;
+        for (size_t i = 0; i <= turn; i++)
+        {
+            messages[count++] = (AIMessage){"user", questions[i]};
+            if (i < turn)
+            {
+                messages[count++] = (AIMessage){"assistant", answers[i]};
+            }
+        }
+
+        size_t size;
+        stringHeap body = AIProvider_BuildRequest(&AI_PROVIDER_OPENAI, "mock-model", messages, count, false, &size);
+        result.bytes = size;
+        result.totalBytes += size;
+        result.messages = count;
+        benchmarkSink = body[size / 2];
+
+        free(*lastBody);
+        *lastBody = body;
+    }
+    Timer_Stop(&timer);
+    result.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    free(messages);
+    return result;
+}
+
+/// @brief Writes every request of the conversation with AIConversation, the answer of a turn appended after its request.
+/// @param reference The last request of the rebuild method, to compare with. Can be NULL.
+AIConversationBenchmarkResult AIConversationBenchmark_RunConversation(const char *title, stringHeap *questions, stringHeap *answers, size_t turns,
+                                                                      size_t tokenBudget, size_t summaryTokenBudget, const char *reference)
+{
+    AIConversationBenchmarkResult result = {title, "Conversation", turns, 0, 0, 0, 0, 0, "-"};
+    AIConversation *conversation = AIConversation_Create(&AI_PROVIDER_OPENAI, AI_CONVERSATION_BENCHMARK_SYSTEM_PROMPT, tokenBudget, summaryTokenBudget);
+
+    const char *body = NULL;
+    Timer timer = Timer_CreateStack("Conversation");
+    Timer_Start(&timer);
+    for (size_t turn = 0; turn < turns; turn++)
+    {
+        if (turn > 0)
+        {
+            AIConversation_Append(conversation, "assistant", answers[turn - 1]);
+        }
+        AIConversation_Append(conversation, "user", questions[turn]);
+
+        body = AIConversation_BuildRequest(conversation, "mock-model", false, &result.bytes);
+        result.totalBytes += result.bytes;
+        benchmarkSink = body[result.bytes / 2];
+    }
+    Timer_Stop(&timer);
+    result.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    // The summary is sent as a message too, counted from the request
+    cJSON *json = cJSON_ParseWithLength(body, result.bytes);
+    result.messages = json != NULL ? (size_t)cJSON_GetArraySize(cJSON_GetObjectItemCaseSensitive(json, "messages")) : 0;
+    result.tokens = AIConversation_GetTokenCount(conversation);
+    if (reference != NULL)
+    {
+        result.same = strcmp(body, reference) == 0 ? "yes" : "no";
+    }
+    else
+    {
+        result.same = json != NULL ? "json" : "no";
+    }
+
+    cJSON_Delete(json);
+    AIConversation_Destroy(conversation);
+    return result;
+}
+
+/// @brief Measures the token estimate over the texts of the conversation.
+void AIConversationBenchmark_RunEstimate(stringHeap *answers, size_t turns, size_t answerLength)
+{
+    size_t tokens = 0;
+    Timer timer = Timer_CreateStack("Estimate");
+    Timer_Start(&timer);
+    for (size_t round = 0; round < AI_CONVERSATION_BENCHMARK_ESTIMATE_ROUNDS; round++)
+    {
+        for (size_t i = 0; i < turns; i++)
+        {
+            tokens += AIConversation_EstimateTokens(answers[i], answerLength);
+        }
+    }
+    Timer_Stop(&timer);
+
+    time_t nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+    double bytes = (double)AI_CONVERSATION_BENCHMARK_ESTIMATE_ROUNDS * (double)turns * (double)answerLength;
+    printf("Token estimate: %zu tokens per answer of %zu characters, %.1f MB/s\n",
+           tokens / AI_CONVERSATION_BENCHMARK_ESTIMATE_ROUNDS / turns, answerLength, nanoseconds > 0 ? bytes / ((double)nanoseconds / 1e9) / 1e6 : 0.0);
+}
+
+int main(int argc, char **argv)
+{
+    int turns = argc > 1 ? atoi(argv[1]) : AI_CONVERSATION_BENCHMARK_DEFAULT_TURNS;
+    int answerLength = argc > 2 ? atoi(argv[2]) : AI_CONVERSATION_BENCHMARK_DEFAULT_ANSWER_LENGTH;
+    turns = turns > 0 && turns <= AI_CONVERSATION_BENCHMARK_MAXIMUM_TURNS ? turns : AI_CONVERSATION_BENCHMARK_DEFAULT_TURNS;
+    answerLength = answerLength > 0 && answerLength <= AI_CONVERSATION_BENCHMARK_MAXIMUM_ANSWER_LENGTH ? answerLength : AI_CONVERSATION_BENCHMARK_DEFAULT_ANSWER_LENGTH;
+
+    stringHeap *questions = (stringHeap *)malloc((size_t)turns * sizeof(stringHeap));
+    stringHeap *answers = (stringHeap *)malloc((size_t)turns * sizeof(stringHeap));
+    for (size_t i = 0; i < (size_t)turns; i++)
+    {
+        questions[i] = AIConversationBenchmark_CreateText(i, 96);
+        answers[i] = AIConversationBenchmark_CreateText(i, (size_t)answerLength);
+    }
+
+    printf("AIConversation benchmark, %d turns, %d characters per answer\n", turns, answerLength);
+    printf("%-12s %-12s %6s %8s %8s %10s %14s %10s %5s\n", "Scenario", "Method", "Turns", "Messages", "Tokens", "Bytes", "Per turn (us)", "MB/s", "Same");
+
+    stringHeap rebuildBody;
+    AIConversationBenchmarkResult cjson = AIConversationBenchmark_RunCJSON(questions, answers, (size_t)turns);
+    AIConversationBenchmarkResult rebuild = AIConversationBenchmark_RunRebuild(questions, answers, (size_t)turns, &rebuildBody);
+    AIConversationBenchmarkResult unbounded = AIConversationBenchmark_RunConversation("Unbounded", questions, answers, (size_t)turns, SIZE_MAX, 0, rebuildBody);
+    cjson.tokens = unbounded.tokens;
+    rebuild.tokens = unbounded.tokens;
+    AIConversationBenchmark_Print(&cjson);
+    AIConversationBenchmark_Print(&rebuild);
+    AIConversationBenchmark_Print(&unbounded);
+    free(rebuildBody);
+
+    AIConversationBenchmarkResult budget = AIConversationBenchmark_RunConversation("Budget", questions, answers, (size_t)turns,
+                                                                                    AI_CONVERSATION_DEFAULT_TOKEN_BUDGET, AI_CONVERSATION_DEFAULT_SUMMARY_TOKEN_BUDGET, NULL);
+    AIConversationBenchmark_Print(&budget);
+
+    AIConversationBenchmarkResult noSummary = AIConversationBenchmark_RunConversation("No summary", questions, answers, (size_t)turns,
+                                                                                       AI_CONVERSATION_DEFAULT_TOKEN_BUDGET, 0, NULL);
+    AIConversationBenchmark_Print(&noSummary);
+
+    AIConversationBenchmark_RunEstimate(answers, (size_t)turns, (size_t)answerLength);
+
+    for (size_t i = 0; i < (size_t)turns; i++)
+    {
+        free(questions[i]);
+        free(answers[i]);
+    }
+    free(questions);
+    free(answers);
+
+    return 0;
+}
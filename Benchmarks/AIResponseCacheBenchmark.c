@@ -0,0 +1,274 @@
+#include "Core.h"
+
+#include "AI/AIManager.h"
+#include "AI/AIMockServer.h"
+#include "AI/AIResponseCache.h"
+#include "Modules/NetworkManager.h"
+#include "Utils/Timer.h"
+
+// Measures AIResponseCache alone, its keys, stores and lookups in memory and on disk, then canned queries repeated through AIChat
+// against AIMockServer at the latency of a remote model, without a cache, with a cache in memory and with a cache reopened from disk.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./AIResponseCacheBenchmark [queries] [repeats]
+
+#define AI_RESPONSE_CACHE_BENCHMARK_DEFAULT_QUERIES 8
+#define AI_RESPONSE_CACHE_BENCHMARK_MAXIMUM_QUERIES 1000
+#define AI_RESPONSE_CACHE_BENCHMARK_DEFAULT_REPEATS 5
+#define AI_RESPONSE_CACHE_BENCHMARK_MAXIMUM_REPEATS 1000
+#define AI_RESPONSE_CACHE_BENCHMARK_KEYS 4096          // distinct requests of the cache scenarios
+#define AI_RESPONSE_CACHE_BENCHMARK_REQUEST_LENGTH 1024 // bytes per request of the cache scenarios
+#define AI_RESPONSE_CACHE_BENCHMARK_ANSWER_LENGTH 1024
+#define AI_RESPONSE_CACHE_BENCHMARK_ROUNDS 20
+#define AI_RESPONSE_CACHE_BENCHMARK_LATENCY 20000000 // nanoseconds before the first byte of a response
+#define AI_RESPONSE_CACHE_BENCHMARK_DISK_PATH "AIResponseCacheBenchmark.cache"
+
+/// @brief Result of a benchmark scenario.
+typedef struct AIResponseCacheBenchmarkResult
+{
+    const char *title;
+    const char *method;
+    size_t runs;
+    double hitRate;
+    size_t requests; // reaching the server, 0 when not measured
+    time_t nanoseconds;
+} AIResponseCacheBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile char benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+void AIResponseCacheBenchmark_Print(const AIResponseCacheBenchmarkResult *result)
+{
+    double perRun = (double)result->nanoseconds / (double)result->runs;
+
+    printf("%-10s %-12s %7zu %8.1f %9zu %14.3f %12.0f\n",
+           result->title,
+           result->method,
+           result->runs,
+           result->hitRate * 100.0,
+           result->requests,
+           perRun / 1000.0,
+           perRun > 0.0 ? 1e9 / perRun : 0.0);
+}
+
+/// @brief Builds a text of a length, different for every seed.
+stringHeap AIResponseCacheBenchmark_CreateText(const char *line, size_t seed, size_t length)
+{
+    stringHeap text = (stringHeap)malloc(length + 1);
+    size_t written = 0;
+    while (written < length)
+    {
+        char formatted[160];
+        int formattedLength = snprintf(formatted, sizeof(formatted), line, seed);
+        size_t copied = length - written < (size_t)formattedLength ? length - written : (size_t)formattedLength;
+        memcpy(text + written, formatted, copied);
+        written += copied;
+    }
+    text[length] = '\0';
+
+    return text;
+}
+
+/// @brief Looks every key up for rounds, and measures the lookups.
+AIResponseCacheBenchmarkResult AIResponseCacheBenchmark_RunLookups(const char *method, AIResponseCache *cache, const AIResponseCacheKey *keys)
+{
+    AIResponseCacheStatistics before = AIResponseCache_GetStatistics(cache);
+    AIResponseCacheBenchmarkResult result = {"Cache", method, AI_RESPONSE_CACHE_BENCHMARK_ROUNDS * AI_RESPONSE_CACHE_BENCHMARK_KEYS, 0.0, 0, 0};
+
+    Timer timer = Timer_CreateStack("Lookups");
+    Timer_Start(&timer);
+    for (size_t round = 0; round < AI_RESPONSE_CACHE_BENCHMARK_ROUNDS; round++)
+    {
+        for (size_t i = 0; i < AI_RESPONSE_CACHE_BENCHMARK_KEYS; i++)
+        {
+            stringHeap answer = AIResponseCache_Get(cache, keys[i]);
+            benchmarkSink = answer != NULL ? answer[0] : 0;
+            free(answer);
+        }
+    }
+    Timer_Stop(&timer);
+    result.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    AIResponseCacheStatistics after = AIResponseCache_GetStatistics(cache);
+    result.hitRate = (double)(after.memoryHits + after.diskHits - before.memoryHits - before.diskHits) / (double)result.runs;
+
+    return result;
+}
+
+/// @brief Measures the cache alone, without network.
+void AIResponseCacheBenchmark_RunCache()
+{
+    stringHeap *requests = (stringHeap *)malloc(AI_RESPONSE_CACHE_BENCHMARK_KEYS * sizeof(stringHeap));
+    AIResponseCacheKey *keys = (AIResponseCacheKey *)malloc(AI_RESPONSE_CACHE_BENCHMARK_KEYS * sizeof(AIResponseCacheKey));
+    AIResponseCacheKey *missingKeys = (AIResponseCacheKey *)malloc(AI_RESPONSE_CACHE_BENCHMARK_KEYS * sizeof(AIResponseCacheKey));
+    stringHeap answer = AIResponseCacheBenchmark_CreateText("- The \"sensor\" reads **21.5 C** at the door %zu.\n", 0, AI_RESPONSE_CACHE_BENCHMARK_ANSWER_LENGTH);
+    for (size_t i = 0; i < AI_RESPONSE_CACHE_BENCHMARK_KEYS; i++)
+    {
+        requests[i] = AIResponseCacheBenchmark_CreateText("{\"role\":\"user\",\"content\":\"How warm is it at door %zu?\"},", i, AI_RESPONSE_CACHE_BENCHMARK_REQUEST_LENGTH);
+    }
+
+    AIResponseCacheBenchmarkResult key = {"Cache", "Key", AI_RESPONSE_CACHE_BENCHMARK_ROUNDS * AI_RESPONSE_CACHE_BENCHMARK_KEYS, 0.0, 0, 0};
+    Timer timer = Timer_CreateStack("Key");
+    Timer_Start(&timer);
+    for (size_t round = 0; round < AI_RESPONSE_CACHE_BENCHMARK_ROUNDS; round++)
+    {
+        for (size_t i = 0; i < AI_RESPONSE_CACHE_BENCHMARK_KEYS; i++)
+        {
+            keys[i] = AIResponseCache_CreateKey("http://127.0.0.1/v1/chat/completions", requests[i], AI_RESPONSE_CACHE_BENCHMARK_REQUEST_LENGTH);
+        }
+    }
+    Timer_Stop(&timer);
+    key.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+    AIResponseCacheBenchmark_Print(&key);
+
+    for (size_t i = 0; i < AI_RESPONSE_CACHE_BENCHMARK_KEYS; i++)
+    {
+        missingKeys[i] = AIResponseCache_CreateKey("http://127.0.0.1/v1/other", requests[i], AI_RESPONSE_CACHE_BENCHMARK_REQUEST_LENGTH);
+    }
+
+    // Memory holds every key, the disk tier is written too but never read
+    remove(AI_RESPONSE_CACHE_BENCHMARK_DISK_PATH);
+    AIResponseCacheSettings settings = AIResponseCache_GetDefaultSettings();
+    settings.memoryCapacity = AI_RESPONSE_CACHE_BENCHMARK_KEYS;
+    settings.diskPath = AI_RESPONSE_CACHE_BENCHMARK_DISK_PATH;
+    settings.diskSlotCount = 2 * AI_RESPONSE_CACHE_BENCHMARK_KEYS;
+    AIResponseCache *cache = AIResponseCache_Create(settings);
+
+    AIResponseCacheBenchmarkResult store = {"Cache", "Put", AI_RESPONSE_CACHE_BENCHMARK_ROUNDS * AI_RESPONSE_CACHE_BENCHMARK_KEYS, 0.0, 0, 0};
+    timer = Timer_CreateStack("Put");
+    Timer_Start(&timer);
+    for (size_t round = 0; round < AI_RESPONSE_CACHE_BENCHMARK_ROUNDS; round++)
+    {
+        for (size_t i = 0; i < AI_RESPONSE_CACHE_BENCHMARK_KEYS; i++)
+        {
+            AIResponseCache_Put(cache, keys[i], answer);
+        }
+    }
+    Timer_Stop(&timer);
+    store.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+    AIResponseCacheBenchmark_Print(&store);
+
+    AIResponseCacheBenchmarkResult memoryHits = AIResponseCacheBenchmark_RunLookups("Memory hit", cache, keys);
+    AIResponseCacheBenchmark_Print(&memoryHits);
+    AIResponseCacheBenchmarkResult misses = AIResponseCacheBenchmark_RunLookups("Miss", cache, missingKeys);
+    AIResponseCacheBenchmark_Print(&misses);
+    AIResponseCache_Destroy(cache);
+
+    // Reopened with a memory of a key, so nearly every lookup reads the disk and evicts the key before it
+    settings.memoryCapacity = 1;
+    cache = AIResponseCache_Create(settings);
+    AIResponseCacheBenchmarkResult diskHits = AIResponseCacheBenchmark_RunLookups("Disk hit", cache, keys);
+    AIResponseCacheBenchmark_Print(&diskHits);
+    AIResponseCache_Destroy(cache);
+    remove(AI_RESPONSE_CACHE_BENCHMARK_DISK_PATH);
+
+    for (size_t i = 0; i < AI_RESPONSE_CACHE_BENCHMARK_KEYS; i++)
+    {
+        free(requests[i]);
+    }
+    free(requests);
+    free(keys);
+    free(missingKeys);
+    free(answer);
+}
+
+/// @brief Sends every query for repeats through a chat, each as a conversation of its own, and measures the requests.
+AIResponseCacheBenchmarkResult AIResponseCacheBenchmark_RunChat(const char *method, AIMockServer *server, AIResponseCache *cache, stringHeap *queries, size_t queryCount, size_t repeats)
+{
+    AIChat *chat = AIChat_CreateWithProvider("Benchmark", "mock-model", (string)AIMockServer_GetUrl(server), "mock-key", "Answer shortly.", &AI_PROVIDER_OPENAI, false);
+    AIChat_SetResponseCache(chat, cache);
+
+    AIResponseCacheStatistics before = cache != NULL ? AIResponseCache_GetStatistics(cache) : (AIResponseCacheStatistics){0};
+    size_t requestsBefore = AIMockServer_GetRequestCount(server);
+    AIResponseCacheBenchmarkResult result = {"Chat", method, queryCount * repeats, 0.0, 0, 0};
+
+    Timer timer = Timer_CreateStack("Chat");
+    Timer_Start(&timer);
+    for (size_t repeat = 0; repeat < repeats; repeat++)
+    {
+        for (size_t i = 0; i < queryCount; i++)
+        {
+            AIChat_ClearHistory(chat);
+            stringHeap answer = AIChat_SendAndReceive(chat, queries[i]);
+            benchmarkSink = answer != NULL ? answer[0] : 0;
+            free(answer);
+        }
+    }
+    Timer_Stop(&timer);
+    result.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+    result.requests = AIMockServer_GetRequestCount(server) - requestsBefore;
+
+    if (cache != NULL)
+    {
+        AIResponseCacheStatistics after = AIResponseCache_GetStatistics(cache);
+        result.hitRate = (double)(after.memoryHits + after.diskHits - before.memoryHits - before.diskHits) / (double)(after.lookups - before.lookups);
+    }
+
+    AIChat_Destroy(chat);
+    return result;
+}
+
+/// @brief Measures canned queries through AIChat against a mock server at the latency of a remote model.
+void AIResponseCacheBenchmark_RunChats(size_t queryCount, size_t repeats)
+{
+    AIMockServerSettings paced = {AI_RESPONSE_CACHE_BENCHMARK_LATENCY, 0, 0};
+    AIMockServer *server = AIMockServer_Create(paced);
+    AIMockServer_AddResponse(server, 200, "{\"choices\":[{\"index\":0,\"message\":{\"role\":\"assistant\",\"content\":\"It is 21.5 C at the door.\"}}]}");
+    if (!AIMockServer_Start(server))
+    {
+        printf("Failed to start the mock server\n");
+        AIMockServer_Destroy(server);
+        return;
+    }
+
+    stringHeap *queries = (stringHeap *)malloc(queryCount * sizeof(stringHeap));
+    for (size_t i = 0; i < queryCount; i++)
+    {
+        queries[i] = AIResponseCacheBenchmark_CreateText("Health check %zu, how warm is it at the door?", i, 48);
+    }
+
+    AIResponseCacheBenchmarkResult uncached = AIResponseCacheBenchmark_RunChat("None", server, NULL, queries, queryCount, repeats);
+    AIResponseCacheBenchmark_Print(&uncached);
+
+    remove(AI_RESPONSE_CACHE_BENCHMARK_DISK_PATH);
+    AIResponseCacheSettings settings = AIResponseCache_GetDefaultSettings();
+    settings.diskPath = AI_RESPONSE_CACHE_BENCHMARK_DISK_PATH;
+    AIResponseCache *cache = AIResponseCache_Create(settings);
+    AIResponseCacheBenchmarkResult memory = AIResponseCacheBenchmark_RunChat("Memory", server, cache, queries, queryCount, repeats);
+    AIResponseCacheBenchmark_Print(&memory);
+    AIResponseCache_Destroy(cache);
+
+    // As a next run of the same script, with the answers of the last run on disk
+    cache = AIResponseCache_Create(settings);
+    AIResponseCacheBenchmarkResult disk = AIResponseCacheBenchmark_RunChat("Reopened", server, cache, queries, queryCount, repeats);
+    AIResponseCacheBenchmark_Print(&disk);
+    AIResponseCache_Destroy(cache);
+    remove(AI_RESPONSE_CACHE_BENCHMARK_DISK_PATH);
+
+    for (size_t i = 0; i < queryCount; i++)
+    {
+        free(queries[i]);
+    }
+    free(queries);
+    AIMockServer_Destroy(server);
+}
+
+int main(int argc, char **argv)
+{
+    int queries = argc > 1 ? atoi(argv[1]) : AI_RESPONSE_CACHE_BENCHMARK_DEFAULT_QUERIES;
+    int repeats = argc > 2 ? atoi(argv[2]) : AI_RESPONSE_CACHE_BENCHMARK_DEFAULT_REPEATS;
+    queries = queries > 0 && queries <= AI_RESPONSE_CACHE_BENCHMARK_MAXIMUM_QUERIES ? queries : AI_RESPONSE_CACHE_BENCHMARK_DEFAULT_QUERIES;
+    repeats = repeats > 0 && repeats <= AI_RESPONSE_CACHE_BENCHMARK_MAXIMUM_REPEATS ? repeats : AI_RESPONSE_CACHE_BENCHMARK_DEFAULT_REPEATS;
+
+    NetworkManager_Initialize();
+
+    printf("AIResponseCache benchmark, %d keys of %d bytes, %d queries repeated %d times at %d ms latency\n",
+           AI_RESPONSE_CACHE_BENCHMARK_KEYS, AI_RESPONSE_CACHE_BENCHMARK_REQUEST_LENGTH, queries, repeats, AI_RESPONSE_CACHE_BENCHMARK_LATENCY / 1000000);
+    printf("%-10s %-12s %7s %8s %9s %14s %12s\n", "Scenario", "Method", "Runs", "Hit (%)", "Requests", "Time (us)", "Per second");
+
+    AIResponseCacheBenchmark_RunCache();
+    AIResponseCacheBenchmark_RunChats((size_t)queries, (size_t)repeats);
+
+    NetworkManager_Terminate();
+
+    return 0;
+}
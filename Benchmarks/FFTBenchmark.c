@@ -0,0 +1,180 @@
+#include "Core.h"
+
+#include "Maths.h"
+#include "Utils/Timer.h"
+
+#include <math.h>
+
+// Measures the accuracy and the speed of FFT_Forward with FFT_Inverse and ComplexBatch_Product on every supported instruction set,
+// against the scalar kernels of the same functions.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./FFTBenchmark [size] [rounds]
+
+#define FFT_BENCHMARK_DEFAULT_SIZE 1024
+#define FFT_BENCHMARK_DEFAULT_ROUNDS 20000
+#define FFT_BENCHMARK_MAXIMUM_SIZE 1048576
+#define FFT_BENCHMARK_ERROR_SIZE 4096 // the reference DFT is quadratic, larger sizes skip the error
+
+/// @brief Result of a benchmark scenario.
+typedef struct FFTBenchmarkResult
+{
+    const char *title;
+    const char *level;
+    double maximumError;
+    long long operations;
+    time_t nanoseconds;
+} FFTBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile float benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+/// @param baseline Nanoseconds of the scalar kernels for the same work, for the speed up column.
+void FFTBenchmark_Print(const FFTBenchmarkResult *result, time_t baseline)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-8s %-8s %12.3g %10.2f %16.0f %8.2fx\n",
+           result->title,
+           result->level,
+           result->maximumError,
+           seconds * 1000.0,
+           seconds > 0.0 ? (double)result->operations / seconds : 0.0,
+           result->nanoseconds > 0 ? (double)baseline / (double)result->nanoseconds : 0.0);
+}
+
+/// @brief Fills a batch with the test signal, two tones and a slow imaginary ramp.
+void FFTBenchmark_Fill(ComplexBatch *batch)
+{
+    for (size_t i = 0; i < batch->count; i++)
+    {
+        batch->real[i] = sinf(0.3f * (float)i) + 0.5f * cosf(1.7f * (float)i);
+        batch->imaginary[i] = 0.1f * (float)(i % 3);
+    }
+}
+
+/// @brief Gets the maximum absolute error of a transformed batch against a double precision DFT of the signal.
+double FFTBenchmark_Error(const ComplexBatch *signal, const ComplexBatch *batch)
+{
+    size_t size = batch->count;
+    if (size > FFT_BENCHMARK_ERROR_SIZE)
+    {
+        return 0.0;
+    }
+
+    double maximumError = 0.0;
+    for (size_t bin = 0; bin < size; bin++)
+    {
+        double real = 0.0;
+        double imaginary = 0.0;
+        for (size_t i = 0; i < size; i++)
+        {
+            double sampleReal = (double)signal->real[i];
+            double sampleImaginary = (double)signal->imaginary[i];
+            double angle = -2.0 * 3.14159265358979323846 * (double)((bin * i) % size) / (double)size;
+
+            real += sampleReal * cos(angle) - sampleImaginary * sin(angle);
+            imaginary += sampleReal * sin(angle) + sampleImaginary * cos(angle);
+        }
+
+        maximumError = fmax(maximumError, fabs((double)batch->real[bin] - real));
+        maximumError = fmax(maximumError, fabs((double)batch->imaginary[bin] - imaginary));
+    }
+
+    return maximumError;
+}
+
+/// @brief Runs FFT_Forward and FFT_Inverse on the used instruction set.
+time_t FFTBenchmark_RoundTrip(const FFTPlan *plan, ComplexBatch *batch, int rounds)
+{
+    Timer timer = Timer_CreateStack("FFT round trip");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        // The inverse gives the signal back, so the values do not grow round after round
+        FFT_Forward(plan, batch);
+        FFT_Inverse(plan, batch);
+        benchmarkSink = batch->real[(size_t)round % batch->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Runs ComplexBatch_Product on the used instruction set.
+time_t FFTBenchmark_Product(const ComplexBatch *batch1, const ComplexBatch *batch2, ComplexBatch *result, int rounds)
+{
+    Timer timer = Timer_CreateStack("Complex product");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        ComplexBatch_Product(batch1, batch2, result);
+        benchmarkSink = result->real[(size_t)round % result->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+int main(int argc, char **argv)
+{
+    int size = argc > 1 ? atoi(argv[1]) : FFT_BENCHMARK_DEFAULT_SIZE;
+    int rounds = argc > 2 ? atoi(argv[2]) : FFT_BENCHMARK_DEFAULT_ROUNDS;
+    size = size > 0 && size <= FFT_BENCHMARK_MAXIMUM_SIZE && (size & (size - 1)) == 0 ? size : FFT_BENCHMARK_DEFAULT_SIZE;
+    rounds = rounds > 0 ? rounds : FFT_BENCHMARK_DEFAULT_ROUNDS;
+
+    size_t count = (size_t)size;
+
+    FFTPlan *plan = FFTPlan_Create(count);
+    ComplexBatch *batch = ComplexBatch_Create(count);
+    ComplexBatch *other = ComplexBatch_Create(count);
+    ComplexBatch *result = ComplexBatch_Create(count);
+    FFTBenchmark_Fill(other); // the signal itself, for the error and as the second factor of the products
+
+    SimdLevel detectedLevel = Simd_GetLevel();
+    SimdLevel levels[] = {SimdLevel_Scalar, SimdLevel_SSE2, SimdLevel_AVX2, SimdLevel_NEON};
+
+    printf("FFT benchmark, %zu samples, %d rounds, detected %s\n", count, rounds, Simd_GetLevelName(detectedLevel));
+    printf("%-8s %-8s %12s %10s %16s %9s\n", "Function", "Level", "Max error", "Time (ms)", "Operations/s", "Speed up");
+
+    time_t forwardBaseline = 0;
+    time_t productBaseline = 0;
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        // Levels the CPU does not have are skipped instead of being clamped to another level.
+        bool isSupported = levels[i] == SimdLevel_Scalar || levels[i] == detectedLevel || (levels[i] == SimdLevel_SSE2 && detectedLevel == SimdLevel_AVX2);
+        if (!isSupported)
+        {
+            continue;
+        }
+
+        Simd_SetLevel(levels[i]);
+
+        // A forward and an inverse transform per round, counted as two transforms
+        FFTBenchmark_Fill(batch);
+        time_t forwardTime = FFTBenchmark_RoundTrip(plan, batch, rounds);
+        FFTBenchmark_Fill(batch);
+        FFT_Forward(plan, batch);
+        forwardBaseline = levels[i] == SimdLevel_Scalar ? forwardTime : forwardBaseline;
+
+        FFTBenchmarkResult forward = {"FFT", Simd_GetLevelName(levels[i]), FFTBenchmark_Error(other, batch), (long long)rounds * 2, forwardTime};
+        FFTBenchmark_Print(&forward, forwardBaseline);
+
+        time_t productTime = FFTBenchmark_Product(batch, other, result, rounds);
+        productBaseline = levels[i] == SimdLevel_Scalar ? productTime : productBaseline;
+
+        FFTBenchmarkResult product = {"Product", Simd_GetLevelName(levels[i]), 0.0, (long long)count * rounds, productTime};
+        FFTBenchmark_Print(&product, productBaseline);
+    }
+
+    Simd_SetLevel(detectedLevel);
+
+    ComplexBatch_Destroy(result);
+    ComplexBatch_Destroy(other);
+    ComplexBatch_Destroy(batch);
+    FFTPlan_Destroy(plan);
+
+    return 0;
+}
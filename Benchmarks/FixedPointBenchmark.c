@@ -0,0 +1,380 @@
+#include "Core.h"
+
+#include "Maths.h"
+#include "Utils/Timer.h"
+
+#include <math.h>
+
+// Compares the fixed-point maths functions with the float functions they mirror, on the FPU of the build host.
+// The float side runs on the scalar kernels, the fixed-point side has no SIMD kernels, so both are plain scalar code.
+// The speed up column is float time over fixed-point time, below 1 means the FPU of the host is faster.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./FixedPointBenchmark [values] [rounds]
+
+#define FIXED_POINT_BENCHMARK_DEFAULT_VALUES 4096
+#define FIXED_POINT_BENCHMARK_DEFAULT_ROUNDS 2000
+
+/// @brief Result of a benchmark scenario.
+typedef struct FixedPointBenchmarkResult
+{
+    const char *title;
+    const char *type;
+    double maximumError;
+    long long operations;
+    time_t nanoseconds;
+} FixedPointBenchmarkResult;
+
+/// @brief Inputs of the scenarios, the same values as float and as fixed-point.
+typedef struct FixedPointBenchmarkData
+{
+    size_t count;
+    float *angles;
+    float *samples; // in [-1, 1)
+    Vector3 *vectors;
+    Fixed *fixedAngles;
+    Fixed15 *fixedSamples;
+    FixedVector3 *fixedVectors;
+    float *results;
+    Fixed *fixedResults;
+} FixedPointBenchmarkData;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile float benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+/// @param baseline Nanoseconds of the float functions for the same work, for the speed up column.
+void FixedPointBenchmark_Print(const FixedPointBenchmarkResult *result, time_t baseline)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-18s %-8s %12.3g %10.2f %16.0f %8.2fx\n",
+           result->title,
+           result->type,
+           result->maximumError,
+           seconds * 1000.0,
+           seconds > 0.0 ? (double)result->operations / seconds : 0.0,
+           result->nanoseconds > 0 ? (double)baseline / (double)result->nanoseconds : 0.0);
+}
+
+/// @brief Gets the maximum absolute difference of the fixed-point results from the float results.
+double FixedPointBenchmark_Error(const FixedPointBenchmarkData *data, size_t count)
+{
+    double maximumError = 0.0;
+    for (size_t i = 0; i < count; i++)
+    {
+        maximumError = fmax(maximumError, fabs((double)Fixed_ToFloat(data->fixedResults[i]) - (double)data->results[i]));
+    }
+
+    return maximumError;
+}
+
+/// @brief Runs SinRad and CosRad, adds them so both are kept.
+time_t FixedPointBenchmark_SinCosFloat(FixedPointBenchmarkData *data, int rounds)
+{
+    Timer timer = Timer_CreateStack("Sin cos float");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < data->count; i++)
+        {
+            data->results[i] = SinRad(data->angles[i]) + CosRad(data->angles[i]);
+        }
+
+        benchmarkSink = data->results[(size_t)round % data->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Runs Fixed_SinCosRad, adds them so both are kept.
+time_t FixedPointBenchmark_SinCosFixed(FixedPointBenchmarkData *data, int rounds)
+{
+    Timer timer = Timer_CreateStack("Sin cos fixed");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < data->count; i++)
+        {
+            Fixed sine;
+            Fixed cosine;
+            Fixed_SinCosRad(data->fixedAngles[i], &sine, &cosine);
+            data->fixedResults[i] = sine + cosine;
+        }
+
+        benchmarkSink = (float)data->fixedResults[(size_t)round % data->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Runs ArcTan2Rad on the components of the vectors.
+time_t FixedPointBenchmark_ArcTan2Float(FixedPointBenchmarkData *data, int rounds)
+{
+    Timer timer = Timer_CreateStack("Arc tangent float");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < data->count; i++)
+        {
+            data->results[i] = ArcTan2Rad(data->vectors[i].y, data->vectors[i].x);
+        }
+
+        benchmarkSink = data->results[(size_t)round % data->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Runs Fixed_ArcTan2Rad on the components of the vectors.
+time_t FixedPointBenchmark_ArcTan2Fixed(FixedPointBenchmarkData *data, int rounds)
+{
+    Timer timer = Timer_CreateStack("Arc tangent fixed");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < data->count; i++)
+        {
+            data->fixedResults[i] = Fixed_ArcTan2Rad(data->fixedVectors[i].y, data->fixedVectors[i].x);
+        }
+
+        benchmarkSink = (float)data->fixedResults[(size_t)round % data->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Normalizes the vectors and takes the dot product with the next vector.
+time_t FixedPointBenchmark_VectorFloat(FixedPointBenchmarkData *data, int rounds)
+{
+    Timer timer = Timer_CreateStack("Vector float");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < data->count; i++)
+        {
+            Vector3 normalized = Vector3_Normalized(data->vectors[i]);
+            data->results[i] = Vector3_Dot(normalized, data->vectors[(i + 1) % data->count]);
+        }
+
+        benchmarkSink = data->results[(size_t)round % data->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Normalizes the fixed-point vectors and takes the dot product with the next vector.
+time_t FixedPointBenchmark_VectorFixed(FixedPointBenchmarkData *data, int rounds)
+{
+    Timer timer = Timer_CreateStack("Vector fixed");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < data->count; i++)
+        {
+            FixedVector3 normalized = FixedVector3_Normalized(data->fixedVectors[i]);
+            data->fixedResults[i] = FixedVector3_Dot(normalized, data->fixedVectors[(i + 1) % data->count]);
+        }
+
+        benchmarkSink = (float)data->fixedResults[(size_t)round % data->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Multiplies every matrix, a rotation of the angle, by the next one.
+time_t FixedPointBenchmark_MatrixFloat(const Matrix4 *matrices, FixedPointBenchmarkData *data, int rounds)
+{
+    Timer timer = Timer_CreateStack("Matrix float");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < data->count; i++)
+        {
+            Matrix4 product = Matrix4_Dot(&matrices[i], &matrices[(i + 1) % data->count]);
+            data->results[i] = product.matrix[0][1];
+        }
+
+        benchmarkSink = data->results[(size_t)round % data->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Multiplies every fixed-point matrix by the next one.
+time_t FixedPointBenchmark_MatrixFixed(const FixedMatrix4 *matrices, FixedPointBenchmarkData *data, int rounds)
+{
+    Timer timer = Timer_CreateStack("Matrix fixed");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < data->count; i++)
+        {
+            FixedMatrix4 product = FixedMatrix4_Dot(&matrices[i], &matrices[(i + 1) % data->count]);
+            data->fixedResults[i] = product.matrix[0][1];
+        }
+
+        benchmarkSink = (float)data->fixedResults[(size_t)round % data->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Sums the products of the samples and the reversed samples, a FIR filter over the whole array.
+time_t FixedPointBenchmark_FilterFloat(FixedPointBenchmarkData *data, int rounds)
+{
+    Timer timer = Timer_CreateStack("Filter float");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        float sum = 0.0f;
+        for (size_t i = 0; i < data->count; i++)
+        {
+            sum += data->samples[i] * data->samples[data->count - 1 - i];
+        }
+
+        data->results[0] = sum;
+        benchmarkSink = sum;
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Runs Fixed15_DotArray on the Q1.15 samples and a reversed copy of them.
+time_t FixedPointBenchmark_FilterFixed(FixedPointBenchmarkData *data, const Fixed15 *reversed, int rounds)
+{
+    Timer timer = Timer_CreateStack("Filter fixed");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        data->fixedResults[0] = Fixed15_DotArray(data->fixedSamples, reversed, data->count);
+        benchmarkSink = (float)data->fixedResults[0];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+int main(int argc, char **argv)
+{
+    int valueCount = argc > 1 ? atoi(argv[1]) : FIXED_POINT_BENCHMARK_DEFAULT_VALUES;
+    int rounds = argc > 2 ? atoi(argv[2]) : FIXED_POINT_BENCHMARK_DEFAULT_ROUNDS;
+    valueCount = valueCount > 0 ? valueCount : FIXED_POINT_BENCHMARK_DEFAULT_VALUES;
+    rounds = rounds > 0 ? rounds : FIXED_POINT_BENCHMARK_DEFAULT_ROUNDS;
+
+    FixedPointBenchmarkData data = {.count = (size_t)valueCount};
+    size_t count = data.count;
+    long long operations = (long long)count * rounds;
+
+    data.angles = (float *)malloc(count * sizeof(float));
+    data.samples = (float *)malloc(count * sizeof(float));
+    data.vectors = (Vector3 *)malloc(count * sizeof(Vector3));
+    data.fixedAngles = (Fixed *)malloc(count * sizeof(Fixed));
+    data.fixedSamples = (Fixed15 *)malloc(count * sizeof(Fixed15));
+    data.fixedVectors = (FixedVector3 *)malloc(count * sizeof(FixedVector3));
+    data.results = (float *)malloc(count * sizeof(float));
+    data.fixedResults = (Fixed *)malloc(count * sizeof(Fixed));
+    Fixed15 *reversedSamples = (Fixed15 *)malloc(count * sizeof(Fixed15));
+    Matrix4 *matrices = (Matrix4 *)malloc(count * sizeof(Matrix4));
+    FixedMatrix4 *fixedMatrices = (FixedMatrix4 *)malloc(count * sizeof(FixedMatrix4));
+
+    // The float inputs are the fixed-point inputs converted back, so the errors are the errors of the functions only
+    for (size_t i = 0; i < count; i++)
+    {
+        data.fixedAngles[i] = Fixed_FromFloat(-100.0f + 200.0f * (float)i / (float)count);
+        data.angles[i] = Fixed_ToFloat(data.fixedAngles[i]);
+
+        data.fixedSamples[i] = Fixed15_FromFloat(sinf(0.05f * (float)i) * 0.9f);
+        data.samples[i] = Fixed15_ToFloat(data.fixedSamples[i]);
+
+        Vector3 vector = NewVector3((float)(i % 17) - 8.0f, (float)(i % 23) * 0.5f - 5.0f, (float)(i % 7) + 0.25f);
+        data.fixedVectors[i] = FixedVector3_FromFloat(vector);
+        data.vectors[i] = FixedVector3_ToFloat(data.fixedVectors[i]);
+
+        Matrix4 identity = Matrix4_Identity();
+        Matrix4 rotation = Matrix4_Rotate(&identity, (float)(i % 360) * 0.0175f, 0.2f, 1.0f, (float)(i % 3));
+        fixedMatrices[i] = FixedMatrix4_FromFloat(&rotation);
+        matrices[i] = FixedMatrix4_ToFloat(&fixedMatrices[i]);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        reversedSamples[i] = data.fixedSamples[count - 1 - i];
+    }
+
+    SimdLevel detectedLevel = Simd_GetLevel();
+    Simd_SetLevel(SimdLevel_Scalar);
+
+    printf("Fixed-point benchmark, %zu values, %d rounds, float on the scalar kernels\n", count, rounds);
+    printf("%-18s %-8s %12s %10s %16s %9s\n", "Function", "Type", "Max error", "Time (ms)", "Operations/s", "Speed up");
+
+    time_t baseline = FixedPointBenchmark_SinCosFloat(&data, rounds);
+    FixedPointBenchmarkResult sinCosFloat = {"SinCos", "Float", 0.0, operations, baseline};
+    FixedPointBenchmark_Print(&sinCosFloat, baseline);
+    FixedPointBenchmarkResult sinCosFixed = {"SinCos", "Q16.16", 0.0, operations, FixedPointBenchmark_SinCosFixed(&data, rounds)};
+    sinCosFixed.maximumError = FixedPointBenchmark_Error(&data, count);
+    FixedPointBenchmark_Print(&sinCosFixed, baseline);
+
+    baseline = FixedPointBenchmark_ArcTan2Float(&data, rounds);
+    FixedPointBenchmarkResult arcTan2Float = {"ArcTan2", "Float", 0.0, operations, baseline};
+    FixedPointBenchmark_Print(&arcTan2Float, baseline);
+    FixedPointBenchmarkResult arcTan2Fixed = {"ArcTan2", "Q16.16", 0.0, operations, FixedPointBenchmark_ArcTan2Fixed(&data, rounds)};
+    arcTan2Fixed.maximumError = FixedPointBenchmark_Error(&data, count);
+    FixedPointBenchmark_Print(&arcTan2Fixed, baseline);
+
+    baseline = FixedPointBenchmark_VectorFloat(&data, rounds);
+    FixedPointBenchmarkResult vectorFloat = {"Vector3 normalize", "Float", 0.0, operations, baseline};
+    FixedPointBenchmark_Print(&vectorFloat, baseline);
+    FixedPointBenchmarkResult vectorFixed = {"Vector3 normalize", "Q16.16", 0.0, operations, FixedPointBenchmark_VectorFixed(&data, rounds)};
+    vectorFixed.maximumError = FixedPointBenchmark_Error(&data, count);
+    FixedPointBenchmark_Print(&vectorFixed, baseline);
+
+    baseline = FixedPointBenchmark_MatrixFloat(matrices, &data, rounds);
+    FixedPointBenchmarkResult matrixFloat = {"Matrix4 dot", "Float", 0.0, operations, baseline};
+    FixedPointBenchmark_Print(&matrixFloat, baseline);
+    FixedPointBenchmarkResult matrixFixed = {"Matrix4 dot", "Q16.16", 0.0, operations, FixedPointBenchmark_MatrixFixed(fixedMatrices, &data, rounds)};
+    matrixFixed.maximumError = FixedPointBenchmark_Error(&data, count);
+    FixedPointBenchmark_Print(&matrixFixed, baseline);
+
+    // A single sum per round, the error is of the sum
+    baseline = FixedPointBenchmark_FilterFloat(&data, rounds);
+    FixedPointBenchmarkResult filterFloat = {"Filter taps", "Float", 0.0, operations, baseline};
+    FixedPointBenchmark_Print(&filterFloat, baseline);
+    FixedPointBenchmarkResult filterFixed = {"Filter taps", "Q1.15", 0.0, operations, FixedPointBenchmark_FilterFixed(&data, reversedSamples, rounds)};
+    filterFixed.maximumError = FixedPointBenchmark_Error(&data, 1);
+    FixedPointBenchmark_Print(&filterFixed, baseline);
+
+    Simd_SetLevel(detectedLevel);
+
+    free(fixedMatrices);
+    free(matrices);
+    free(reversedSamples);
+    free(data.fixedResults);
+    free(data.results);
+    free(data.fixedVectors);
+    free(data.fixedSamples);
+    free(data.vectors);
+    free(data.fixedAngles);
+    free(data.samples);
+    free(data.angles);
+
+    return 0;
+}
@@ -0,0 +1,326 @@
+#include "Core.h"
+
+#include "Modules/GPIOManager.h"
+#include "Utils/Timer.h"
+
+#if PLATFORM_LINUX
+
+#include <errno.h>
+#include <sys/stat.h>
+
+// Measures GPIOManager against a simulated chip of the gpio-sim kernel module, no hardware is needed.
+// Needs root and the module (modprobe gpio-sim) with configfs mounted on /sys/kernel/config.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./GPIOBenchmark [iterations]
+
+#define GPIO_BENCHMARK_DEFAULT_ITERATIONS 100000
+#define GPIO_BENCHMARK_EDGE_COUNT 1000
+#define GPIO_BENCHMARK_SIM_PATH "/sys/kernel/config/gpio-sim/code-charlie-benchmark"
+#define GPIO_BENCHMARK_LINE_COUNT 16
+#define GPIO_BENCHMARK_GROUP_SIZE 8
+#define GPIO_BENCHMARK_INPUT_LINE 15
+
+/// @brief Result of a benchmark scenario.
+typedef struct GPIOBenchmarkResult
+{
+    const char *title;
+    long long operations;
+    time_t nanoseconds;
+    unsigned long long maxNanoseconds; // Worst single operation, 0 if not measured per operation.
+} GPIOBenchmarkResult;
+
+char benchmarkChipPath[64];
+char benchmarkDevicePath[128];
+
+/// @brief Gets the monotonic clock in nanoseconds. Same clock the kernel stamps edge events with.
+/// @return Current time.
+unsigned long long GPIOBenchmark_GetTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+/// @brief Writes a value to a configfs or sysfs attribute.
+/// @param path Path of the attribute.
+/// @param value Value to write.
+/// @return True on success.
+bool GPIOBenchmark_WriteAttribute(const char *path, const char *value)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    bool success = fputs(value, file) >= 0;
+    return fclose(file) == 0 && success;
+}
+
+/// @brief Reads a value of a configfs attribute, without the trailing new line.
+/// @param path Path of the attribute.
+/// @param value Buffer to read into.
+/// @param size Size of the buffer.
+/// @return True on success.
+bool GPIOBenchmark_ReadAttribute(const char *path, char *value, size_t size)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    bool success = fgets(value, (int)size, file) != NULL;
+    fclose(file);
+
+    value[strcspn(value, "\n")] = '\0';
+    return success;
+}
+
+/// @brief Removes the simulated chip. Safe to call on a partially created chip.
+void GPIOBenchmark_DestroySimulator()
+{
+    GPIOBenchmark_WriteAttribute(GPIO_BENCHMARK_SIM_PATH "/live", "0");
+    rmdir(GPIO_BENCHMARK_SIM_PATH "/bank0");
+    rmdir(GPIO_BENCHMARK_SIM_PATH);
+}
+
+/// @brief Creates a simulated chip with a single bank and finds its character device and sysfs directory.
+/// @return True if the chip is live.
+bool GPIOBenchmark_CreateSimulator()
+{
+    if (mkdir(GPIO_BENCHMARK_SIM_PATH, 0755) != 0 && errno != EEXIST)
+    {
+        printf("Cannot create %s : %s. Is gpio-sim loaded and is this run as root?\n", GPIO_BENCHMARK_SIM_PATH, strerror(errno));
+        return false;
+    }
+
+    char lineCount[8];
+    snprintf(lineCount, sizeof(lineCount), "%d", GPIO_BENCHMARK_LINE_COUNT);
+
+    char chipName[32];
+    char deviceName[64];
+
+    if ((mkdir(GPIO_BENCHMARK_SIM_PATH "/bank0", 0755) != 0 && errno != EEXIST) ||
+        !GPIOBenchmark_WriteAttribute(GPIO_BENCHMARK_SIM_PATH "/bank0/num_lines", lineCount) ||
+        !GPIOBenchmark_WriteAttribute(GPIO_BENCHMARK_SIM_PATH "/live", "1") ||
+        !GPIOBenchmark_ReadAttribute(GPIO_BENCHMARK_SIM_PATH "/bank0/chip_name", chipName, sizeof(chipName)) ||
+        !GPIOBenchmark_ReadAttribute(GPIO_BENCHMARK_SIM_PATH "/dev_name", deviceName, sizeof(deviceName)))
+    {
+        printf("Cannot bring the simulated chip up : %s.\n", strerror(errno));
+        GPIOBenchmark_DestroySimulator();
+        return false;
+    }
+
+    snprintf(benchmarkChipPath, sizeof(benchmarkChipPath), "/dev/%s", chipName);
+    snprintf(benchmarkDevicePath, sizeof(benchmarkDevicePath), "/sys/devices/platform/%s/%s", deviceName, chipName);
+    return true;
+}
+
+/// @brief Drives an input line of the simulated chip from the outside, like a signal on the pin.
+/// @param line Line to drive.
+/// @param high Level to drive.
+/// @return True on success.
+bool GPIOBenchmark_DriveLine(int line, bool high)
+{
+    char path[192];
+    snprintf(path, sizeof(path), "%s/sim_gpio%d/pull", benchmarkDevicePath, line);
+
+    return GPIOBenchmark_WriteAttribute(path, high ? "pull-up" : "pull-down");
+}
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+void GPIOBenchmark_Print(const GPIOBenchmarkResult *result)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-28s %10lld %10.2f %14.0f %12.0f %12.0f\n",
+           result->title,
+           result->operations,
+           seconds * 1000.0,
+           seconds > 0.0 ? (double)result->operations / seconds : 0.0,
+           result->operations > 0 ? (double)result->nanoseconds / (double)result->operations : 0.0,
+           (double)result->maxNanoseconds);
+}
+
+/// @brief Toggles a single output line as fast as GPIOPin_WriteValue allows.
+GPIOBenchmarkResult GPIOBenchmark_Toggle(const GPIOChip *chip, int iterations)
+{
+    GPIOPin *pin = GPIOPin_ConsumeAsOutput(chip, 0, "Benchmark Toggle", GPIOOutputType_PushPull, GPIODigitalValue_Low);
+    Timer timer = Timer_CreateStack("Toggle");
+
+    Timer_Start(&timer);
+    for (int i = 0; i < iterations; i++)
+    {
+        GPIOPin_WriteValue(pin, (i & 1) ? GPIODigitalValue_High : GPIODigitalValue_Low);
+    }
+    Timer_Stop(&timer);
+
+    GPIOPin_Release(pin);
+    return (GPIOBenchmarkResult){"Single line toggle", iterations, Timer_GetElapsedNanoseconds(&timer), 0};
+}
+
+/// @brief Reads a single input line, timing every read for the worst case.
+GPIOBenchmarkResult GPIOBenchmark_Read(const GPIOChip *chip, int iterations)
+{
+    GPIOPin *pin = GPIOPin_ConsumeAsInput(chip, 1, "Benchmark Read", GPIOInputBiasType_Kolpa, GPIOInputEventType_Kolpa);
+    unsigned long long total = 0;
+    unsigned long long worst = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        unsigned long long start = GPIOBenchmark_GetTime();
+        GPIOPin_ReadValue(pin);
+        unsigned long long elapsed = GPIOBenchmark_GetTime() - start;
+
+        total += elapsed;
+        worst = elapsed > worst ? elapsed : worst;
+    }
+
+    GPIOPin_Release(pin);
+    return (GPIOBenchmarkResult){"Single line read", iterations, (time_t)total, worst};
+}
+
+/// @brief Writes the same lines one by one and as a group, the group is one ioctl for all lines.
+void GPIOBenchmark_Bulk(const GPIOChip *chip, int iterations, GPIOBenchmarkResult *single, GPIOBenchmarkResult *bulk)
+{
+    GPIOPin *pins[GPIO_BENCHMARK_GROUP_SIZE];
+    for (int i = 0; i < GPIO_BENCHMARK_GROUP_SIZE; i++)
+    {
+        pins[i] = GPIOPin_ConsumeAsOutput(chip, (unsigned char)i, "Benchmark Lines", GPIOOutputType_PushPull, GPIODigitalValue_Low);
+    }
+
+    Timer timer = Timer_CreateStack("Lines");
+    Timer_Start(&timer);
+    for (int i = 0; i < iterations; i++)
+    {
+        for (int j = 0; j < GPIO_BENCHMARK_GROUP_SIZE; j++)
+        {
+            GPIOPin_WriteValue(pins[j], ((i >> j) & 1) ? GPIODigitalValue_High : GPIODigitalValue_Low);
+        }
+    }
+    Timer_Stop(&timer);
+    *single = (GPIOBenchmarkResult){"8 lines, one by one", (long long)iterations * GPIO_BENCHMARK_GROUP_SIZE, Timer_GetElapsedNanoseconds(&timer), 0};
+
+    for (int i = 0; i < GPIO_BENCHMARK_GROUP_SIZE; i++)
+    {
+        GPIOPin_Release(pins[i]);
+    }
+
+    unsigned char indices[GPIO_BENCHMARK_GROUP_SIZE];
+    for (int i = 0; i < GPIO_BENCHMARK_GROUP_SIZE; i++)
+    {
+        indices[i] = (unsigned char)i;
+    }
+
+    GPIOPinGroup *group = GPIOPinGroup_ConsumeAsOutput(chip, indices, GPIO_BENCHMARK_GROUP_SIZE, "Benchmark Group", GPIOOutputType_PushPull, 0);
+
+    Timer_Reset(&timer);
+    Timer_Start(&timer);
+    for (int i = 0; i < iterations; i++)
+    {
+        GPIOPinGroup_WriteMask(group, (unsigned long long)i & 0xFF);
+    }
+    Timer_Stop(&timer);
+    *bulk = (GPIOBenchmarkResult){"8 lines, pin group", (long long)iterations * GPIO_BENCHMARK_GROUP_SIZE, Timer_GetElapsedNanoseconds(&timer), 0};
+
+    GPIOPinGroup_Release(group);
+}
+
+/// @brief Drives an input line from sysfs and waits for its edge through a GPIOEventReader.
+/// Measures kernel timestamp to userspace, which is the latency of the reader thread and the ring buffer.
+GPIOBenchmarkResult GPIOBenchmark_EdgeLatency(const GPIOChip *chip)
+{
+    GPIOBenchmark_DriveLine(GPIO_BENCHMARK_INPUT_LINE, false);
+
+    GPIOPin *pin = GPIOPin_ConsumeAsInput(chip, GPIO_BENCHMARK_INPUT_LINE, "Benchmark Edge", GPIOInputBiasType_Kolpa, GPIOInputEventType_BothEdges);
+    GPIOEventReader *reader = GPIOEventReader_Create(&pin, 1, 64);
+
+    unsigned long long total = 0;
+    unsigned long long worst = 0;
+    long long received = 0;
+
+    for (int i = 0; i < GPIO_BENCHMARK_EDGE_COUNT; i++)
+    {
+        // An edge arriving after the timeout of the last toggle would be taken as the edge of this one, so the queue is emptied first.
+        GPIOEdgeEvent event;
+        while (GPIOEventReader_Read(reader, &event, 1) > 0)
+        {
+        }
+
+        if (!GPIOBenchmark_DriveLine(GPIO_BENCHMARK_INPUT_LINE, (i & 1) == 0))
+        {
+            break;
+        }
+
+        // Polled like the app does every frame, without a frame delay.
+        unsigned long long timeout = GPIOBenchmark_GetTime() + 100000000ULL;
+        while (GPIOEventReader_Read(reader, &event, 1) == 0 && GPIOBenchmark_GetTime() < timeout)
+        {
+        }
+
+        unsigned long long now = GPIOBenchmark_GetTime();
+        if (now >= timeout)
+        {
+            continue;
+        }
+
+        unsigned long long latency = now > event.timestamp ? now - event.timestamp : 0;
+        total += latency;
+        worst = latency > worst ? latency : worst;
+        received++;
+    }
+
+    GPIOEventReader_Destroy(reader);
+    GPIOPin_Release(pin);
+
+    return (GPIOBenchmarkResult){"Edge to userspace", received, (time_t)total, worst};
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : GPIO_BENCHMARK_DEFAULT_ITERATIONS;
+    iterations = iterations > 0 ? iterations : GPIO_BENCHMARK_DEFAULT_ITERATIONS;
+
+    if (!GPIOBenchmark_CreateSimulator())
+    {
+        printf("GPIO benchmark skipped, the simulated chip is not available.\n");
+        return 0;
+    }
+
+    GPIOChip *chip = GPIOChip_Create(benchmarkChipPath);
+    if (chip == NULL)
+    {
+        GPIOBenchmark_DestroySimulator();
+        return 1;
+    }
+
+    GPIOBenchmarkResult results[5];
+    results[0] = GPIOBenchmark_Toggle(chip, iterations);
+    results[1] = GPIOBenchmark_Read(chip, iterations);
+    GPIOBenchmark_Bulk(chip, iterations, &results[2], &results[3]);
+    results[4] = GPIOBenchmark_EdgeLatency(chip);
+
+    printf("GPIO benchmark, gpio-sim chip %s\n", benchmarkChipPath);
+    printf("%-28s %10s %10s %14s %12s %12s\n", "Scenario", "Operations", "Time (ms)", "Operations/s", "Mean (ns)", "Worst (ns)");
+    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++)
+    {
+        GPIOBenchmark_Print(&results[i]);
+    }
+
+    GPIOChip_Destroy(chip);
+    GPIOBenchmark_DestroySimulator();
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    printf("GPIO benchmark skipped, gpio-sim is only available on Linux.\n");
+    return 0;
+}
+
+#endif // PLATFORM_LINUX
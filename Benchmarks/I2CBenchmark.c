@@ -0,0 +1,232 @@
+#ifdef __linux__
+#define _GNU_SOURCE // syscall of the ioctl stand-in
+#endif
+
+#include "Core.h"
+
+#include "Modules/I2CManager.h"
+
+#if PLATFORM_LINUX
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+// Measures I2CPoller against a stand-in of the i2c-dev driver, no hardware is needed. The stand-in replaces ioctl for this executable:
+// I2C_RDWR transactions are answered by simulated devices at the pace of a 400 kHz bus, every other request goes to the kernel.
+// Every byte of a simulated sample holds the same value, so a sample torn by the sequence lock shows as bytes which differ.
+// Readers run on the main thread while the poller publishes, build with -DCMAKE_C_FLAGS=-fsanitize=thread to check the sequence lock too.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./I2CBenchmark [milliseconds]
+
+#define I2C_BENCHMARK_DEFAULT_DURATION 500 // milliseconds of concurrent reads
+#define I2C_BENCHMARK_DEVICE_COUNT 4
+#define I2C_BENCHMARK_PERIOD 5000000            // nanoseconds between two reads of a device, a read of a whole sample takes 0.8 ms of the bus
+#define I2C_BENCHMARK_STOP_PERIOD 1000000000ULL // nanoseconds between two reads in the stop scenario, a stop must not wait for it
+#define I2C_BENCHMARK_BIT_NANOSECONDS 2500      // 400 kHz
+#define I2C_BENCHMARK_NACK_EVERY 1000           // every this many transactions is not acknowledged
+
+/// @brief Result of a benchmark scenario.
+typedef struct I2CBenchmarkResult
+{
+    const char *title;
+    long long operations;
+    time_t nanoseconds;
+    unsigned long long failures; // torn samples, or counts which do not match
+} I2CBenchmarkResult;
+
+_Atomic unsigned long long benchmarkTransactionCount = 0;
+_Atomic unsigned long long benchmarkNackCount = 0;
+
+/// @brief Gets the monotonic clock in nanoseconds. Same clock the poller stamps samples with.
+/// @return Current time.
+unsigned long long I2CBenchmark_GetTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+/// @brief Answers an I2C_RDWR transaction like a device on the bus. A read fills the bytes one at a time at the pace of the bus.
+/// @return Count of the messages done, or -1 with errno set like the driver when the device does not acknowledge.
+int I2CBenchmark_Transfer(struct i2c_rdwr_ioctl_data *transaction)
+{
+    unsigned long long index = atomic_fetch_add_explicit(&benchmarkTransactionCount, 1, memory_order_relaxed) + 1;
+    if (index % I2C_BENCHMARK_NACK_EVERY == 0)
+    {
+        atomic_fetch_add_explicit(&benchmarkNackCount, 1, memory_order_relaxed);
+        errno = EREMOTEIO;
+        return -1;
+    }
+
+    unsigned char value = (unsigned char)index;
+    for (unsigned int i = 0; i < transaction->nmsgs; i++)
+    {
+        struct i2c_msg *message = &transaction->msgs[i];
+
+        // Address byte and data bytes, 9 bits each with the acknowledge bit
+        unsigned long long due = I2CBenchmark_GetTime() + 9ULL * I2C_BENCHMARK_BIT_NANOSECONDS;
+        while (I2CBenchmark_GetTime() < due)
+        {
+        }
+
+        for (unsigned short j = 0; j < message->len; j++)
+        {
+            if (message->flags & I2C_M_RD)
+            {
+                message->buf[j] = value;
+            }
+
+            due += 9ULL * I2C_BENCHMARK_BIT_NANOSECONDS;
+            while (I2CBenchmark_GetTime() < due)
+            {
+            }
+        }
+    }
+
+    return (int)transaction->nmsgs;
+}
+
+/// @brief Stand-in of ioctl for this executable. I2C transactions go to the simulated devices, every other request to the kernel.
+int ioctl(int fileDescriptor, unsigned long request, ...)
+{
+    va_list arguments;
+    va_start(arguments, request);
+    void *argument = va_arg(arguments, void *);
+    va_end(arguments);
+
+    if (request == I2C_RDWR)
+    {
+        return I2CBenchmark_Transfer((struct i2c_rdwr_ioctl_data *)argument);
+    }
+
+    return (int)syscall(SYS_ioctl, fileDescriptor, request, argument);
+}
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+void I2CBenchmark_Print(const I2CBenchmarkResult *result)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-28s %10lld %10.2f %14.0f %12.0f %10llu\n",
+           result->title,
+           result->operations,
+           seconds * 1000.0,
+           seconds > 0.0 ? (double)result->operations / seconds : 0.0,
+           result->operations > 0 ? (double)result->nanoseconds / (double)result->operations : 0.0,
+           result->failures);
+}
+
+/// @brief Reads the latest samples of all devices while the poller publishes them, counting the torn samples.
+/// Also checks that every transaction which is not acknowledged is counted as an error of the poller.
+void I2CBenchmark_Concurrent(I2CBus *bus, int milliseconds, I2CBenchmarkResult *latest, I2CBenchmarkResult *published)
+{
+    I2CPoller *poller = I2CPoller_Create(bus);
+    int devices[I2C_BENCHMARK_DEVICE_COUNT];
+    for (int i = 0; i < I2C_BENCHMARK_DEVICE_COUNT; i++)
+    {
+        devices[i] = I2CPoller_AddDevice(poller, (unsigned char)(0x68 + i), 0x3B, I2C_POLLER_MAX_SAMPLE_SIZE, I2C_BENCHMARK_PERIOD);
+    }
+
+    atomic_store(&benchmarkTransactionCount, 0);
+    atomic_store(&benchmarkNackCount, 0);
+    I2CPoller_Start(poller);
+
+    unsigned long long torn = 0;
+    long long reads = 0;
+    unsigned long long start = I2CBenchmark_GetTime();
+    unsigned long long end = start + (unsigned long long)milliseconds * 1000000ULL;
+    for (int i = 0; I2CBenchmark_GetTime() < end; i++, reads++)
+    {
+        I2CSample sample;
+        if (!I2CPoller_GetLatest(poller, devices[i % I2C_BENCHMARK_DEVICE_COUNT], &sample))
+        {
+            continue;
+        }
+
+        for (unsigned int j = 1; j < sample.length; j++)
+        {
+            if (sample.data[j] != sample.data[0])
+            {
+                torn++;
+                break;
+            }
+        }
+    }
+    unsigned long long elapsed = I2CBenchmark_GetTime() - start;
+    *latest = (I2CBenchmarkResult){"Latest sample, concurrent", reads, (time_t)elapsed, torn};
+
+    // Every transaction not acknowledged is a counted error, but the one in progress when the counts are read
+    unsigned long long errors = I2CPoller_GetErrorCount(poller);
+    unsigned long long nacks = atomic_load(&benchmarkNackCount);
+    unsigned long long transactions = atomic_load(&benchmarkTransactionCount);
+    I2CPoller_Destroy(poller);
+
+    *published = (I2CBenchmarkResult){"Device reads", (long long)transactions, (time_t)elapsed, errors > nacks || nacks > errors + 1};
+}
+
+/// @brief Destroys a started poller waiting for a read a second away, the stop wakes it instead of waiting for the read.
+I2CBenchmarkResult I2CBenchmark_Stop(I2CBus *bus)
+{
+    I2CPoller *poller = I2CPoller_Create(bus);
+    int device = I2CPoller_AddDevice(poller, 0x68, 0x3B, 6, I2C_BENCHMARK_STOP_PERIOD);
+    I2CPoller_Start(poller);
+
+    // The first read is at the start, the poller then waits for the next one
+    I2CSample sample;
+    while (!I2CPoller_GetLatest(poller, device, &sample))
+    {
+    }
+
+    unsigned long long start = I2CBenchmark_GetTime();
+    I2CPoller_Destroy(poller);
+    unsigned long long elapsed = I2CBenchmark_GetTime() - start;
+
+    return (I2CBenchmarkResult){"Stop while waiting", 1, (time_t)elapsed, elapsed >= I2C_BENCHMARK_STOP_PERIOD / 2};
+}
+
+int main(int argc, char **argv)
+{
+    int milliseconds = argc > 1 ? atoi(argv[1]) : I2C_BENCHMARK_DEFAULT_DURATION;
+    milliseconds = milliseconds > 0 ? milliseconds : I2C_BENCHMARK_DEFAULT_DURATION;
+
+    // Any file opens as the bus, its transactions never reach the kernel
+    I2CBus *bus = I2CBus_Open("/dev/null");
+    if (bus == NULL)
+    {
+        return 1;
+    }
+
+    I2CBenchmarkResult results[3];
+    I2CBenchmark_Concurrent(bus, milliseconds, &results[0], &results[1]);
+    results[2] = I2CBenchmark_Stop(bus);
+
+    printf("I2C benchmark, %d devices of %d bytes every %d us on a simulated 400 kHz bus\n",
+           I2C_BENCHMARK_DEVICE_COUNT, I2C_POLLER_MAX_SAMPLE_SIZE, I2C_BENCHMARK_PERIOD / 1000);
+    printf("%-28s %10s %10s %14s %12s %10s\n", "Scenario", "Operations", "Time (ms)", "Operations/s", "Mean (ns)", "Failures");
+    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++)
+    {
+        I2CBenchmark_Print(&results[i]);
+    }
+
+    I2CBus_Close(bus);
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    printf("I2C benchmark skipped, i2c-dev is only available on Linux.\n");
+    return 0;
+}
+
+#endif // PLATFORM_LINUX
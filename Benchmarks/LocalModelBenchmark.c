@@ -0,0 +1,265 @@
+#include "Core.h"
+
+#include "AI/LocalModel.h"
+#include "Maths.h"
+#include "Utils.h"
+
+#include <math.h>
+#include <stdint.h>
+
+// Measures the prompt and generation speed of LocalModel in tokens per second on every supported instruction set and on a worker pool,
+// for 8 bit and 4 bit weights. Without a model file a model of random weights is written in the layout of LocalModel.h, the speed does not
+// depend on what the weights are.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./LocalModelBenchmark [model file] [threads]
+
+#define LOCAL_MODEL_BENCHMARK_DIMENSION 288
+#define LOCAL_MODEL_BENCHMARK_HIDDEN_DIMENSION 768
+#define LOCAL_MODEL_BENCHMARK_LAYERS 6
+#define LOCAL_MODEL_BENCHMARK_HEADS 6
+#define LOCAL_MODEL_BENCHMARK_VOCABULARY 4096
+#define LOCAL_MODEL_BENCHMARK_SEQUENCE 256
+#define LOCAL_MODEL_BENCHMARK_GROUP 32
+#define LOCAL_MODEL_BENCHMARK_TOKENS 128
+
+#define LOCAL_MODEL_BENCHMARK_PROMPT "The robot checked the sensors, read the temperature of the room and told the user that everything was fine."
+
+/// @brief Result of a benchmark scenario.
+typedef struct LocalModelBenchmarkResult
+{
+    const char *weights;
+    const char *method;
+    const char *level;
+    LocalModelStatistics statistics;
+    size_t sameLength; // characters equal to the text of the scalar level, float sums in another order can break near ties
+} LocalModelBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile char benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+void LocalModelBenchmark_Print(const LocalModelBenchmarkResult *result)
+{
+    const LocalModelStatistics *statistics = &result->statistics;
+
+    printf("%-8s %-12s %-8s %8zu %12.1f %8zu %12.1f %6zu\n",
+           result->weights,
+           result->method,
+           result->level,
+           statistics->promptTokens,
+           statistics->promptNanoseconds > 0 ? (double)statistics->promptTokens * 1e9 / (double)statistics->promptNanoseconds : 0.0,
+           statistics->generatedTokens,
+           statistics->generationNanoseconds > 0 ? (double)statistics->generatedTokens * 1e9 / (double)statistics->generationNanoseconds : 0.0,
+           result->sameLength);
+}
+
+/// @brief Gets the length of the common start of two texts.
+size_t LocalModelBenchmark_SameLength(const char *text, const char *reference)
+{
+    size_t length = 0;
+    while (text[length] != '\0' && text[length] == reference[length])
+    {
+        length++;
+    }
+
+    return length;
+}
+
+/// @brief Writes zeros up to the file alignment.
+void LocalModelBenchmark_Pad(FILE *file)
+{
+    static const char zeros[LOCAL_MODEL_FILE_ALIGNMENT] = {0};
+    long offset = ftell(file);
+    fwrite(zeros, 1, (size_t)((LOCAL_MODEL_FILE_ALIGNMENT - offset % LOCAL_MODEL_FILE_ALIGNMENT) % LOCAL_MODEL_FILE_ALIGNMENT), file);
+}
+
+/// @brief Writes a quantized matrix of random values, scaled so a product keeps about the magnitude of its input.
+void LocalModelBenchmark_WriteMatrix(FILE *file, size_t rows, size_t columns, uint32_t bits)
+{
+    size_t count = rows * columns;
+    size_t valuesSize = bits == 4 ? count / 2 : count;
+
+    unsigned char *values = (unsigned char *)malloc(valuesSize);
+    float *scales = (float *)malloc(count / LOCAL_MODEL_BENCHMARK_GROUP * sizeof(float));
+    for (size_t i = 0; i < valuesSize; i++)
+    {
+        values[i] = bits == 4 ? (unsigned char)rand() : (unsigned char)(int8_t)(rand() % 255 - 127);
+    }
+
+    float largest = bits == 4 ? 8.0f : 127.0f;
+    for (size_t i = 0; i < count / LOCAL_MODEL_BENCHMARK_GROUP; i++)
+    {
+        scales[i] = ((float)rand() / (float)RAND_MAX + 0.5f) / (largest * sqrtf((float)columns));
+    }
+
+    fwrite(values, 1, valuesSize, file);
+    LocalModelBenchmark_Pad(file);
+    fwrite(scales, sizeof(float), count / LOCAL_MODEL_BENCHMARK_GROUP, file);
+    LocalModelBenchmark_Pad(file);
+
+    free(scales);
+    free(values);
+}
+
+/// @brief Writes a model of random weights. The vocabulary is the bytes, the begin and end tokens, then merges of letters and earlier merges.
+bool LocalModelBenchmark_WriteModel(const char *path, uint32_t bits)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    LocalModelHeader header = {LOCAL_MODEL_MAGIC, LOCAL_MODEL_VERSION, LOCAL_MODEL_BENCHMARK_VOCABULARY, LOCAL_MODEL_BENCHMARK_DIMENSION,
+                               LOCAL_MODEL_BENCHMARK_HIDDEN_DIMENSION, LOCAL_MODEL_BENCHMARK_LAYERS, LOCAL_MODEL_BENCHMARK_HEADS, LOCAL_MODEL_BENCHMARK_HEADS,
+                               LOCAL_MODEL_BENCHMARK_SEQUENCE, bits, LOCAL_MODEL_BENCHMARK_GROUP, 256, 257};
+    fwrite(&header, sizeof(header), 1, file);
+
+    static char tokens[LOCAL_MODEL_BENCHMARK_VOCABULARY][16];
+    for (uint32_t i = 0; i < LOCAL_MODEL_BENCHMARK_VOCABULARY; i++)
+    {
+        if (i < 256)
+        {
+            tokens[i][0] = (char)i;
+            tokens[i][1] = '\0';
+        }
+        else if (i < 258)
+        {
+            strcpy(tokens[i], i == 256 ? "<s>" : "</s>");
+        }
+        else
+        {
+            // A letter or a space, followed by a letter or the start of an earlier merge
+            const char *letters = " etaoinshrdlucmfwypvbgk";
+            char first = letters[rand() % 23];
+            const char *second = i > 300 && rand() % 2 == 0 ? tokens[258 + rand() % (i - 258)] : (char[]){letters[1 + rand() % 22], '\0'};
+            snprintf(tokens[i], sizeof(tokens[i]), "%c%.14s", first, second);
+        }
+
+        float score = i < 258 ? 0.0f : -(float)i;
+        uint32_t length = (uint32_t)strlen(tokens[i]);
+        length = length > 0 ? length : 1; // the zero byte
+        fwrite(&score, sizeof(score), 1, file);
+        fwrite(&length, sizeof(length), 1, file);
+        fwrite(tokens[i], 1, length, file);
+    }
+    LocalModelBenchmark_Pad(file);
+
+    size_t normCount = (2 * LOCAL_MODEL_BENCHMARK_LAYERS + 1) * LOCAL_MODEL_BENCHMARK_DIMENSION;
+    for (size_t i = 0; i < normCount; i++)
+    {
+        float weight = 1.0f;
+        fwrite(&weight, sizeof(weight), 1, file);
+    }
+    LocalModelBenchmark_Pad(file);
+
+    LocalModelBenchmark_WriteMatrix(file, LOCAL_MODEL_BENCHMARK_VOCABULARY, LOCAL_MODEL_BENCHMARK_DIMENSION, bits);
+    for (size_t i = 0; i < LOCAL_MODEL_BENCHMARK_LAYERS; i++)
+    {
+        for (size_t j = 0; j < 4; j++)
+        {
+            LocalModelBenchmark_WriteMatrix(file, LOCAL_MODEL_BENCHMARK_DIMENSION, LOCAL_MODEL_BENCHMARK_DIMENSION, bits);
+        }
+        LocalModelBenchmark_WriteMatrix(file, LOCAL_MODEL_BENCHMARK_HIDDEN_DIMENSION, LOCAL_MODEL_BENCHMARK_DIMENSION, bits);
+        LocalModelBenchmark_WriteMatrix(file, LOCAL_MODEL_BENCHMARK_HIDDEN_DIMENSION, LOCAL_MODEL_BENCHMARK_DIMENSION, bits);
+        LocalModelBenchmark_WriteMatrix(file, LOCAL_MODEL_BENCHMARK_DIMENSION, LOCAL_MODEL_BENCHMARK_HIDDEN_DIMENSION, bits);
+    }
+    LocalModelBenchmark_WriteMatrix(file, LOCAL_MODEL_BENCHMARK_VOCABULARY, LOCAL_MODEL_BENCHMARK_DIMENSION, bits);
+
+    return fclose(file) == 0;
+}
+
+/// @brief Runs the scenarios of a model file.
+void LocalModelBenchmark_Run(const char *path, const char *weights, WorkerPool *pool)
+{
+    LocalModel *model = LocalModel_Load((const string)path, NULL);
+    LocalModel *pooledModel = LocalModel_Load((const string)path, pool);
+    if (model == NULL || pooledModel == NULL)
+    {
+        printf("Failed to load model file '%s'\n", path);
+        return;
+    }
+
+    LocalModelSampling sampling = LocalModel_GetDefaultSampling();
+    sampling.maxTokens = LOCAL_MODEL_BENCHMARK_TOKENS;
+
+    stringHeap reference = NULL;
+    SimdLevel detectedLevel = Simd_GetLevel();
+    SimdLevel levels[] = {SimdLevel_Scalar, SimdLevel_SSE2, SimdLevel_AVX2, SimdLevel_NEON};
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        // Levels the CPU does not have are skipped instead of being clamped to another level.
+        bool isSupported = levels[i] == SimdLevel_Scalar || levels[i] == detectedLevel || (levels[i] == SimdLevel_SSE2 && detectedLevel == SimdLevel_AVX2);
+        if (!isSupported)
+        {
+            continue;
+        }
+
+        Simd_SetLevel(levels[i]);
+
+        stringHeap text = LocalModel_Generate(model, LOCAL_MODEL_BENCHMARK_PROMPT, &sampling);
+        benchmarkSink = text[0];
+        reference = reference == NULL ? StringDuplicate(text) : reference;
+
+        LocalModelBenchmarkResult result = {weights, "Single", Simd_GetLevelName(levels[i]), LocalModel_GetStatistics(model), LocalModelBenchmark_SameLength(text, reference)};
+        LocalModelBenchmark_Print(&result);
+        free(text);
+    }
+
+    Simd_SetLevel(detectedLevel);
+
+    char method[32];
+    snprintf(method, sizeof(method), "%zu threads", WorkerPool_GetThreadCount(pool));
+    stringHeap text = LocalModel_Generate(pooledModel, LOCAL_MODEL_BENCHMARK_PROMPT, &sampling);
+    benchmarkSink = text[0];
+    LocalModelBenchmarkResult result = {weights, method, Simd_GetLevelName(detectedLevel), LocalModel_GetStatistics(pooledModel), LocalModelBenchmark_SameLength(text, reference)};
+    LocalModelBenchmark_Print(&result);
+    free(text);
+
+    sampling.temperature = 0.8f;
+    sampling.topK = 40;
+    text = LocalModel_Generate(pooledModel, LOCAL_MODEL_BENCHMARK_PROMPT, &sampling);
+    benchmarkSink = text[0];
+    result = (LocalModelBenchmarkResult){weights, "Top 40", Simd_GetLevelName(detectedLevel), LocalModel_GetStatistics(pooledModel), LocalModelBenchmark_SameLength(text, reference)};
+    LocalModelBenchmark_Print(&result);
+    free(text);
+
+    free(reference);
+    LocalModel_Destroy(pooledModel);
+    LocalModel_Destroy(model);
+}
+
+int main(int argc, char **argv)
+{
+    int threads = argc > 2 ? atoi(argv[2]) : 0;
+    threads = threads > 0 ? threads : 0;
+
+    WorkerPool *pool = WorkerPool_Create((size_t)threads);
+
+    printf("LocalModel benchmark, %zu threads, detected %s\n", WorkerPool_GetThreadCount(pool), Simd_GetLevelName(Simd_GetLevel()));
+    printf("%-8s %-12s %-8s %8s %12s %8s %12s %6s\n", "Weights", "Method", "Level", "Prompt", "Prompt tok/s", "Answer", "Answer tok/s", "Same");
+
+    if (argc > 1)
+    {
+        LocalModelBenchmark_Run(argv[1], "File", pool);
+    }
+    else
+    {
+        const char *path = "LocalModelBenchmark.model";
+        uint32_t bits[] = {8, 4};
+        for (size_t i = 0; i < sizeof(bits) / sizeof(bits[0]); i++)
+        {
+            if (!LocalModelBenchmark_WriteModel(path, bits[i]))
+            {
+                printf("Failed to write model file '%s'\n", path);
+                break;
+            }
+
+            LocalModelBenchmark_Run(path, bits[i] == 8 ? "Int8" : "Int4", pool);
+            remove(path);
+        }
+    }
+
+    WorkerPool_Destroy(pool);
+
+    return 0;
+}
@@ -0,0 +1,245 @@
+#include "Core.h"
+
+#include "Maths.h"
+#include "Utils/Timer.h"
+
+// Compares the batch maths kernels of every supported instruction set with the by-value functions they replace,
+// and the Matrix4 kernels with the scalar code they replace.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./MathsBenchmark [vectors] [rounds]
+
+#define MATHS_BENCHMARK_DEFAULT_VECTORS 4096
+#define MATHS_BENCHMARK_DEFAULT_ROUNDS 2000
+
+/// @brief Result of a benchmark scenario.
+typedef struct MathsBenchmarkResult
+{
+    const char *title;
+    const char *level;
+    long long operations;
+    time_t nanoseconds;
+} MathsBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile float benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+/// @param baseline Nanoseconds of the replaced code for the same work, for the speed up column.
+void MathsBenchmark_Print(const MathsBenchmarkResult *result, time_t baseline)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-22s %-8s %12lld %10.2f %16.0f %8.2fx\n",
+           result->title,
+           result->level,
+           result->operations,
+           seconds * 1000.0,
+           seconds > 0.0 ? (double)result->operations / seconds : 0.0,
+           result->nanoseconds > 0 ? (double)baseline / (double)result->nanoseconds : 0.0);
+}
+
+/// @brief Runs the by-value Vector3 functions over an array of structures, the code the batch functions replace.
+time_t MathsBenchmark_ByValue(Vector3 *vectors, Vector3 *others, float *dots, size_t count, int rounds)
+{
+    Timer timer = Timer_CreateStack("By value");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            Vector3 vector = Vector3_Lerp(Vector3_Add(vectors[i], others[i]), others[i], 0.25f);
+            vector = Vector3_Normalized(Vector3_Multiply(vector, 2.0f));
+            dots[i] = Vector3_Dot(vector, others[i]);
+        }
+
+        benchmarkSink = dots[round % count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Runs the same operations with the batch functions on the given instruction set.
+time_t MathsBenchmark_Batch(const Vector3Batch *vectors, const Vector3Batch *others, Vector3Batch *result, float *dots, int rounds)
+{
+    Timer timer = Timer_CreateStack("Batch");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        Vector3Batch_Add(vectors, others, result);
+        Vector3Batch_Lerp(result, others, 0.25f, result);
+        Vector3Batch_Multiply(result, 2.0f, result);
+        Vector3Batch_Normalize(result, result);
+        Vector3Batch_Dot(result, others, dots);
+
+        benchmarkSink = dots[(size_t)round % vectors->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Multiplies every matrix with the next one with Matrix4_Dot.
+time_t MathsBenchmark_Matrix4Dot(const Matrix4 *matrices, size_t count, int rounds)
+{
+    Timer timer = Timer_CreateStack("Matrix4 dot");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; i++)
+        {
+            Matrix4 result = Matrix4_Dot(&matrices[i], &matrices[(i + 1) % count]);
+            sum += result.matrix[round % 4][i % 4];
+        }
+
+        benchmarkSink = sum;
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Inverts every matrix with Matrix4_Inverse.
+time_t MathsBenchmark_Matrix4Inverse(const Matrix4 *matrices, size_t count, int rounds)
+{
+    Timer timer = Timer_CreateStack("Matrix4 inverse");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; i++)
+        {
+            Matrix4 result = Matrix4_Inverse(&matrices[i]);
+            sum += result.matrix[round % 4][i % 4];
+        }
+
+        benchmarkSink = sum;
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Transforms a batch of points by a single matrix.
+time_t MathsBenchmark_Transform(const Matrix4 *matrix, const Vector3Batch *points, Vector3Batch *result, int rounds)
+{
+    Timer timer = Timer_CreateStack("Transform");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        Vector3Batch_Transform(points, matrix, result);
+        benchmarkSink = result->x[(size_t)round % points->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Checks if the CPU has an instruction set. Levels the CPU does not have are skipped instead of being clamped to another level.
+bool MathsBenchmark_IsSupported(SimdLevel level, SimdLevel detectedLevel)
+{
+    return level == SimdLevel_Scalar || level == detectedLevel || (level == SimdLevel_SSE2 && detectedLevel == SimdLevel_AVX2);
+}
+
+int main(int argc, char **argv)
+{
+    int vectorCount = argc > 1 ? atoi(argv[1]) : MATHS_BENCHMARK_DEFAULT_VECTORS;
+    int rounds = argc > 2 ? atoi(argv[2]) : MATHS_BENCHMARK_DEFAULT_ROUNDS;
+    vectorCount = vectorCount > 0 ? vectorCount : MATHS_BENCHMARK_DEFAULT_VECTORS;
+    rounds = rounds > 0 ? rounds : MATHS_BENCHMARK_DEFAULT_ROUNDS;
+
+    size_t count = (size_t)vectorCount;
+    long long operations = (long long)count * rounds;
+
+    Vector3 *vectors = (Vector3 *)malloc(count * sizeof(Vector3));
+    Vector3 *others = (Vector3 *)malloc(count * sizeof(Vector3));
+    float *dots = Simd_AllocateFloats(count);
+
+    Vector3Batch *vectorBatch = Vector3Batch_Create(count);
+    Vector3Batch *otherBatch = Vector3Batch_Create(count);
+    Vector3Batch *resultBatch = Vector3Batch_Create(count);
+
+    // Sensor like values, a slowly turning vector and a noisy offset
+    for (size_t i = 0; i < count; i++)
+    {
+        vectors[i] = NewVector3((float)(i % 97) * 0.01f, 9.81f - (float)(i % 13) * 0.02f, (float)(i % 31) * -0.03f);
+        others[i] = NewVector3(0.5f, (float)(i % 7) * 0.1f, 1.0f - (float)(i % 5) * 0.1f);
+
+        Vector3Batch_Set(vectorBatch, i, vectors[i]);
+        Vector3Batch_Set(otherBatch, i, others[i]);
+    }
+
+    SimdLevel detectedLevel = Simd_GetLevel();
+    SimdLevel levels[] = {SimdLevel_Scalar, SimdLevel_SSE2, SimdLevel_AVX2, SimdLevel_NEON};
+
+    time_t baseline = MathsBenchmark_ByValue(vectors, others, dots, count, rounds);
+    MathsBenchmarkResult byValue = {"Vector3 by value", "-", operations, baseline};
+
+    printf("Maths benchmark, %zu vectors, %d rounds, detected %s\n", count, rounds, Simd_GetLevelName(detectedLevel));
+    printf("%-22s %-8s %12s %10s %16s %9s\n", "Scenario", "Level", "Vectors", "Time (ms)", "Vectors/second", "Speed up");
+    MathsBenchmark_Print(&byValue, baseline);
+
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        if (!MathsBenchmark_IsSupported(levels[i], detectedLevel))
+        {
+            continue;
+        }
+
+        Simd_SetLevel(levels[i]);
+        MathsBenchmarkResult batch = {"Vector3 batch", Simd_GetLevelName(levels[i]), operations, MathsBenchmark_Batch(vectorBatch, otherBatch, resultBatch, dots, rounds)};
+        MathsBenchmark_Print(&batch, baseline);
+    }
+
+    // Matrix4 kernels against the scalar kernels, the loops Matrix4_Dot had before. Rotations and translations, always invertible.
+    Matrix4 *matrices = (Matrix4 *)malloc(count * sizeof(Matrix4));
+    for (size_t i = 0; i < count; i++)
+    {
+        Matrix4 identity = Matrix4_Identity();
+        matrices[i] = Matrix4_Rotate(&identity, (float)(i % 360) * 0.0175f, 0.2f, 1.0f, (float)(i % 3));
+        matrices[i] = Matrix4_Translate(&matrices[i], (float)(i % 11), -1.5f, (float)(i % 7) * 0.5f);
+    }
+
+    printf("%-22s %-8s %12s %10s %16s %9s\n", "Scenario", "Level", "Operations", "Time (ms)", "Operations/s", "Speed up");
+
+    time_t matrixBaselines[3] = {0};
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        if (!MathsBenchmark_IsSupported(levels[i], detectedLevel))
+        {
+            continue;
+        }
+
+        Simd_SetLevel(levels[i]);
+        MathsBenchmarkResult results[3] = {
+            {"Matrix4 dot", Simd_GetLevelName(levels[i]), operations, MathsBenchmark_Matrix4Dot(matrices, count, rounds)},
+            {"Matrix4 inverse", Simd_GetLevelName(levels[i]), operations, MathsBenchmark_Matrix4Inverse(matrices, count, rounds)},
+            {"Vector3 transform", Simd_GetLevelName(levels[i]), operations, MathsBenchmark_Transform(&matrices[1], vectorBatch, resultBatch, rounds)},
+        };
+
+        for (int r = 0; r < 3; r++)
+        {
+            // Scalar is the first level, the baseline of the others
+            matrixBaselines[r] = levels[i] == SimdLevel_Scalar ? results[r].nanoseconds : matrixBaselines[r];
+            MathsBenchmark_Print(&results[r], matrixBaselines[r]);
+        }
+    }
+
+    Simd_SetLevel(detectedLevel);
+
+    free(matrices);
+    Vector3Batch_Destroy(resultBatch);
+    Vector3Batch_Destroy(otherBatch);
+    Vector3Batch_Destroy(vectorBatch);
+    Simd_Free(dots);
+    free(others);
+    free(vectors);
+
+    return 0;
+}
@@ -0,0 +1,255 @@
+#include "Core.h"
+
+#include "Maths.h"
+#include "Utils.h"
+
+#include <math.h>
+
+// Measures MatrixN_Dot on every supported instruction set and on a worker pool against a plain triple loop, for a small,
+// a medium and a given size of square matrices, and the solves of a system and a least squares fit.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./MatrixNBenchmark [size] [threads]
+
+#define MATRIX_N_BENCHMARK_DEFAULT_SIZE 512
+#define MATRIX_N_BENCHMARK_MAXIMUM_SIZE 4096
+#define MATRIX_N_BENCHMARK_WORK 200000000.0 // multiply-adds per measurement, small products are repeated up to it
+#define MATRIX_N_BENCHMARK_FIT_ROWS 10000   // measurements of the least squares fit
+#define MATRIX_N_BENCHMARK_FIT_COLUMNS 16   // parameters of the least squares fit
+
+/// @brief Result of a benchmark scenario.
+typedef struct MatrixNBenchmarkResult
+{
+    size_t size;
+    const char *method;
+    const char *level;
+    double maximumError;
+    double operations; // floating point operations of a single run, a multiply-add is two
+    int runs;
+    time_t nanoseconds;
+} MatrixNBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile float benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+/// @param baseline Nanoseconds per run of the triple loop for the same size, for the speed up column. 0 for none.
+void MatrixNBenchmark_Print(const MatrixNBenchmarkResult *result, double baseline)
+{
+    double perRun = (double)result->nanoseconds / (double)result->runs;
+
+    printf("%6zu %-14s %-8s %12.3g %14.1f %10.2f ",
+           result->size,
+           result->method,
+           result->level,
+           result->maximumError,
+           perRun / 1000.0,
+           perRun > 0.0 ? result->operations / perRun : 0.0);
+
+    if (baseline > 0.0 && perRun > 0.0)
+    {
+        printf("%9.2fx\n", baseline / perRun);
+    }
+    else
+    {
+        printf("%10s\n", "-");
+    }
+}
+
+/// @brief Fills a matrix with random values in [-1, 1].
+void MatrixNBenchmark_Fill(MatrixN *matrix)
+{
+    for (size_t i = 0; i < matrix->rows; i++)
+    {
+        for (size_t j = 0; j < matrix->columns; j++)
+        {
+            matrix->data[i * matrix->stride + j] = (float)rand() / (float)RAND_MAX * 2.0f - 1.0f;
+        }
+    }
+}
+
+/// @brief The baseline, a triple loop in the cache friendly order without blocking or packing.
+void MatrixNBenchmark_NaiveDot(const MatrixN *left, const MatrixN *right, MatrixN *result)
+{
+    MatrixN_Fill(result, 0.0f);
+    for (size_t i = 0; i < left->rows; i++)
+    {
+        float *resultRow = result->data + i * result->stride;
+        for (size_t k = 0; k < left->columns; k++)
+        {
+            float value = left->data[i * left->stride + k];
+            const float *rightRow = right->data + k * right->stride;
+            for (size_t j = 0; j < right->columns; j++)
+            {
+                resultRow[j] += value * rightRow[j];
+            }
+        }
+    }
+}
+
+/// @brief Gets the maximum absolute difference of two matrices.
+double MatrixNBenchmark_Error(const MatrixN *matrix, const MatrixN *reference)
+{
+    double maximumError = 0.0;
+    for (size_t i = 0; i < matrix->rows; i++)
+    {
+        for (size_t j = 0; j < matrix->columns; j++)
+        {
+            maximumError = fmax(maximumError, fabs((double)matrix->data[i * matrix->stride + j] - (double)reference->data[i * reference->stride + j]));
+        }
+    }
+
+    return maximumError;
+}
+
+/// @brief Runs the product scenarios of a size.
+void MatrixNBenchmark_RunDot(size_t size, WorkerPool *pool)
+{
+    MatrixN *left = MatrixN_Create(size, size);
+    MatrixN *right = MatrixN_Create(size, size);
+    MatrixN *reference = MatrixN_Create(size, size);
+    MatrixN *result = MatrixN_Create(size, size);
+    MatrixNBenchmark_Fill(left);
+    MatrixNBenchmark_Fill(right);
+
+    double operations = 2.0 * (double)size * (double)size * (double)size;
+    int runs = (int)ceil(MATRIX_N_BENCHMARK_WORK * 2.0 / operations);
+
+    Timer timer = Timer_CreateStack("Naive");
+    Timer_Start(&timer);
+    for (int run = 0; run < runs; run++)
+    {
+        MatrixNBenchmark_NaiveDot(left, right, reference);
+        benchmarkSink = reference->data[0];
+    }
+    Timer_Stop(&timer);
+    MatrixNBenchmarkResult naive = {size, "Triple loop", "Scalar", 0.0, operations, runs, Timer_GetElapsedNanoseconds(&timer)};
+    double baseline = (double)naive.nanoseconds / (double)runs;
+    MatrixNBenchmark_Print(&naive, baseline);
+
+    SimdLevel detectedLevel = Simd_GetLevel();
+    SimdLevel levels[] = {SimdLevel_Scalar, SimdLevel_SSE2, SimdLevel_AVX2, SimdLevel_NEON};
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        // Levels the CPU does not have are skipped instead of being clamped to another level.
+        bool isSupported = levels[i] == SimdLevel_Scalar || levels[i] == detectedLevel || (levels[i] == SimdLevel_SSE2 && detectedLevel == SimdLevel_AVX2);
+        if (!isSupported)
+        {
+            continue;
+        }
+
+        Simd_SetLevel(levels[i]);
+
+        timer = Timer_CreateStack("Blocked");
+        Timer_Start(&timer);
+        for (int run = 0; run < runs; run++)
+        {
+            MatrixN_Dot(left, right, result, NULL);
+            benchmarkSink = result->data[0];
+        }
+        Timer_Stop(&timer);
+        MatrixNBenchmarkResult blocked = {size, "MatrixN_Dot", Simd_GetLevelName(levels[i]), MatrixNBenchmark_Error(result, reference), operations, runs, Timer_GetElapsedNanoseconds(&timer)};
+        MatrixNBenchmark_Print(&blocked, baseline);
+    }
+
+    Simd_SetLevel(detectedLevel);
+
+    char method[32];
+    snprintf(method, sizeof(method), "%zu threads", WorkerPool_GetThreadCount(pool));
+    timer = Timer_CreateStack("Parallel");
+    Timer_Start(&timer);
+    for (int run = 0; run < runs; run++)
+    {
+        MatrixN_Dot(left, right, result, pool);
+        benchmarkSink = result->data[0];
+    }
+    Timer_Stop(&timer);
+    MatrixNBenchmarkResult parallel = {size, method, Simd_GetLevelName(detectedLevel), MatrixNBenchmark_Error(result, reference), operations, runs, Timer_GetElapsedNanoseconds(&timer)};
+    MatrixNBenchmark_Print(&parallel, baseline);
+
+    MatrixN_Destroy(result);
+    MatrixN_Destroy(reference);
+    MatrixN_Destroy(right);
+    MatrixN_Destroy(left);
+}
+
+/// @brief Runs the solve scenarios, a system of a size with LU and a least squares fit with Cholesky. The error is of the solution against the known one.
+void MatrixNBenchmark_RunSolves(size_t size, WorkerPool *pool)
+{
+    MatrixN *matrix = MatrixN_Create(size, size);
+    MatrixN *lu = MatrixN_Create(size, size);
+    MatrixN *solution = MatrixN_Create(size, 1);
+    MatrixN *rightSide = MatrixN_Create(size, 1);
+    size_t *pivots = (size_t *)malloc(size * sizeof(size_t));
+    MatrixNBenchmark_Fill(matrix);
+    MatrixNBenchmark_Fill(solution);
+    for (size_t i = 0; i < size; i++)
+    {
+        matrix->data[i * matrix->stride + i] += (float)size; // diagonally dominant, so the float solution stays close
+    }
+
+    Timer timer = Timer_CreateStack("LU");
+    Timer_Start(&timer);
+    MatrixN_Copy(matrix, lu);
+    MatrixN_Dot(matrix, solution, rightSide, NULL);
+    bool isSolved = MatrixN_DecomposeLU(lu, pivots);
+    MatrixN_SolveLU(lu, pivots, rightSide);
+    Timer_Stop(&timer);
+    MatrixNBenchmarkResult luSolve = {size, "LU solve", isSolved ? "Scalar" : "Singular", MatrixNBenchmark_Error(rightSide, solution),
+                                      2.0 / 3.0 * (double)size * (double)size * (double)size, 1, Timer_GetElapsedNanoseconds(&timer)};
+    MatrixNBenchmark_Print(&luSolve, 0.0);
+
+    MatrixN *a = MatrixN_Create(MATRIX_N_BENCHMARK_FIT_ROWS, MATRIX_N_BENCHMARK_FIT_COLUMNS);
+    MatrixN *parameters = MatrixN_Create(MATRIX_N_BENCHMARK_FIT_COLUMNS, 1);
+    MatrixN *measurements = MatrixN_Create(MATRIX_N_BENCHMARK_FIT_ROWS, 1);
+    MatrixN *fit = MatrixN_Create(MATRIX_N_BENCHMARK_FIT_COLUMNS, 1);
+    MatrixNBenchmark_Fill(a);
+    MatrixNBenchmark_Fill(parameters);
+    MatrixN_Dot(a, parameters, measurements, NULL);
+
+    timer = Timer_CreateStack("Least squares");
+    Timer_Start(&timer);
+    isSolved = MatrixN_SolveLeastSquares(a, measurements, fit, pool);
+    Timer_Stop(&timer);
+    MatrixNBenchmarkResult leastSquares = {MATRIX_N_BENCHMARK_FIT_ROWS, "Least squares", isSolved ? Simd_GetLevelName(Simd_GetLevel()) : "Singular",
+                                           MatrixNBenchmark_Error(fit, parameters),
+                                           2.0 * MATRIX_N_BENCHMARK_FIT_ROWS * MATRIX_N_BENCHMARK_FIT_COLUMNS * (MATRIX_N_BENCHMARK_FIT_COLUMNS + 1), 1, Timer_GetElapsedNanoseconds(&timer)};
+    MatrixNBenchmark_Print(&leastSquares, 0.0);
+
+    MatrixN_Destroy(fit);
+    MatrixN_Destroy(measurements);
+    MatrixN_Destroy(parameters);
+    MatrixN_Destroy(a);
+    free(pivots);
+    MatrixN_Destroy(rightSide);
+    MatrixN_Destroy(solution);
+    MatrixN_Destroy(lu);
+    MatrixN_Destroy(matrix);
+}
+
+int main(int argc, char **argv)
+{
+    int size = argc > 1 ? atoi(argv[1]) : MATRIX_N_BENCHMARK_DEFAULT_SIZE;
+    int threads = argc > 2 ? atoi(argv[2]) : 0;
+    size = size > 0 && size <= MATRIX_N_BENCHMARK_MAXIMUM_SIZE ? size : MATRIX_N_BENCHMARK_DEFAULT_SIZE;
+    threads = threads > 0 ? threads : 0;
+
+    WorkerPool *pool = WorkerPool_Create((size_t)threads);
+
+    printf("MatrixN benchmark, up to %d x %d, %zu threads, detected %s\n", size, size, WorkerPool_GetThreadCount(pool), Simd_GetLevelName(Simd_GetLevel()));
+    printf("%6s %-14s %-8s %12s %14s %10s %10s\n", "Size", "Method", "Level", "Max error", "Time (us)", "GFLOP/s", "Speed up");
+
+    size_t sizes[] = {8, 64, (size_t)size};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        if (i == 0 || sizes[i] > sizes[i - 1])
+        {
+            MatrixNBenchmark_RunDot(sizes[i], pool);
+        }
+    }
+
+    MatrixNBenchmark_RunSolves((size_t)size, pool);
+
+    WorkerPool_Destroy(pool);
+
+    return 0;
+}
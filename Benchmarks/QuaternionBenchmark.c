@@ -0,0 +1,282 @@
+#include "Core.h"
+
+#include "Maths.h"
+#include "Utils/Timer.h"
+
+#include <math.h>
+
+// Compares quaternion rotations with the Matrix4 code they replace: composing chains of rotations,
+// integrating gyroscope readings into an orientation and rotating arrays of points.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./QuaternionBenchmark [rotations] [rounds]
+
+#define QUATERNION_BENCHMARK_DEFAULT_ROTATIONS 4096
+#define QUATERNION_BENCHMARK_DEFAULT_ROUNDS 500
+#define QUATERNION_BENCHMARK_TIME_STEP 0.001f // a 1 kHz IMU
+
+/// @brief Result of a benchmark scenario.
+typedef struct QuaternionBenchmarkResult
+{
+    const char *title;
+    const char *method;
+    double maximumError; // largest element difference of the rotation matrices or the points from the baseline
+    long long operations;
+    time_t nanoseconds;
+} QuaternionBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile float benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+/// @param baseline Nanoseconds of the Matrix4 code for the same work, for the speed up column.
+void QuaternionBenchmark_Print(const QuaternionBenchmarkResult *result, time_t baseline)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-16s %-22s %12.3g %10.2f %16.0f %8.2fx\n",
+           result->title,
+           result->method,
+           result->maximumError,
+           seconds * 1000.0,
+           seconds > 0.0 ? (double)result->operations / seconds : 0.0,
+           result->nanoseconds > 0 ? (double)baseline / (double)result->nanoseconds : 0.0);
+}
+
+/// @brief Gets the largest element difference of two matrices.
+double QuaternionBenchmark_MatrixError(const Matrix4 *matrix1, const Matrix4 *matrix2)
+{
+    double maximumError = 0.0;
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            maximumError = fmax(maximumError, fabs((double)matrix1->matrix[i][j] - (double)matrix2->matrix[i][j]));
+    return maximumError;
+}
+
+/// @brief Composes the chain of rotation matrices with Matrix4_Dot, every round.
+time_t QuaternionBenchmark_ComposeMatrix(const Matrix4 *matrices, size_t count, int rounds, Matrix4 *result)
+{
+    Timer timer = Timer_CreateStack("Compose matrix");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        Matrix4 composed = Matrix4_Identity();
+        for (size_t i = 0; i < count; i++)
+        {
+            composed = Matrix4_Dot(&composed, &matrices[i]);
+        }
+
+        *result = composed;
+        benchmarkSink = composed.matrix[0][0];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Composes the chain of rotations with Quaternion_Compose, every round.
+time_t QuaternionBenchmark_ComposeQuaternion(const Quaternion *rotations, size_t count, int rounds, Quaternion *result)
+{
+    Timer timer = Timer_CreateStack("Compose quaternion");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        *result = Quaternion_Compose(rotations, count);
+        benchmarkSink = result->w;
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Integrates the gyroscope readings into an orientation matrix with Matrix4_Rotate.
+time_t QuaternionBenchmark_IntegrateMatrix(const Vector3 *rates, size_t count, int rounds, Matrix4 *result)
+{
+    Timer timer = Timer_CreateStack("Integrate matrix");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        Matrix4 orientation = Matrix4_Identity();
+        for (size_t i = 0; i < count; i++)
+        {
+            float rate = Vector3_Magnitude(rates[i]);
+            orientation = Matrix4_Rotate(&orientation, rate * QUATERNION_BENCHMARK_TIME_STEP, rates[i].x, rates[i].y, rates[i].z);
+        }
+
+        *result = orientation;
+        benchmarkSink = orientation.matrix[0][0];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Integrates the gyroscope readings into an orientation with Quaternion_Integrate.
+time_t QuaternionBenchmark_IntegrateQuaternion(const Vector3 *rates, size_t count, int rounds, Quaternion *result)
+{
+    Timer timer = Timer_CreateStack("Integrate quaternion");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        Quaternion orientation = Quaternion_Identity();
+        for (size_t i = 0; i < count; i++)
+        {
+            orientation = Quaternion_Integrate(orientation, rates[i], QUATERNION_BENCHMARK_TIME_STEP);
+        }
+
+        *result = orientation;
+        benchmarkSink = orientation.w;
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Rotates every point by a matrix one at a time, the rows of the matrix written out.
+time_t QuaternionBenchmark_RotateMatrix(const Matrix4 *matrix, const Vector3 *points, Vector3 *results, size_t count, int rounds)
+{
+    Timer timer = Timer_CreateStack("Rotate matrix");
+    Timer_Start(&timer);
+
+    const float(*m)[4] = matrix->matrix;
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            Vector3 p = points[i];
+            results[i] = (Vector3){
+                m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z,
+                m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z,
+                m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z};
+        }
+
+        benchmarkSink = results[(size_t)round % count].x;
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Rotates every point with Quaternion_RotateVector3 one at a time.
+time_t QuaternionBenchmark_RotateQuaternion(Quaternion rotation, const Vector3 *points, Vector3 *results, size_t count, int rounds)
+{
+    Timer timer = Timer_CreateStack("Rotate quaternion");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            results[i] = Quaternion_RotateVector3(rotation, points[i]);
+        }
+
+        benchmarkSink = results[(size_t)round % count].x;
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Rotates a batch of points with Quaternion_TransformBatch on the SIMD kernels of the CPU.
+time_t QuaternionBenchmark_RotateBatch(Quaternion rotation, const Vector3Batch *batch, Vector3Batch *result, int rounds)
+{
+    Timer timer = Timer_CreateStack("Rotate batch");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        Quaternion_TransformBatch(rotation, batch, result);
+        benchmarkSink = result->x[(size_t)round % result->count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+int main(int argc, char **argv)
+{
+    int rotationCount = argc > 1 ? atoi(argv[1]) : QUATERNION_BENCHMARK_DEFAULT_ROTATIONS;
+    int rounds = argc > 2 ? atoi(argv[2]) : QUATERNION_BENCHMARK_DEFAULT_ROUNDS;
+    rotationCount = rotationCount > 0 ? rotationCount : QUATERNION_BENCHMARK_DEFAULT_ROTATIONS;
+    rounds = rounds > 0 ? rounds : QUATERNION_BENCHMARK_DEFAULT_ROUNDS;
+
+    size_t count = (size_t)rotationCount;
+    long long operations = (long long)count * rounds;
+
+    Matrix4 *matrices = (Matrix4 *)malloc(count * sizeof(Matrix4));
+    Quaternion *rotations = (Quaternion *)malloc(count * sizeof(Quaternion));
+    Vector3 *rates = (Vector3 *)malloc(count * sizeof(Vector3));
+    Vector3 *points = (Vector3 *)malloc(count * sizeof(Vector3));
+    Vector3 *rotatedPoints = (Vector3 *)malloc(count * sizeof(Vector3));
+    Vector3Batch *batch = Vector3Batch_Create(count);
+    Vector3Batch *resultBatch = Vector3Batch_Create(count);
+
+    // Small rotations around changing axes, a few hundred degrees per second on every axis like a tumbling body
+    Matrix4 identity = Matrix4_Identity();
+    for (size_t i = 0; i < count; i++)
+    {
+        Vector3 axis = NewVector3(sinf(0.01f * (float)i), cosf(0.013f * (float)i), 0.5f);
+        float angle = 0.02f + 0.01f * (float)(i % 7);
+
+        matrices[i] = Matrix4_Rotate(&identity, angle, axis.x, axis.y, axis.z);
+        rotations[i] = Quaternion_FromAxisAngle(axis, angle);
+        rates[i] = Vector3_Multiply(axis, 5.0f);
+        points[i] = NewVector3((float)(i % 17) - 8.0f, (float)(i % 23) * 0.5f, (float)(i % 7));
+        Vector3Batch_Set(batch, i, points[i]);
+    }
+
+    printf("Quaternion benchmark, %zu rotations, %d rounds, detected %s\n", count, rounds, Simd_GetLevelName(Simd_GetLevel()));
+    printf("%-16s %-22s %12s %10s %16s %9s\n", "Scenario", "Method", "Max error", "Time (ms)", "Rotations/s", "Speed up");
+
+    Matrix4 composedMatrix;
+    Quaternion composedQuaternion;
+    time_t baseline = QuaternionBenchmark_ComposeMatrix(matrices, count, rounds, &composedMatrix);
+    QuaternionBenchmarkResult composeMatrix = {"Compose", "Matrix4_Dot", 0.0, operations, baseline};
+    QuaternionBenchmark_Print(&composeMatrix, baseline);
+
+    QuaternionBenchmarkResult composeQuaternion = {"Compose", "Quaternion_Compose", 0.0, operations, QuaternionBenchmark_ComposeQuaternion(rotations, count, rounds, &composedQuaternion)};
+    Matrix4 composedConverted = Quaternion_ToMatrix4(composedQuaternion);
+    composeQuaternion.maximumError = QuaternionBenchmark_MatrixError(&composedMatrix, &composedConverted);
+    QuaternionBenchmark_Print(&composeQuaternion, baseline);
+
+    Matrix4 integratedMatrix;
+    Quaternion integratedQuaternion;
+    baseline = QuaternionBenchmark_IntegrateMatrix(rates, count, rounds, &integratedMatrix);
+    QuaternionBenchmarkResult integrateMatrix = {"Gyro integrate", "Matrix4_Rotate", 0.0, operations, baseline};
+    QuaternionBenchmark_Print(&integrateMatrix, baseline);
+
+    QuaternionBenchmarkResult integrateQuaternion = {"Gyro integrate", "Quaternion_Integrate", 0.0, operations, QuaternionBenchmark_IntegrateQuaternion(rates, count, rounds, &integratedQuaternion)};
+    Matrix4 integratedConverted = Quaternion_ToMatrix4(integratedQuaternion);
+    integrateQuaternion.maximumError = QuaternionBenchmark_MatrixError(&integratedMatrix, &integratedConverted);
+    QuaternionBenchmark_Print(&integrateQuaternion, baseline);
+
+    baseline = QuaternionBenchmark_RotateMatrix(&matrices[1], points, rotatedPoints, count, rounds);
+    QuaternionBenchmarkResult rotateMatrix = {"Rotate points", "Matrix4 by value", 0.0, operations, baseline};
+    QuaternionBenchmark_Print(&rotateMatrix, baseline);
+
+    QuaternionBenchmarkResult rotateQuaternion = {"Rotate points", "Quaternion by value", 0.0, operations, QuaternionBenchmark_RotateQuaternion(rotations[1], points, rotatedPoints, count, rounds)};
+    QuaternionBenchmark_Print(&rotateQuaternion, baseline);
+
+    QuaternionBenchmarkResult rotateBatch = {"Rotate points", "Quaternion batch", 0.0, operations, QuaternionBenchmark_RotateBatch(rotations[1], batch, resultBatch, rounds)};
+    for (size_t i = 0; i < count; i++)
+    {
+        Vector3 point = Vector3Batch_Get(resultBatch, i);
+        rotateBatch.maximumError = fmax(rotateBatch.maximumError, fabs((double)point.x - (double)rotatedPoints[i].x));
+        rotateBatch.maximumError = fmax(rotateBatch.maximumError, fabs((double)point.y - (double)rotatedPoints[i].y));
+        rotateBatch.maximumError = fmax(rotateBatch.maximumError, fabs((double)point.z - (double)rotatedPoints[i].z));
+    }
+    QuaternionBenchmark_Print(&rotateBatch, baseline);
+
+    Vector3Batch_Destroy(resultBatch);
+    Vector3Batch_Destroy(batch);
+    free(rotatedPoints);
+    free(points);
+    free(rates);
+    free(rotations);
+    free(matrices);
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+#include "Core.h"
+
+#include "Modules/RenderManager.h"
+#include "Modules/RenderBackend.h"
+#include "UIX/MarkdownRenderer.h"
+#include "Utils/Timer.h"
+
+// Renders typical chat layouts with the headless backend and reports rendering throughput.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./RenderBenchmark [frames]
+
+#define RENDER_BENCHMARK_DEFAULT_FRAMES 2000
+#define RENDER_BENCHMARK_STREAM_CHUNK_SIZE 7
+
+const char RENDER_BENCHMARK_RESPONSE[] =
+    "# Setting up the servo\n"
+    "To drive a **servo** from the board, request the line as an *output* and toggle it with a `20 ms` period.\n"
+    "\n"
+    "- Pulse width of `1 ms` is the minimum angle.\n"
+    "- Pulse width of `2 ms` is the maximum angle.\n"
+    "- Anything in between is mapped **linearly**.\n"
+    "\n"
+    "```\n"
+    "GPIOPin *pin = GPIOPin_ConsumeAsOutput(chip, 9, \"Servo\", ACTIVE_LOW, LOW);\n"
+    "GPIOPin_SetValue(pin, HIGH);\n"
+    "```\n"
+    "\n"
+    "1. Check the wiring before powering the servo.\n"
+    "2. Keep the signal ground common with the board ground.\n"
+    "\n"
+    "If the servo jitters, the pulses are not regular enough. A dedicated *PWM* peripheral gives the most stable result.\n";
+
+/// @brief Result of a benchmark scenario.
+typedef struct RenderBenchmarkResult
+{
+    const char *title;
+    int frames;
+    time_t nanoseconds;
+    RendererBackendStats stats;
+} RenderBenchmarkResult;
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+void RenderBenchmark_Print(const RenderBenchmarkResult *result)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-22s %8d %10.2f %14.0f %12llu %12llu %10.1f\n",
+           result->title,
+           result->frames,
+           seconds * 1000.0,
+           seconds > 0.0 ? (double)result->stats.cellsWritten / seconds : 0.0,
+           result->stats.cellsChanged,
+           result->stats.bytesEmitted,
+           result->frames > 0 ? (double)result->stats.bytesEmitted / result->frames : 0.0);
+}
+
+/// @brief Runs a scenario and measures it with the headless counters.
+/// @param title Title of the scenario.
+/// @param frames Count of frames to render.
+/// @param frame Function rendering a single frame.
+/// @return Result of the scenario.
+RenderBenchmarkResult RenderBenchmark_Run(const char *title, int frames, void (*frame)(int))
+{
+    Timer timer = Timer_CreateStack((string)title);
+
+    RendererHeadless_ResetStats();
+    Timer_Start(&timer);
+
+    for (int i = 0; i < frames; i++)
+    {
+        frame(i);
+    }
+
+    Timer_Stop(&timer);
+
+    return (RenderBenchmarkResult){title, frames, Timer_GetElapsedNanoseconds(&timer), RendererManager_GetBackendStats()};
+}
+
+RendererWindow *benchmarkInputWindow;
+RendererWindow *benchmarkHistoryWindow;
+RendererWindow *benchmarkResponseWindow;
+MarkdownRenderer *benchmarkResponseRenderer;
+
+/// @brief Full chat redraw, clears the response window and lays out the whole response.
+void RenderBenchmark_FullRedraw(int frame)
+{
+    (void)frame;
+
+    RendererWindow_Clear(benchmarkResponseWindow);
+    RendererWindow_PutCharToPosition(benchmarkResponseWindow, NewVector2Int(1, 1), NULL, '>');
+
+    MarkdownRenderer_Clear(benchmarkResponseRenderer);
+    MarkdownRenderer_Invalidate(benchmarkResponseRenderer);
+    MarkdownRenderer_Append(benchmarkResponseRenderer, RENDER_BENCHMARK_RESPONSE, sizeof(RENDER_BENCHMARK_RESPONSE) - 1);
+    MarkdownRenderer_Draw(benchmarkResponseRenderer, benchmarkResponseWindow, NewVector2Int(2, 1));
+}
+
+/// @brief Streamed response, appends a small chunk and draws the changed lines.
+void RenderBenchmark_Stream(int frame)
+{
+    size_t responseSize = sizeof(RENDER_BENCHMARK_RESPONSE) - 1;
+    size_t offset = ((size_t)frame * RENDER_BENCHMARK_STREAM_CHUNK_SIZE) % responseSize;
+
+    if (offset < RENDER_BENCHMARK_STREAM_CHUNK_SIZE)
+    {
+        MarkdownRenderer_Clear(benchmarkResponseRenderer);
+    }
+
+    size_t chunkSize = responseSize - offset < RENDER_BENCHMARK_STREAM_CHUNK_SIZE ? responseSize - offset : RENDER_BENCHMARK_STREAM_CHUNK_SIZE;
+    MarkdownRenderer_Append(benchmarkResponseRenderer, RENDER_BENCHMARK_RESPONSE + offset, chunkSize);
+    MarkdownRenderer_Draw(benchmarkResponseRenderer, benchmarkResponseWindow, NewVector2Int(2, 1));
+}
+
+/// @brief Typing into the input window, a character per frame like the input echo.
+void RenderBenchmark_Typing(int frame)
+{
+    Vector2Int size = RendererWindow_GetWindowSize(benchmarkInputWindow);
+    int columns = size.x - 4;
+    int lines = size.y - 2;
+    int index = frame % (columns * lines);
+
+    if (index == 0)
+    {
+        RendererWindow_Clear(benchmarkInputWindow);
+    }
+
+    char character = RENDER_BENCHMARK_RESPONSE[frame % (sizeof(RENDER_BENCHMARK_RESPONSE) - 1)];
+    character = (character == '\n') ? ' ' : character;
+
+    RendererWindow_PutCharToPosition(benchmarkInputWindow, NewVector2Int(2 + index % columns, 1 + index / columns), NULL, character);
+}
+
+/// @brief History panel, rewrites every line of the history window.
+void RenderBenchmark_History(int frame)
+{
+    Vector2Int size = RendererWindow_GetWindowSize(benchmarkHistoryWindow);
+
+    for (int line = 1; line < size.y - 1; line++)
+    {
+        RendererWindow_PutStringToPosition(benchmarkHistoryWindow, NewVector2Int(2, line), NULL, "%3d | message %d of the conversation", line, frame + line);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : RENDER_BENCHMARK_DEFAULT_FRAMES;
+    frames = frames > 0 ? frames : RENDER_BENCHMARK_DEFAULT_FRAMES;
+
+    RendererHeadless_SetScreenSize(NewVector2Int(160, 48));
+    RendererManager_SelectBackend(RendererBackend_GetHeadless());
+    RendererManager_Initialize();
+
+    Vector2Int terminalSize = RendererWindow_GetWindowSize(RENDERER_MAIN_WINDOW);
+
+    benchmarkInputWindow = RendererWindow_Create("Input", NewVector2Int(terminalSize.x * 3 / 4, 0), NewVector2Int(terminalSize.x / 4, terminalSize.y), RENDERER_MAIN_WINDOW);
+    benchmarkHistoryWindow = RendererWindow_Create("History", NewVector2Int(0, 0), NewVector2Int(terminalSize.x * 3 / 4, terminalSize.y / 2), RENDERER_MAIN_WINDOW);
+    benchmarkResponseWindow = RendererWindow_Create("Response", NewVector2Int(0, terminalSize.y / 2), NewVector2Int(terminalSize.x * 3 / 4, terminalSize.y / 2), RENDERER_MAIN_WINDOW);
+    benchmarkResponseRenderer = MarkdownRenderer_Create("Benchmark Response", RendererWindow_GetWindowSize(benchmarkResponseWindow).x - 3);
+
+    RenderBenchmarkResult results[4];
+    results[0] = RenderBenchmark_Run("Full redraw", frames, RenderBenchmark_FullRedraw);
+    MarkdownRenderer_Clear(benchmarkResponseRenderer);
+    results[1] = RenderBenchmark_Run("Streamed response", frames, RenderBenchmark_Stream);
+    results[2] = RenderBenchmark_Run("Typing", frames, RenderBenchmark_Typing);
+    results[3] = RenderBenchmark_Run("History rewrite", frames, RenderBenchmark_History);
+
+    printf("Render benchmark, headless backend, screen %dx%d\n", terminalSize.x, terminalSize.y);
+    printf("%-22s %8s %10s %14s %12s %12s %10s\n", "Scenario", "Frames", "Time (ms)", "Cells/second", "Changed", "Bytes", "Bytes/frame");
+    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++)
+    {
+        RenderBenchmark_Print(&results[i]);
+    }
+
+    MarkdownRenderer_Destroy(benchmarkResponseRenderer);
+    RendererWindow_Destroy(benchmarkResponseWindow);
+    RendererWindow_Destroy(benchmarkHistoryWindow);
+    RendererWindow_Destroy(benchmarkInputWindow);
+    RendererManager_Terminate();
+
+    return 0;
+}
@@ -0,0 +1,286 @@
+#ifdef __linux__
+#define _GNU_SOURCE // syscall of the ioctl stand-in
+#endif
+
+#include "Core.h"
+
+#include "Modules/SPIManager.h"
+
+#if PLATFORM_LINUX
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/spi/spidev.h>
+
+// Measures SPIDevice against a stand-in of the spidev driver, no hardware is needed. The stand-in replaces ioctl for this executable:
+// the settings requests are recorded, and an SPI_IOC_MESSAGE batch is answered as if MOSI was wired back to MISO, every segment receives what it sends.
+// The stand-in also checks every descriptor against the segments and the settings of the device, a descriptor which differs is a failure.
+// Times are the user space cost of a batch, the stand-in takes no time on the bus. Every other request goes to the kernel.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./SPIBenchmark [iterations]
+
+#define SPI_BENCHMARK_DEFAULT_ITERATIONS 100000
+#define SPI_BENCHMARK_SPEED 8000000         // Hz, default clock of the device
+#define SPI_BENCHMARK_SEGMENT_SPEED 1000000 // Hz, clock of the segments which set their own
+#define SPI_BENCHMARK_EXCHANGE_SIZE 64
+#define SPI_BENCHMARK_REGISTER_COUNT 14     // a 6 axis sensor with its temperature, like the MPU-6000
+
+/// @brief Result of a benchmark scenario.
+typedef struct SPIBenchmarkResult
+{
+    const char *title;
+    long long operations;
+    time_t nanoseconds;
+    unsigned long long failures; // wrong received bytes or wrong descriptors
+} SPIBenchmarkResult;
+
+unsigned char benchmarkMode = 0xFF;
+unsigned char benchmarkBitsPerWord = 0;
+uint32_t benchmarkSpeedHz = 0;
+
+const SPITransfer *benchmarkExpected = NULL; // segments the next batch must describe, NULL to skip the check
+unsigned long long benchmarkMessageCount = 0;
+unsigned long long benchmarkDescriptorFailures = 0;
+
+/// @brief Gets the monotonic clock in nanoseconds.
+/// @return Current time.
+unsigned long long SPIBenchmark_GetTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+/// @brief Answers an SPI_IOC_MESSAGE batch with MOSI wired back to MISO. A segment without a transmit buffer sends zeros.
+/// @param handles Descriptors of the batch.
+/// @param count Count of the descriptors.
+/// @return Count of the bytes transferred, like the driver.
+int SPIBenchmark_Message(const struct spi_ioc_transfer *handles, size_t count)
+{
+    benchmarkMessageCount++;
+
+    int length = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const struct spi_ioc_transfer *handle = &handles[i];
+
+        if (benchmarkExpected != NULL)
+        {
+            const SPITransfer *transfer = &benchmarkExpected[i];
+            uint32_t speedHz = transfer->speedHz != 0 ? transfer->speedHz : benchmarkSpeedHz;
+
+            if (handle->tx_buf != (unsigned long)transfer->transmitBuffer || handle->rx_buf != (unsigned long)transfer->receiveBuffer ||
+                handle->len != transfer->length || handle->speed_hz != speedHz || handle->delay_usecs != transfer->delayMicroseconds ||
+                handle->bits_per_word != benchmarkBitsPerWord || handle->cs_change != transfer->changeChipSelect)
+            {
+                benchmarkDescriptorFailures++;
+            }
+        }
+
+        if (handle->rx_buf != 0)
+        {
+            if (handle->tx_buf != 0)
+            {
+                memmove((void *)(uintptr_t)handle->rx_buf, (const void *)(uintptr_t)handle->tx_buf, handle->len);
+            }
+            else
+            {
+                memset((void *)(uintptr_t)handle->rx_buf, 0, handle->len);
+            }
+        }
+
+        length += (int)handle->len;
+    }
+
+    return length;
+}
+
+/// @brief Stand-in of ioctl for this executable. spidev requests go to the simulated device, every other request to the kernel.
+int ioctl(int fileDescriptor, unsigned long request, ...)
+{
+    va_list arguments;
+    va_start(arguments, request);
+    void *argument = va_arg(arguments, void *);
+    va_end(arguments);
+
+    if (request == SPI_IOC_WR_MODE)
+    {
+        benchmarkMode = *(unsigned char *)argument;
+        return 0;
+    }
+    if (request == SPI_IOC_WR_BITS_PER_WORD)
+    {
+        benchmarkBitsPerWord = *(unsigned char *)argument;
+        return 0;
+    }
+    if (request == SPI_IOC_WR_MAX_SPEED_HZ)
+    {
+        benchmarkSpeedHz = *(uint32_t *)argument;
+        return 0;
+    }
+
+    // SPI_IOC_MESSAGE(N) carries the count of the descriptors in the size of the request
+    if (_IOC_TYPE(request) == SPI_IOC_MAGIC && _IOC_NR(request) == 0 && _IOC_DIR(request) == _IOC_WRITE)
+    {
+        return SPIBenchmark_Message((const struct spi_ioc_transfer *)argument, _IOC_SIZE(request) / sizeof(struct spi_ioc_transfer));
+    }
+
+    return (int)syscall(SYS_ioctl, fileDescriptor, request, argument);
+}
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+void SPIBenchmark_Print(const SPIBenchmarkResult *result)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-28s %10lld %10.2f %14.0f %12.1f %10llu\n",
+           result->title,
+           result->operations,
+           seconds * 1000.0,
+           seconds > 0.0 ? (double)result->operations / seconds : 0.0,
+           result->operations > 0 ? (double)result->nanoseconds / (double)result->operations : 0.0,
+           result->failures);
+}
+
+/// @brief Exchanges a single segment of aligned buffers, every byte sent must come back.
+SPIBenchmarkResult SPIBenchmark_Exchange(SPIDevice *device, int iterations)
+{
+    unsigned char *transmit = (unsigned char *)SPIDevice_AllocateBuffer(SPI_BENCHMARK_EXCHANGE_SIZE);
+    unsigned char *receive = (unsigned char *)SPIDevice_AllocateBuffer(SPI_BENCHMARK_EXCHANGE_SIZE);
+    unsigned long long failures = ((uintptr_t)transmit | (uintptr_t)receive) % SPI_DEVICE_BUFFER_ALIGNMENT != 0;
+
+    SPITransfer expected = {.transmitBuffer = transmit, .receiveBuffer = receive, .length = SPI_BENCHMARK_EXCHANGE_SIZE};
+    benchmarkExpected = &expected;
+
+    time_t nanoseconds = 0;
+    for (int i = 0; i < iterations; i++)
+    {
+        for (int j = 0; j < SPI_BENCHMARK_EXCHANGE_SIZE; j++)
+        {
+            transmit[j] = (unsigned char)(i + j);
+        }
+
+        unsigned long long start = SPIBenchmark_GetTime();
+        bool success = SPIDevice_Exchange(device, transmit, receive, SPI_BENCHMARK_EXCHANGE_SIZE);
+        nanoseconds += (time_t)(SPIBenchmark_GetTime() - start);
+
+        failures += !success || memcmp(transmit, receive, SPI_BENCHMARK_EXCHANGE_SIZE) != 0;
+    }
+
+    benchmarkExpected = NULL;
+    SPIDevice_FreeBuffer(transmit);
+    SPIDevice_FreeBuffer(receive);
+
+    return (SPIBenchmarkResult){"Exchange, loopback", iterations, nanoseconds, failures};
+}
+
+/// @brief Sends full batches of segments with their own clock, delay and chip select, in one ioctl each.
+SPIBenchmarkResult SPIBenchmark_Batch(SPIDevice *device, int iterations)
+{
+    unsigned char transmit[SPI_DEVICE_MAX_BATCH_TRANSFERS][16];
+    unsigned char receive[SPI_DEVICE_MAX_BATCH_TRANSFERS][16];
+    SPITransfer transfers[SPI_DEVICE_MAX_BATCH_TRANSFERS];
+    for (int i = 0; i < SPI_DEVICE_MAX_BATCH_TRANSFERS; i++)
+    {
+        for (int j = 0; j < 16; j++)
+        {
+            transmit[i][j] = (unsigned char)(i * 16 + j);
+        }
+
+        transfers[i] = (SPITransfer){
+            .transmitBuffer = transmit[i],
+            .receiveBuffer = i % 4 == 3 ? NULL : receive[i],
+            .length = (unsigned int)(1 + i % 16),
+            .speedHz = i % 2 == 0 ? 0 : SPI_BENCHMARK_SEGMENT_SPEED,
+            .delayMicroseconds = (unsigned short)(i % 3),
+            .changeChipSelect = i % 8 == 7,
+        };
+    }
+
+    benchmarkExpected = transfers;
+    unsigned long long messages = benchmarkMessageCount;
+    unsigned long long failures = 0;
+
+    unsigned long long start = SPIBenchmark_GetTime();
+    for (int i = 0; i < iterations; i++)
+    {
+        failures += !SPIDevice_Transfer(device, transfers, SPI_DEVICE_MAX_BATCH_TRANSFERS);
+    }
+    unsigned long long elapsed = SPIBenchmark_GetTime() - start;
+
+    for (int i = 0; i < SPI_DEVICE_MAX_BATCH_TRANSFERS; i++)
+    {
+        failures += transfers[i].receiveBuffer != NULL && memcmp(transmit[i], receive[i], transfers[i].length) != 0;
+    }
+    failures += benchmarkMessageCount - messages != (unsigned long long)iterations;
+
+    benchmarkExpected = NULL;
+
+    return (SPIBenchmarkResult){"Batch of 32 segments", iterations, (time_t)elapsed, failures};
+}
+
+/// @brief Reads the registers of a sensor, the address and the data must go in a single batch.
+SPIBenchmarkResult SPIBenchmark_ReadRegisters(SPIDevice *device, int iterations)
+{
+    unsigned char values[SPI_BENCHMARK_REGISTER_COUNT];
+    unsigned long long messages = benchmarkMessageCount;
+    unsigned long long failures = 0;
+
+    unsigned long long start = SPIBenchmark_GetTime();
+    for (int i = 0; i < iterations; i++)
+    {
+        // The address has no receive buffer and the data sends zeros, so the loopback reads back zeros
+        memset(values, 0xFF, sizeof(values));
+        failures += !SPIDevice_ReadRegisters(device, 0x80 | 0x3B, values, SPI_BENCHMARK_REGISTER_COUNT);
+        failures += values[0] != 0 || values[SPI_BENCHMARK_REGISTER_COUNT - 1] != 0;
+    }
+    unsigned long long elapsed = SPIBenchmark_GetTime() - start;
+
+    failures += benchmarkMessageCount - messages != (unsigned long long)iterations;
+
+    return (SPIBenchmarkResult){"Read registers", iterations, (time_t)elapsed, failures};
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : SPI_BENCHMARK_DEFAULT_ITERATIONS;
+    iterations = iterations > 0 ? iterations : SPI_BENCHMARK_DEFAULT_ITERATIONS;
+
+    // Any file opens as the device, its spidev requests never reach the kernel
+    SPIDevice *device = SPIDevice_Open("/dev/null", SPIMode_3, SPI_BENCHMARK_SPEED, 8);
+    if (device == NULL)
+    {
+        return 1;
+    }
+
+    SPIBenchmarkResult results[3];
+    results[0] = SPIBenchmark_Exchange(device, iterations);
+    results[1] = SPIBenchmark_Batch(device, iterations);
+    results[2] = SPIBenchmark_ReadRegisters(device, iterations);
+
+    printf("SPI benchmark, mode %u at %u Hz with %u bits per word on a simulated loopback device\n", benchmarkMode, benchmarkSpeedHz, benchmarkBitsPerWord);
+    printf("%-28s %10s %10s %14s %12s %10s\n", "Scenario", "Operations", "Time (ms)", "Operations/s", "Mean (ns)", "Failures");
+    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++)
+    {
+        SPIBenchmark_Print(&results[i]);
+    }
+    printf("Wrong descriptors: %llu\n", benchmarkDescriptorFailures);
+
+    SPIDevice_Close(device);
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    printf("SPI benchmark skipped, spidev is only available on Linux.\n");
+    return 0;
+}
+
+#endif // PLATFORM_LINUX
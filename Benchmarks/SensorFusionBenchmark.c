@@ -0,0 +1,351 @@
+#include "Core.h"
+
+#include "Maths.h"
+#include "Utils/Timer.h"
+
+#include <math.h>
+
+// Measures the per sample cost and the accuracy of the sensor fusion filters on a simulated IMU with noise and a gyroscope bias,
+// next to integrating the gyroscope alone, and the cost of a Kalman filter step of a 3D constant velocity model.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./SensorFusionBenchmark [samples] [rounds]
+
+#define SENSOR_FUSION_BENCHMARK_DEFAULT_SAMPLES 20000
+#define SENSOR_FUSION_BENCHMARK_DEFAULT_ROUNDS 20
+#define SENSOR_FUSION_BENCHMARK_TIME_STEP 0.005f // a 200 Hz IMU
+#define SENSOR_FUSION_BENCHMARK_SETTLE_SAMPLES 400 // errors are measured after the first 2 seconds
+
+/// @brief Simulated samples of an IMU, the true orientation and the readings in the body frame.
+typedef struct SensorFusionBenchmarkSamples
+{
+    size_t count;
+    Quaternion *truth;
+    Vector3 *gyroscope;
+    Vector3 *accelerometer;
+    Vector3 *magnetometer;
+} SensorFusionBenchmarkSamples;
+
+/// @brief Result of a benchmark scenario.
+typedef struct SensorFusionBenchmarkResult
+{
+    const char *title;
+    const char *method;
+    double meanError;    // mean error of the estimate, in degrees for the orientations and in units for the Kalman filter positions
+    double maximumError; // largest error of the estimate, same units with the mean error
+    long long operations;
+    time_t nanoseconds;
+} SensorFusionBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile float benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+/// @param baseline Nanoseconds of integrating the gyroscope alone for the same samples, for the relative cost column.
+void SensorFusionBenchmark_Print(const SensorFusionBenchmarkResult *result, time_t baseline)
+{
+    printf("%-16s %-26s %10.2f %10.2f %12.1f %8.2fx\n",
+           result->title,
+           result->method,
+           result->meanError,
+           result->maximumError,
+           result->operations > 0 ? (double)result->nanoseconds / (double)result->operations : 0.0,
+           baseline > 0 ? (double)result->nanoseconds / (double)baseline : 0.0);
+}
+
+/// @brief Gets the angle between two orientations in degrees.
+double SensorFusionBenchmark_Angle(Quaternion orientation1, Quaternion orientation2)
+{
+    double dot = fabs((double)Quaternion_Dot(orientation1, orientation2));
+    return 2.0 * acos(dot > 1.0 ? 1.0 : dot) * 180.0 / 3.14159265358979;
+}
+
+/// @brief Gets the angle between the directions of gravity of two orientations in degrees, the tilt error, blind to the yaw.
+double SensorFusionBenchmark_TiltAngle(Quaternion orientation1, Quaternion orientation2)
+{
+    Vector3 up = NewVector3(0.0f, 0.0f, 1.0f);
+    double dot = (double)Vector3_Dot(Quaternion_RotateVector3(Quaternion_Conjugate(orientation1), up), Quaternion_RotateVector3(Quaternion_Conjugate(orientation2), up));
+    return acos(dot > 1.0 ? 1.0 : (dot < -1.0 ? -1.0 : dot)) * 180.0 / 3.14159265358979;
+}
+
+/// @brief Adds an estimate to the error statistics of a result, skipping the samples of the settling time.
+/// Without a magnetometer only the tilt is observable, so only the tilt error is counted then.
+void SensorFusionBenchmark_AddError(SensorFusionBenchmarkResult *result, size_t index, size_t count, bool tiltOnly, Quaternion estimate, Quaternion truth)
+{
+    if (index < SENSOR_FUSION_BENCHMARK_SETTLE_SAMPLES || count <= SENSOR_FUSION_BENCHMARK_SETTLE_SAMPLES)
+    {
+        return;
+    }
+
+    double error = tiltOnly ? SensorFusionBenchmark_TiltAngle(estimate, truth) : SensorFusionBenchmark_Angle(estimate, truth);
+    result->meanError += error / (double)(count - SENSOR_FUSION_BENCHMARK_SETTLE_SAMPLES);
+    result->maximumError = fmax(result->maximumError, error);
+}
+
+/// @brief Gets a uniform noise value in [-amplitude, amplitude].
+float SensorFusionBenchmark_Noise(float amplitude)
+{
+    return amplitude * ((float)rand() / (float)RAND_MAX * 2.0f - 1.0f);
+}
+
+/// @brief Simulates a body tumbling slowly, read by a noisy IMU with a biased gyroscope in a magnetic field inclined 60 degrees down.
+void SensorFusionBenchmark_Simulate(SensorFusionBenchmarkSamples *samples)
+{
+    Quaternion orientation = Quaternion_FromEuler(0.4f, -0.3f, 1.0f);
+    Vector3 bias = NewVector3(0.02f, -0.01f, 0.015f);
+    Vector3 field = NewVector3(0.5f, 0.0f, -0.866f);
+
+    srand(42);
+    for (size_t i = 0; i < samples->count; i++)
+    {
+        float time = (float)i * SENSOR_FUSION_BENCHMARK_TIME_STEP;
+        Vector3 rate = NewVector3(0.6f * sinf(0.7f * time), 0.5f * cosf(0.5f * time), 0.8f * sinf(0.3f * time));
+        orientation = Quaternion_Integrate(orientation, rate, SENSOR_FUSION_BENCHMARK_TIME_STEP);
+
+        Quaternion inverse = Quaternion_Conjugate(orientation);
+        Vector3 gravity = Quaternion_RotateVector3(inverse, NewVector3(0.0f, 0.0f, 9.81f));
+        Vector3 magnetic = Quaternion_RotateVector3(inverse, field);
+
+        samples->truth[i] = orientation;
+        samples->gyroscope[i] = NewVector3(rate.x + bias.x + SensorFusionBenchmark_Noise(0.01f), rate.y + bias.y + SensorFusionBenchmark_Noise(0.01f), rate.z + bias.z + SensorFusionBenchmark_Noise(0.01f));
+        samples->accelerometer[i] = NewVector3(gravity.x + SensorFusionBenchmark_Noise(0.1f), gravity.y + SensorFusionBenchmark_Noise(0.1f), gravity.z + SensorFusionBenchmark_Noise(0.1f));
+        samples->magnetometer[i] = NewVector3(magnetic.x + SensorFusionBenchmark_Noise(0.02f), magnetic.y + SensorFusionBenchmark_Noise(0.02f), magnetic.z + SensorFusionBenchmark_Noise(0.02f));
+    }
+}
+
+/// @brief Integrates the gyroscope alone from the true initial orientation, the cheapest estimate, drifting with the bias.
+void SensorFusionBenchmark_Gyroscope(const SensorFusionBenchmarkSamples *samples, int rounds, SensorFusionBenchmarkResult *result)
+{
+    Timer timer = Timer_CreateStack("Gyroscope");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        Quaternion orientation = samples->truth[0];
+        for (size_t i = 0; i < samples->count; i++)
+        {
+            orientation = Quaternion_Integrate(orientation, samples->gyroscope[i], SENSOR_FUSION_BENCHMARK_TIME_STEP);
+        }
+        benchmarkSink = orientation.w;
+    }
+
+    Timer_Stop(&timer);
+    result->nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    Quaternion orientation = samples->truth[0];
+    for (size_t i = 0; i < samples->count; i++)
+    {
+        orientation = Quaternion_Integrate(orientation, samples->gyroscope[i], SENSOR_FUSION_BENCHMARK_TIME_STEP);
+        SensorFusionBenchmark_AddError(result, i, samples->count, false, orientation, samples->truth[i]);
+    }
+}
+
+/// @brief Runs a complementary filter over the samples, without the magnetometer if useMagnetometer is false.
+void SensorFusionBenchmark_Complementary(const SensorFusionBenchmarkSamples *samples, int rounds, bool useMagnetometer, SensorFusionBenchmarkResult *result)
+{
+    Vector3 zero = NewVector3(0.0f, 0.0f, 0.0f);
+    Timer timer = Timer_CreateStack("Complementary");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        ComplementaryFilter filter = ComplementaryFilter_CreateStack(0.5f);
+        for (size_t i = 0; i < samples->count; i++)
+        {
+            ComplementaryFilter_Update(&filter, samples->gyroscope[i], samples->accelerometer[i], useMagnetometer ? samples->magnetometer[i] : zero, SENSOR_FUSION_BENCHMARK_TIME_STEP);
+        }
+        benchmarkSink = filter.angles.x;
+    }
+
+    Timer_Stop(&timer);
+    result->nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    ComplementaryFilter filter = ComplementaryFilter_CreateStack(0.5f);
+    for (size_t i = 0; i < samples->count; i++)
+    {
+        ComplementaryFilter_Update(&filter, samples->gyroscope[i], samples->accelerometer[i], useMagnetometer ? samples->magnetometer[i] : zero, SENSOR_FUSION_BENCHMARK_TIME_STEP);
+        SensorFusionBenchmark_AddError(result, i, samples->count, !useMagnetometer, ComplementaryFilter_GetOrientation(&filter), samples->truth[i]);
+    }
+}
+
+/// @brief Runs a Mahony filter over the samples, without the magnetometer if useMagnetometer is false.
+void SensorFusionBenchmark_Mahony(const SensorFusionBenchmarkSamples *samples, int rounds, bool useMagnetometer, SensorFusionBenchmarkResult *result)
+{
+    Vector3 zero = NewVector3(0.0f, 0.0f, 0.0f);
+    Timer timer = Timer_CreateStack("Mahony");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        MahonyFilter filter = MahonyFilter_CreateStack(1.0f, 0.05f);
+        for (size_t i = 0; i < samples->count; i++)
+        {
+            MahonyFilter_Update(&filter, samples->gyroscope[i], samples->accelerometer[i], useMagnetometer ? samples->magnetometer[i] : zero, SENSOR_FUSION_BENCHMARK_TIME_STEP);
+        }
+        benchmarkSink = filter.orientation.w;
+    }
+
+    Timer_Stop(&timer);
+    result->nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    MahonyFilter filter = MahonyFilter_CreateStack(1.0f, 0.05f);
+    for (size_t i = 0; i < samples->count; i++)
+    {
+        MahonyFilter_Update(&filter, samples->gyroscope[i], samples->accelerometer[i], useMagnetometer ? samples->magnetometer[i] : zero, SENSOR_FUSION_BENCHMARK_TIME_STEP);
+        SensorFusionBenchmark_AddError(result, i, samples->count, !useMagnetometer, filter.orientation, samples->truth[i]);
+    }
+}
+
+/// @brief Runs a Madgwick filter over the samples, without the magnetometer if useMagnetometer is false.
+void SensorFusionBenchmark_Madgwick(const SensorFusionBenchmarkSamples *samples, int rounds, bool useMagnetometer, SensorFusionBenchmarkResult *result)
+{
+    Vector3 zero = NewVector3(0.0f, 0.0f, 0.0f);
+    Timer timer = Timer_CreateStack("Madgwick");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        MadgwickFilter filter = MadgwickFilter_CreateStack(0.1f);
+        for (size_t i = 0; i < samples->count; i++)
+        {
+            MadgwickFilter_Update(&filter, samples->gyroscope[i], samples->accelerometer[i], useMagnetometer ? samples->magnetometer[i] : zero, SENSOR_FUSION_BENCHMARK_TIME_STEP);
+        }
+        benchmarkSink = filter.orientation.w;
+    }
+
+    Timer_Stop(&timer);
+    result->nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    MadgwickFilter filter = MadgwickFilter_CreateStack(0.1f);
+    for (size_t i = 0; i < samples->count; i++)
+    {
+        MadgwickFilter_Update(&filter, samples->gyroscope[i], samples->accelerometer[i], useMagnetometer ? samples->magnetometer[i] : zero, SENSOR_FUSION_BENCHMARK_TIME_STEP);
+        SensorFusionBenchmark_AddError(result, i, samples->count, !useMagnetometer, filter.orientation, samples->truth[i]);
+    }
+}
+
+/// @brief Creates the Kalman filter of a 3D constant velocity model, position and velocity states and position measurements.
+KalmanFilter SensorFusionBenchmark_KalmanModel()
+{
+    KalmanFilter filter = KalmanFilter_CreateStack(6, 3);
+    for (int i = 0; i < 3; i++)
+    {
+        filter.transition[i][i + 3] = SENSOR_FUSION_BENCHMARK_TIME_STEP;
+        filter.processNoise[i][i] = 1e-6f;
+        filter.processNoise[i + 3][i + 3] = 1e-4f;
+        filter.covariance[i + 3][i + 3] = 10.0f;
+        filter.measurementNoise[i][i] = 0.01f;
+    }
+    return filter;
+}
+
+/// @brief Runs the Kalman filter of a constant velocity model over noisy positions, a predict and an update per sample.
+/// The error columns are the position error of the estimate in the units of the positions, not degrees.
+void SensorFusionBenchmark_Kalman(const SensorFusionBenchmarkSamples *samples, int rounds, SensorFusionBenchmarkResult *result)
+{
+    float *positions = (float *)malloc(samples->count * 3 * sizeof(float));
+    for (size_t i = 0; i < samples->count; i++)
+    {
+        float time = (float)i * SENSOR_FUSION_BENCHMARK_TIME_STEP;
+        positions[i * 3 + 0] = 1.0f + 2.0f * time + SensorFusionBenchmark_Noise(0.1f);
+        positions[i * 3 + 1] = -3.0f * time + SensorFusionBenchmark_Noise(0.1f);
+        positions[i * 3 + 2] = 0.5f * time + SensorFusionBenchmark_Noise(0.1f);
+    }
+
+    Timer timer = Timer_CreateStack("Kalman");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        KalmanFilter filter = SensorFusionBenchmark_KalmanModel();
+        for (size_t i = 0; i < samples->count; i++)
+        {
+            KalmanFilter_Predict(&filter);
+            KalmanFilter_Update(&filter, &positions[i * 3]);
+        }
+        benchmarkSink = filter.state[0];
+    }
+
+    Timer_Stop(&timer);
+    result->nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+
+    KalmanFilter filter = SensorFusionBenchmark_KalmanModel();
+    for (size_t i = 0; i < samples->count; i++)
+    {
+        KalmanFilter_Predict(&filter);
+        KalmanFilter_Update(&filter, &positions[i * 3]);
+
+        if (i >= SENSOR_FUSION_BENCHMARK_SETTLE_SAMPLES && samples->count > SENSOR_FUSION_BENCHMARK_SETTLE_SAMPLES)
+        {
+            double time = (double)i * SENSOR_FUSION_BENCHMARK_TIME_STEP;
+            double dx = filter.state[0] - (1.0 + 2.0 * time), dy = filter.state[1] + 3.0 * time, dz = filter.state[2] - 0.5 * time;
+            double error = sqrt(dx * dx + dy * dy + dz * dz);
+            result->meanError += error / (double)(samples->count - SENSOR_FUSION_BENCHMARK_SETTLE_SAMPLES);
+            result->maximumError = fmax(result->maximumError, error);
+        }
+    }
+
+    free(positions);
+}
+
+int main(int argc, char **argv)
+{
+    int sampleCount = argc > 1 ? atoi(argv[1]) : SENSOR_FUSION_BENCHMARK_DEFAULT_SAMPLES;
+    int rounds = argc > 2 ? atoi(argv[2]) : SENSOR_FUSION_BENCHMARK_DEFAULT_ROUNDS;
+    sampleCount = sampleCount > 0 ? sampleCount : SENSOR_FUSION_BENCHMARK_DEFAULT_SAMPLES;
+    rounds = rounds > 0 ? rounds : SENSOR_FUSION_BENCHMARK_DEFAULT_ROUNDS;
+
+    SensorFusionBenchmarkSamples samples;
+    samples.count = (size_t)sampleCount;
+    samples.truth = (Quaternion *)malloc(samples.count * sizeof(Quaternion));
+    samples.gyroscope = (Vector3 *)malloc(samples.count * sizeof(Vector3));
+    samples.accelerometer = (Vector3 *)malloc(samples.count * sizeof(Vector3));
+    samples.magnetometer = (Vector3 *)malloc(samples.count * sizeof(Vector3));
+    SensorFusionBenchmark_Simulate(&samples);
+
+    long long operations = (long long)samples.count * rounds;
+
+    printf("Sensor fusion benchmark, %zu samples at %.0f Hz, %d rounds\n", samples.count, 1.0 / SENSOR_FUSION_BENCHMARK_TIME_STEP, rounds);
+    printf("%-16s %-26s %10s %10s %12s %9s\n", "Filter", "Sensors", "Mean err", "Max err", "ns/update", "Cost");
+
+    SensorFusionBenchmarkResult gyroscope = {"Gyroscope only", "gyro", 0.0, 0.0, operations, 0};
+    SensorFusionBenchmark_Gyroscope(&samples, rounds, &gyroscope);
+    time_t baseline = gyroscope.nanoseconds;
+    SensorFusionBenchmark_Print(&gyroscope, baseline);
+
+    SensorFusionBenchmarkResult complementaryImu = {"Complementary", "gyro + accel", 0.0, 0.0, operations, 0};
+    SensorFusionBenchmark_Complementary(&samples, rounds, false, &complementaryImu);
+    SensorFusionBenchmark_Print(&complementaryImu, baseline);
+
+    SensorFusionBenchmarkResult complementaryMarg = {"Complementary", "gyro + accel + mag", 0.0, 0.0, operations, 0};
+    SensorFusionBenchmark_Complementary(&samples, rounds, true, &complementaryMarg);
+    SensorFusionBenchmark_Print(&complementaryMarg, baseline);
+
+    SensorFusionBenchmarkResult mahonyImu = {"Mahony", "gyro + accel", 0.0, 0.0, operations, 0};
+    SensorFusionBenchmark_Mahony(&samples, rounds, false, &mahonyImu);
+    SensorFusionBenchmark_Print(&mahonyImu, baseline);
+
+    SensorFusionBenchmarkResult mahonyMarg = {"Mahony", "gyro + accel + mag", 0.0, 0.0, operations, 0};
+    SensorFusionBenchmark_Mahony(&samples, rounds, true, &mahonyMarg);
+    SensorFusionBenchmark_Print(&mahonyMarg, baseline);
+
+    SensorFusionBenchmarkResult madgwickImu = {"Madgwick", "gyro + accel", 0.0, 0.0, operations, 0};
+    SensorFusionBenchmark_Madgwick(&samples, rounds, false, &madgwickImu);
+    SensorFusionBenchmark_Print(&madgwickImu, baseline);
+
+    SensorFusionBenchmarkResult madgwickMarg = {"Madgwick", "gyro + accel + mag", 0.0, 0.0, operations, 0};
+    SensorFusionBenchmark_Madgwick(&samples, rounds, true, &madgwickMarg);
+    SensorFusionBenchmark_Print(&madgwickMarg, baseline);
+
+    SensorFusionBenchmarkResult kalman = {"Kalman 6x3", "position, error in units", 0.0, 0.0, operations, 0};
+    SensorFusionBenchmark_Kalman(&samples, rounds, &kalman);
+    SensorFusionBenchmark_Print(&kalman, baseline);
+
+    printf("Errors are in degrees after the first %d samples, of the whole orientation with a magnetometer and of the tilt without one.\n", SENSOR_FUSION_BENCHMARK_SETTLE_SAMPLES);
+
+    free(samples.magnetometer);
+    free(samples.accelerometer);
+    free(samples.gyroscope);
+    free(samples.truth);
+
+    return 0;
+}
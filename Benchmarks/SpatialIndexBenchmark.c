@@ -0,0 +1,264 @@
+#include "Core.h"
+
+#include "Maths.h"
+#include "Utils/Timer.h"
+
+#include <float.h>
+#include <math.h>
+
+// Compares nearest neighbour and radius queries of the uniform grid and the bounding volume hierarchy with a brute force scan
+// of the points, for points spread evenly in a cube and for points in tight clusters, and measures how long the indices take to build.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./SpatialIndexBenchmark [points] [queries]
+
+#define SPATIAL_INDEX_BENCHMARK_DEFAULT_POINTS 1000000
+#define SPATIAL_INDEX_BENCHMARK_DEFAULT_QUERIES 100000
+#define SPATIAL_INDEX_BENCHMARK_BRUTE_FORCE_QUERIES 100 // a scan of a million points per query, so only a few
+#define SPATIAL_INDEX_BENCHMARK_CLUSTERS 64
+#define SPATIAL_INDEX_BENCHMARK_NEIGHBOURS 32.0 // points a radius query finds on average in the uniform cube
+
+/// @brief Result of a benchmark scenario.
+typedef struct SpatialIndexBenchmarkResult
+{
+    const char *title;
+    const char *method;
+    size_t queries;
+    size_t mismatches; // queries whose answer differs from the brute force scan, checked on the brute force queries
+    time_t nanoseconds;
+} SpatialIndexBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile size_t benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+/// @param baseline Nanoseconds per query of the brute force scan, for the speed up column.
+void SpatialIndexBenchmark_Print(const SpatialIndexBenchmarkResult *result, double baseline)
+{
+    double perQuery = result->queries > 0 ? (double)result->nanoseconds / (double)result->queries : 0.0;
+
+    printf("%-20s %-14s %10zu %10zu %14.1f %8.1fx\n",
+           result->title,
+           result->method,
+           result->queries,
+           result->mismatches,
+           perQuery,
+           perQuery > 0.0 ? baseline / perQuery : 0.0);
+}
+
+/// @brief Prints the build time of an index as a table line, in milliseconds instead of per query.
+/// @param title Title of the scenario.
+/// @param method Name of the index.
+/// @param nanoseconds Time the build took.
+void SpatialIndexBenchmark_PrintBuild(const char *title, const char *method, time_t nanoseconds)
+{
+    printf("%-20s %-14s %10s %10s %11.1f ms %9s\n", title, method, "-", "-", (double)nanoseconds / 1e6, "-");
+}
+
+/// @brief Gets a random float in [0, 1).
+float SpatialIndexBenchmark_Random()
+{
+    return (float)rand() / ((float)RAND_MAX + 1.0f);
+}
+
+/// @brief Finds the nearest point by scanning all of them, the baseline.
+size_t SpatialIndexBenchmark_BruteNearest(const Vector3Batch *points, Vector3 position, float *squaredDistance)
+{
+    float bestDistance = FLT_MAX;
+    size_t bestIndex = SIZE_MAX;
+    for (size_t i = 0; i < points->count; i++)
+    {
+        float dx = points->x[i] - position.x, dy = points->y[i] - position.y, dz = points->z[i] - position.z;
+        float distance = dx * dx + dy * dy + dz * dz;
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            bestIndex = i;
+        }
+    }
+
+    *squaredDistance = bestDistance;
+    return bestIndex;
+}
+
+/// @brief Counts the points within a radius by scanning all of them, the baseline.
+size_t SpatialIndexBenchmark_BruteRadius(const Vector3Batch *points, Vector3 position, float radius)
+{
+    float squaredRadius = radius * radius;
+    size_t found = 0;
+    for (size_t i = 0; i < points->count; i++)
+    {
+        float dx = points->x[i] - position.x, dy = points->y[i] - position.y, dz = points->z[i] - position.z;
+        found += dx * dx + dy * dy + dz * dz <= squaredRadius;
+    }
+
+    return found;
+}
+
+/// @brief Runs the nearest neighbour and the radius scenarios on a set of points.
+void SpatialIndexBenchmark_Run(const char *title, const Vector3Batch *points, const Vector3 *queries, size_t queryCount, float radius)
+{
+    size_t bruteCount = queryCount < SPATIAL_INDEX_BENCHMARK_BRUTE_FORCE_QUERIES ? queryCount : SPATIAL_INDEX_BENCHMARK_BRUTE_FORCE_QUERIES;
+    float *bruteDistances = (float *)malloc(bruteCount * sizeof(float));
+    size_t *bruteCounts = (size_t *)malloc(bruteCount * sizeof(size_t));
+    char scenario[64];
+
+    Timer timer = Timer_CreateStack("Build grid");
+    Timer_Start(&timer);
+    SpatialGrid *grid = SpatialGrid_Create(points, 0.0f);
+    Timer_Stop(&timer);
+    snprintf(scenario, sizeof(scenario), "%s build", title);
+    SpatialIndexBenchmark_PrintBuild(scenario, "SpatialGrid", Timer_GetElapsedNanoseconds(&timer));
+
+    timer = Timer_CreateStack("Build hierarchy");
+    Timer_Start(&timer);
+    SpatialBVH *bvh = SpatialBVH_Create(points);
+    Timer_Stop(&timer);
+    SpatialIndexBenchmark_PrintBuild(scenario, "SpatialBVH", Timer_GetElapsedNanoseconds(&timer));
+
+    // Nearest neighbour
+    snprintf(scenario, sizeof(scenario), "%s nearest", title);
+    timer = Timer_CreateStack("Brute nearest");
+    Timer_Start(&timer);
+    for (size_t i = 0; i < bruteCount; i++)
+    {
+        benchmarkSink = SpatialIndexBenchmark_BruteNearest(points, queries[i], &bruteDistances[i]);
+    }
+    Timer_Stop(&timer);
+    SpatialIndexBenchmarkResult bruteNearest = {scenario, "Brute force", bruteCount, 0, Timer_GetElapsedNanoseconds(&timer)};
+    double baseline = bruteCount > 0 ? (double)bruteNearest.nanoseconds / (double)bruteCount : 0.0;
+    SpatialIndexBenchmark_Print(&bruteNearest, baseline);
+
+    SpatialIndexBenchmarkResult gridNearest = {scenario, "SpatialGrid", queryCount, 0, 0};
+    timer = Timer_CreateStack("Grid nearest");
+    Timer_Start(&timer);
+    for (size_t i = 0; i < queryCount; i++)
+    {
+        benchmarkSink = SpatialGrid_Nearest(grid, queries[i], NULL);
+    }
+    Timer_Stop(&timer);
+    gridNearest.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+    for (size_t i = 0; i < bruteCount; i++)
+    {
+        float distance;
+        SpatialGrid_Nearest(grid, queries[i], &distance);
+        gridNearest.mismatches += distance != bruteDistances[i];
+    }
+    SpatialIndexBenchmark_Print(&gridNearest, baseline);
+
+    SpatialIndexBenchmarkResult bvhNearest = {scenario, "SpatialBVH", queryCount, 0, 0};
+    timer = Timer_CreateStack("Hierarchy nearest");
+    Timer_Start(&timer);
+    for (size_t i = 0; i < queryCount; i++)
+    {
+        benchmarkSink = SpatialBVH_Nearest(bvh, queries[i], NULL);
+    }
+    Timer_Stop(&timer);
+    bvhNearest.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+    for (size_t i = 0; i < bruteCount; i++)
+    {
+        float distance;
+        SpatialBVH_Nearest(bvh, queries[i], &distance);
+        bvhNearest.mismatches += distance != bruteDistances[i];
+    }
+    SpatialIndexBenchmark_Print(&bvhNearest, baseline);
+
+    // Radius, counting only, so the cost of the results array does not hide the cost of the search
+    snprintf(scenario, sizeof(scenario), "%s radius", title);
+    timer = Timer_CreateStack("Brute radius");
+    Timer_Start(&timer);
+    for (size_t i = 0; i < bruteCount; i++)
+    {
+        bruteCounts[i] = SpatialIndexBenchmark_BruteRadius(points, queries[i], radius);
+    }
+    Timer_Stop(&timer);
+    SpatialIndexBenchmarkResult bruteRadius = {scenario, "Brute force", bruteCount, 0, Timer_GetElapsedNanoseconds(&timer)};
+    baseline = bruteCount > 0 ? (double)bruteRadius.nanoseconds / (double)bruteCount : 0.0;
+    SpatialIndexBenchmark_Print(&bruteRadius, baseline);
+
+    SpatialIndexBenchmarkResult gridRadius = {scenario, "SpatialGrid", queryCount, 0, 0};
+    timer = Timer_CreateStack("Grid radius");
+    Timer_Start(&timer);
+    for (size_t i = 0; i < queryCount; i++)
+    {
+        benchmarkSink = SpatialGrid_QueryRadius(grid, queries[i], radius, NULL, 0);
+    }
+    Timer_Stop(&timer);
+    gridRadius.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+    for (size_t i = 0; i < bruteCount; i++)
+    {
+        gridRadius.mismatches += SpatialGrid_QueryRadius(grid, queries[i], radius, NULL, 0) != bruteCounts[i];
+    }
+    SpatialIndexBenchmark_Print(&gridRadius, baseline);
+
+    SpatialIndexBenchmarkResult bvhRadius = {scenario, "SpatialBVH", queryCount, 0, 0};
+    timer = Timer_CreateStack("Hierarchy radius");
+    Timer_Start(&timer);
+    for (size_t i = 0; i < queryCount; i++)
+    {
+        benchmarkSink = SpatialBVH_QueryRadius(bvh, queries[i], radius, NULL, 0);
+    }
+    Timer_Stop(&timer);
+    bvhRadius.nanoseconds = Timer_GetElapsedNanoseconds(&timer);
+    for (size_t i = 0; i < bruteCount; i++)
+    {
+        bvhRadius.mismatches += SpatialBVH_QueryRadius(bvh, queries[i], radius, NULL, 0) != bruteCounts[i];
+    }
+    SpatialIndexBenchmark_Print(&bvhRadius, baseline);
+
+    SpatialBVH_Destroy(bvh);
+    SpatialGrid_Destroy(grid);
+    free(bruteCounts);
+    free(bruteDistances);
+}
+
+int main(int argc, char **argv)
+{
+    int pointCount = argc > 1 ? atoi(argv[1]) : SPATIAL_INDEX_BENCHMARK_DEFAULT_POINTS;
+    int queryCount = argc > 2 ? atoi(argv[2]) : SPATIAL_INDEX_BENCHMARK_DEFAULT_QUERIES;
+    pointCount = pointCount > 0 ? pointCount : SPATIAL_INDEX_BENCHMARK_DEFAULT_POINTS;
+    queryCount = queryCount > 0 ? queryCount : SPATIAL_INDEX_BENCHMARK_DEFAULT_QUERIES;
+
+    size_t count = (size_t)pointCount;
+    Vector3Batch *points = Vector3Batch_Create(count);
+    Vector3 *queries = (Vector3 *)malloc((size_t)queryCount * sizeof(Vector3));
+
+    // The radius that holds SPATIAL_INDEX_BENCHMARK_NEIGHBOURS points of the unit cube on average
+    float radius = (float)cbrt(SPATIAL_INDEX_BENCHMARK_NEIGHBOURS / (double)count * 3.0 / (4.0 * 3.14159265358979));
+
+    printf("Spatial index benchmark, %zu points, %d queries, radius %.4f\n", count, queryCount, radius);
+    printf("%-20s %-14s %10s %10s %14s %9s\n", "Scenario", "Method", "Queries", "Mismatches", "ns/query", "Speed up");
+
+    srand(7);
+    for (size_t i = 0; i < count; i++)
+    {
+        Vector3Batch_Set(points, i, NewVector3(SpatialIndexBenchmark_Random(), SpatialIndexBenchmark_Random(), SpatialIndexBenchmark_Random()));
+    }
+    for (int i = 0; i < queryCount; i++)
+    {
+        queries[i] = NewVector3(SpatialIndexBenchmark_Random(), SpatialIndexBenchmark_Random(), SpatialIndexBenchmark_Random());
+    }
+    SpatialIndexBenchmark_Run("Uniform", points, queries, (size_t)queryCount, radius);
+
+    // Clusters of a hundredth of the cube, the case where most cells of a grid are empty and a few are crowded
+    Vector3 centers[SPATIAL_INDEX_BENCHMARK_CLUSTERS];
+    for (int i = 0; i < SPATIAL_INDEX_BENCHMARK_CLUSTERS; i++)
+    {
+        centers[i] = NewVector3(SpatialIndexBenchmark_Random(), SpatialIndexBenchmark_Random(), SpatialIndexBenchmark_Random());
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        Vector3 center = centers[i % SPATIAL_INDEX_BENCHMARK_CLUSTERS];
+        Vector3Batch_Set(points, i, NewVector3(center.x + 0.01f * SpatialIndexBenchmark_Random(), center.y + 0.01f * SpatialIndexBenchmark_Random(), center.z + 0.01f * SpatialIndexBenchmark_Random()));
+    }
+    for (int i = 0; i < queryCount; i++)
+    {
+        Vector3 center = centers[i % SPATIAL_INDEX_BENCHMARK_CLUSTERS];
+        queries[i] = NewVector3(center.x + 0.02f * SpatialIndexBenchmark_Random() - 0.005f, center.y + 0.02f * SpatialIndexBenchmark_Random() - 0.005f, center.z + 0.02f * SpatialIndexBenchmark_Random() - 0.005f);
+    }
+    SpatialIndexBenchmark_Run("Clustered", points, queries, (size_t)queryCount, radius * 0.1f);
+
+    free(queries);
+    Vector3Batch_Destroy(points);
+
+    return 0;
+}
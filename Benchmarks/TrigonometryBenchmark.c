@@ -0,0 +1,236 @@
+#include "Core.h"
+
+#include "Maths.h"
+#include "Utils/Timer.h"
+
+#include <math.h>
+
+// Measures the accuracy and the speed of every trigonometry accuracy tier on every supported instruction set,
+// against SinRad, CosRad and ArcTan2Rad called one angle at a time.
+// Build with -DCODE_CHARLIE_BUILD_BENCHMARKS=ON, run as ./TrigonometryBenchmark [angles] [rounds]
+
+#define TRIGONOMETRY_BENCHMARK_DEFAULT_ANGLES 4096
+#define TRIGONOMETRY_BENCHMARK_DEFAULT_ROUNDS 2000
+#define TRIGONOMETRY_BENCHMARK_RANGE 100.0f // angles are swept over [-range, range] radians, a few turns of a motor
+
+/// @brief Result of a benchmark scenario.
+typedef struct TrigonometryBenchmarkResult
+{
+    const char *title;
+    const char *level;
+    const char *accuracy;
+    double maximumError;
+    long long operations;
+    time_t nanoseconds;
+} TrigonometryBenchmarkResult;
+
+// Keeps the results alive, so the compiler cannot drop the measured work
+volatile float benchmarkSink;
+
+/// @brief Prints a scenario result as a table line.
+/// @param result Result to print.
+/// @param baseline Nanoseconds of the C library calls for the same work, for the speed up column.
+void TrigonometryBenchmark_Print(const TrigonometryBenchmarkResult *result, time_t baseline)
+{
+    double seconds = (double)result->nanoseconds / 1e9;
+
+    printf("%-8s %-8s %-8s %12.3g %10.2f %16.0f %8.2fx\n",
+           result->title,
+           result->level,
+           result->accuracy,
+           result->maximumError,
+           seconds * 1000.0,
+           seconds > 0.0 ? (double)result->operations / seconds : 0.0,
+           result->nanoseconds > 0 ? (double)baseline / (double)result->nanoseconds : 0.0);
+}
+
+/// @brief Gets the name of an accuracy tier.
+const char *TrigonometryBenchmark_GetAccuracyName(TrigAccuracy accuracy)
+{
+    switch (accuracy)
+    {
+    case TrigAccuracy_Exact:
+        return "Exact";
+    case TrigAccuracy_Precise:
+        return "Precise";
+    case TrigAccuracy_Fast:
+        return "Fast";
+    default:
+        return "Unknown";
+    }
+}
+
+/// @brief Gets the maximum absolute error of sines and cosines against the double precision C library.
+double TrigonometryBenchmark_SinCosError(const float *angles, const float *sines, const float *cosines, size_t count)
+{
+    double maximumError = 0.0;
+    for (size_t i = 0; i < count; i++)
+    {
+        maximumError = fmax(maximumError, fabs((double)sines[i] - sin((double)angles[i])));
+        maximumError = fmax(maximumError, fabs((double)cosines[i] - cos((double)angles[i])));
+    }
+
+    return maximumError;
+}
+
+/// @brief Gets the maximum absolute error of angles against the double precision C library.
+double TrigonometryBenchmark_ArcTan2Error(const float *ys, const float *xs, const float *angles, size_t count)
+{
+    double maximumError = 0.0;
+    for (size_t i = 0; i < count; i++)
+    {
+        maximumError = fmax(maximumError, fabs((double)angles[i] - atan2((double)ys[i], (double)xs[i])));
+    }
+
+    return maximumError;
+}
+
+/// @brief Runs SinRad and CosRad one angle at a time, the code the array functions replace.
+time_t TrigonometryBenchmark_SinCosByValue(const float *angles, float *sines, float *cosines, size_t count, int rounds)
+{
+    Timer timer = Timer_CreateStack("Sin cos by value");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            sines[i] = SinRad(angles[i]);
+            cosines[i] = CosRad(angles[i]);
+        }
+
+        benchmarkSink = sines[(size_t)round % count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Runs SinCosRadArray with an accuracy tier on the used instruction set.
+time_t TrigonometryBenchmark_SinCosArray(const float *angles, float *sines, float *cosines, size_t count, int rounds, TrigAccuracy accuracy)
+{
+    Timer timer = Timer_CreateStack("Sin cos array");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        SinCosRadArray(angles, sines, cosines, count, accuracy);
+        benchmarkSink = sines[(size_t)round % count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Runs ArcTan2Rad one point at a time, the code the array functions replace.
+time_t TrigonometryBenchmark_ArcTan2ByValue(const float *ys, const float *xs, float *angles, size_t count, int rounds)
+{
+    Timer timer = Timer_CreateStack("Arc tangent by value");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            angles[i] = ArcTan2Rad(ys[i], xs[i]);
+        }
+
+        benchmarkSink = angles[(size_t)round % count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+/// @brief Runs ArcTan2RadArray with an accuracy tier on the used instruction set.
+time_t TrigonometryBenchmark_ArcTan2Array(const float *ys, const float *xs, float *angles, size_t count, int rounds, TrigAccuracy accuracy)
+{
+    Timer timer = Timer_CreateStack("Arc tangent array");
+    Timer_Start(&timer);
+
+    for (int round = 0; round < rounds; round++)
+    {
+        ArcTan2RadArray(ys, xs, angles, count, accuracy);
+        benchmarkSink = angles[(size_t)round % count];
+    }
+
+    Timer_Stop(&timer);
+    return Timer_GetElapsedNanoseconds(&timer);
+}
+
+int main(int argc, char **argv)
+{
+    int angleCount = argc > 1 ? atoi(argv[1]) : TRIGONOMETRY_BENCHMARK_DEFAULT_ANGLES;
+    int rounds = argc > 2 ? atoi(argv[2]) : TRIGONOMETRY_BENCHMARK_DEFAULT_ROUNDS;
+    angleCount = angleCount > 0 ? angleCount : TRIGONOMETRY_BENCHMARK_DEFAULT_ANGLES;
+    rounds = rounds > 0 ? rounds : TRIGONOMETRY_BENCHMARK_DEFAULT_ROUNDS;
+
+    size_t count = (size_t)angleCount;
+    long long operations = (long long)count * rounds;
+
+    float *angles = Simd_AllocateFloats(count);
+    float *sines = Simd_AllocateFloats(count);
+    float *cosines = Simd_AllocateFloats(count);
+    float *ys = Simd_AllocateFloats(count);
+    float *xs = Simd_AllocateFloats(count);
+
+    // Evenly swept angles, and points on circles of changing radius around the origin in every quadrant
+    for (size_t i = 0; i < count; i++)
+    {
+        angles[i] = -TRIGONOMETRY_BENCHMARK_RANGE + 2.0f * TRIGONOMETRY_BENCHMARK_RANGE * (float)i / (float)count;
+
+        float radius = 0.01f + (float)(i % 101);
+        ys[i] = radius * sinf(angles[i]);
+        xs[i] = radius * cosf(angles[i]);
+    }
+
+    SimdLevel detectedLevel = Simd_GetLevel();
+    SimdLevel levels[] = {SimdLevel_Scalar, SimdLevel_SSE2, SimdLevel_AVX2, SimdLevel_NEON};
+    TrigAccuracy accuracies[] = {TrigAccuracy_Exact, TrigAccuracy_Precise, TrigAccuracy_Fast};
+
+    time_t sinCosBaseline = TrigonometryBenchmark_SinCosByValue(angles, sines, cosines, count, rounds);
+    TrigonometryBenchmarkResult sinCosByValue = {"SinCos", "-", "By value", TrigonometryBenchmark_SinCosError(angles, sines, cosines, count), operations, sinCosBaseline};
+
+    time_t arcTan2Baseline = TrigonometryBenchmark_ArcTan2ByValue(ys, xs, sines, count, rounds);
+    TrigonometryBenchmarkResult arcTan2ByValue = {"ArcTan2", "-", "By value", TrigonometryBenchmark_ArcTan2Error(ys, xs, sines, count), operations, arcTan2Baseline};
+
+    printf("Trigonometry benchmark, %zu angles, %d rounds, detected %s\n", count, rounds, Simd_GetLevelName(detectedLevel));
+    printf("%-8s %-8s %-8s %12s %10s %16s %9s\n", "Function", "Level", "Accuracy", "Max error", "Time (ms)", "Angles/second", "Speed up");
+    TrigonometryBenchmark_Print(&sinCosByValue, sinCosBaseline);
+    TrigonometryBenchmark_Print(&arcTan2ByValue, arcTan2Baseline);
+
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        // Levels the CPU does not have are skipped instead of being clamped to another level.
+        bool isSupported = levels[i] == SimdLevel_Scalar || levels[i] == detectedLevel || (levels[i] == SimdLevel_SSE2 && detectedLevel == SimdLevel_AVX2);
+        if (!isSupported)
+        {
+            continue;
+        }
+
+        Simd_SetLevel(levels[i]);
+
+        for (size_t a = 0; a < sizeof(accuracies) / sizeof(accuracies[0]); a++)
+        {
+            const char *accuracyName = TrigonometryBenchmark_GetAccuracyName(accuracies[a]);
+
+            time_t sinCosTime = TrigonometryBenchmark_SinCosArray(angles, sines, cosines, count, rounds, accuracies[a]);
+            TrigonometryBenchmarkResult sinCos = {"SinCos", Simd_GetLevelName(levels[i]), accuracyName, TrigonometryBenchmark_SinCosError(angles, sines, cosines, count), operations, sinCosTime};
+            TrigonometryBenchmark_Print(&sinCos, sinCosBaseline);
+
+            time_t arcTan2Time = TrigonometryBenchmark_ArcTan2Array(ys, xs, sines, count, rounds, accuracies[a]);
+            TrigonometryBenchmarkResult arcTan2 = {"ArcTan2", Simd_GetLevelName(levels[i]), accuracyName, TrigonometryBenchmark_ArcTan2Error(ys, xs, sines, count), operations, arcTan2Time};
+            TrigonometryBenchmark_Print(&arcTan2, arcTan2Baseline);
+        }
+    }
+
+    Simd_SetLevel(detectedLevel);
+
+    Simd_Free(xs);
+    Simd_Free(ys);
+    Simd_Free(cosines);
+    Simd_Free(sines);
+    Simd_Free(angles);
+
+    return 0;
+}
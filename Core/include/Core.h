@@ -103,7 +103,10 @@ void Core_DebugLog(const char *header, const char *file, int line, const char *f
 
 #pragma region Debug
 
+// Can be overridden by the build, benchmarks disable info logs to not measure the log file
+#ifndef DEBUG_INFO_ENABLED
 #define DEBUG_INFO_ENABLED true
+#endif
 #define DEBUG_WARNING_ENABLED true
 #define DEBUG_ERROR_ENABLED true
 #define DEBUG_ASSERT_ENABLED true
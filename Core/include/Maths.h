@@ -5,7 +5,18 @@
 #include "Maths/Algebra.h"
 #include "Maths/Arithmetic.h"
 #include "Maths/Complex.h"
+#include "Maths/ComplexBatch.h"
+#include "Maths/FFT.h"
+#include "Maths/FixedMatrices.h"
+#include "Maths/FixedPoint.h"
+#include "Maths/FixedVectors.h"
 #include "Maths/Geometry.h"
 #include "Maths/Matrices.h"
+#include "Maths/MatrixN.h"
+#include "Maths/Quaternion.h"
+#include "Maths/SensorFusion.h"
+#include "Maths/SpatialIndex.h"
 #include "Maths/Trigonometry.h"
 #include "Maths/Vectors.h"
+#include "Maths/VectorsBatch.h"
+#include "Maths/Simd.h"
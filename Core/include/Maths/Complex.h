@@ -21,6 +21,12 @@ Complex Complex_Add(Complex complex1, Complex complex2);
 /// @return The resulting complex number after multiplication.
 Complex Complex_Multiply(Complex complex, float scalar);
 
+/// @brief Multiplies two complex numbers, (a + bi)(c + di) = (ac - bd) + (ad + bc)i.
+/// @param complex1 The first complex number.
+/// @param complex2 The second complex number.
+/// @return The complex product of the two complex numbers.
+Complex Complex_Product(Complex complex1, Complex complex2);
+
 /// @brief Calculates the magnitude (length) of a complex number.
 /// @param complex The complex number to calculate the magnitude for.
 /// @return The magnitude of the complex number.
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/Complex.h"
+#include "Maths/Simd.h"
+
+#pragma region typedefs
+
+/// @brief Complex numbers stored as a structure of arrays, one aligned array for the real parts and one for the imaginary parts. Processed with the SIMD kernels of the CPU. Should be used with helper functions.
+typedef struct ComplexBatch
+{
+    float *real;
+    float *imaginary;
+    size_t count;
+} ComplexBatch;
+
+#pragma endregion typedefs
+
+/// @brief Creates a batch of complex numbers, all zero. Both parts are allocated in a single block, each aligned to SIMD_ALIGNMENT.
+/// @param count Count of the complex numbers.
+/// @return Pointer to the created batch.
+ComplexBatch *ComplexBatch_Create(size_t count);
+
+/// @brief Destroys a batch of complex numbers and frees its parts.
+/// @param batch The batch to destroy.
+void ComplexBatch_Destroy(ComplexBatch *batch);
+
+/// @brief Sets a complex number of a batch.
+/// @param batch The batch.
+/// @param index Index of the complex number.
+/// @param complex The complex number to set.
+void ComplexBatch_Set(ComplexBatch *batch, size_t index, Complex complex);
+
+/// @brief Gets a complex number of a batch.
+/// @param batch The batch.
+/// @param index Index of the complex number.
+/// @return The complex number at the index.
+Complex ComplexBatch_Get(const ComplexBatch *batch, size_t index);
+
+/// @brief Sets the real parts of a batch from samples and the imaginary parts to zero, e.g. before the FFT of sensor or audio samples.
+/// @param batch The batch.
+/// @param samples Real samples, one per complex number of the batch.
+void ComplexBatch_SetReal(ComplexBatch *batch, const float *samples);
+
+/// @brief Adds the complex numbers of two batches pairwise, Complex_Add over the batch.
+/// @param batch1 The first batch.
+/// @param batch2 The second batch, same count with the first batch.
+/// @param result The batch to write the sums to. Can be one of the input batches.
+void ComplexBatch_Add(const ComplexBatch *batch1, const ComplexBatch *batch2, ComplexBatch *result);
+
+/// @brief Multiplies every complex number of a batch by a scalar, Complex_Multiply over the batch.
+/// @param batch The batch to multiply.
+/// @param scalar The scalar value.
+/// @param result The batch to write the products to. Can be the input batch.
+void ComplexBatch_Multiply(const ComplexBatch *batch, float scalar, ComplexBatch *result);
+
+/// @brief Multiplies the complex numbers of two batches pairwise, Complex_Product over the batch.
+/// @param batch1 The first batch.
+/// @param batch2 The second batch, same count with the first batch.
+/// @param result The batch to write the products to. Can be one of the input batches.
+void ComplexBatch_Product(const ComplexBatch *batch1, const ComplexBatch *batch2, ComplexBatch *result);
+
+/// @brief Conjugates every complex number of a batch, Complex_Conjugate over the batch.
+/// @param batch The batch to conjugate.
+/// @param result The batch to write the conjugates to. Can be the input batch.
+void ComplexBatch_Conjugate(const ComplexBatch *batch, ComplexBatch *result);
+
+/// @brief Calculates the squared magnitudes of the complex numbers of a batch, the power spectrum of an FFT result.
+/// @param batch The batch.
+/// @param results Array to write the squared magnitudes to, a float per complex number.
+void ComplexBatch_SquaredMagnitude(const ComplexBatch *batch, float *results);
+
+/// @brief Calculates the magnitudes of the complex numbers of a batch, Complex_Magnitude over the batch.
+/// @param batch The batch.
+/// @param results Array to write the magnitudes to, a float per complex number.
+void ComplexBatch_Magnitude(const ComplexBatch *batch, float *results);
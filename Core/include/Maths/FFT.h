@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/ComplexBatch.h"
+
+#pragma region typedefs
+
+/// @brief Precomputed tables of a fast Fourier transform size. Created once and shared by every transform of the same size. Should be used with helper functions.
+typedef struct FFTPlan
+{
+    size_t size;               // Count of the samples, a power of 2
+    unsigned int *bitReversal; // Index of every sample after the bit reversal permutation
+    float *twiddles;           // Twiddle factors of every radix 4 stage, one stage after another
+} FFTPlan;
+
+#pragma endregion typedefs
+
+/// @brief Creates the tables of a fast Fourier transform size.
+/// @param size Count of the samples of a transform, a power of 2.
+/// @return Pointer to the created plan.
+FFTPlan *FFTPlan_Create(size_t size);
+
+/// @brief Destroys a plan and frees its tables.
+/// @param plan The plan to destroy.
+void FFTPlan_Destroy(FFTPlan *plan);
+
+/// @brief Transforms a batch from the time domain to the frequency domain in place, with radix 4 stages on the SIMD kernels of the CPU and a radix 2 stage for odd powers of 2.
+/// @param plan The plan of the batch count.
+/// @param batch The batch to transform, count same with the plan size. Bin k is the frequency k * sample rate / size, bins above size / 2 are the negative frequencies.
+/// @note Not normalized, a constant signal of 1 gives size at bin 0.
+void FFT_Forward(const FFTPlan *plan, ComplexBatch *batch);
+
+/// @brief Transforms a batch from the frequency domain back to the time domain in place. Normalized, so the inverse of the forward transform gives the samples back.
+/// @param plan The plan of the batch count.
+/// @param batch The batch to transform, count same with the plan size.
+void FFT_Inverse(const FFTPlan *plan, ComplexBatch *batch);
+
+/// @brief Gets the frequency of a bin of a forward transform.
+/// @param plan The plan of the transform.
+/// @param bin Index of the bin, below size / 2 for positive frequencies.
+/// @param sampleRate Sample rate of the transformed samples in Hz.
+/// @return Frequency of the bin in Hz.
+float FFT_GetBinFrequency(const FFTPlan *plan, size_t bin, float sampleRate);
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/FixedPoint.h"
+#include "Maths/FixedVectors.h"
+#include "Maths/Matrices.h"
+
+#pragma region typedefs
+
+/// @brief Represents a 2x2 matrix of Q16.16 fixed-point values.
+typedef struct FixedMatrix2
+{
+    Fixed matrix[2][2];
+} FixedMatrix2;
+
+/// @brief Represents a 3x3 matrix of Q16.16 fixed-point values.
+typedef struct FixedMatrix3
+{
+    Fixed matrix[3][3];
+} FixedMatrix3;
+
+/// @brief Represents a 4x4 matrix of Q16.16 fixed-point values.
+typedef struct FixedMatrix4
+{
+    Fixed matrix[4][4];
+} FixedMatrix4;
+
+#pragma endregion typedefs
+
+#pragma region FixedMatrix2
+
+/// @brief Creates a 2x2 fixed-point identity matrix.
+/// @return The identity matrix.
+FixedMatrix2 FixedMatrix2_Identity();
+
+/// @brief Converts a 2x2 float matrix to a fixed-point matrix, saturated to the range.
+/// @param matrix Pointer to the matrix to convert.
+/// @return The resulting fixed-point matrix.
+FixedMatrix2 FixedMatrix2_FromFloat(const Matrix2 *matrix);
+
+/// @brief Converts a 2x2 fixed-point matrix to a float matrix.
+/// @param matrix Pointer to the matrix to convert.
+/// @return The resulting float matrix.
+Matrix2 FixedMatrix2_ToFloat(const FixedMatrix2 *matrix);
+
+/// @brief Adds two 2x2 fixed-point matrices, saturated to the range.
+/// @param matrix1 Pointer to the first matrix.
+/// @param matrix2 Pointer to the second matrix.
+/// @return The resulting matrix after addition.
+FixedMatrix2 FixedMatrix2_Add(const FixedMatrix2 *matrix1, const FixedMatrix2 *matrix2);
+
+/// @brief Multiplies a 2x2 fixed-point matrix by a scalar, saturated to the range.
+/// @param matrix Pointer to the matrix to multiply.
+/// @param scalar The scalar value.
+/// @return The resulting matrix after multiplication.
+FixedMatrix2 FixedMatrix2_Multiply(const FixedMatrix2 *matrix, Fixed scalar);
+
+/// @brief Calculates the dot product of two 2x2 fixed-point matrices, every element summed in 64 bits and saturated once.
+/// @param matrix1 Pointer to the first matrix.
+/// @param matrix2 Pointer to the second matrix.
+/// @return The resulting matrix after the dot product.
+FixedMatrix2 FixedMatrix2_Dot(const FixedMatrix2 *matrix1, const FixedMatrix2 *matrix2);
+
+/// @brief Transposes a 2x2 fixed-point matrix.
+/// @param matrix Pointer to the matrix to transpose.
+/// @return The transposed matrix.
+FixedMatrix2 FixedMatrix2_Transpose(const FixedMatrix2 *matrix);
+
+/// @brief Multiplies a 2D fixed-point vector by a 2x2 fixed-point matrix, the vector as a column.
+/// @param matrix Pointer to the matrix.
+/// @param vector The vector to transform.
+/// @return The transformed vector.
+FixedVector2 FixedMatrix2_MultiplyVector(const FixedMatrix2 *matrix, FixedVector2 vector);
+
+#pragma endregion FixedMatrix2
+
+#pragma region FixedMatrix3
+
+/// @brief Creates a 3x3 fixed-point identity matrix.
+/// @return The identity matrix.
+FixedMatrix3 FixedMatrix3_Identity();
+
+/// @brief Converts a 3x3 float matrix to a fixed-point matrix, saturated to the range.
+/// @param matrix Pointer to the matrix to convert.
+/// @return The resulting fixed-point matrix.
+FixedMatrix3 FixedMatrix3_FromFloat(const Matrix3 *matrix);
+
+/// @brief Converts a 3x3 fixed-point matrix to a float matrix.
+/// @param matrix Pointer to the matrix to convert.
+/// @return The resulting float matrix.
+Matrix3 FixedMatrix3_ToFloat(const FixedMatrix3 *matrix);
+
+/// @brief Adds two 3x3 fixed-point matrices, saturated to the range.
+/// @param matrix1 Pointer to the first matrix.
+/// @param matrix2 Pointer to the second matrix.
+/// @return The resulting matrix after addition.
+FixedMatrix3 FixedMatrix3_Add(const FixedMatrix3 *matrix1, const FixedMatrix3 *matrix2);
+
+/// @brief Multiplies a 3x3 fixed-point matrix by a scalar, saturated to the range.
+/// @param matrix Pointer to the matrix to multiply.
+/// @param scalar The scalar value.
+/// @return The resulting matrix after multiplication.
+FixedMatrix3 FixedMatrix3_Multiply(const FixedMatrix3 *matrix, Fixed scalar);
+
+/// @brief Calculates the dot product of two 3x3 fixed-point matrices, every element summed in 64 bits and saturated once.
+/// @param matrix1 Pointer to the first matrix.
+/// @param matrix2 Pointer to the second matrix.
+/// @return The resulting matrix after the dot product.
+FixedMatrix3 FixedMatrix3_Dot(const FixedMatrix3 *matrix1, const FixedMatrix3 *matrix2);
+
+/// @brief Transposes a 3x3 fixed-point matrix.
+/// @param matrix Pointer to the matrix to transpose.
+/// @return The transposed matrix.
+FixedMatrix3 FixedMatrix3_Transpose(const FixedMatrix3 *matrix);
+
+/// @brief Multiplies a 3D fixed-point vector by a 3x3 fixed-point matrix, the vector as a column.
+/// @param matrix Pointer to the matrix.
+/// @param vector The vector to transform.
+/// @return The transformed vector.
+FixedVector3 FixedMatrix3_MultiplyVector(const FixedMatrix3 *matrix, FixedVector3 vector);
+
+#pragma endregion FixedMatrix3
+
+#pragma region FixedMatrix4
+
+/// @brief Creates a 4x4 fixed-point identity matrix.
+/// @return The identity matrix.
+FixedMatrix4 FixedMatrix4_Identity();
+
+/// @brief Converts a 4x4 float matrix to a fixed-point matrix, saturated to the range.
+/// @param matrix Pointer to the matrix to convert.
+/// @return The resulting fixed-point matrix.
+FixedMatrix4 FixedMatrix4_FromFloat(const Matrix4 *matrix);
+
+/// @brief Converts a 4x4 fixed-point matrix to a float matrix.
+/// @param matrix Pointer to the matrix to convert.
+/// @return The resulting float matrix.
+Matrix4 FixedMatrix4_ToFloat(const FixedMatrix4 *matrix);
+
+/// @brief Adds two 4x4 fixed-point matrices, saturated to the range.
+/// @param matrix1 Pointer to the first matrix.
+/// @param matrix2 Pointer to the second matrix.
+/// @return The resulting matrix after addition.
+FixedMatrix4 FixedMatrix4_Add(const FixedMatrix4 *matrix1, const FixedMatrix4 *matrix2);
+
+/// @brief Multiplies a 4x4 fixed-point matrix by a scalar, saturated to the range.
+/// @param matrix Pointer to the matrix to multiply.
+/// @param scalar The scalar value.
+/// @return The resulting matrix after multiplication.
+FixedMatrix4 FixedMatrix4_Multiply(const FixedMatrix4 *matrix, Fixed scalar);
+
+/// @brief Calculates the dot product of two 4x4 fixed-point matrices, every element summed in 64 bits and saturated once.
+/// @param matrix1 Pointer to the first matrix.
+/// @param matrix2 Pointer to the second matrix.
+/// @return The resulting matrix after the dot product.
+FixedMatrix4 FixedMatrix4_Dot(const FixedMatrix4 *matrix1, const FixedMatrix4 *matrix2);
+
+/// @brief Transposes a 4x4 fixed-point matrix.
+/// @param matrix Pointer to the matrix to transpose.
+/// @return The transposed matrix.
+FixedMatrix4 FixedMatrix4_Transpose(const FixedMatrix4 *matrix);
+
+/// @brief Multiplies a 4D fixed-point vector by a 4x4 fixed-point matrix, the vector as a column.
+/// @param matrix Pointer to the matrix.
+/// @param vector The vector to transform.
+/// @return The transformed vector.
+FixedVector4 FixedMatrix4_MultiplyVector(const FixedMatrix4 *matrix, FixedVector4 vector);
+
+#pragma endregion FixedMatrix4
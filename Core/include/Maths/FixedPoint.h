@@ -0,0 +1,211 @@
+#pragma once
+
+#include "Core.h"
+
+#include <stdint.h>
+
+#pragma region typedefs
+
+// Signed Q16.16 fixed-point number, 16 integer bits and 16 fraction bits. Range is about [-32768, 32768) with a resolution of 1 / 65536.
+// Arithmetic saturates to the range instead of wrapping. For targets without an FPU, can be used with helper functions.
+typedef int32_t Fixed;
+
+// Signed Q1.15 fixed-point number, a sign bit and 15 fraction bits. Range is [-1, 1) with a resolution of 1 / 32768.
+// Arithmetic saturates to the range instead of wrapping. Suited to samples, gains and filter coefficients, can be used with helper functions.
+typedef int16_t Fixed15;
+
+#define FIXED_FRACTION_BITS 16
+#define FIXED_ONE ((Fixed)1 << FIXED_FRACTION_BITS)
+#define FIXED_HALF ((Fixed)1 << (FIXED_FRACTION_BITS - 1))
+#define FIXED_MAX INT32_MAX
+#define FIXED_MIN INT32_MIN
+#define FIXED_PI ((Fixed)205887)        // PI rounded to Q16.16
+#define FIXED_HALF_PI ((Fixed)102944)   // PI / 2 rounded to Q16.16
+#define FIXED_TWO_PI ((Fixed)411775)    // 2 * PI rounded to Q16.16
+
+#define FIXED15_FRACTION_BITS 15
+#define FIXED15_MAX INT16_MAX // 1 - 1 / 32768, 1 itself is not representable
+#define FIXED15_MIN INT16_MIN // -1
+
+// Lookup table sizes of the trigonometry functions. Entries between two table values are interpolated linearly.
+#define FIXED_SINE_TABLE_SIZE 256        // entries per quarter turn
+#define FIXED_ARC_TANGENT_TABLE_SIZE 256 // entries over [0, 1]
+
+#define NewFixed(value) ((Fixed)((value) * 65536.0f + ((value) < 0 ? -0.5f : 0.5f)))
+
+#pragma endregion typedefs
+
+#pragma region Fixed
+
+/// @brief Clamps a 64 bit intermediate of fixed-point arithmetic to the Q16.16 range.
+/// @param value The intermediate value.
+/// @return The saturated value.
+Fixed Fixed_Saturate(int64_t value);
+
+/// @brief Converts a float to Q16.16, rounded to the nearest and saturated to the range.
+/// @param value The float value.
+/// @return The fixed-point value.
+Fixed Fixed_FromFloat(float value);
+
+/// @brief Converts a Q16.16 value to float.
+/// @param value The fixed-point value.
+/// @return The float value.
+float Fixed_ToFloat(Fixed value);
+
+/// @brief Converts an integer to Q16.16, saturated to the range.
+/// @param value The integer value.
+/// @return The fixed-point value.
+Fixed Fixed_FromInt(int value);
+
+/// @brief Converts a Q16.16 value to an integer, rounded to the nearest.
+/// @param value The fixed-point value.
+/// @return The integer value.
+int Fixed_ToInt(Fixed value);
+
+/// @brief Adds two Q16.16 values, saturated to the range.
+/// @param a The first value.
+/// @param b The second value.
+/// @return The sum.
+Fixed Fixed_Add(Fixed a, Fixed b);
+
+/// @brief Subtracts a Q16.16 value from another, saturated to the range.
+/// @param a The value to subtract from.
+/// @param b The value to subtract.
+/// @return The difference.
+Fixed Fixed_Subtract(Fixed a, Fixed b);
+
+/// @brief Multiplies two Q16.16 values with a 64 bit intermediate, rounded to the nearest and saturated to the range.
+/// @param a The first value.
+/// @param b The second value.
+/// @return The product.
+Fixed Fixed_Multiply(Fixed a, Fixed b);
+
+/// @brief Divides a Q16.16 value by another with a 64 bit intermediate, saturated to the range.
+/// @param a The dividend.
+/// @param b The divisor. Dividing by zero saturates to the sign of the dividend, 0 / 0 is 0.
+/// @return The quotient, rounded toward zero.
+Fixed Fixed_Divide(Fixed a, Fixed b);
+
+/// @brief Gets the absolute value of a Q16.16 value, saturated, so FIXED_MIN gives FIXED_MAX.
+/// @param value The value.
+/// @return The absolute value.
+Fixed Fixed_Abs(Fixed value);
+
+/// @brief Gets the square root of a Q16.16 value with integer operations only.
+/// @param value The value. Negative values give 0.
+/// @return The square root, rounded toward zero.
+Fixed Fixed_SquareRoot(Fixed value);
+
+/// @brief Gets the integer square root of a 64 bit value, e.g. the magnitude of a sum of Q32.32 squares as Q16.16.
+/// @param value The value.
+/// @return The square root, rounded toward zero.
+uint32_t Fixed_IntegerSquareRoot(uint64_t value);
+
+/// @brief Linearly interpolates between two Q16.16 values.
+/// @param startValue The starting value.
+/// @param endValue The ending value.
+/// @param time The interpolation factor, FIXED_ONE is the ending value.
+/// @return The interpolated value, saturated to the range.
+Fixed Fixed_Lerp(Fixed startValue, Fixed endValue, Fixed time);
+
+#pragma endregion Fixed
+
+#pragma region Fixed15
+
+/// @brief Converts a float to Q1.15, rounded to the nearest and saturated to the range.
+/// @param value The float value.
+/// @return The fixed-point value.
+Fixed15 Fixed15_FromFloat(float value);
+
+/// @brief Converts a Q1.15 value to float.
+/// @param value The fixed-point value.
+/// @return The float value.
+float Fixed15_ToFloat(Fixed15 value);
+
+/// @brief Converts a Q16.16 value to Q1.15, rounded to the nearest and saturated to the range.
+/// @param value The Q16.16 value.
+/// @return The Q1.15 value.
+Fixed15 Fixed15_FromFixed(Fixed value);
+
+/// @brief Converts a Q1.15 value to Q16.16, exact.
+/// @param value The Q1.15 value.
+/// @return The Q16.16 value.
+Fixed Fixed15_ToFixed(Fixed15 value);
+
+/// @brief Adds two Q1.15 values, saturated to the range.
+/// @param a The first value.
+/// @param b The second value.
+/// @return The sum.
+Fixed15 Fixed15_Add(Fixed15 a, Fixed15 b);
+
+/// @brief Subtracts a Q1.15 value from another, saturated to the range.
+/// @param a The value to subtract from.
+/// @param b The value to subtract.
+/// @return The difference.
+Fixed15 Fixed15_Subtract(Fixed15 a, Fixed15 b);
+
+/// @brief Multiplies two Q1.15 values, rounded to the nearest and saturated, so -1 * -1 gives FIXED15_MAX.
+/// @param a The first value.
+/// @param b The second value.
+/// @return The product.
+Fixed15 Fixed15_Multiply(Fixed15 a, Fixed15 b);
+
+/// @brief Multiplies two Q1.15 arrays pairwise and accumulates the products in 64 bits, e.g. a FIR filter tap sum.
+/// @param values The first array.
+/// @param coefficients The second array, same count with the first array.
+/// @param count Count of the values.
+/// @return The sum of the products as Q16.16, saturated to the range.
+Fixed Fixed15_DotArray(const Fixed15 *values, const Fixed15 *coefficients, size_t count);
+
+#pragma endregion Fixed15
+
+#pragma region Trigonometry
+
+/// @brief Converts a Q16.16 degree value to radians.
+/// @param degree The angle in degrees.
+/// @return The angle in radians.
+Fixed Fixed_Deg2Rad(Fixed degree);
+
+/// @brief Converts a Q16.16 radian value to degrees.
+/// @param radian The angle in radians.
+/// @return The angle in degrees, saturated to the range.
+Fixed Fixed_Rad2Deg(Fixed radian);
+
+/// @brief Gets the sine of a Q16.16 radian value from a quarter wave lookup table, about 2e-5 maximum absolute error.
+/// @param radian The angle in radians, any value of the range.
+/// @return The sine.
+Fixed Fixed_SinRad(Fixed radian);
+
+/// @brief Gets the cosine of a Q16.16 radian value from a quarter wave lookup table, about 2e-5 maximum absolute error.
+/// @param radian The angle in radians, any value of the range.
+/// @return The cosine.
+Fixed Fixed_CosRad(Fixed radian);
+
+/// @brief Gets the sine and the cosine of a Q16.16 radian value with a single angle reduction.
+/// @param radian The angle in radians, any value of the range.
+/// @param sine Pointer to write the sine to.
+/// @param cosine Pointer to write the cosine to.
+void Fixed_SinCosRad(Fixed radian, Fixed *sine, Fixed *cosine);
+
+/// @brief Gets the sine of a Q16.16 degree value.
+/// @param degree The angle in degrees.
+/// @return The sine.
+Fixed Fixed_SinDeg(Fixed degree);
+
+/// @brief Gets the cosine of a Q16.16 degree value.
+/// @param degree The angle in degrees.
+/// @return The cosine.
+Fixed Fixed_CosDeg(Fixed degree);
+
+/// @brief Gets the tangent of a Q16.16 radian value, the sine divided by the cosine.
+/// @param radian The angle in radians.
+/// @return The tangent, saturated to the range near the poles.
+Fixed Fixed_TanRad(Fixed radian);
+
+/// @brief Gets the angle of a point from a lookup table, about 3e-5 maximum absolute error.
+/// @param y The y coordinate of the point.
+/// @param x The x coordinate of the point.
+/// @return The angle in radians, in [-PI, PI]. 0 for the origin.
+Fixed Fixed_ArcTan2Rad(Fixed y, Fixed x);
+
+#pragma endregion Trigonometry
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/FixedPoint.h"
+#include "Maths/Vectors.h"
+
+#pragma region typedefs
+
+// A vector that contains 2 Q16.16 fixed-point values. Can be used with helper functions.
+typedef struct FixedVector2
+{
+    Fixed x;
+    Fixed y;
+} FixedVector2;
+
+// A vector that contains 3 Q16.16 fixed-point values. Can be used with helper functions.
+typedef struct FixedVector3
+{
+    Fixed x;
+    Fixed y;
+    Fixed z;
+} FixedVector3;
+
+// A vector that contains 4 Q16.16 fixed-point values. Can be used with helper functions.
+typedef struct FixedVector4
+{
+    Fixed x;
+    Fixed y;
+    Fixed z;
+    Fixed w;
+} FixedVector4;
+
+#define NewFixedVector2(x, y) \
+    (FixedVector2) { x, y }
+#define NewFixedVector3(x, y, z) \
+    (FixedVector3) { x, y, z }
+#define NewFixedVector4(x, y, z, w) \
+    (FixedVector4) { x, y, z, w }
+
+#pragma endregion typedefs
+
+#pragma region FixedVector2
+
+/// @brief Converts a 2D float vector to a 2D fixed-point vector, saturated to the range.
+/// @param vector The vector to convert.
+/// @return The resulting fixed-point vector.
+FixedVector2 FixedVector2_FromFloat(Vector2 vector);
+
+/// @brief Converts a 2D fixed-point vector to a 2D float vector.
+/// @param vector The vector to convert.
+/// @return The resulting float vector.
+Vector2 FixedVector2_ToFloat(FixedVector2 vector);
+
+/// @brief Adds two 2D fixed-point vectors, saturated to the range.
+/// @param vector1 The first vector.
+/// @param vector2 The second vector.
+/// @return The resulting vector after addition.
+FixedVector2 FixedVector2_Add(FixedVector2 vector1, FixedVector2 vector2);
+
+/// @brief Multiplies a 2D fixed-point vector by a scalar, saturated to the range.
+/// @param vector The vector to multiply.
+/// @param scalar The scalar value.
+/// @return The resulting vector after multiplication.
+FixedVector2 FixedVector2_Multiply(FixedVector2 vector, Fixed scalar);
+
+/// @brief Normalizes a 2D fixed-point vector to have a magnitude of 1.
+/// @param vector The vector to normalize.
+/// @return The normalized vector, zero for a zero vector.
+FixedVector2 FixedVector2_Normalized(FixedVector2 vector);
+
+/// @brief Calculates the magnitude (length) of a 2D fixed-point vector, the squares summed in 64 bits.
+/// @param vector The vector to calculate the magnitude for.
+/// @return The magnitude of the vector, saturated to the range.
+Fixed FixedVector2_Magnitude(FixedVector2 vector);
+
+/// @brief Calculates the dot product of two 2D fixed-point vectors, the products summed in 64 bits.
+/// @param vector1 The first vector.
+/// @param vector2 The second vector.
+/// @return The dot product of the two vectors, saturated to the range.
+Fixed FixedVector2_Dot(FixedVector2 vector1, FixedVector2 vector2);
+
+/// @brief Linearly interpolates between two 2D fixed-point vectors.
+/// @param startVector The starting vector.
+/// @param endVector The ending vector.
+/// @param time The interpolation factor, 0 to FIXED_ONE.
+/// @return The interpolated vector.
+FixedVector2 FixedVector2_Lerp(FixedVector2 startVector, FixedVector2 endVector, Fixed time);
+
+#pragma endregion FixedVector2
+
+#pragma region FixedVector3
+
+/// @brief Converts a 3D float vector to a 3D fixed-point vector, saturated to the range.
+/// @param vector The vector to convert.
+/// @return The resulting fixed-point vector.
+FixedVector3 FixedVector3_FromFloat(Vector3 vector);
+
+/// @brief Converts a 3D fixed-point vector to a 3D float vector.
+/// @param vector The vector to convert.
+/// @return The resulting float vector.
+Vector3 FixedVector3_ToFloat(FixedVector3 vector);
+
+/// @brief Adds two 3D fixed-point vectors, saturated to the range.
+/// @param vector1 The first vector.
+/// @param vector2 The second vector.
+/// @return The resulting vector after addition.
+FixedVector3 FixedVector3_Add(FixedVector3 vector1, FixedVector3 vector2);
+
+/// @brief Multiplies a 3D fixed-point vector by a scalar, saturated to the range.
+/// @param vector The vector to multiply.
+/// @param scalar The scalar value.
+/// @return The resulting vector after multiplication.
+FixedVector3 FixedVector3_Multiply(FixedVector3 vector, Fixed scalar);
+
+/// @brief Normalizes a 3D fixed-point vector to have a magnitude of 1.
+/// @param vector The vector to normalize.
+/// @return The normalized vector, zero for a zero vector.
+FixedVector3 FixedVector3_Normalized(FixedVector3 vector);
+
+/// @brief Calculates the magnitude (length) of a 3D fixed-point vector, the squares summed in 64 bits.
+/// @param vector The vector to calculate the magnitude for.
+/// @return The magnitude of the vector, saturated to the range.
+Fixed FixedVector3_Magnitude(FixedVector3 vector);
+
+/// @brief Calculates the dot product of two 3D fixed-point vectors, the products summed in 64 bits.
+/// @param vector1 The first vector.
+/// @param vector2 The second vector.
+/// @return The dot product of the two vectors, saturated to the range.
+Fixed FixedVector3_Dot(FixedVector3 vector1, FixedVector3 vector2);
+
+/// @brief Linearly interpolates between two 3D fixed-point vectors.
+/// @param startVector The starting vector.
+/// @param endVector The ending vector.
+/// @param time The interpolation factor, 0 to FIXED_ONE.
+/// @return The interpolated vector.
+FixedVector3 FixedVector3_Lerp(FixedVector3 startVector, FixedVector3 endVector, Fixed time);
+
+#pragma endregion FixedVector3
+
+#pragma region FixedVector4
+
+/// @brief Converts a 4D float vector to a 4D fixed-point vector, saturated to the range.
+/// @param vector The vector to convert.
+/// @return The resulting fixed-point vector.
+FixedVector4 FixedVector4_FromFloat(Vector4 vector);
+
+/// @brief Converts a 4D fixed-point vector to a 4D float vector.
+/// @param vector The vector to convert.
+/// @return The resulting float vector.
+Vector4 FixedVector4_ToFloat(FixedVector4 vector);
+
+/// @brief Adds two 4D fixed-point vectors, saturated to the range.
+/// @param vector1 The first vector.
+/// @param vector2 The second vector.
+/// @return The resulting vector after addition.
+FixedVector4 FixedVector4_Add(FixedVector4 vector1, FixedVector4 vector2);
+
+/// @brief Multiplies a 4D fixed-point vector by a scalar, saturated to the range.
+/// @param vector The vector to multiply.
+/// @param scalar The scalar value.
+/// @return The resulting vector after multiplication.
+FixedVector4 FixedVector4_Multiply(FixedVector4 vector, Fixed scalar);
+
+/// @brief Normalizes a 4D fixed-point vector to have a magnitude of 1.
+/// @param vector The vector to normalize.
+/// @return The normalized vector, zero for a zero vector.
+FixedVector4 FixedVector4_Normalized(FixedVector4 vector);
+
+/// @brief Calculates the magnitude (length) of a 4D fixed-point vector, the squares summed in 64 bits.
+/// @param vector The vector to calculate the magnitude for.
+/// @return The magnitude of the vector, saturated to the range.
+Fixed FixedVector4_Magnitude(FixedVector4 vector);
+
+/// @brief Calculates the dot product of two 4D fixed-point vectors, the products summed in 64 bits.
+/// @param vector1 The first vector.
+/// @param vector2 The second vector.
+/// @return The dot product of the two vectors, saturated to the range.
+Fixed FixedVector4_Dot(FixedVector4 vector1, FixedVector4 vector2);
+
+/// @brief Linearly interpolates between two 4D fixed-point vectors.
+/// @param startVector The starting vector.
+/// @param endVector The ending vector.
+/// @param time The interpolation factor, 0 to FIXED_ONE.
+/// @return The interpolated vector.
+FixedVector4 FixedVector4_Lerp(FixedVector4 startVector, FixedVector4 endVector, Fixed time);
+
+#pragma endregion FixedVector4
@@ -2,6 +2,52 @@
 
 #include "Core.h"
 
+#include "Maths/Vectors.h"
+
+#pragma region typedefs
+
+/// @brief Axis aligned bounding box. A box with a min greater than its max on any axis is empty. Can be used with helper functions.
+typedef struct AABB
+{
+    Vector3 min;
+    Vector3 max;
+} AABB;
+
+/// @brief Half line from an origin along a direction. Distances along the ray are in units of the direction, so a unit direction gives world distances. Can be used with helper functions.
+typedef struct Ray
+{
+    Vector3 origin;
+    Vector3 direction;
+} Ray;
+
+/// @brief Line segment between two points. Can be used with helper functions.
+typedef struct Segment
+{
+    Vector3 start;
+    Vector3 end;
+} Segment;
+
+/// @brief Sphere of a center and a radius. Can be used with helper functions.
+typedef struct Sphere
+{
+    Vector3 center;
+    float radius;
+} Sphere;
+
+#define NewAABB(min, max) \
+    (AABB) { min, max }
+
+#define NewRay(origin, direction) \
+    (Ray) { origin, direction }
+
+#define NewSegment(start, end) \
+    (Segment) { start, end }
+
+#define NewSphere(center, radius) \
+    (Sphere) { center, radius }
+
+#pragma endregion typedefs
+
 // Returns the perimeter of a circle given its radius
 float PerimeterOfCircle(float radius);
 
@@ -13,3 +59,138 @@ float SurfaceAreaOfSphere(float radius);
 
 // Returns the volume of a sphere given its radius
 float VolumeOfSphere(float radius);
+
+#pragma region AABB
+
+/// @brief Creates an empty box, which grows to exactly the first point or box merged into it.
+/// @return The empty box.
+AABB AABB_Empty();
+
+/// @brief Creates the bounding box of points.
+/// @param points The points.
+/// @param count Count of the points.
+/// @return The bounding box, empty for no points.
+AABB AABB_FromPoints(const Vector3 *points, size_t count);
+
+/// @brief Grows a box to contain a point.
+/// @param box The box.
+/// @param point The point.
+/// @return The grown box.
+AABB AABB_Expand(AABB box, Vector3 point);
+
+/// @brief Merges two boxes.
+/// @param box1 The first box.
+/// @param box2 The second box.
+/// @return The smallest box containing both boxes.
+AABB AABB_Merge(AABB box1, AABB box2);
+
+/// @brief Checks if a box is empty.
+/// @param box The box.
+/// @return True if the box contains no point.
+bool AABB_IsEmpty(AABB box);
+
+/// @brief Gets the center of a box.
+/// @param box The box, not empty.
+/// @return The center.
+Vector3 AABB_Center(AABB box);
+
+/// @brief Gets the surface area of a box.
+/// @param box The box.
+/// @return The surface area, 0 for an empty box.
+float AABB_SurfaceArea(AABB box);
+
+/// @brief Checks if a box contains a point, points on the faces are inside.
+/// @param box The box.
+/// @param point The point.
+/// @return True if the point is inside the box.
+bool AABB_ContainsPoint(AABB box, Vector3 point);
+
+/// @brief Checks if two boxes overlap, touching boxes overlap.
+/// @param box1 The first box.
+/// @param box2 The second box.
+/// @return True if the boxes overlap.
+bool AABB_Intersects(AABB box1, AABB box2);
+
+/// @brief Calculates the squared distance from a point to a box, without a square root.
+/// @param box The box.
+/// @param point The point.
+/// @return The squared distance, 0 for a point inside the box.
+float AABB_SquaredDistance(AABB box, Vector3 point);
+
+#pragma endregion AABB
+
+#pragma region Sphere
+
+/// @brief Checks if a sphere contains a point, points on the surface are inside.
+/// @param sphere The sphere.
+/// @param point The point.
+/// @return True if the point is inside the sphere.
+bool Sphere_ContainsPoint(Sphere sphere, Vector3 point);
+
+/// @brief Checks if two spheres overlap.
+/// @param sphere1 The first sphere.
+/// @param sphere2 The second sphere.
+/// @return True if the spheres overlap.
+bool Sphere_Intersects(Sphere sphere1, Sphere sphere2);
+
+/// @brief Checks if a sphere and a box overlap.
+/// @param sphere The sphere.
+/// @param box The box.
+/// @return True if they overlap.
+bool Sphere_IntersectsAABB(Sphere sphere, AABB box);
+
+#pragma endregion Sphere
+
+#pragma region Ray
+
+/// @brief Gets a point along a ray.
+/// @param ray The ray.
+/// @param distance Distance from the origin, in units of the direction.
+/// @return The point.
+Vector3 Ray_At(Ray ray, float distance);
+
+/// @brief Intersects a ray with a box with the slab method.
+/// @param ray The ray. Zero direction components are handled, the ray is parallel to those slabs.
+/// @param box The box.
+/// @param distance Pointer to write the distance of the entry point to, 0 if the origin is inside the box. Can be NULL.
+/// @return True if the ray hits the box.
+bool Ray_IntersectAABB(Ray ray, AABB box, float *distance);
+
+/// @brief Intersects a ray with a sphere.
+/// @param ray The ray.
+/// @param sphere The sphere.
+/// @param distance Pointer to write the distance of the first hit in front of the origin to, 0 if the origin is inside the sphere. Can be NULL.
+/// @return True if the ray hits the sphere.
+bool Ray_IntersectSphere(Ray ray, Sphere sphere, float *distance);
+
+#pragma endregion Ray
+
+#pragma region Segment
+
+/// @brief Gets the closest point of a segment to a point.
+/// @param segment The segment.
+/// @param point The point.
+/// @return The closest point on the segment.
+Vector3 Segment_ClosestPoint(Segment segment, Vector3 point);
+
+/// @brief Calculates the squared distance from a point to a segment.
+/// @param segment The segment.
+/// @param point The point.
+/// @return The squared distance.
+float Segment_SquaredDistance(Segment segment, Vector3 point);
+
+/// @brief Intersects a segment with a box.
+/// @param segment The segment.
+/// @param box The box.
+/// @param fraction Pointer to write the fraction of the segment to the entry point to, in [0, 1]. Can be NULL.
+/// @return True if the segment touches the box.
+bool Segment_IntersectAABB(Segment segment, AABB box, float *fraction);
+
+/// @brief Intersects a segment with a sphere.
+/// @param segment The segment.
+/// @param sphere The sphere.
+/// @param fraction Pointer to write the fraction of the segment to the first hit to, in [0, 1]. Can be NULL.
+/// @return True if the segment touches the sphere.
+bool Segment_IntersectSphere(Segment segment, Sphere sphere, float *fraction);
+
+#pragma endregion Segment
@@ -16,10 +16,10 @@ typedef struct Matrix3
     float matrix[3][3];
 } Matrix3;
 
-/// @brief Represents a 4x4 matrix.
+/// @brief Represents a 4x4 matrix. Row major and aligned to 16 bytes, so a row is loaded to a SIMD register with a single aligned load.
 typedef struct Matrix4
 {
-    float matrix[4][4];
+    _Alignas(16) float matrix[4][4];
 } Matrix4;
 
 #pragma endregion typedefs
@@ -154,7 +154,7 @@ Matrix4 Matrix4_Add(const Matrix4 *matrix1, const Matrix4 *matrix2);
 /// @return The resulting matrix after multiplication.
 Matrix4 Matrix4_Multiply(const Matrix4 *matrix, float scalar);
 
-/// @brief Computes the dot product of two 4x4 matrices.
+/// @brief Computes the dot product of two 4x4 matrices with the SIMD kernels of the CPU.
 /// @param matrix1 Pointer to the first matrix.
 /// @param matrix2 Pointer to the second matrix.
 /// @return The resulting matrix after the dot product.
@@ -165,9 +165,9 @@ Matrix4 Matrix4_Dot(const Matrix4 *matrix1, const Matrix4 *matrix2);
 /// @return The transposed matrix.
 Matrix4 Matrix4_Transpose(const Matrix4 *matrix);
 
-/// @brief Computes the inverse of a 4x4 matrix.
+/// @brief Computes the inverse of a 4x4 matrix with the SIMD kernels of the CPU.
 /// @param matrix Pointer to the matrix to invert.
-/// @return The inverted matrix.
+/// @return The inverted matrix, a zero matrix if no inverse exists.
 Matrix4 Matrix4_Inverse(const Matrix4 *matrix);
 
 /// @brief Scales a 4x4 matrix.
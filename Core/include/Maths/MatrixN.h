@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/Simd.h"
+#include "Utils/Arena.h"
+#include "Utils/WorkerPool.h"
+
+#pragma region typedefs
+
+/// @brief Dense matrix of any size, row major. Rows of a created matrix start aligned to SIMD_ALIGNMENT, a row is padded to a multiple of 8 floats.
+/// A view is a block of another matrix sharing its data and its stride. Element (row, column) is data[row * stride + column]. Should be used with helper functions.
+typedef struct MatrixN
+{
+    float *data;
+    size_t rows;
+    size_t columns;
+    size_t stride; // floats from the start of a row to the start of the next one, at least columns
+} MatrixN;
+
+#pragma endregion typedefs
+
+/// @brief Creates a matrix on the heap, all zero.
+/// @param rows Count of the rows.
+/// @param columns Count of the columns.
+/// @return Pointer to the created matrix. Should be destroyed with MatrixN_Destroy.
+MatrixN *MatrixN_Create(size_t rows, size_t columns);
+
+/// @brief Creates a matrix in an arena, all zero. Freed with the arena, should not be destroyed.
+/// @param arena Arena to allocate the matrix and its data from.
+/// @param rows Count of the rows.
+/// @param columns Count of the columns.
+/// @return Pointer to the created matrix, or NULL if the arena does not have enough space left.
+MatrixN *MatrixN_CreateInArena(Arena *arena, size_t rows, size_t columns);
+
+/// @brief Destroys a matrix of MatrixN_Create and frees its data. Views of it should not be used anymore.
+/// @param matrix The matrix to destroy.
+void MatrixN_Destroy(MatrixN *matrix);
+
+/// @brief Creates a view of a block of a matrix, without copying. Writing to the view writes to the matrix.
+/// @param matrix The matrix.
+/// @param row First row of the block.
+/// @param column First column of the block.
+/// @param rows Count of the rows of the block.
+/// @param columns Count of the columns of the block.
+/// @return The view, should not be destroyed.
+MatrixN MatrixN_CreateView(const MatrixN *matrix, size_t row, size_t column, size_t rows, size_t columns);
+
+/// @brief Gets an element of a matrix.
+/// @param matrix The matrix.
+/// @param row Row of the element.
+/// @param column Column of the element.
+/// @return The element.
+float MatrixN_Get(const MatrixN *matrix, size_t row, size_t column);
+
+/// @brief Sets an element of a matrix.
+/// @param matrix The matrix.
+/// @param row Row of the element.
+/// @param column Column of the element.
+/// @param value Value to set.
+void MatrixN_Set(MatrixN *matrix, size_t row, size_t column, float value);
+
+/// @brief Sets every element of a matrix to a value.
+/// @param matrix The matrix.
+/// @param value Value to set.
+void MatrixN_Fill(MatrixN *matrix, float value);
+
+/// @brief Sets a matrix to the identity, ones on the diagonal and zeros elsewhere. Works on matrices that are not square too.
+/// @param matrix The matrix.
+void MatrixN_SetIdentity(MatrixN *matrix);
+
+/// @brief Copies a matrix to another one of the same size.
+/// @param matrix The matrix to copy.
+/// @param result The matrix to copy to.
+void MatrixN_Copy(const MatrixN *matrix, MatrixN *result);
+
+/// @brief Adds two matrices of the same size. The result can be one of them.
+/// @param matrix1 The first matrix.
+/// @param matrix2 The second matrix.
+/// @param result The matrix to write the sum to.
+void MatrixN_Add(const MatrixN *matrix1, const MatrixN *matrix2, MatrixN *result);
+
+/// @brief Multiplies a matrix by a scalar. The result can be the matrix.
+/// @param matrix The matrix.
+/// @param scalar The scalar.
+/// @param result The matrix to write the product to.
+void MatrixN_Multiply(const MatrixN *matrix, float scalar, MatrixN *result);
+
+/// @brief Transposes a matrix.
+/// @param matrix The matrix, rows x columns.
+/// @param result The matrix to write the transpose to, columns x rows. Cannot be the matrix.
+void MatrixN_Transpose(const MatrixN *matrix, MatrixN *result);
+
+/// @brief Calculates the product of two matrices with a cache blocked, SIMD kernel.
+/// @param left The left matrix, rows x depth.
+/// @param right The right matrix, depth x columns.
+/// @param result The matrix to write the product to, rows x columns. Cannot be or overlap the left or the right matrix.
+/// @param pool Pool to run blocks of rows on in parallel. Can be NULL to run on the calling thread, as small products do anyway.
+void MatrixN_Dot(const MatrixN *left, const MatrixN *right, MatrixN *result, WorkerPool *pool);
+
+/// @brief Adds the product of two matrices to a matrix, as MatrixN_Dot without clearing the result first.
+/// @param left The left matrix, rows x depth.
+/// @param right The right matrix, depth x columns.
+/// @param result The matrix to add the product to, rows x columns. Cannot be or overlap the left or the right matrix.
+/// @param pool Pool to run blocks of rows on in parallel. Can be NULL to run on the calling thread.
+void MatrixN_DotAdd(const MatrixN *left, const MatrixN *right, MatrixN *result, WorkerPool *pool);
+
+/// @brief Decomposes a square matrix in place into lower and upper triangular matrices with partial pivoting, PA = LU.
+/// The upper matrix is written on and above the diagonal, the lower one below it with its diagonal of ones left out.
+/// @param matrix The matrix to decompose.
+/// @param pivots Array of rows count to write the pivots to, row i was swapped with row pivots[i] at step i.
+/// @return False if the matrix is singular, the matrix is partly decomposed then.
+bool MatrixN_DecomposeLU(MatrixN *matrix, size_t *pivots);
+
+/// @brief Solves AX = B in place with a decomposition of MatrixN_DecomposeLU.
+/// @param lu The decomposed matrix A.
+/// @param pivots Pivots of the decomposition.
+/// @param rightSide The matrix B, any count of columns. Overwritten with X.
+void MatrixN_SolveLU(const MatrixN *lu, const size_t *pivots, MatrixN *rightSide);
+
+/// @brief Decomposes a symmetric positive definite matrix in place into a lower triangular matrix L, A = L * L^T. Only the lower triangle of the matrix is read,
+/// the upper one is set to zero.
+/// @param matrix The matrix to decompose.
+/// @return False if the matrix is not positive definite, the matrix is partly decomposed then.
+bool MatrixN_DecomposeCholesky(MatrixN *matrix);
+
+/// @brief Solves AX = B in place with a decomposition of MatrixN_DecomposeCholesky.
+/// @param lower The decomposed matrix A.
+/// @param rightSide The matrix B, any count of columns. Overwritten with X.
+void MatrixN_SolveCholesky(const MatrixN *lower, MatrixN *rightSide);
+
+/// @brief Finds X minimizing the squared error of AX - B, through the normal equations A^T A X = A^T B solved with a Cholesky decomposition.
+/// Fits calibration models, with a row of A and B per measurement and a column of A per parameter.
+/// @param a The matrix A, at least as many rows as columns.
+/// @param b The matrix B, the same rows as A.
+/// @param result The matrix to write X to, columns of A x columns of B.
+/// @param pool Pool to run the products on. Can be NULL to run on the calling thread.
+/// @return False if the columns of A are linearly dependent, the result is not written then.
+bool MatrixN_SolveLeastSquares(const MatrixN *a, const MatrixN *b, MatrixN *result, WorkerPool *pool);
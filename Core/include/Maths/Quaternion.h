@@ -0,0 +1,192 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/Matrices.h"
+#include "Maths/Vectors.h"
+#include "Maths/VectorsBatch.h"
+
+#pragma region typedefs
+
+/// @brief A rotation in 3D as a quaternion, x, y and z are the vector part and w is the scalar part.
+/// Rotations are unit quaternions, a rotation of angle around a unit axis is (axis * sin(angle / 2), cos(angle / 2)). Can be used with helper functions.
+typedef struct Quaternion
+{
+    float x;
+    float y;
+    float z;
+    float w;
+} Quaternion;
+
+/// @brief A 3D transform, applied to a point as the scale first, then the rotation, then the translation. Can be used with helper functions.
+typedef struct Transform3D
+{
+    Vector3 position;
+    Quaternion rotation; // unit quaternion
+    Vector3 scale;
+} Transform3D;
+
+#define NewQuaternion(x, y, z, w) \
+    (Quaternion) { x, y, z, w }
+
+#pragma endregion typedefs
+
+#pragma region Quaternion
+
+/// @brief Creates the identity quaternion, no rotation.
+/// @return The identity quaternion.
+Quaternion Quaternion_Identity();
+
+/// @brief Creates a rotation around an axis, the same rotation with Matrix4_Rotate.
+/// @param axis The rotation axis, does not need to be normalized.
+/// @param angle The rotation angle in radians, counter clockwise looking from the tip of the axis.
+/// @return The rotation, identity if the axis is zero.
+Quaternion Quaternion_FromAxisAngle(Vector3 axis, float angle);
+
+/// @brief Creates a rotation from Euler angles, yaw around z first, then pitch around y, then roll around x, the aerospace convention of IMUs.
+/// @param roll Rotation around the x axis in radians.
+/// @param pitch Rotation around the y axis in radians.
+/// @param yaw Rotation around the z axis in radians.
+/// @return The rotation.
+Quaternion Quaternion_FromEuler(float roll, float pitch, float yaw);
+
+/// @brief Gets the Euler angles of a rotation, the inverse of Quaternion_FromEuler.
+/// @param quaternion The unit quaternion.
+/// @return Roll in x, pitch in y and yaw in z, in radians. Pitch is in [-PI / 2, PI / 2].
+Vector3 Quaternion_ToEuler(Quaternion quaternion);
+
+/// @brief Multiplies two quaternions, the Hamilton product. The result rotates by quaternion2 first, then by quaternion1.
+/// @param quaternion1 The first quaternion.
+/// @param quaternion2 The second quaternion.
+/// @return The product. Its magnitude is the product of the magnitudes, rounding errors accumulate over long chains.
+Quaternion Quaternion_Multiply(Quaternion quaternion1, Quaternion quaternion2);
+
+/// @brief Multiplies two rotations and normalizes the product, so chains of rotations stay unit quaternions.
+/// @param quaternion1 The first rotation.
+/// @param quaternion2 The second rotation, applied first.
+/// @return The normalized product.
+Quaternion Quaternion_MultiplyNormalized(Quaternion quaternion1, Quaternion quaternion2);
+
+/// @brief Gets the conjugate of a quaternion, the inverse rotation of a unit quaternion.
+/// @param quaternion The quaternion.
+/// @return The conjugate.
+Quaternion Quaternion_Conjugate(Quaternion quaternion);
+
+/// @brief Gets the inverse of a quaternion of any magnitude.
+/// @param quaternion The quaternion.
+/// @return The inverse, zero for a zero quaternion.
+Quaternion Quaternion_Inverse(Quaternion quaternion);
+
+/// @brief Calculates the dot product of two quaternions, the cosine of half the angle between two rotations.
+/// @param quaternion1 The first quaternion.
+/// @param quaternion2 The second quaternion.
+/// @return The dot product.
+float Quaternion_Dot(Quaternion quaternion1, Quaternion quaternion2);
+
+/// @brief Calculates the magnitude of a quaternion.
+/// @param quaternion The quaternion.
+/// @return The magnitude.
+float Quaternion_Magnitude(Quaternion quaternion);
+
+/// @brief Normalizes a quaternion to have a magnitude of 1.
+/// @param quaternion The quaternion to normalize.
+/// @return The normalized quaternion, identity for a zero quaternion.
+Quaternion Quaternion_Normalized(Quaternion quaternion);
+
+/// @brief Spherical linear interpolation between two rotations, at a constant angular speed along the shorter arc.
+/// @param startRotation The rotation at time 0.
+/// @param endRotation The rotation at time 1.
+/// @param time The interpolation factor (0.0 to 1.0).
+/// @return The interpolated rotation. Nearly equal rotations are interpolated linearly and normalized.
+Quaternion Quaternion_Slerp(Quaternion startRotation, Quaternion endRotation, float time);
+
+/// @brief Rotates a vector by a rotation, without building a matrix.
+/// @param quaternion The unit quaternion.
+/// @param vector The vector to rotate.
+/// @return The rotated vector.
+Vector3 Quaternion_RotateVector3(Quaternion quaternion, Vector3 vector);
+
+/// @brief Advances an orientation by an angular velocity of the body, e.g. a gyroscope reading, over a time step.
+/// @param orientation The unit quaternion of the orientation, kept a unit quaternion step after step.
+/// @param angularVelocity Angular velocity around the x, y and z axes of the body in radians per second.
+/// @param deltaTime The time step in seconds.
+/// @return The normalized orientation after the time step.
+Quaternion Quaternion_Integrate(Quaternion orientation, Vector3 angularVelocity, float deltaTime);
+
+/// @brief Converts a rotation to a 3x3 rotation matrix.
+/// @param quaternion The unit quaternion.
+/// @return The rotation matrix, for column vectors.
+Matrix3 Quaternion_ToMatrix3(Quaternion quaternion);
+
+/// @brief Converts a rotation to a 4x4 rotation matrix, the same matrix with Matrix4_Rotate of the identity.
+/// @param quaternion The unit quaternion.
+/// @return The rotation matrix, for column vectors.
+Matrix4 Quaternion_ToMatrix4(Quaternion quaternion);
+
+/// @brief Converts a 3x3 rotation matrix to a rotation.
+/// @param matrix Pointer to the rotation matrix, orthonormal.
+/// @return The unit quaternion, w is not negative.
+Quaternion Quaternion_FromMatrix3(const Matrix3 *matrix);
+
+/// @brief Converts the rotation of a 4x4 matrix to a rotation. The translation and the bottom row are ignored.
+/// @param matrix Pointer to the matrix, with an orthonormal top left 3x3 part.
+/// @return The unit quaternion, w is not negative.
+Quaternion Quaternion_FromMatrix4(const Matrix4 *matrix);
+
+/// @brief Multiplies the rotations of two arrays pairwise and normalizes the products, e.g. the orientations of many bodies by their updates.
+/// @param quaternions1 The first rotations.
+/// @param quaternions2 The second rotations, applied first. Same count with the first rotations.
+/// @param results Array to write the products to. Can be one of the input arrays.
+/// @param count Count of the rotations.
+void Quaternion_MultiplyArray(const Quaternion *quaternions1, const Quaternion *quaternions2, Quaternion *results, size_t count);
+
+/// @brief Composes a chain of rotations into one, normalized once at the end instead of after every product.
+/// @param rotations The rotations, the last one is applied first, same order with the matrices of a Matrix4_Dot chain.
+/// @param count Count of the rotations.
+/// @return The composed rotation, identity for no rotations.
+Quaternion Quaternion_Compose(const Quaternion *rotations, size_t count);
+
+/// @brief Rotates every point of a batch, through a single matrix and the SIMD transform kernel of the CPU.
+/// @param quaternion The unit quaternion.
+/// @param batch The batch of points to rotate.
+/// @param result The batch to write the rotated points to. Can be the input batch.
+void Quaternion_TransformBatch(Quaternion quaternion, const Vector3Batch *batch, Vector3Batch *result);
+
+#pragma endregion Quaternion
+
+#pragma region Transform3D
+
+/// @brief Creates the identity transform, no translation, no rotation and a scale of 1.
+/// @return The identity transform.
+Transform3D Transform3D_Identity();
+
+/// @brief Composes two transforms, the child transform applied first, e.g. a sensor on a moving body.
+/// @param parent Pointer to the parent transform.
+/// @param child Pointer to the child transform.
+/// @return The composed transform.
+/// @note Exact when the scale of the parent is uniform, a non uniform parent scale would shear a rotated child, which a Transform3D cannot hold.
+Transform3D Transform3D_Compose(const Transform3D *parent, const Transform3D *child);
+
+/// @brief Gets the inverse of a transform.
+/// @param transform Pointer to the transform, with no zero scale.
+/// @return The inverse transform, exact for a uniform scale.
+Transform3D Transform3D_Inverse(const Transform3D *transform);
+
+/// @brief Transforms a point.
+/// @param transform Pointer to the transform.
+/// @param point The point to transform.
+/// @return The transformed point.
+Vector3 Transform3D_TransformPoint(const Transform3D *transform, Vector3 point);
+
+/// @brief Converts a transform to a 4x4 matrix.
+/// @param transform Pointer to the transform.
+/// @return The transformation matrix, for column vectors.
+Matrix4 Transform3D_ToMatrix4(const Transform3D *transform);
+
+/// @brief Transforms every point of a batch, through a single matrix and the SIMD transform kernel of the CPU.
+/// @param transform Pointer to the transform.
+/// @param batch The batch of points to transform.
+/// @param result The batch to write the transformed points to. Can be the input batch.
+void Transform3D_TransformBatch(const Transform3D *transform, const Vector3Batch *batch, Vector3Batch *result);
+
+#pragma endregion Transform3D
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/Quaternion.h"
+#include "Maths/Vectors.h"
+
+#pragma region typedefs
+
+// Maximum sizes of a KalmanFilter, the matrices are fixed size arrays inside the filter, so a filter lives on the stack or in a static.
+// Set for the whole build with the CODE_CHARLIE_KALMAN_FILTER_MAX_STATES and CODE_CHARLIE_KALMAN_FILTER_MAX_MEASUREMENTS CMake options,
+// never for a single file: SensorFusion.c and its callers must agree on the layout of a filter. The defaults are for builds without CMake.
+#ifndef KALMAN_FILTER_MAX_STATES
+#define KALMAN_FILTER_MAX_STATES 6
+#endif
+#ifndef KALMAN_FILTER_MAX_MEASUREMENTS
+#define KALMAN_FILTER_MAX_MEASUREMENTS 3
+#endif
+
+// Every filter takes the samples in the body frame of the sensor, x forward, y left and z up.
+// Gyroscope in radians per second, accelerometer and magnetometer in any unit, only their directions are used.
+// A zero accelerometer or magnetometer sample skips its correction, e.g. for an IMU without a magnetometer.
+// Orientations rotate the body frame to the earth frame, z up and x toward the horizontal part of the magnetic field.
+
+/// @brief Complementary filter of roll, pitch and yaw. The gyroscope is trusted for changes faster than the time constant,
+/// the accelerometer and the magnetometer for slower changes. The cheapest filter, accurate away from pitch of +-90 degrees. Should be used with helper functions.
+typedef struct ComplementaryFilter
+{
+    Vector3 angles;     // roll, pitch and yaw in radians, same order with Quaternion_FromEuler
+    float timeConstant; // in seconds
+    bool isInitialized; // the first sample with an accelerometer reading sets the angles directly
+} ComplementaryFilter;
+
+/// @brief Mahony AHRS filter, a PI controller on the error between the measured and the estimated directions of gravity and the magnetic field,
+/// feeding a gyroscope corrected by it. The integral part estimates the gyroscope bias. Should be used with helper functions.
+typedef struct MahonyFilter
+{
+    Quaternion orientation;
+    Vector3 integralError;  // the gyroscope bias estimate, in radians per second
+    float proportionalGain; // e.g. 1
+    float integralGain;     // e.g. 0.01, 0 disables the bias estimate
+    bool isInitialized;
+} MahonyFilter;
+
+/// @brief Madgwick AHRS filter, a gradient descent step toward the orientation that matches the measured directions of gravity and the magnetic field every sample. Should be used with helper functions.
+typedef struct MadgwickFilter
+{
+    Quaternion orientation;
+    float beta; // step size, the gyroscope error in radians per second, e.g. 0.04
+    bool isInitialized;
+} MadgwickFilter;
+
+/// @brief Linear Kalman filter with fixed size matrices, state x, covariance P, transition F, process noise Q, observation H and measurement noise R.
+/// Only the top left stateCount and measurementCount parts of the arrays are used. Should be used with helper functions.
+typedef struct KalmanFilter
+{
+    int stateCount;
+    int measurementCount;
+    float state[KALMAN_FILTER_MAX_STATES];                                                   // x
+    float covariance[KALMAN_FILTER_MAX_STATES][KALMAN_FILTER_MAX_STATES];                    // P
+    float transition[KALMAN_FILTER_MAX_STATES][KALMAN_FILTER_MAX_STATES];                    // F
+    float processNoise[KALMAN_FILTER_MAX_STATES][KALMAN_FILTER_MAX_STATES];                  // Q
+    float observation[KALMAN_FILTER_MAX_MEASUREMENTS][KALMAN_FILTER_MAX_STATES];             // H
+    float measurementNoise[KALMAN_FILTER_MAX_MEASUREMENTS][KALMAN_FILTER_MAX_MEASUREMENTS]; // R
+} KalmanFilter;
+
+#pragma endregion typedefs
+
+#pragma region ComplementaryFilter
+
+/// @brief Creates a complementary filter on the stack.
+/// @param timeConstant Time constant in seconds, the crossover between the gyroscope and the absolute sensors, e.g. 0.5.
+/// @return The filter, not initialized.
+ComplementaryFilter ComplementaryFilter_CreateStack(float timeConstant);
+
+/// @brief Updates the filter with a sample. Does not allocate.
+/// @param filter The filter to update.
+/// @param gyroscope Angular velocity of the body in radians per second.
+/// @param accelerometer Acceleration of the body, the reaction to gravity at rest. Zero to skip the roll and pitch correction.
+/// @param magnetometer Magnetic field in the body frame. Zero to skip the yaw correction, yaw is the integrated gyroscope then.
+/// @param deltaTime Time since the previous sample in seconds.
+void ComplementaryFilter_Update(ComplementaryFilter *filter, Vector3 gyroscope, Vector3 accelerometer, Vector3 magnetometer, float deltaTime);
+
+/// @brief Gets the orientation of the filter.
+/// @param filter The filter.
+/// @return The orientation as a unit quaternion.
+Quaternion ComplementaryFilter_GetOrientation(const ComplementaryFilter *filter);
+
+#pragma endregion ComplementaryFilter
+
+#pragma region MahonyFilter
+
+/// @brief Creates a Mahony filter on the stack.
+/// @param proportionalGain Gain of the direction error, how fast the filter follows the absolute sensors.
+/// @param integralGain Gain of the integrated direction error, the gyroscope bias estimate. 0 to disable.
+/// @return The filter, not initialized.
+MahonyFilter MahonyFilter_CreateStack(float proportionalGain, float integralGain);
+
+/// @brief Updates the filter with a sample. Does not allocate.
+/// @param filter The filter to update.
+/// @param gyroscope Angular velocity of the body in radians per second.
+/// @param accelerometer Acceleration of the body. Zero to skip the corrections, the orientation is the integrated gyroscope then.
+/// @param magnetometer Magnetic field in the body frame. Zero to skip the yaw correction.
+/// @param deltaTime Time since the previous sample in seconds.
+void MahonyFilter_Update(MahonyFilter *filter, Vector3 gyroscope, Vector3 accelerometer, Vector3 magnetometer, float deltaTime);
+
+#pragma endregion MahonyFilter
+
+#pragma region MadgwickFilter
+
+/// @brief Creates a Madgwick filter on the stack.
+/// @param beta Step size of the gradient descent, larger follows the absolute sensors faster but lets more of their noise through.
+/// @return The filter, not initialized.
+MadgwickFilter MadgwickFilter_CreateStack(float beta);
+
+/// @brief Updates the filter with a sample. Does not allocate.
+/// @param filter The filter to update.
+/// @param gyroscope Angular velocity of the body in radians per second.
+/// @param accelerometer Acceleration of the body. Zero to skip the gradient step, the orientation is the integrated gyroscope then.
+/// @param magnetometer Magnetic field in the body frame. Zero for the gravity only step, yaw is the integrated gyroscope then.
+/// @param deltaTime Time since the previous sample in seconds.
+void MadgwickFilter_Update(MadgwickFilter *filter, Vector3 gyroscope, Vector3 accelerometer, Vector3 magnetometer, float deltaTime);
+
+#pragma endregion MadgwickFilter
+
+#pragma region KalmanFilter
+
+/// @brief Creates a Kalman filter on the stack. State is zero, P and F are identity, Q is zero, H observes the first measurementCount states and R is identity.
+/// Set the matrices of the model on the returned filter before the first update.
+/// @param stateCount Count of the states, up to KALMAN_FILTER_MAX_STATES.
+/// @param measurementCount Count of the measurements of an update, up to KALMAN_FILTER_MAX_MEASUREMENTS.
+/// @return The filter.
+KalmanFilter KalmanFilter_CreateStack(int stateCount, int measurementCount);
+
+/// @brief Predicts the state one step forward, x = F x and P = F P F' + Q. Does not allocate.
+/// @param filter The filter.
+void KalmanFilter_Predict(KalmanFilter *filter);
+
+/// @brief Corrects the state with a measurement, z = H x + noise. Does not allocate.
+/// @param filter The filter.
+/// @param measurement The measurement, measurementCount values.
+/// @return False if the innovation covariance H P H' + R is singular, the filter is not changed then.
+bool KalmanFilter_Update(KalmanFilter *filter, const float *measurement);
+
+#pragma endregion KalmanFilter
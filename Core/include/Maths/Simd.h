@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/Trigonometry.h"
+
+#include <stdint.h>
+
+#pragma region typedefs
+
+/// @brief Instruction sets the batch maths kernels are written for. Ordered from the slowest to the fastest on the same architecture.
+typedef enum SimdLevel
+{
+    SimdLevel_Scalar = 0, // Plain C, every architecture.
+    SimdLevel_SSE2,       // 4 floats per instruction, every x86-64 CPU.
+    SimdLevel_AVX2,       // 8 floats per instruction with fused multiply-add, x86-64 CPUs since 2013.
+    SimdLevel_NEON        // 4 floats per instruction, every AArch64 CPU.
+} SimdLevel;
+
+/// @brief Kernels of a single instruction set over float arrays. Vectors of any dimension are processed one component array at a time.
+/// @note Every kernel allows the result to be the same array as an input.
+typedef struct SimdKernels
+{
+    void (*add)(const float *array1, const float *array2, float *result, size_t count);
+    void (*multiply)(const float *array, float scalar, float *result, size_t count);
+    void (*lerp)(const float *startArray, const float *endArray, float time, float *result, size_t count);
+    // Dimension of dot and normalize is 1 to 4.
+    void (*dot)(const float *const *components1, const float *const *components2, int dimension, float *result, size_t count);
+    void (*normalize)(const float *const *components, float *const *results, int dimension, size_t count);
+    // Matrices are 16 row major floats aligned to 16 bytes, the storage of Matrix4. Unlike the other kernels, the result matrix can not be an input matrix.
+    void (*matrix4Dot)(const float *matrix1, const float *matrix2, float *result);
+    bool (*matrix4Inverse)(const float *matrix, float *result); // false for a singular matrix, the result is not written
+    // Dimension of transform is 3, points with a w of 1 and the bottom row ignored, or 4.
+    void (*transform)(const float *matrix, const float *const *components, int dimension, float *const *results, size_t count);
+    // Sines or cosines can be NULL. TrigAccuracy_Exact is calculated with the C library on every instruction set.
+    void (*sinCos)(const float *radians, float *sines, float *cosines, TrigAccuracy accuracy, size_t count);
+    void (*arcTan2)(const float *ys, const float *xs, float *results, TrigAccuracy accuracy, size_t count);
+    // Complex numbers are separate real and imaginary arrays.
+    void (*complexMultiply)(const float *real1, const float *imaginary1, const float *real2, const float *imaginary2, float *realResult, float *imaginaryResult, size_t count);
+    // A radix 4 stage of FFT_Forward in place, over blocks of 4 * quarter complex numbers with the twiddles of the stage in FFTPlan.
+    void (*fftRadix4)(float *real, float *imaginary, size_t size, size_t quarter, const float *twiddles);
+    // Adds the product of a rows x depth row major left matrix and a depth x columns right matrix packed by MatrixN into panels of SIMD_GEMM_PANEL columns to a row major result.
+    void (*matrixDotAdd)(const float *left, size_t leftStride, const float *packedRight, float *result, size_t resultStride, size_t rows, size_t columns, size_t depth);
+    // Dot product of quantized weights and values in groups of groupSize with a scale per group, groupSize a multiple of 32 and count a multiple of groupSize.
+    // Values are int8 in [-127, 127]. Weights are int8, or for quantized4Dot two 4 bit values offset by 8 per byte, the low halves of the bytes of a group
+    // being its first half and the high halves its second half.
+    float (*quantizedDot)(const int8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count);
+    float (*quantized4Dot)(const uint8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count);
+} SimdKernels;
+
+// Alignment of the batch arrays, an AVX2 register
+#define SIMD_ALIGNMENT 32
+
+// Columns of a panel of the packed right matrix of matrixDotAdd. A panel is depth rows of SIMD_GEMM_PANEL floats one after the other,
+// the panels follow each other and the columns past the right matrix in the last panel are zero.
+#define SIMD_GEMM_PANEL 16
+
+// Marks a function as compiled for AVX2 and FMA without compiling the whole project for them. It is only called after the CPU is checked.
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define SIMD_TARGET_AVX2
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SIMD_ARCHITECTURE_X86 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SIMD_ARCHITECTURE_ARM 1
+#endif
+
+#pragma endregion typedefs
+
+/// @brief Gets the instruction set the batch kernels use. Detected on the first call as the fastest one the CPU supports.
+/// @return The used instruction set.
+SimdLevel Simd_GetLevel();
+
+/// @brief Forces the batch kernels to an instruction set, for benchmarks and for comparing against the scalar results.
+/// @param level Instruction set to use. Clamped to the fastest one the CPU supports.
+/// @return The instruction set now in use.
+SimdLevel Simd_SetLevel(SimdLevel level);
+
+/// @brief Gets the name of an instruction set.
+/// @param level Instruction set.
+/// @return Name of the instruction set, e.g. "AVX2".
+const char *Simd_GetLevelName(SimdLevel level);
+
+/// @brief Gets the kernels of the used instruction set.
+/// @return Kernels of Simd_GetLevel.
+const SimdKernels *Simd_GetKernels();
+
+/// @brief Allocates a float array aligned to SIMD_ALIGNMENT.
+/// @param count Count of the floats.
+/// @return The allocated array. Should be freed with Simd_Free.
+float *Simd_AllocateFloats(size_t count);
+
+/// @brief Frees an array of Simd_AllocateFloats.
+/// @param array Array to free.
+void Simd_Free(float *array);
+
+#pragma region Kernels
+
+// Kernel tables of every instruction set, NULL where the architecture does not have the instruction set.
+// Used by Simd_GetKernels, apps should use the batch functions instead.
+
+const SimdKernels *SimdKernels_GetScalar();
+const SimdKernels *SimdKernels_GetSSE2();
+const SimdKernels *SimdKernels_GetAVX2();
+const SimdKernels *SimdKernels_GetNEON();
+
+#pragma endregion Kernels
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/Geometry.h"
+#include "Maths/Vectors.h"
+#include "Maths/VectorsBatch.h"
+
+#include <stdint.h>
+
+#pragma region typedefs
+
+// Children per node of a SpatialBVH, the bounds of the children are stored as a structure of arrays, so a node is tested against a query in one pass of 4 lanes
+#define SPATIAL_BVH_WIDTH 4
+
+/// @brief Uniform grid over a static set of points, bulk loaded once. The points are sorted by cell into a batch, so a cell is a contiguous run of the batch.
+/// Best for points spread evenly and for queries of a radius close to the cell size. Should be used with helper functions.
+typedef struct SpatialGrid
+{
+    Vector3Batch *points; // the points sorted by cell
+    size_t *indices;      // index of each sorted point in the batch the grid was created from
+    size_t *cellStarts;   // first sorted point of each cell, cellCount + 1 entries, so a cell is [cellStarts[cell], cellStarts[cell + 1])
+    size_t cellCount;
+    Vector3Int dimensions; // cells along x, y and z
+    Vector3 origin;        // the min corner of the grid
+    float cellSize;
+    float inverseCellSize;
+} SpatialGrid;
+
+/// @brief Node of a SpatialBVH, the bounds of up to SPATIAL_BVH_WIDTH children one array per component.
+typedef struct SpatialBVHNode
+{
+    float minX[SPATIAL_BVH_WIDTH];
+    float minY[SPATIAL_BVH_WIDTH];
+    float minZ[SPATIAL_BVH_WIDTH];
+    float maxX[SPATIAL_BVH_WIDTH];
+    float maxY[SPATIAL_BVH_WIDTH];
+    float maxZ[SPATIAL_BVH_WIDTH];
+    uint32_t children[SPATIAL_BVH_WIDTH]; // node index of an inner child, first sorted point of a leaf child
+    uint32_t counts[SPATIAL_BVH_WIDTH];   // points of a leaf child, 0 for an inner child and for an unused lane, whose bounds are empty
+} SpatialBVHNode;
+
+/// @brief Bounding volume hierarchy over a static set of points, bulk loaded once by median splits, with 4 children per node.
+/// Adapts to clustered points, where a grid has many empty and some crowded cells. Should be used with helper functions.
+typedef struct SpatialBVH
+{
+    Vector3Batch *points; // the points sorted by leaf, so a leaf is a contiguous run of the batch
+    size_t *indices;      // index of each sorted point in the batch the hierarchy was created from
+    SpatialBVHNode *nodes;
+    size_t nodeCount; // nodes[0] is the root
+    AABB bounds;      // bounds of all points
+} SpatialBVH;
+
+#pragma endregion typedefs
+
+#pragma region SpatialGrid
+
+/// @brief Creates a grid over points.
+/// @param points The points, copied into the grid.
+/// @param cellSize Size of the cells. 0 picks a size for about 2 points per cell. Raised if the grid would have many more cells than points.
+/// @return Pointer to the created grid.
+SpatialGrid *SpatialGrid_Create(const Vector3Batch *points, float cellSize);
+
+/// @brief Destroys a grid and frees its resources.
+/// @param grid The grid to destroy.
+void SpatialGrid_Destroy(SpatialGrid *grid);
+
+/// @brief Finds the nearest point to a position.
+/// @param grid The grid.
+/// @param position The position, can be outside the grid.
+/// @param squaredDistance Pointer to write the squared distance to the nearest point to. Can be NULL.
+/// @return Index of the nearest point in the batch of SpatialGrid_Create, SIZE_MAX for a grid of no points.
+size_t SpatialGrid_Nearest(const SpatialGrid *grid, Vector3 position, float *squaredDistance);
+
+/// @brief Finds the points within a radius of a position.
+/// @param grid The grid.
+/// @param position Center of the query.
+/// @param radius Radius of the query, points at the radius are included.
+/// @param results Array to write the indices of the found points to, in the batch of SpatialGrid_Create. Can be NULL to only count.
+/// @param capacity Capacity of the results array, further points are counted but not written.
+/// @return Count of the points found.
+size_t SpatialGrid_QueryRadius(const SpatialGrid *grid, Vector3 position, float radius, size_t *results, size_t capacity);
+
+/// @brief Finds the points inside a box.
+/// @param grid The grid.
+/// @param box The box of the query, points on the faces are included.
+/// @param results Array to write the indices of the found points to, in the batch of SpatialGrid_Create. Can be NULL to only count.
+/// @param capacity Capacity of the results array, further points are counted but not written.
+/// @return Count of the points found.
+size_t SpatialGrid_QueryBox(const SpatialGrid *grid, AABB box, size_t *results, size_t capacity);
+
+#pragma endregion SpatialGrid
+
+#pragma region SpatialBVH
+
+/// @brief Creates a bounding volume hierarchy over points.
+/// @param points The points, copied into the hierarchy.
+/// @return Pointer to the created hierarchy.
+SpatialBVH *SpatialBVH_Create(const Vector3Batch *points);
+
+/// @brief Destroys a bounding volume hierarchy and frees its resources.
+/// @param bvh The hierarchy to destroy.
+void SpatialBVH_Destroy(SpatialBVH *bvh);
+
+/// @brief Finds the nearest point to a position, visiting the closer children first and skipping the ones farther than the best point so far.
+/// @param bvh The hierarchy.
+/// @param position The position.
+/// @param squaredDistance Pointer to write the squared distance to the nearest point to. Can be NULL.
+/// @return Index of the nearest point in the batch of SpatialBVH_Create, SIZE_MAX for a hierarchy of no points.
+size_t SpatialBVH_Nearest(const SpatialBVH *bvh, Vector3 position, float *squaredDistance);
+
+/// @brief Finds the points within a radius of a position.
+/// @param bvh The hierarchy.
+/// @param position Center of the query.
+/// @param radius Radius of the query, points at the radius are included.
+/// @param results Array to write the indices of the found points to, in the batch of SpatialBVH_Create. Can be NULL to only count.
+/// @param capacity Capacity of the results array, further points are counted but not written.
+/// @return Count of the points found.
+size_t SpatialBVH_QueryRadius(const SpatialBVH *bvh, Vector3 position, float radius, size_t *results, size_t capacity);
+
+/// @brief Finds the points inside a box.
+/// @param bvh The hierarchy.
+/// @param box The box of the query, points on the faces are included.
+/// @param results Array to write the indices of the found points to, in the batch of SpatialBVH_Create. Can be NULL to only count.
+/// @param capacity Capacity of the results array, further points are counted but not written.
+/// @return Count of the points found.
+size_t SpatialBVH_QueryBox(const SpatialBVH *bvh, AABB box, size_t *results, size_t capacity);
+
+#pragma endregion SpatialBVH
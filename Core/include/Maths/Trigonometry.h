@@ -2,6 +2,35 @@
 
 #include "Core.h"
 
+#pragma region typedefs
+
+// Accuracy of the approximated trigonometry functions, for finite angles below 8192 radians. Errors are the maximum absolute errors.
+typedef enum TrigAccuracy
+{
+    TrigAccuracy_Exact = 0, // C library functions, one angle at a time.
+    TrigAccuracy_Precise,   // Minimax polynomials, about 3e-7, a few units in the last place of a float.
+    TrigAccuracy_Fast       // Shorter minimax polynomials, about 2e-5 for sine and cosine, 1e-4 for arc tangent.
+} TrigAccuracy;
+
+// Minimax polynomial coefficients of an accuracy tier, the lowest degree first. Shared by the scalar and the SIMD kernels.
+typedef struct TrigPolynomials
+{
+    float sine[3];       // sin(r) = r + r * z * P(z), z = r * r, |r| <= PI / 4
+    int sineCount;
+    float cosine[3];     // cos(r) = 1 + z * P(z)
+    int cosineCount;
+    float arcTangent[8]; // atan(a) = a * P(a * a), 0 <= a <= 1
+    int arcTangentCount;
+} TrigPolynomials;
+
+// PI / 2 in three parts, the first two with trailing zero bits, so quadrant * part is exact while reducing the angle
+#define TRIG_HALF_PI_1 1.5703125f
+#define TRIG_HALF_PI_2 4.837512969970703125e-4f
+#define TRIG_HALF_PI_3 7.54978995489188216e-8f
+#define TRIG_TWO_OVER_PI 0.636619772367581343f
+
+#pragma endregion typedefs
+
 // Converts the radian value to degree
 float Rad2Deg(float radian);
 
@@ -61,3 +90,27 @@ float CscRad(float radian);
 
 // Returns the cosecant of the degree value
 float CscDeg(float degree);
+
+// Gets the polynomials of an accuracy tier, NULL for TrigAccuracy_Exact
+const TrigPolynomials *Trig_GetPolynomials(TrigAccuracy accuracy);
+
+// Returns the sine of the radian value with the given accuracy
+float SinRadFast(float radian, TrigAccuracy accuracy);
+
+// Returns the cosine of the radian value with the given accuracy
+float CosRadFast(float radian, TrigAccuracy accuracy);
+
+// Calculates the sine and the cosine of the radian value together, sharing the range reduction
+void SinCosRad(float radian, TrigAccuracy accuracy, float *sine, float *cosine);
+
+// Calculates the sine and the cosine of the degree value together, sharing the range reduction
+void SinCosDeg(float degree, TrigAccuracy accuracy, float *sine, float *cosine);
+
+// Returns the angle that points to the given x and y coordinates in radians with the given accuracy, same arguments with atan2f
+float ArcTan2RadFast(float y, float x, TrigAccuracy accuracy);
+
+// Calculates the sines and the cosines of an array of radian values with the SIMD kernels of the CPU. Sines or cosines can be NULL when not needed.
+void SinCosRadArray(const float *radians, float *sines, float *cosines, size_t count, TrigAccuracy accuracy);
+
+// Calculates the angles of arrays of y and x coordinates in radians with the SIMD kernels of the CPU. Results can be one of the input arrays.
+void ArcTan2RadArray(const float *ys, const float *xs, float *results, size_t count, TrigAccuracy accuracy);
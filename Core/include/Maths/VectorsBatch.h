@@ -0,0 +1,215 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Maths/Matrices.h"
+#include "Maths/Vectors.h"
+#include "Maths/Simd.h"
+
+#pragma region typedefs
+
+/// @brief 2D vectors stored as a structure of arrays, one aligned array per component. Processed with the SIMD kernels of the CPU. Should be used with helper functions.
+typedef struct Vector2Batch
+{
+    float *x;
+    float *y;
+    size_t count;
+} Vector2Batch;
+
+/// @brief 3D vectors stored as a structure of arrays, one aligned array per component. Processed with the SIMD kernels of the CPU. Should be used with helper functions.
+typedef struct Vector3Batch
+{
+    float *x;
+    float *y;
+    float *z;
+    size_t count;
+} Vector3Batch;
+
+/// @brief 4D vectors stored as a structure of arrays, one aligned array per component. Processed with the SIMD kernels of the CPU. Should be used with helper functions.
+typedef struct Vector4Batch
+{
+    float *x;
+    float *y;
+    float *z;
+    float *w;
+    size_t count;
+} Vector4Batch;
+
+#pragma endregion typedefs
+
+#pragma region Vector2Batch
+
+/// @brief Creates a batch of 2D vectors, all zero. Components are allocated in a single block, each aligned to SIMD_ALIGNMENT.
+/// @param count Count of the vectors.
+/// @return Pointer to the created batch.
+Vector2Batch *Vector2Batch_Create(size_t count);
+
+/// @brief Destroys a batch of 2D vectors and frees its components.
+/// @param batch The batch to destroy.
+void Vector2Batch_Destroy(Vector2Batch *batch);
+
+/// @brief Sets a vector of a batch.
+/// @param batch The batch.
+/// @param index Index of the vector.
+/// @param vector The vector to set.
+void Vector2Batch_Set(Vector2Batch *batch, size_t index, Vector2 vector);
+
+/// @brief Gets a vector of a batch.
+/// @param batch The batch.
+/// @param index Index of the vector.
+/// @return The vector at the index.
+Vector2 Vector2Batch_Get(const Vector2Batch *batch, size_t index);
+
+/// @brief Adds the vectors of two batches pairwise, Vector2_Add over the batch.
+/// @param batch1 The first batch.
+/// @param batch2 The second batch, same count with the first batch.
+/// @param result The batch to write the sums to. Can be one of the input batches.
+void Vector2Batch_Add(const Vector2Batch *batch1, const Vector2Batch *batch2, Vector2Batch *result);
+
+/// @brief Multiplies every vector of a batch by a scalar, Vector2_Multiply over the batch.
+/// @param batch The batch to multiply.
+/// @param scalar The scalar value.
+/// @param result The batch to write the products to. Can be the input batch.
+void Vector2Batch_Multiply(const Vector2Batch *batch, float scalar, Vector2Batch *result);
+
+/// @brief Calculates the dot products of the vectors of two batches pairwise, Vector2_Dot over the batch.
+/// @param batch1 The first batch.
+/// @param batch2 The second batch, same count with the first batch.
+/// @param results Array to write the dot products to, a float per vector.
+void Vector2Batch_Dot(const Vector2Batch *batch1, const Vector2Batch *batch2, float *results);
+
+/// @brief Normalizes every vector of a batch to have a magnitude of 1, Vector2_Normalized over the batch. Zero vectors stay zero.
+/// @param batch The batch to normalize.
+/// @param result The batch to write the normalized vectors to. Can be the input batch.
+void Vector2Batch_Normalize(const Vector2Batch *batch, Vector2Batch *result);
+
+/// @brief Linearly interpolates the vectors of two batches pairwise, Vector2_Lerp over the batch.
+/// @param startBatch The batch at time 0.
+/// @param endBatch The batch at time 1, same count with the start batch.
+/// @param time Interpolation time, same for every vector.
+/// @param result The batch to write the interpolated vectors to. Can be one of the input batches.
+void Vector2Batch_Lerp(const Vector2Batch *startBatch, const Vector2Batch *endBatch, float time, Vector2Batch *result);
+
+#pragma endregion Vector2Batch
+
+#pragma region Vector3Batch
+
+/// @brief Creates a batch of 3D vectors, all zero. Components are allocated in a single block, each aligned to SIMD_ALIGNMENT.
+/// @param count Count of the vectors.
+/// @return Pointer to the created batch.
+Vector3Batch *Vector3Batch_Create(size_t count);
+
+/// @brief Destroys a batch of 3D vectors and frees its components.
+/// @param batch The batch to destroy.
+void Vector3Batch_Destroy(Vector3Batch *batch);
+
+/// @brief Sets a vector of a batch.
+/// @param batch The batch.
+/// @param index Index of the vector.
+/// @param vector The vector to set.
+void Vector3Batch_Set(Vector3Batch *batch, size_t index, Vector3 vector);
+
+/// @brief Gets a vector of a batch.
+/// @param batch The batch.
+/// @param index Index of the vector.
+/// @return The vector at the index.
+Vector3 Vector3Batch_Get(const Vector3Batch *batch, size_t index);
+
+/// @brief Adds the vectors of two batches pairwise, Vector3_Add over the batch.
+/// @param batch1 The first batch.
+/// @param batch2 The second batch, same count with the first batch.
+/// @param result The batch to write the sums to. Can be one of the input batches.
+void Vector3Batch_Add(const Vector3Batch *batch1, const Vector3Batch *batch2, Vector3Batch *result);
+
+/// @brief Multiplies every vector of a batch by a scalar, Vector3_Multiply over the batch.
+/// @param batch The batch to multiply.
+/// @param scalar The scalar value.
+/// @param result The batch to write the products to. Can be the input batch.
+void Vector3Batch_Multiply(const Vector3Batch *batch, float scalar, Vector3Batch *result);
+
+/// @brief Calculates the dot products of the vectors of two batches pairwise, Vector3_Dot over the batch.
+/// @param batch1 The first batch.
+/// @param batch2 The second batch, same count with the first batch.
+/// @param results Array to write the dot products to, a float per vector.
+void Vector3Batch_Dot(const Vector3Batch *batch1, const Vector3Batch *batch2, float *results);
+
+/// @brief Normalizes every vector of a batch to have a magnitude of 1, Vector3_Normalized over the batch. Zero vectors stay zero.
+/// @param batch The batch to normalize.
+/// @param result The batch to write the normalized vectors to. Can be the input batch.
+void Vector3Batch_Normalize(const Vector3Batch *batch, Vector3Batch *result);
+
+/// @brief Linearly interpolates the vectors of two batches pairwise, Vector3_Lerp over the batch.
+/// @param startBatch The batch at time 0.
+/// @param endBatch The batch at time 1, same count with the start batch.
+/// @param time Interpolation time, same for every vector.
+/// @param result The batch to write the interpolated vectors to. Can be one of the input batches.
+void Vector3Batch_Lerp(const Vector3Batch *startBatch, const Vector3Batch *endBatch, float time, Vector3Batch *result);
+
+/// @brief Transforms every point of a batch by a matrix, as a Vector4 with a w of 1. The bottom row of the matrix is ignored, the matrix should be affine.
+/// @param batch The batch of points to transform.
+/// @param matrix The transformation matrix, e.g. of Matrix4_Rotate and Matrix4_Translate.
+/// @param result The batch to write the transformed points to. Can be the input batch.
+void Vector3Batch_Transform(const Vector3Batch *batch, const Matrix4 *matrix, Vector3Batch *result);
+
+#pragma endregion Vector3Batch
+
+#pragma region Vector4Batch
+
+/// @brief Creates a batch of 4D vectors, all zero. Components are allocated in a single block, each aligned to SIMD_ALIGNMENT.
+/// @param count Count of the vectors.
+/// @return Pointer to the created batch.
+Vector4Batch *Vector4Batch_Create(size_t count);
+
+/// @brief Destroys a batch of 4D vectors and frees its components.
+/// @param batch The batch to destroy.
+void Vector4Batch_Destroy(Vector4Batch *batch);
+
+/// @brief Sets a vector of a batch.
+/// @param batch The batch.
+/// @param index Index of the vector.
+/// @param vector The vector to set.
+void Vector4Batch_Set(Vector4Batch *batch, size_t index, Vector4 vector);
+
+/// @brief Gets a vector of a batch.
+/// @param batch The batch.
+/// @param index Index of the vector.
+/// @return The vector at the index.
+Vector4 Vector4Batch_Get(const Vector4Batch *batch, size_t index);
+
+/// @brief Adds the vectors of two batches pairwise, Vector4_Add over the batch.
+/// @param batch1 The first batch.
+/// @param batch2 The second batch, same count with the first batch.
+/// @param result The batch to write the sums to. Can be one of the input batches.
+void Vector4Batch_Add(const Vector4Batch *batch1, const Vector4Batch *batch2, Vector4Batch *result);
+
+/// @brief Multiplies every vector of a batch by a scalar, Vector4_Multiply over the batch.
+/// @param batch The batch to multiply.
+/// @param scalar The scalar value.
+/// @param result The batch to write the products to. Can be the input batch.
+void Vector4Batch_Multiply(const Vector4Batch *batch, float scalar, Vector4Batch *result);
+
+/// @brief Calculates the dot products of the vectors of two batches pairwise, Vector4_Dot over the batch.
+/// @param batch1 The first batch.
+/// @param batch2 The second batch, same count with the first batch.
+/// @param results Array to write the dot products to, a float per vector.
+void Vector4Batch_Dot(const Vector4Batch *batch1, const Vector4Batch *batch2, float *results);
+
+/// @brief Normalizes every vector of a batch to have a magnitude of 1, Vector4_Normalized over the batch. Zero vectors stay zero.
+/// @param batch The batch to normalize.
+/// @param result The batch to write the normalized vectors to. Can be the input batch.
+void Vector4Batch_Normalize(const Vector4Batch *batch, Vector4Batch *result);
+
+/// @brief Linearly interpolates the vectors of two batches pairwise, Vector4_Lerp over the batch.
+/// @param startBatch The batch at time 0.
+/// @param endBatch The batch at time 1, same count with the start batch.
+/// @param time Interpolation time, same for every vector.
+/// @param result The batch to write the interpolated vectors to. Can be one of the input batches.
+void Vector4Batch_Lerp(const Vector4Batch *startBatch, const Vector4Batch *endBatch, float time, Vector4Batch *result);
+
+/// @brief Transforms every vector of a batch by a matrix.
+/// @param batch The batch to transform.
+/// @param matrix The transformation matrix.
+/// @param result The batch to write the transformed vectors to. Can be the input batch.
+void Vector4Batch_Transform(const Vector4Batch *batch, const Matrix4 *matrix, Vector4Batch *result);
+
+#pragma endregion Vector4Batch
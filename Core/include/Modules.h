@@ -5,4 +5,7 @@
 #include "Modules/GPIOManager.h"
 #include "Modules/InputManager.h"
 #include "Modules/RenderManager.h"
+#include "Modules/RenderBackend.h"
 #include "Modules/NetworkManager.h"
+#include "Modules/SPIManager.h"
+#include "Modules/I2CManager.h"
@@ -3,7 +3,6 @@
 #include "Core.h"
 
 // todo add support to different pin settings for input, output and active levels. for now, only digital output and output.
-// todo add event support for input pins (rising, falling, both edges).
 
 #pragma region typedefs
 
@@ -45,6 +44,7 @@ typedef enum GPIOInputEventType
 typedef enum GPIOOutputType
 {
     GPIOOutputType_Kolpa = -1,                // An invalid or error state (-1).
+    GPIOOutputType_PushPull = 0,              // Pin actively writes both LOW and HIGH. The default of a line, no flags are requested.
     GPIOOutputType_OpenDrain = (1UL << (0)),  // Pin can actively write LOW, but when it is HIGH, it goes into a high-impedance state. Requires an external pull-up resistor to achieve a physical HIGH. Allows multiple outputs to be connected to the same line.
     GPIOOutputType_OpenSource = (1UL << (1)), // Pin can actively write HIGH, but when it is LOW, it goes into a high-impedance state. Requires an external pull-up resistor to achieve a physical LOW. Allows multiple outputs to be connected to the same line.
     GPIOOutputType_ActiveLow = (1UL << (2))   // Logical 1 writes LOW (inactive) and logical 0 writes HIGH (inactive) to the pin.
@@ -56,6 +56,76 @@ typedef struct GPIOChip GPIOChip;
 /// @brief Represents a GPIO pin.
 typedef struct GPIOPin GPIOPin;
 
+/// @brief Represents GPIO pins of a chip requested together. Read and written in a single call, so all pins change at the same instant.
+typedef struct GPIOPinGroup GPIOPinGroup;
+
+/// @brief Maximum count of pins in a group. Same with the line limit of a libgpiod bulk request.
+#define GPIO_PIN_GROUP_MAX_PINS 64
+
+/// @brief An edge of an input pin, captured by a GPIOEventReader.
+typedef struct GPIOEdgeEvent
+{
+    size_t pinIndex;              // Index of the pin in the pins passed to the reader.
+    GPIOInputEventType type;      // Rising or falling edge.
+    unsigned long long timestamp; // Kernel timestamp of the edge in nanoseconds. Taken in the interrupt, not when read.
+} GPIOEdgeEvent;
+
+/// @brief Reads edge events of input pins on a background thread into a ring buffer. Drained by the app every frame.
+typedef struct GPIOEventReader GPIOEventReader;
+
+/// @brief Maximum count of pins a GPIOEventReader can watch.
+#define GPIO_EVENT_READER_MAX_PINS 64
+
+/// @brief Count of events read from a line with a single read call. Same with the limit of libgpiod.
+#define GPIO_EVENT_READER_BATCH_SIZE 16
+
+/// @brief A pulse train on an output pin, generated by the PWM scheduler thread.
+typedef struct GPIOPwm GPIOPwm;
+
+/// @brief Timing statistics of the PWM scheduler thread. Lateness is how much later than its deadline an edge was written.
+typedef struct GPIOPwmStats
+{
+    unsigned long long edgeCount;               // Count of written edges.
+    unsigned long long wakeCount;               // Count of wake ups, edges of different channels at the same instant share a wake up.
+    unsigned long long meanLatenessNanoseconds; // Mean lateness of the wake ups.
+    unsigned long long maxLatenessNanoseconds;  // Worst lateness of the wake ups.
+    unsigned long long missedPeriodCount;       // Periods skipped since the thread woke up after them.
+} GPIOPwmStats;
+
+// Maximum count of PWM channels running together
+#define GPIO_PWM_MAX_CHANNELS 32
+
+// Edges due within this many nanoseconds of a wake up are written in the same wake up
+#define GPIO_PWM_COALESCE_NANOSECONDS 20000ULL
+
+// Standard hobby servo timing, 50 Hz with 1 ms to 2 ms pulses
+#define GPIO_PWM_SERVO_PERIOD_NANOSECONDS 20000000ULL
+#define GPIO_PWM_SERVO_MIN_PULSE_NANOSECONDS 1000000ULL
+#define GPIO_PWM_SERVO_MAX_PULSE_NANOSECONDS 2000000ULL
+
+/// @brief A step of an output waveform. The mask is written to the pin group, then the next step is written after the delay.
+typedef struct GPIOWaveformStep
+{
+    unsigned long long valueMask;        // Values of the pins. Bit i is the value of the pin i of the group.
+    unsigned long long delayNanoseconds; // Time from this step to the next one. The delay of the last step is waited before the playback ends.
+} GPIOWaveformStep;
+
+/// @brief Plays waveforms on an output pin group from its own thread with busy-wait timing.
+typedef struct GPIOWaveformPlayer GPIOWaveformPlayer;
+
+/// @brief Achieved timing of the last played waveform. Error is how much later than its scheduled time a step was written.
+typedef struct GPIOWaveformStats
+{
+    unsigned long long stepCount;            // Count of the written steps.
+    unsigned long long meanErrorNanoseconds; // Mean error of the steps.
+    unsigned long long maxErrorNanoseconds;  // Worst error of the steps.
+    unsigned long long durationNanoseconds;  // Time from the first write to the end of the last delay.
+    unsigned long long failedWriteCount;     // Steps the kernel did not accept.
+} GPIOWaveformStats;
+
+// Delays longer than this sleep until this close to the deadline and busy-wait the rest, so long gaps do not burn the core
+#define GPIO_WAVEFORM_SPIN_NANOSECONDS 200000ULL
+
 #pragma endregion typedefs
 
 #if PLATFORM_LINUX
@@ -79,7 +149,7 @@ void GPIOChip_Destroy(GPIOChip *chip);
 /// @param index The index of the GPIO pin to consume.
 /// @param consumer The name of the consumer (e.g., "MyLED").
 /// @param biasType The input bias type for the pin.
-/// @param eventType The input event type for the pin.
+/// @param eventType The input event type for the pin. Kolpa requests the pin without events. Events are read with a GPIOEventReader.
 /// @return A pointer to the created GPIOPin instance, or NULL if consumption fails.
 /// @note Logs an error if the GPIO line cannot be retrieved or if the line request fails.
 GPIOPin *GPIOPin_ConsumeAsInput(const GPIOChip *chip, unsigned char index, const string consumer, GPIOInputBiasType biasType, GPIOInputEventType eventType);
@@ -112,4 +182,165 @@ int GPIOPin_WriteValue(const GPIOPin *pin, GPIODigitalValue value);
 /// @note Logs a warning if the read operation fails.
 GPIODigitalValue GPIOPin_ReadValue(const GPIOPin *pin);
 
+/// @brief Creates an event reader and starts its thread. The thread waits for edges of all pins and pushes them to the ring buffer.
+/// @param pins Input pins to watch. Should be consumed with an event type. Should not be released before the reader is destroyed.
+/// @param pinCount Count of the pins, at most GPIO_EVENT_READER_MAX_PINS.
+/// @param capacity How many events can wait to be read. Rounded up to a power of 2. Newer events are dropped and counted when full.
+/// @return A pointer to the created GPIOEventReader instance, or NULL if the thread cannot be started.
+GPIOEventReader *GPIOEventReader_Create(GPIOPin *const *pins, size_t pinCount, size_t capacity);
+
+/// @brief Stops the thread of an event reader and frees its resources. Waiting events are dropped.
+/// @param reader The GPIOEventReader instance to destroy.
+void GPIOEventReader_Destroy(GPIOEventReader *reader);
+
+/// @brief Reads the waiting events, oldest first. Should be called from a single thread, usually every frame.
+/// @param reader The GPIOEventReader instance to read from.
+/// @param events Buffer to copy the events into.
+/// @param maxCount Maximum count of events to read.
+/// @return Count of the read events.
+size_t GPIOEventReader_Read(GPIOEventReader *reader, GPIOEdgeEvent *events, size_t maxCount);
+
+/// @brief Gets the count of all events captured by the reader, including the dropped ones.
+/// @param reader The GPIOEventReader instance.
+/// @return Count of the captured events.
+unsigned long long GPIOEventReader_GetEventCount(const GPIOEventReader *reader);
+
+/// @brief Gets the count of events dropped because the ring buffer was full. Should stay 0, otherwise the buffer should be larger or read more often.
+/// @param reader The GPIOEventReader instance.
+/// @return Count of the dropped events.
+unsigned long long GPIOEventReader_GetOverflowCount(const GPIOEventReader *reader);
+
+/// @brief Consumes GPIO pins of a GPIO chip with a single input request.
+/// @param chip The GPIOChip instance to consume the pins from.
+/// @param indices Indices of the GPIO pins to consume. Order of the indices is the order of the values.
+/// @param count Count of the pins, at most GPIO_PIN_GROUP_MAX_PINS.
+/// @param consumer The name of the consumer (e.g., "MyBus").
+/// @param biasType The input bias type for all pins.
+/// @return A pointer to the created GPIOPinGroup instance, or NULL if consumption fails.
+/// @note Either all pins are requested or none.
+GPIOPinGroup *GPIOPinGroup_ConsumeAsInput(const GPIOChip *chip, const unsigned char *indices, size_t count, const string consumer, GPIOInputBiasType biasType);
+
+/// @brief Consumes GPIO pins of a GPIO chip with a single output request.
+/// @param chip The GPIOChip instance to consume the pins from.
+/// @param indices Indices of the GPIO pins to consume. Order of the indices is the order of the values.
+/// @param count Count of the pins, at most GPIO_PIN_GROUP_MAX_PINS.
+/// @param consumer The name of the consumer (e.g., "MyBus").
+/// @param outputType The output type for all pins.
+/// @param initialMask Initial values of the pins. Bit i is the value of the pin i.
+/// @return A pointer to the created GPIOPinGroup instance, or NULL if consumption fails.
+/// @note Either all pins are requested or none.
+GPIOPinGroup *GPIOPinGroup_ConsumeAsOutput(const GPIOChip *chip, const unsigned char *indices, size_t count, const string consumer, GPIOOutputType outputType, unsigned long long initialMask);
+
+/// @brief Releases all pins of a GPIO pin group and frees its resources.
+/// @param group The GPIOPinGroup instance to release.
+void GPIOPinGroup_Release(GPIOPinGroup *group);
+
+/// @brief Gets the count of pins in a GPIO pin group.
+/// @param group The GPIOPinGroup instance.
+/// @return Count of the pins.
+size_t GPIOPinGroup_GetSize(const GPIOPinGroup *group);
+
+/// @brief Writes digital values to all pins of a GPIO pin group with a single call.
+/// @param group The GPIOPinGroup instance to write to.
+/// @param values Values to write, one per pin in the order of the indices.
+/// @return 0 on success, or -1 if the operation fails.
+/// @note Logs a warning if the write operation fails.
+int GPIOPinGroup_WriteValues(const GPIOPinGroup *group, const GPIODigitalValue *values);
+
+/// @brief Reads the digital values of all pins of a GPIO pin group with a single call.
+/// @param group The GPIOPinGroup instance to read from.
+/// @param values Buffer for the values, one per pin in the order of the indices.
+/// @return 0 on success, or -1 if the operation fails.
+/// @note Logs a warning if the read operation fails.
+int GPIOPinGroup_ReadValues(const GPIOPinGroup *group, GPIODigitalValue *values);
+
+/// @brief Writes a bit mask to all pins of a GPIO pin group with a single call. Used for parallel buses.
+/// @param group The GPIOPinGroup instance to write to.
+/// @param mask Values of the pins. Bit i is written to the pin i.
+/// @return 0 on success, or -1 if the operation fails.
+int GPIOPinGroup_WriteMask(const GPIOPinGroup *group, unsigned long long mask);
+
+/// @brief Reads all pins of a GPIO pin group as a bit mask with a single call.
+/// @param group The GPIOPinGroup instance to read from.
+/// @param mask Values of the pins. Bit i is the value of the pin i.
+/// @return 0 on success, or -1 if the operation fails.
+int GPIOPinGroup_ReadMask(const GPIOPinGroup *group, unsigned long long *mask);
+
+/// @brief Starts a PWM channel on an output pin. The scheduler thread is started with the first channel.
+/// @param pin Output pin to drive. Should not be written or released before the channel is destroyed.
+/// @param periodNanoseconds Period of the pulse train.
+/// @param dutyNanoseconds Width of the high pulse in every period. 0 keeps the pin low, period or more keeps it high.
+/// @return A pointer to the created GPIOPwm instance, or NULL if all channels are in use.
+GPIOPwm *GPIOPwm_Create(GPIOPin *pin, unsigned long long periodNanoseconds, unsigned long long dutyNanoseconds);
+
+/// @brief Starts a PWM channel with servo timing, centered. Position is set with GPIOPwm_SetServoPosition.
+/// @param pin Output pin of the servo signal.
+/// @return A pointer to the created GPIOPwm instance, or NULL if all channels are in use.
+GPIOPwm *GPIOPwm_CreateServo(GPIOPin *pin);
+
+/// @brief Stops a PWM channel, leaves its pin low and frees its resources. The scheduler thread is stopped with the last channel.
+/// @param pwm The GPIOPwm instance to destroy.
+void GPIOPwm_Destroy(GPIOPwm *pwm);
+
+/// @brief Sets the period of a PWM channel. Applied from the next period, so a running pulse is never cut.
+/// @param pwm The GPIOPwm instance.
+/// @param periodNanoseconds New period.
+void GPIOPwm_SetPeriod(GPIOPwm *pwm, unsigned long long periodNanoseconds);
+
+/// @brief Sets the width of the high pulse of a PWM channel. Applied from the next period.
+/// @param pwm The GPIOPwm instance.
+/// @param dutyNanoseconds New pulse width. 0 keeps the pin low, period or more keeps it high.
+void GPIOPwm_SetDuty(GPIOPwm *pwm, unsigned long long dutyNanoseconds);
+
+/// @brief Sets the pulse width of a PWM channel as a share of its period. Applied from the next period.
+/// @param pwm The GPIOPwm instance.
+/// @param dutyCycle Share of the period the pin is high, between 0 and 1.
+void GPIOPwm_SetDutyCycle(GPIOPwm *pwm, float dutyCycle);
+
+/// @brief Sets the servo position of a PWM channel. Maps linearly to the servo pulse widths.
+/// @param pwm The GPIOPwm instance, should be created with GPIOPwm_CreateServo.
+/// @param position Position between 0 (minimum pulse) and 1 (maximum pulse). Clamped.
+void GPIOPwm_SetServoPosition(GPIOPwm *pwm, float position);
+
+/// @brief Runs the PWM scheduler thread with SCHED_FIFO real-time scheduling. Applied now if the thread runs, on start otherwise.
+/// @param priority Real-time priority, 1 to 99. 0 goes back to normal scheduling.
+/// @return True on success. False if the process is not allowed (needs CAP_SYS_NICE or an rtprio limit), normal scheduling is kept.
+bool GPIOPwm_SetRealtimePriority(int priority);
+
+/// @brief Gets the timing statistics of the PWM scheduler thread.
+/// @return Statistics since the last reset.
+GPIOPwmStats GPIOPwm_GetStats();
+
+/// @brief Resets the timing statistics of the PWM scheduler thread.
+void GPIOPwm_ResetStats();
+
+/// @brief Creates a waveform player and starts its thread. The thread sleeps while nothing is played.
+/// @param group Output pin group to play on. Should not be written or released before the player is destroyed.
+/// @param cpu CPU to pin the thread to, or -1 to let it run on any CPU. An isolated CPU gives the steadiest timing.
+/// @param priority SCHED_FIFO priority of the thread, 1 to 99, or 0 for normal scheduling. Kept normal with a warning if the process is not allowed.
+/// @return A pointer to the created GPIOWaveformPlayer instance, or NULL if the thread cannot be started.
+GPIOWaveformPlayer *GPIOWaveformPlayer_Create(GPIOPinGroup *group, int cpu, int priority);
+
+/// @brief Stops the thread of a waveform player after the playing waveform and destroys it.
+/// @param player The GPIOWaveformPlayer instance to destroy.
+void GPIOWaveformPlayer_Destroy(GPIOWaveformPlayer *player);
+
+/// @brief Starts playing a waveform. Steps are converted to line values before the playback, so the timed loop only writes and waits.
+/// @param player The GPIOWaveformPlayer instance.
+/// @param steps Steps of the waveform. Copied, can be reused after the call.
+/// @param count Count of the steps.
+/// @return True if the playback is started, false if a waveform is still playing.
+/// @note Each step is one ioctl, so steps shorter than its cost (about a microsecond on most boards) are late. Check the error with GPIOWaveformPlayer_Wait.
+bool GPIOWaveformPlayer_Play(GPIOWaveformPlayer *player, const GPIOWaveformStep *steps, size_t count);
+
+/// @brief Checks if a waveform is playing.
+/// @param player The GPIOWaveformPlayer instance.
+/// @return True while a waveform is playing.
+bool GPIOWaveformPlayer_IsPlaying(GPIOWaveformPlayer *player);
+
+/// @brief Blocks until the playing waveform ends.
+/// @param player The GPIOWaveformPlayer instance.
+/// @return Timing of the last played waveform.
+GPIOWaveformStats GPIOWaveformPlayer_Wait(GPIOWaveformPlayer *player);
+
 #endif // PLATFORM_LINUX
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Core.h"
+
+#pragma region typedefs
+
+/// @brief An opened i2c-dev bus. Every transaction is a single I2C_RDWR ioctl, so it is atomic on the bus and the bus can be shared between threads.
+typedef struct I2CBus I2CBus;
+
+/// @brief Reads registers of several devices of a bus on its own thread, every device at its own rate. Latest samples are read without locks.
+typedef struct I2CPoller I2CPoller;
+
+// Bytes of a single register write, the register address is sent in front of them
+#define I2C_BUS_MAX_WRITE_SIZE 32
+
+// Devices of a single poller
+#define I2C_POLLER_MAX_DEVICES 16
+
+// Register bytes of a single poller sample, a multiple of 8
+#define I2C_POLLER_MAX_SAMPLE_SIZE 32
+
+/// @brief Latest sample of a polled device.
+typedef struct I2CSample
+{
+    unsigned char data[I2C_POLLER_MAX_SAMPLE_SIZE]; // Register bytes, starting at the register of the device.
+    unsigned int length;                            // Count of the valid bytes.
+    unsigned long long timestamp;                   // Monotonic time of the read in nanoseconds.
+    unsigned long long sampleCount;                 // Count of the samples read so far, changes when a new sample is published.
+} I2CSample;
+
+#pragma endregion typedefs
+
+#if PLATFORM_LINUX
+
+/// @brief Opens an i2c-dev bus.
+/// @param busPath The file path to the bus (e.g., "/dev/i2c-1").
+/// @return A pointer to the created I2CBus instance, or NULL if the bus cannot be opened.
+I2CBus *I2CBus_Open(const string busPath);
+
+/// @brief Closes an i2c-dev bus. Pollers of the bus should be destroyed first.
+/// @param bus The I2CBus instance to close.
+void I2CBus_Close(I2CBus *bus);
+
+/// @brief Reads consecutive registers as a register write and a read joined with a repeated start, in one I2C_RDWR ioctl.
+/// @param bus The I2CBus instance.
+/// @param address 7 bit address of the device.
+/// @param reg First register to read.
+/// @param values Buffer to read the registers into.
+/// @param count Count of the registers to read.
+/// @return True if the registers are read.
+bool I2CBus_ReadRegisters(I2CBus *bus, unsigned char address, unsigned char reg, unsigned char *values, unsigned short count);
+
+/// @brief Writes consecutive registers in one I2C_RDWR ioctl.
+/// @param bus The I2CBus instance.
+/// @param address 7 bit address of the device.
+/// @param reg First register to write.
+/// @param values Values to write.
+/// @param count Count of the registers to write, at most I2C_BUS_MAX_WRITE_SIZE.
+/// @return True if the registers are written.
+bool I2CBus_WriteRegisters(I2CBus *bus, unsigned char address, unsigned char reg, const unsigned char *values, unsigned short count);
+
+/// @brief Creates a poller of a bus. Devices are added before the poller is started.
+/// @param bus The I2CBus instance to poll.
+/// @return A pointer to the created I2CPoller instance.
+I2CPoller *I2CPoller_Create(I2CBus *bus);
+
+/// @brief Stops the thread of a poller and destroys it.
+/// @param poller The I2CPoller instance to destroy.
+void I2CPoller_Destroy(I2CPoller *poller);
+
+/// @brief Adds a register block to poll. Should be called before I2CPoller_Start.
+/// @param poller The I2CPoller instance.
+/// @param address 7 bit address of the device.
+/// @param reg First register to read.
+/// @param count Count of the registers to read, at most I2C_POLLER_MAX_SAMPLE_SIZE.
+/// @param periodNanoseconds Time between two reads of the device.
+/// @return Index of the device to get its samples with, or -1 if the poller is full.
+int I2CPoller_AddDevice(I2CPoller *poller, unsigned char address, unsigned char reg, unsigned int count, unsigned long long periodNanoseconds);
+
+/// @brief Starts the thread of a poller. Reads of a device are scheduled on absolute deadlines, so its rate does not drift.
+/// @param poller The I2CPoller instance to start.
+/// @return True if the thread is started.
+bool I2CPoller_Start(I2CPoller *poller);
+
+/// @brief Gets the latest sample of a device. Never blocks the poller thread, safe to call every frame from App_Update.
+/// @param poller The I2CPoller instance.
+/// @param deviceIndex Index of the device from I2CPoller_AddDevice.
+/// @param sample Sample to copy the latest sample into.
+/// @return True if the device has a sample, false if it has not been read yet.
+bool I2CPoller_GetLatest(const I2CPoller *poller, int deviceIndex, I2CSample *sample);
+
+/// @brief Gets the count of the failed reads of all devices of a poller.
+/// @param poller The I2CPoller instance.
+/// @return Count of the failed reads.
+unsigned long long I2CPoller_GetErrorCount(const I2CPoller *poller);
+
+#endif // PLATFORM_LINUX
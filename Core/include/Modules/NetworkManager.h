@@ -6,7 +6,8 @@
 
 #pragma region typedefs
 
-#define NETWORK_MANAGER_MAX_RESPONSE_DATA_LENGTH 8192
+// Initial capacity of a response body, the body grows as the data arrives
+#define NETWORK_MANAGER_INITIAL_RESPONSE_CAPACITY 8192
 
 /// @brief Enum representing the response codes for network requests.
 typedef enum NetworkResponseCode
@@ -177,6 +178,7 @@ typedef struct NetworkResponse
     stringHeap body;
     size_t bodySize;
     NetworkResponseCode code;
+    long statusCode; // HTTP status of the response, an error status is still a response with a body
 } NetworkResponse;
 
 /// @brief Callback function type for handling network responses.
@@ -216,7 +218,7 @@ void NetworkRequest_Destroy(NetworkRequest *request);
 ///@param request The network request to perform.
 ///@param finishCallback The callback function to handle the response. Can be NULL.
 ///@param chunkCallback The callback function to handle response chunks. Can be NULL.
-/// @return The response from the network request or NULL if error. Response is allocated on heap and must be freed by the caller.
+/// @return The response from the network request or NULL if error. An HTTP error status is a response, its statusCode should be checked. Response is allocated on heap and must be freed by the caller.
 NetworkResponse *NetworkRequest_Request(NetworkRequest *request, NetworkResponseFinishCallback finishCallback, NetworkResponseChunkCallback chunkCallback);
 
 /// @brief Destroys the network response and frees its resources.
@@ -0,0 +1,259 @@
+#pragma once
+
+#include "Core.h"
+
+#include "Modules/RenderManager.h"
+
+#pragma region typedefs
+
+// Returned by readKey when there is no key waiting. Same value with curses ERR.
+#define RENDERER_BACKEND_KEY_NONE -1
+
+// Default screen size of the headless backend when no size is set before initialization.
+#define RENDERER_HEADLESS_DEFAULT_SIZE_X 120
+#define RENDERER_HEADLESS_DEFAULT_SIZE_Y 40
+
+// Count of keys the headless backend can hold before they are read.
+#define RENDERER_HEADLESS_KEY_QUEUE_SIZE 256
+
+// Most UTF-8 bytes of the character of a cell, a single code point
+#define RENDERER_CELL_MAX_CHARACTER_BYTES 4
+
+// Most bytes of a single escape sequence or SGR parameter appended to a frame, a cursor move to the largest position fits
+#define RENDERER_CELL_MAX_SEQUENCE_BYTES 32
+
+// Bytes reserved in a frame for the final cursor move and visibility change
+#define RENDERER_CELL_FRAME_EXTRA_BYTES 64
+
+// Unchanged cells up to this count are rewritten instead of sending a cursor move over them
+#define RENDERER_CELL_MAX_REWRITE_GAP 4
+
+// Milliseconds to wait for the rest of an escape sequence after an escape key in the ANSI backend
+#define RENDERER_ANSI_ESCAPE_TIMEOUT 25
+
+/// @brief Capabilities of the terminal a backend draws to. Filled by the backend on initialization.
+typedef struct RendererBackendCapabilities
+{
+    Vector2Int screenSize; // Count of columns and lines.
+    int colorCount;        // Count of colors, 8, 16, 256 or 0x1000000 for direct color.
+    int colorPairCount;    // Count of color pair handles the backend can hold. Pair 0 is always the terminal defaults.
+    bool canChangeColor;   // Whether colors can be redefined with RGB values.
+} RendererBackendCapabilities;
+
+/// @brief Counters of a backend. Used for measuring rendering throughput.
+typedef struct RendererBackendStats
+{
+    unsigned long long cellsWritten; // Cells written by put and clear operations.
+    unsigned long long cellsChanged; // Cells that changed on screen by refreshes.
+    unsigned long long bytesEmitted; // Bytes sent or would be sent to the terminal.
+    unsigned long long refreshCount; // Count of refresh operations.
+} RendererBackendStats;
+
+/// @brief A single character cell of the screen with its attributes.
+/// A cell holds a single code point taking a single column. Combining marks take a cell of their own and wide characters are not widened,
+/// so only text of single column characters lines up, like most Latin, Greek and Cyrillic text, box drawing and symbols.
+typedef struct RendererCell
+{
+    char character[RENDERER_CELL_MAX_CHARACTER_BYTES]; // UTF-8 sequence of the code point, the unused bytes are 0.
+    RendererTextAttributeMask mask;
+    int colorPairHandle;
+} RendererCell;
+
+/// @brief Window with its own cells, used by the backends that do not rely on a terminal library.
+typedef struct RendererCellWindow RendererCellWindow;
+
+/// @brief Screen with the cells the terminal shows and the cells composed from windows. Encodes the difference as ANSI sequences.
+typedef struct RendererCellScreen RendererCellScreen;
+
+/// @brief Operations the renderer needs from a terminal library. Window handles are owned and interpreted by the backend.
+/// @note All functions must be set except present and getStats, which can be NULL. resizeScreen reads the new terminal size and returns it.
+typedef struct RendererBackend
+{
+    const char *name;
+
+    void (*initialize)(RendererBackendCapabilities *capabilities);
+    void (*terminate)();
+    void *(*getScreenWindow)();
+    void *(*createWindow)(Vector2Int position, Vector2Int size);
+    void (*destroyWindow)(void *window);
+    void (*setWindowGeometry)(void *window, Vector2Int position, Vector2Int size);
+    Vector2Int (*resizeScreen)();
+
+    void (*initializeColorPair)(int handle, RendererColorPair colorPair);
+    void (*changeColor)(RendererColor color, Vector3Int colorToChangeTo);
+    void (*setCursorVisibility)(RendererCursorVisibility visibility);
+
+    void (*setAttribute)(void *window, RendererTextAttributeMask mask, int colorPairHandle);
+    void (*setCursorPosition)(void *window, Vector2Int position);
+    Vector2Int (*getCursorPosition)(void *window);
+    void (*putString)(void *window, const char *text, size_t length);
+    void (*clear)(void *window);
+    void (*drawBorder)(void *window, const int borderChars[8]);
+    void (*refresh)(void *window);
+    void (*present)();
+
+    int (*readKey)(void *window);
+    RendererBackendStats (*getStats)();
+} RendererBackend;
+
+#pragma endregion typedefs
+
+/// @brief Sends everything refreshed since the last present to the terminal. Called by the core once per loop.
+/// @note Only does work for backends that batch output per frame, refreshing is enough for the others.
+void RendererManager_Present();
+
+/// @brief Marks the terminal as resized. Used by the SIGWINCH handler and backends without a real terminal.
+void RendererManager_RequestResize();
+
+/// @brief Applies a pending terminal resize to the backend and the main window, then calls the resize callback. Called by the core once per loop.
+/// @return True if the terminal was resized.
+bool RendererManager_HandleResize();
+
+/// @brief Gets the counters of the selected backend.
+/// @return Counters of the backend. All zero if the backend does not count.
+RendererBackendStats RendererManager_GetBackendStats();
+
+/// @brief Gets the curses backend. Draws to the real terminal, default backend of the renderer.
+/// @return Pointer to the curses backend.
+const RendererBackend *RendererBackend_GetCurses();
+
+#if !PLATFORM_WINDOWS
+/// @brief Gets the ANSI backend. Writes escape sequences of the changed cells to the terminal with a single write per frame.
+/// @return Pointer to the ANSI backend.
+const RendererBackend *RendererBackend_GetAnsi();
+#endif
+
+/// @brief Gets the headless backend. Draws to an in-memory cell grid, does not need a terminal.
+/// @return Pointer to the headless backend.
+const RendererBackend *RendererBackend_GetHeadless();
+
+/// @brief Sets the screen size of the headless backend. Acts like a terminal resize if the renderer is initialized.
+/// @param size Count of columns and lines.
+void RendererHeadless_SetScreenSize(Vector2Int size);
+
+/// @brief Gets a cell of the headless screen. Only refreshed content is visible, like a real terminal.
+/// @param position Column and line of the cell.
+/// @return The cell. Blank cell if the position is out of the screen.
+RendererCell RendererHeadless_GetCell(Vector2Int position);
+
+/// @brief Copies a line of the headless screen as UTF-8 text. Stops before a character which does not fit the buffer.
+/// @param line Line to copy.
+/// @param buffer Buffer to copy into. Null terminated.
+/// @param bufferSize Size of the buffer.
+void RendererHeadless_GetLine(int line, char *buffer, size_t bufferSize);
+
+/// @brief Adds a key to the headless input queue. Read by the input manager and string input functions.
+/// @param key Key code to add.
+void RendererHeadless_PushKey(int key);
+
+/// @brief Resets the counters of the headless backend.
+void RendererHeadless_ResetStats();
+
+/// @brief Creates a cell window. Everything is blank and touched initially.
+/// @param position Position of the window on the screen.
+/// @param size Size of the window.
+/// @return The created cell window.
+RendererCellWindow *RendererCellWindow_Create(Vector2Int position, Vector2Int size);
+
+/// @brief Destroys the cell window.
+/// @param window Cell window to destroy.
+void RendererCellWindow_Destroy(RendererCellWindow *window);
+
+/// @brief Moves and resizes a cell window. Content is kept where it still fits and the whole window is touched.
+/// @param window Cell window to change.
+/// @param position New position of the window on the screen.
+/// @param size New size of the window.
+void RendererCellWindow_SetGeometry(RendererCellWindow *window, Vector2Int position, Vector2Int size);
+
+/// @brief Sets the attribute of the next written cells.
+/// @param window Cell window to set the attribute of.
+/// @param mask Attribute mask.
+/// @param colorPairHandle Color pair handle.
+void RendererCellWindow_SetAttribute(RendererCellWindow *window, RendererTextAttributeMask mask, int colorPairHandle);
+
+/// @brief Moves the cursor of the window. Positions out of the window are ignored.
+/// @param window Cell window to move the cursor of.
+/// @param position New cursor position, relative to the window.
+void RendererCellWindow_SetCursorPosition(RendererCellWindow *window, Vector2Int position);
+
+/// @brief Gets the cursor of the window.
+/// @param window Cell window to get the cursor of.
+/// @return Cursor position, relative to the window.
+Vector2Int RendererCellWindow_GetCursorPosition(const RendererCellWindow *window);
+
+/// @brief Writes the text from the cursor with the current attribute. Wraps at the window edge and stops at the end of the window.
+/// Every code point takes a cell, invalid or cut UTF-8 sequences are written as U+FFFD and control characters as blanks.
+/// @param window Cell window to write to.
+/// @param text UTF-8 text to write. Does not have to be null terminated.
+/// @param length Length of the text.
+/// @return Count of written cells.
+size_t RendererCellWindow_PutString(RendererCellWindow *window, const char *text, size_t length);
+
+/// @brief Fills the window with blanks and moves the cursor to the top left.
+/// @param window Cell window to clear.
+/// @return Count of written cells.
+size_t RendererCellWindow_Clear(RendererCellWindow *window);
+
+/// @brief Draws the border of the window. 0 characters are replaced with ASCII defaults.
+/// @param window Cell window to draw the border of.
+/// @param borderChars Left, right, top, bottom, top left, top right, bottom left and bottom right code points, like 0x2502 for a box drawing line.
+/// @return Count of written cells.
+size_t RendererCellWindow_DrawBorder(RendererCellWindow *window, const int borderChars[8]);
+
+/// @brief Creates a cell screen. The terminal should be cleared before the first encoded frame.
+/// @param size Count of columns and lines.
+/// @param colorCount Count of colors of the terminal.
+/// @param colorPairCapacity Count of color pair handles.
+/// @return The created cell screen.
+RendererCellScreen *RendererCellScreen_Create(Vector2Int size, int colorCount, int colorPairCapacity);
+
+/// @brief Destroys the cell screen.
+/// @param screen Cell screen to destroy.
+void RendererCellScreen_Destroy(RendererCellScreen *screen);
+
+/// @brief Resizes a cell screen after a terminal resize. The next frame clears the terminal and redraws every cell.
+/// @param screen Cell screen to resize.
+/// @param size New count of columns and lines.
+/// @note Frame capacity changes with the size, frame buffers smaller than the new capacity should be allocated again.
+void RendererCellScreen_Resize(RendererCellScreen *screen, Vector2Int size);
+
+/// @brief Sets the colors of a color pair handle.
+/// @param screen Cell screen to set the colors in.
+/// @param handle Color pair handle.
+/// @param colorPair Foreground and background colors.
+void RendererCellScreen_SetColorPair(RendererCellScreen *screen, int handle, RendererColorPair colorPair);
+
+/// @brief Sets the cursor visibility, sent with the next encoded frame.
+/// @param screen Cell screen to set the cursor visibility of.
+/// @param visibility Cursor visibility.
+void RendererCellScreen_SetCursorVisibility(RendererCellScreen *screen, RendererCursorVisibility visibility);
+
+/// @brief Copies the lines of the window written since the last compose into the screen. Leaves the terminal cursor at the window cursor.
+/// @param screen Cell screen to compose into.
+/// @param window Cell window to compose.
+void RendererCellScreen_Compose(RendererCellScreen *screen, RendererCellWindow *window);
+
+/// @brief Gets the buffer size a frame of the screen can take at most. Every cell is counted with the longest cursor move
+/// to the screen size, the longest SGR sequence of the color count of the terminal and the longest character.
+/// @param screen Cell screen to get the frame capacity of.
+/// @return Size in bytes.
+size_t RendererCellScreen_GetFrameCapacity(const RendererCellScreen *screen);
+
+/// @brief Encodes the composed cells that differ from the terminal as ANSI sequences. Cursor moves and attribute changes are only sent when needed.
+/// @param screen Cell screen to encode.
+/// @param buffer Frame buffer to encode into. Not null terminated.
+/// @param capacity Size of the buffer. Must be at least RendererCellScreen_GetFrameCapacity.
+/// @param cellsChanged Incremented by the count of changed cells.
+/// @return Count of encoded bytes.
+size_t RendererCellScreen_Encode(RendererCellScreen *screen, char *buffer, size_t capacity, unsigned long long *cellsChanged);
+
+/// @brief Gets a cell the terminal shows.
+/// @param screen Cell screen to get the cell of.
+/// @param position Column and line of the cell.
+/// @return The cell. Blank cell if the position is out of the screen.
+RendererCell RendererCellScreen_GetCell(const RendererCellScreen *screen, Vector2Int position);
+
+/// @brief Gets the size of the screen.
+/// @param screen Cell screen to get the size of.
+/// @return Count of columns and lines.
+Vector2Int RendererCellScreen_GetSize(const RendererCellScreen *screen);
@@ -49,7 +49,7 @@ typedef enum RendererCursorVisibility
 } RendererCursorVisibility;
 
 /// @brief Vector representing text and background colors.
-/// @note Should be used with only 'RendererColor' enum.
+/// @note Should be used with 'RendererColor' enum or colors from RendererManager_GetNearestColor.
 typedef Vector2Int RendererColorPair;
 
 /// @brief Vector representing the borders of a renderer window.
@@ -57,11 +57,21 @@ typedef Vector2Int RendererColorPair;
 typedef Vector3Int RendererWindowBorders;
 
 /// @brief Text attribute structure for rendering text in the terminal. Contains color pair and mask.
+/// @note Attributes with the same color pair share a single backend color pair.
 typedef struct RendererTextAttribute RendererTextAttribute;
 
-/// @brief Window structure for rendering text in the terminal. Wrapper for ncurses window with some additions.
+/// @brief Id of an interned text attribute. Interned attributes are owned by the renderer and live until it terminates.
+typedef int RendererTextAttributeId;
+
+/// @brief Invalid interned text attribute id.
+#define RENDERER_TEXT_ATTRIBUTE_ID_KOLPA -1
+
+/// @brief Window structure for rendering text in the terminal. Wrapper for a backend window with some additions.
 typedef struct RendererWindow RendererWindow;
 
+/// @brief Terminal library operations the renderer draws with. Defined in RenderBackend.h.
+typedef struct RendererBackend RendererBackend;
+
 /// @brief Global pointer to the main renderer window.
 extern RendererWindow *RENDERER_MAIN_WINDOW;
 
@@ -76,12 +86,34 @@ void RendererManager_Initialize();
 /// @brief Stops the renderer module. Should not be used by app.
 void RendererManager_Terminate();
 
+/// @brief Selects the backend the renderer draws with. Should be used before the core runs, curses is used otherwise.
+/// @param backend Backend to select. Got from RendererBackend_GetCurses or RendererBackend_GetHeadless.
+void RendererManager_SelectBackend(const RendererBackend *backend);
+
+/// @brief Sets the function called after the terminal is resized. Windows keep their geometry, the callback should place them again.
+/// @param callback Function to call. NULL removes the callback.
+void RendererManager_SetResizeCallback(Core_VoidToVoid callback);
+
+/// @brief Reads a key from the backend. Does not block for the main window.
+/// @param window Window to read the key with. Curses echoes and moves the cursor of this window.
+/// @return Key code or RENDERER_BACKEND_KEY_NONE if there is no key waiting.
+int RendererManager_ReadKey(const RendererWindow *window);
+
 /// @brief Changes the color of the terminal.
 /// @param color The color to change.
 /// @param colorToChangeTo The RGB values to change the color to.
 /// @note Should be used within only 0-1000 range. User's terminal should support changing colors.
 void RendererManager_ChangeColor(RendererColor color, Vector3Int colorToChangeTo);
 
+/// @brief Gets the count of colors the terminal supports.
+/// @return Count of colors. 8, 16, 256 or 0x1000000 for direct color terminals.
+int RendererManager_GetColorCount();
+
+/// @brief Gets the terminal color closest to the RGB value. Uses the 256 color palette or direct colors if the terminal supports them.
+/// @param color RGB value to find the closest color for. Should be used within 0-255 range.
+/// @return The closest color. Can be used in RendererColorPair.
+RendererColor RendererManager_GetNearestColor(Vector3Int color);
+
 /// @brief Sets the visibility of the cursor in the terminal.
 /// @param visibility The desired cursor visibility.
 void RendererManager_SetCursorVisibility(RendererCursorVisibility visibility);
@@ -99,8 +131,20 @@ void RendererTextAttribute_Destroy(RendererTextAttribute *attribute);
 /// @brief Changes the color pair of a text attribute.
 /// @param attribute The text attribute to change.
 /// @param colorPair The new color pair to assign.
+/// @note Interned attributes are shared, so they cannot be changed.
 void RendererTextAttribute_ChangeColor(RendererTextAttribute *attribute, RendererColorPair colorPair);
 
+/// @brief Gets the id of the interned text attribute with the mask and color pair. Creates it on first use, returns the same id for the same values after that.
+/// @param mask The text attribute mask (e.g., Bold, Underline).
+/// @param colorPair The foreground and background colors.
+/// @return Id of the interned text attribute.
+RendererTextAttributeId RendererTextAttribute_Intern(RendererTextAttributeMask mask, RendererColorPair colorPair);
+
+/// @brief Gets the interned text attribute of the id.
+/// @param id Id got from RendererTextAttribute_Intern.
+/// @return The interned text attribute. Should not be destroyed.
+const RendererTextAttribute *RendererTextAttribute_GetInterned(RendererTextAttributeId id);
+
 /// @brief Creates a renderer window.
 /// @param position The position of the window in the terminal.
 /// @param size The size of the window.
@@ -114,13 +158,13 @@ RendererWindow *RendererWindow_Create(const string title, Vector2Int position, V
 /// @param window The renderer window to destroy.
 void RendererWindow_Destroy(RendererWindow *window);
 
-/// @brief Updates/renders the renderer window. Used for redrawing the curses window content.
+/// @brief Updates/renders the renderer window. Used for redrawing the backend window content.
 /// @param window The renderer window to update/renders.
 void RendererWindow_UpdateContent(const RendererWindow *window);
 
-/// @brief Updates the global position of the window based on its relative position and parent's global position. Used for tasks that destroy and create the curses window.
+/// @brief Updates the global position of the window based on its relative position and parent's global position. Used for tasks that destroy and create the backend window.
 /// @param window Window to update global position for.
-/// @note This function should be called after the curses window is created.
+/// @note This function should be called after the backend window is created.
 void RendererWindow_UpdateAppearance(RendererWindow *window);
 
 /// @brief Clears the renderer window. Deletes all the content.
@@ -208,6 +252,13 @@ void RendererWindow_SetSize(RendererWindow *window, Vector2Int newSize);
 /// @param add If true, the new position will be added to the current position.
 void RendererWindow_SetPosition(RendererWindow *window, Vector2Int newPosition, bool add);
 
+/// @brief Moves and resizes the window in place. The backend window and its content are kept.
+/// @param window Renderer window to change.
+/// @param position New position relative to the parent window.
+/// @param size New size of the window.
+/// @note The window is not refreshed, so a layout can change many windows and refresh them together.
+void RendererWindow_SetGeometry(RendererWindow *window, Vector2Int position, Vector2Int size);
+
 /// @brief Sets the parent window for the renderer window.
 /// @param window The renderer window.
 /// @param parentWindow The parent window to set.
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Core.h"
+
+#pragma region typedefs
+
+/// @brief Clock polarity and phase of an SPI device.
+typedef enum SPIMode
+{
+    SPIMode_Kolpa = -1, // An invalid or error state (-1).
+    SPIMode_0 = 0,      // Clock idles low, data is sampled on the rising edge.
+    SPIMode_1 = 1,      // Clock idles low, data is sampled on the falling edge.
+    SPIMode_2 = 2,      // Clock idles high, data is sampled on the falling edge.
+    SPIMode_3 = 3       // Clock idles high, data is sampled on the rising edge.
+} SPIMode;
+
+/// @brief An opened spidev device. Keeps its own transfer descriptors, so submitting a batch does not allocate.
+typedef struct SPIDevice SPIDevice;
+
+/// @brief A single full-duplex segment of a batch. Segments of a batch are sent in one ioctl, chip select stays active between them unless changeChipSelect is set.
+typedef struct SPITransfer
+{
+    const void *transmitBuffer;       // Bytes to send. NULL sends zeros.
+    void *receiveBuffer;              // Bytes received while sending. NULL drops them.
+    unsigned int length;              // Length of both buffers in bytes.
+    unsigned int speedHz;             // Clock of this segment. 0 uses the speed of the device.
+    unsigned short delayMicroseconds; // Wait after this segment before the next one or releasing chip select.
+    bool changeChipSelect;            // Releases chip select after this segment. On the last segment, keeps it active for the next batch instead.
+} SPITransfer;
+
+// Segments of a single batch. spidev also limits the total bytes of a batch, 4096 by default (spidev bufsiz parameter).
+#define SPI_DEVICE_MAX_BATCH_TRANSFERS 32
+
+// Alignment of the buffers of SPIDevice_AllocateBuffer, a cache line. Also satisfies the DMA alignment of the usual SPI controllers.
+#define SPI_DEVICE_BUFFER_ALIGNMENT 64
+
+#pragma endregion typedefs
+
+#if PLATFORM_LINUX
+
+/// @brief Opens and configures an spidev device.
+/// @param devicePath The file path to the device (e.g., "/dev/spidev2.0").
+/// @param mode Clock polarity and phase of the device.
+/// @param speedHz Default clock of the transfers.
+/// @param bitsPerWord Word size of the transfers, usually 8.
+/// @return A pointer to the created SPIDevice instance, or NULL if the device cannot be opened or configured.
+SPIDevice *SPIDevice_Open(const string devicePath, SPIMode mode, unsigned int speedHz, unsigned char bitsPerWord);
+
+/// @brief Closes an spidev device and releases its resources.
+/// @param device The SPIDevice instance to close.
+void SPIDevice_Close(SPIDevice *device);
+
+/// @brief Changes the mode, default speed and word size of an opened device.
+/// @param device The SPIDevice instance.
+/// @param mode Clock polarity and phase of the device.
+/// @param speedHz Default clock of the transfers.
+/// @param bitsPerWord Word size of the transfers.
+/// @return True if the device accepted every setting.
+bool SPIDevice_Configure(SPIDevice *device, SPIMode mode, unsigned int speedHz, unsigned char bitsPerWord);
+
+/// @brief Submits the segments as a single SPI_IOC_MESSAGE ioctl. Reading a sensor with a register write and a burst read costs one system call.
+/// @param device The SPIDevice instance.
+/// @param transfers Segments to send in order.
+/// @param count Count of the segments, at most SPI_DEVICE_MAX_BATCH_TRANSFERS.
+/// @return True if the whole batch is transferred.
+/// @note spidev copies the buffers through its own kernel buffer. Buffers of SPIDevice_AllocateBuffer keep those copies on whole cache lines.
+bool SPIDevice_Transfer(SPIDevice *device, const SPITransfer *transfers, size_t count);
+
+/// @brief Sends and receives a single full-duplex segment.
+/// @param device The SPIDevice instance.
+/// @param transmitBuffer Bytes to send. NULL sends zeros.
+/// @param receiveBuffer Bytes received while sending. NULL drops them.
+/// @param length Length of both buffers in bytes.
+/// @return True if the segment is transferred.
+bool SPIDevice_Exchange(SPIDevice *device, const void *transmitBuffer, void *receiveBuffer, unsigned int length);
+
+/// @brief Reads consecutive registers with a register write and a burst read in one batch.
+/// @param device The SPIDevice instance.
+/// @param address First register byte to send, including the read bit of the device if it has one.
+/// @param values Buffer to read the registers into.
+/// @param count Count of the registers to read.
+/// @return True if the registers are read.
+bool SPIDevice_ReadRegisters(SPIDevice *device, unsigned char address, unsigned char *values, unsigned int count);
+
+/// @brief Allocates a transfer buffer aligned to SPI_DEVICE_BUFFER_ALIGNMENT.
+/// @param size Size of the buffer in bytes.
+/// @return The allocated buffer. Should be freed with SPIDevice_FreeBuffer.
+void *SPIDevice_AllocateBuffer(size_t size);
+
+/// @brief Frees a buffer of SPIDevice_AllocateBuffer.
+/// @param buffer Buffer to free.
+void SPIDevice_FreeBuffer(void *buffer);
+
+#endif // PLATFORM_LINUX
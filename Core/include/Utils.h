@@ -7,3 +7,6 @@
 #include "Utils/Timer.h"
 #include "Utils/ResourceManager.h"
 #include "Utils/HashMap.h"
+#include "Utils/RingBuffer.h"
+#include "Utils/Arena.h"
+#include "Utils/WorkerPool.h"
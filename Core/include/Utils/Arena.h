@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Core.h"
+
+/// @brief A bump allocator over a single block allocated once. Allocations are freed all together by resetting the arena, or back to a mark by rewinding it.
+/// For scratch memory of a frame or of a calculation, without a malloc and free per allocation. Shouldn't be used without helper functions.
+/// @note Not thread safe, each thread should use its own arena.
+typedef struct Arena Arena;
+
+/// @brief Creator function for Arena.
+/// @param capacity Size of the block in bytes, cannot be resized later on.
+/// @return The created Arena struct.
+Arena *Arena_Create(size_t capacity);
+
+/// @brief Destroyer function for Arena. Every allocation of the arena is freed with it.
+/// @param arena Arena to destroy.
+void Arena_Destroy(Arena *arena);
+
+/// @brief Allocates memory from the arena.
+/// @param arena Arena to allocate from.
+/// @param size Size of the allocation in bytes.
+/// @param alignment Alignment of the allocation, a power of 2.
+/// @return Pointer to the allocation, or NULL if the arena does not have enough space left.
+void *Arena_Allocate(Arena *arena, size_t size, size_t alignment);
+
+/// @brief Frees every allocation of the arena at once.
+/// @param arena Arena to reset.
+void Arena_Reset(Arena *arena);
+
+/// @brief Gets the used size of the arena, which can be passed to Arena_Rewind later as a mark.
+/// @param arena Arena to get the used size.
+/// @return Used bytes of the arena, including alignment padding.
+size_t Arena_GetUsed(const Arena *arena);
+
+/// @brief Frees the allocations made after a mark of Arena_GetUsed, keeping the ones before it.
+/// @param arena Arena to rewind.
+/// @param mark Used size to go back to, not more than the current used size.
+void Arena_Rewind(Arena *arena, size_t mark);
+
+/// @brief Capacity getter for Arena.
+/// @param arena Arena to get capacity.
+/// @return Size of the block in bytes.
+size_t Arena_GetCapacity(const Arena *arena);
@@ -1,3 +1,57 @@
 #pragma once
 
-#include <Core.h>
+#include "Core.h"
+
+// The resize multiplier used when the HashMap load reaches to the limit when setting new item
+#define HASH_MAP_RESIZE_MULTIPLIER 2
+
+// The load limit for resizing the HashMap, resized when size is more than x/4 of the capacity
+#define HASH_MAP_MAX_LOAD_QUARTERS 3
+
+/// @brief An open addressing hash map implementation. Can store any type of key and value. Copies passed keys and values to its own property. Shouldn't be used without helper functions.
+/// @note Keys are hashed and compared byte by byte, so key structs should be zero initialized to clear padding.
+typedef struct HashMap HashMap;
+
+/// @brief Creator function for HashMap.
+/// @param sizeOfKey Size of the key type to store in.
+/// @param sizeOfValue Size of the value type to store in.
+/// @param initialCapacity How many slots the HashMap has initially. Rounded up to a power of 2. Can be resized later on.
+/// @return The created HashMap struct.
+HashMap *HashMap_Create(size_t sizeOfKey, size_t sizeOfValue, size_t initialCapacity);
+
+/// @brief Destroyer function for HashMap.
+/// @param map HashMap to destroy.
+void HashMap_Destroy(HashMap *map);
+
+/// @brief Setter function for HashMap. Adds the key if it is absent, replaces the value otherwise. Uses memcpy to copy the key and the value.
+/// @param map HashMap to set the value in.
+/// @param key Key to set the value of.
+/// @param value New value of the key.
+void HashMap_Set(HashMap *map, const void *key, const void *value);
+
+/// @brief Getter function for HashMap. Should be casted before dereference / usage like : *(ValueType*)function...
+/// @param map HashMap to get the value from.
+/// @param key Key to get the value of.
+/// @return Pointer to the value of the key inside the HashMap. NULL if the key is absent. Invalidated by HashMap_Set and HashMap_Remove.
+void *HashMap_Get(const HashMap *map, const void *key);
+
+/// @brief Remover function for HashMap. Removes the key and its value.
+/// @param map HashMap to remove the key from.
+/// @param key Key to remove.
+/// @return True if the key was present and removed, false otherwise.
+bool HashMap_Remove(HashMap *map, const void *key);
+
+/// @brief Clear function for HashMap. Removes all keys. Capacity remains the same.
+/// @param map HashMap to clear.
+void HashMap_Clear(HashMap *map);
+
+/// @brief Size getter for HashMap.
+/// @param map HashMap to get size.
+/// @return The count of keys in the HashMap.
+size_t HashMap_GetSize(const HashMap *map);
+
+/// @brief Hashes a block of bytes with FNV-1a. Used by HashMap and can be used for any other byte hashing.
+/// @param data Bytes to hash.
+/// @param size Count of bytes to hash.
+/// @return 64 bit hash of the bytes.
+unsigned long long HashMap_HashBytes(const void *data, size_t size);
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Core.h"
+
+// Size of a cache line, the indices of the producer and the consumer are kept this far apart so they do not share a line
+#define RING_BUFFER_CACHE_LINE_SIZE 64
+
+/// @brief A lock free ring buffer for a single producer thread and a single consumer thread. Can store any type. Copies passed items to its own property. Shouldn't be used without helper functions.
+/// @note Only one thread can push and only one thread can pop. Any other use needs a lock.
+typedef struct RingBuffer RingBuffer;
+
+/// @brief Creator function for RingBuffer.
+/// @param sizeOfItem Size of the item type to store in.
+/// @param capacity How many items the RingBuffer can hold. Rounded up to a power of 2, cannot be resized later on.
+/// @return The created RingBuffer struct.
+RingBuffer *RingBuffer_Create(size_t sizeOfItem, size_t capacity);
+
+/// @brief Destroyer function for RingBuffer. Neither thread should use the RingBuffer anymore.
+/// @param buffer RingBuffer to destroy.
+void RingBuffer_Destroy(RingBuffer *buffer);
+
+/// @brief Pusher function for RingBuffer. Should only be called by the producer thread. Uses memcpy to copy the item.
+/// @param buffer RingBuffer to push the item to.
+/// @param item Item to push.
+/// @return True if the item is pushed, false if the RingBuffer is full.
+bool RingBuffer_Push(RingBuffer *buffer, const void *item);
+
+/// @brief Popper function for RingBuffer. Should only be called by the consumer thread. Uses memcpy to copy the item.
+/// @param buffer RingBuffer to pop the item from.
+/// @param item Buffer to copy the oldest item into.
+/// @return True if an item is popped, false if the RingBuffer is empty.
+bool RingBuffer_Pop(RingBuffer *buffer, void *item);
+
+/// @brief Pops up to the given count of items with a single index update. Should only be called by the consumer thread.
+/// @param buffer RingBuffer to pop the items from.
+/// @param items Buffer to copy the items into, oldest first.
+/// @param maxCount Maximum count of items to pop.
+/// @return Count of the popped items.
+size_t RingBuffer_PopMany(RingBuffer *buffer, void *items, size_t maxCount);
+
+/// @brief Size getter for RingBuffer. Exact for the consumer thread, a snapshot for the others.
+/// @param buffer RingBuffer to get size.
+/// @return Count of the items waiting in the RingBuffer.
+size_t RingBuffer_GetSize(const RingBuffer *buffer);
+
+/// @brief Capacity getter for RingBuffer.
+/// @param buffer RingBuffer to get capacity.
+/// @return Count of the items the RingBuffer can hold.
+size_t RingBuffer_GetCapacity(const RingBuffer *buffer);
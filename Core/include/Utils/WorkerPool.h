@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Core.h"
+
+/// @brief Task of WorkerPool_ParallelFor, called once for every index of the loop from any thread of the pool.
+typedef void (*WorkerPoolTask)(void *context, size_t index);
+
+/// @brief Threads started once and kept waiting for parallel loops, so a loop does not pay for starting threads. Shouldn't be used without helper functions.
+/// The thread calling WorkerPool_ParallelFor works on the loop too, so a pool of N threads starts N - 1 of them.
+/// @note Only one thread should run loops on a pool at a time. Runs loops on the calling thread only where threads are not supported, on Windows for now.
+typedef struct WorkerPool WorkerPool;
+
+/// @brief Creator function for WorkerPool. Starts the threads.
+/// @param threadCount Count of the threads working on a loop including the calling one. 0 uses one per online CPU.
+/// @return The created WorkerPool struct.
+WorkerPool *WorkerPool_Create(size_t threadCount);
+
+/// @brief Destroyer function for WorkerPool. Stops and joins the threads, should not be called while a loop runs.
+/// @param pool WorkerPool to destroy.
+void WorkerPool_Destroy(WorkerPool *pool);
+
+/// @brief Runs a task for every index in [0, count) on the threads of the pool and waits until all of them are done.
+/// Indices are handed out one at a time to the thread that is free first, so a task should be big enough to cover the cost of that, a block of rows instead of a row.
+/// @param pool WorkerPool to run the loop on. Can be NULL to run the loop on the calling thread.
+/// @param count Count of the indices.
+/// @param task Task to call for every index.
+/// @param context Pointer passed to every call of the task.
+void WorkerPool_ParallelFor(WorkerPool *pool, size_t count, WorkerPoolTask task, void *context);
+
+/// @brief Thread count getter for WorkerPool.
+/// @param pool WorkerPool to get thread count.
+/// @return Count of the threads working on a loop including the calling one.
+size_t WorkerPool_GetThreadCount(const WorkerPool *pool);
@@ -42,6 +42,8 @@ void Core_Run(Core_VoidToVoid start, Core_VoidToVoid lateStart, Core_VoidToVoid
     {
         Timer_Start(&loopTimer);
 
+        RendererManager_HandleResize();
+
         InputManager_PollInputs();
         DebugInfo("'Input polling' function called.");
 
@@ -51,6 +53,8 @@ void Core_Run(Core_VoidToVoid start, Core_VoidToVoid lateStart, Core_VoidToVoid
         UPDATE_LATE();
         DebugInfo("'Late update' function called.");
 
+        RendererManager_Present();
+
         Timer_Stop(&loopTimer);
 
         loopNanoseconds = (loopTimer.endTime.seconds - loopTimer.startTime.seconds) * 1000000000L + (loopTimer.endTime.nanoseconds - loopTimer.startTime.nanoseconds);
@@ -11,6 +11,13 @@ Complex Complex_Multiply(Complex complex, float scalar)
     return (Complex){complex.real * scalar, complex.imaginary * scalar};
 }
 
+Complex Complex_Product(Complex complex1, Complex complex2)
+{
+    return (Complex){
+        complex1.real * complex2.real - complex1.imaginary * complex2.imaginary,
+        complex1.real * complex2.imaginary + complex1.imaginary * complex2.real};
+}
+
 float Complex_Magnitude(Complex complex)
 {
     return SquareRoot(complex.real * complex.real + complex.imaginary * complex.imaginary);
@@ -0,0 +1,119 @@
+#include "Maths/ComplexBatch.h"
+
+#include <math.h>
+
+ComplexBatch *ComplexBatch_Create(size_t count)
+{
+    ComplexBatch *batch = (ComplexBatch *)malloc(sizeof(ComplexBatch));
+    DebugAssert(batch != NULL, "Memory allocation failed.");
+
+    // Both parts in a single block, the imaginary parts start on the first SIMD_ALIGNMENT boundary after the real parts
+    size_t floatsPerAlignment = SIMD_ALIGNMENT / sizeof(float);
+    size_t stride = (count + floatsPerAlignment - 1) / floatsPerAlignment * floatsPerAlignment;
+
+    float *block = Simd_AllocateFloats(stride * 2);
+    memset(block, 0, stride * 2 * sizeof(float));
+
+    batch->real = block;
+    batch->imaginary = block + stride;
+    batch->count = count;
+
+    return batch;
+}
+
+void ComplexBatch_Destroy(ComplexBatch *batch)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+
+    Simd_Free(batch->real); // start of the single block of both parts
+    batch->real = NULL;
+    batch->imaginary = NULL;
+    batch->count = 0;
+
+    free(batch);
+    batch = NULL;
+}
+
+void ComplexBatch_Set(ComplexBatch *batch, size_t index, Complex complex)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+    DebugAssert(index < batch->count, "Index %zu is out of the batch with %zu complex numbers.", index, batch->count);
+
+    batch->real[index] = complex.real;
+    batch->imaginary[index] = complex.imaginary;
+}
+
+Complex ComplexBatch_Get(const ComplexBatch *batch, size_t index)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+    DebugAssert(index < batch->count, "Index %zu is out of the batch with %zu complex numbers.", index, batch->count);
+
+    return (Complex){batch->real[index], batch->imaginary[index]};
+}
+
+void ComplexBatch_SetReal(ComplexBatch *batch, const float *samples)
+{
+    DebugAssert(batch != NULL && samples != NULL, "Null pointer passed as parameter.");
+
+    memcpy(batch->real, samples, batch->count * sizeof(float));
+    memset(batch->imaginary, 0, batch->count * sizeof(float));
+}
+
+void ComplexBatch_Add(const ComplexBatch *batch1, const ComplexBatch *batch2, ComplexBatch *result)
+{
+    DebugAssert(batch1 != NULL && batch2 != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch1->count == batch2->count && batch1->count == result->count, "Batch counts do not match.");
+
+    const SimdKernels *kernels = Simd_GetKernels();
+    kernels->add(batch1->real, batch2->real, result->real, batch1->count);
+    kernels->add(batch1->imaginary, batch2->imaginary, result->imaginary, batch1->count);
+}
+
+void ComplexBatch_Multiply(const ComplexBatch *batch, float scalar, ComplexBatch *result)
+{
+    DebugAssert(batch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    const SimdKernels *kernels = Simd_GetKernels();
+    kernels->multiply(batch->real, scalar, result->real, batch->count);
+    kernels->multiply(batch->imaginary, scalar, result->imaginary, batch->count);
+}
+
+void ComplexBatch_Product(const ComplexBatch *batch1, const ComplexBatch *batch2, ComplexBatch *result)
+{
+    DebugAssert(batch1 != NULL && batch2 != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch1->count == batch2->count && batch1->count == result->count, "Batch counts do not match.");
+
+    Simd_GetKernels()->complexMultiply(batch1->real, batch1->imaginary, batch2->real, batch2->imaginary, result->real, result->imaginary, batch1->count);
+}
+
+void ComplexBatch_Conjugate(const ComplexBatch *batch, ComplexBatch *result)
+{
+    DebugAssert(batch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    if (result != batch)
+    {
+        memcpy(result->real, batch->real, batch->count * sizeof(float));
+    }
+
+    Simd_GetKernels()->multiply(batch->imaginary, -1.0f, result->imaginary, batch->count);
+}
+
+void ComplexBatch_SquaredMagnitude(const ComplexBatch *batch, float *results)
+{
+    DebugAssert(batch != NULL && results != NULL, "Null pointer passed as parameter.");
+
+    const float *components[2] = {batch->real, batch->imaginary};
+    Simd_GetKernels()->dot(components, components, 2, results, batch->count);
+}
+
+void ComplexBatch_Magnitude(const ComplexBatch *batch, float *results)
+{
+    ComplexBatch_SquaredMagnitude(batch, results);
+
+    for (size_t i = 0; i < batch->count; i++)
+    {
+        results[i] = sqrtf(results[i]);
+    }
+}
@@ -0,0 +1,172 @@
+#include "Maths/FFT.h"
+
+#include <math.h>
+
+#pragma region Source Only
+
+/// @brief Gets the quarter of the first radix 4 stage. A radix 4 stage is two radix 2 stages merged, an odd power of 2 starts with a single radix 2 stage.
+/// @param size Count of the samples, a power of 2.
+/// @return Quarter of the blocks of the first radix 4 stage, 1 or 2.
+size_t FFT_GetFirstQuarter(size_t size)
+{
+    int stageCount = 0;
+    for (size_t length = size; length > 1; length >>= 1)
+    {
+        stageCount++;
+    }
+
+    return stageCount % 2 == 0 ? 1 : 2;
+}
+
+/// @brief Runs the butterflies of the radix 2 stage, pairs of neighbours with a twiddle factor of 1.
+void FFT_Radix2(float *real, float *imaginary, size_t size)
+{
+    for (size_t i = 0; i < size; i += 2)
+    {
+        float real0 = real[i];
+        float imaginary0 = imaginary[i];
+
+        real[i] = real0 + real[i + 1];
+        imaginary[i] = imaginary0 + imaginary[i + 1];
+        real[i + 1] = real0 - real[i + 1];
+        imaginary[i + 1] = imaginary0 - imaginary[i + 1];
+    }
+}
+
+#pragma endregion Source Only
+
+FFTPlan *FFTPlan_Create(size_t size)
+{
+    DebugAssert(size > 0 && (size & (size - 1)) == 0 && size <= UINT_MAX, "FFT size %zu is not a power of 2.", size);
+
+    FFTPlan *plan = (FFTPlan *)malloc(sizeof(FFTPlan));
+    DebugAssert(plan != NULL, "Memory allocation failed.");
+
+    plan->size = size;
+
+    plan->bitReversal = (unsigned int *)malloc(size * sizeof(unsigned int));
+    DebugAssert(plan->bitReversal != NULL, "Memory allocation failed.");
+
+    size_t bitCount = 0;
+    while (((size_t)1 << bitCount) < size)
+    {
+        bitCount++;
+    }
+
+    for (size_t i = 0; i < size; i++)
+    {
+        size_t reversed = 0;
+        for (size_t bit = 0; bit < bitCount; bit++)
+        {
+            reversed |= ((i >> bit) & 1) << (bitCount - 1 - bit);
+        }
+
+        plan->bitReversal[i] = (unsigned int)reversed;
+    }
+
+    // Every radix 4 stage with a quarter q needs the twiddles W^2j, W^j and W^3j for j < q, W = e^(-2 PI i / 4q), real parts then imaginary parts.
+    // Calculated in double, so the error of a table does not grow with the size.
+    size_t twiddleCount = 0;
+    for (size_t quarter = FFT_GetFirstQuarter(size); quarter * 4 <= size; quarter *= 4)
+    {
+        twiddleCount += quarter * 6;
+    }
+
+    plan->twiddles = Simd_AllocateFloats(twiddleCount);
+
+    float *twiddles = plan->twiddles;
+    for (size_t quarter = FFT_GetFirstQuarter(size); quarter * 4 <= size; quarter *= 4)
+    {
+        for (size_t j = 0; j < quarter; j++)
+        {
+            double angle = -2.0 * 3.14159265358979323846 * (double)j / (double)(quarter * 4);
+
+            twiddles[j] = (float)cos(2.0 * angle);
+            twiddles[quarter + j] = (float)sin(2.0 * angle);
+            twiddles[quarter * 2 + j] = (float)cos(angle);
+            twiddles[quarter * 3 + j] = (float)sin(angle);
+            twiddles[quarter * 4 + j] = (float)cos(3.0 * angle);
+            twiddles[quarter * 5 + j] = (float)sin(3.0 * angle);
+        }
+
+        twiddles += quarter * 6;
+    }
+
+    return plan;
+}
+
+void FFTPlan_Destroy(FFTPlan *plan)
+{
+    DebugAssert(plan != NULL, "Null pointer passed as parameter.");
+
+    free(plan->bitReversal);
+    plan->bitReversal = NULL;
+
+    Simd_Free(plan->twiddles);
+    plan->twiddles = NULL;
+    plan->size = 0;
+
+    free(plan);
+    plan = NULL;
+}
+
+void FFT_Forward(const FFTPlan *plan, ComplexBatch *batch)
+{
+    DebugAssert(plan != NULL && batch != NULL, "Null pointer passed as parameter.");
+    DebugAssert(plan->size == batch->count, "FFT size %zu does not match the batch with %zu complex numbers.", plan->size, batch->count);
+
+    float *real = batch->real;
+    float *imaginary = batch->imaginary;
+
+    // Decimation in time, the samples are put to bit reversed order first
+    for (size_t i = 0; i < plan->size; i++)
+    {
+        size_t reversed = plan->bitReversal[i];
+        if (i < reversed)
+        {
+            float temporary = real[i];
+            real[i] = real[reversed];
+            real[reversed] = temporary;
+
+            temporary = imaginary[i];
+            imaginary[i] = imaginary[reversed];
+            imaginary[reversed] = temporary;
+        }
+    }
+
+    size_t firstQuarter = FFT_GetFirstQuarter(plan->size);
+    if (firstQuarter == 2)
+    {
+        FFT_Radix2(real, imaginary, plan->size);
+    }
+
+    const SimdKernels *kernels = Simd_GetKernels();
+    const float *twiddles = plan->twiddles;
+    for (size_t quarter = firstQuarter; quarter * 4 <= plan->size; quarter *= 4)
+    {
+        kernels->fftRadix4(real, imaginary, plan->size, quarter, twiddles);
+        twiddles += quarter * 6;
+    }
+}
+
+void FFT_Inverse(const FFTPlan *plan, ComplexBatch *batch)
+{
+    DebugAssert(plan != NULL && batch != NULL, "Null pointer passed as parameter.");
+
+    // The inverse is the conjugate of the forward transform of the conjugate, divided by the size
+    const SimdKernels *kernels = Simd_GetKernels();
+    kernels->multiply(batch->imaginary, -1.0f, batch->imaginary, batch->count);
+
+    FFT_Forward(plan, batch);
+
+    float scale = 1.0f / (float)plan->size;
+    kernels->multiply(batch->real, scale, batch->real, batch->count);
+    kernels->multiply(batch->imaginary, -scale, batch->imaginary, batch->count);
+}
+
+float FFT_GetBinFrequency(const FFTPlan *plan, size_t bin, float sampleRate)
+{
+    DebugAssert(plan != NULL, "Null pointer passed as parameter.");
+
+    return (float)bin * sampleRate / (float)plan->size;
+}
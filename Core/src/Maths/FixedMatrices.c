@@ -0,0 +1,246 @@
+#include "Maths/FixedMatrices.h"
+
+#pragma region Source Only
+
+/// @brief Dot product of two row major square matrices of a size, every element saturated once.
+void FixedMatrix_Dot(const Fixed *matrix1, const Fixed *matrix2, Fixed *result, int size)
+{
+    for (int i = 0; i < size; i++)
+        for (int j = 0; j < size; j++)
+        {
+            int64_t sum = 0;
+            for (int k = 0; k < size; k++)
+                sum += ((int64_t)matrix1[i * size + k] * matrix2[k * size + j] + FIXED_HALF) >> FIXED_FRACTION_BITS;
+            result[i * size + j] = Fixed_Saturate(sum);
+        }
+}
+
+/// @brief Multiplies a column vector of a size by a row major square matrix of the same size.
+void FixedMatrix_MultiplyVector(const Fixed *matrix, const Fixed *vector, Fixed *result, int size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        int64_t sum = 0;
+        for (int k = 0; k < size; k++)
+            sum += ((int64_t)matrix[i * size + k] * vector[k] + FIXED_HALF) >> FIXED_FRACTION_BITS;
+        result[i] = Fixed_Saturate(sum);
+    }
+}
+
+#pragma endregion Source Only
+
+#pragma region FixedMatrix2
+
+FixedMatrix2 FixedMatrix2_Identity()
+{
+    FixedMatrix2 result = {0};
+    for (int i = 0; i < 2; i++)
+        result.matrix[i][i] = FIXED_ONE;
+    return result;
+}
+
+FixedMatrix2 FixedMatrix2_FromFloat(const Matrix2 *matrix)
+{
+    FixedMatrix2 result;
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            result.matrix[i][j] = Fixed_FromFloat(matrix->matrix[i][j]);
+    return result;
+}
+
+Matrix2 FixedMatrix2_ToFloat(const FixedMatrix2 *matrix)
+{
+    Matrix2 result;
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            result.matrix[i][j] = Fixed_ToFloat(matrix->matrix[i][j]);
+    return result;
+}
+
+FixedMatrix2 FixedMatrix2_Add(const FixedMatrix2 *matrix1, const FixedMatrix2 *matrix2)
+{
+    FixedMatrix2 result;
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            result.matrix[i][j] = Fixed_Add(matrix1->matrix[i][j], matrix2->matrix[i][j]);
+    return result;
+}
+
+FixedMatrix2 FixedMatrix2_Multiply(const FixedMatrix2 *matrix, Fixed scalar)
+{
+    FixedMatrix2 result;
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            result.matrix[i][j] = Fixed_Multiply(matrix->matrix[i][j], scalar);
+    return result;
+}
+
+FixedMatrix2 FixedMatrix2_Dot(const FixedMatrix2 *matrix1, const FixedMatrix2 *matrix2)
+{
+    FixedMatrix2 result;
+    FixedMatrix_Dot(&matrix1->matrix[0][0], &matrix2->matrix[0][0], &result.matrix[0][0], 2);
+    return result;
+}
+
+FixedMatrix2 FixedMatrix2_Transpose(const FixedMatrix2 *matrix)
+{
+    FixedMatrix2 result;
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            result.matrix[i][j] = matrix->matrix[j][i];
+    return result;
+}
+
+FixedVector2 FixedMatrix2_MultiplyVector(const FixedMatrix2 *matrix, FixedVector2 vector)
+{
+    Fixed components[2] = {vector.x, vector.y};
+    Fixed result[2];
+    FixedMatrix_MultiplyVector(&matrix->matrix[0][0], components, result, 2);
+    return (FixedVector2){result[0], result[1]};
+}
+
+#pragma endregion FixedMatrix2
+
+#pragma region FixedMatrix3
+
+FixedMatrix3 FixedMatrix3_Identity()
+{
+    FixedMatrix3 result = {0};
+    for (int i = 0; i < 3; i++)
+        result.matrix[i][i] = FIXED_ONE;
+    return result;
+}
+
+FixedMatrix3 FixedMatrix3_FromFloat(const Matrix3 *matrix)
+{
+    FixedMatrix3 result;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            result.matrix[i][j] = Fixed_FromFloat(matrix->matrix[i][j]);
+    return result;
+}
+
+Matrix3 FixedMatrix3_ToFloat(const FixedMatrix3 *matrix)
+{
+    Matrix3 result;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            result.matrix[i][j] = Fixed_ToFloat(matrix->matrix[i][j]);
+    return result;
+}
+
+FixedMatrix3 FixedMatrix3_Add(const FixedMatrix3 *matrix1, const FixedMatrix3 *matrix2)
+{
+    FixedMatrix3 result;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            result.matrix[i][j] = Fixed_Add(matrix1->matrix[i][j], matrix2->matrix[i][j]);
+    return result;
+}
+
+FixedMatrix3 FixedMatrix3_Multiply(const FixedMatrix3 *matrix, Fixed scalar)
+{
+    FixedMatrix3 result;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            result.matrix[i][j] = Fixed_Multiply(matrix->matrix[i][j], scalar);
+    return result;
+}
+
+FixedMatrix3 FixedMatrix3_Dot(const FixedMatrix3 *matrix1, const FixedMatrix3 *matrix2)
+{
+    FixedMatrix3 result;
+    FixedMatrix_Dot(&matrix1->matrix[0][0], &matrix2->matrix[0][0], &result.matrix[0][0], 3);
+    return result;
+}
+
+FixedMatrix3 FixedMatrix3_Transpose(const FixedMatrix3 *matrix)
+{
+    FixedMatrix3 result;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            result.matrix[i][j] = matrix->matrix[j][i];
+    return result;
+}
+
+FixedVector3 FixedMatrix3_MultiplyVector(const FixedMatrix3 *matrix, FixedVector3 vector)
+{
+    Fixed components[3] = {vector.x, vector.y, vector.z};
+    Fixed result[3];
+    FixedMatrix_MultiplyVector(&matrix->matrix[0][0], components, result, 3);
+    return (FixedVector3){result[0], result[1], result[2]};
+}
+
+#pragma endregion FixedMatrix3
+
+#pragma region FixedMatrix4
+
+FixedMatrix4 FixedMatrix4_Identity()
+{
+    FixedMatrix4 result = {0};
+    for (int i = 0; i < 4; i++)
+        result.matrix[i][i] = FIXED_ONE;
+    return result;
+}
+
+FixedMatrix4 FixedMatrix4_FromFloat(const Matrix4 *matrix)
+{
+    FixedMatrix4 result;
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            result.matrix[i][j] = Fixed_FromFloat(matrix->matrix[i][j]);
+    return result;
+}
+
+Matrix4 FixedMatrix4_ToFloat(const FixedMatrix4 *matrix)
+{
+    Matrix4 result;
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            result.matrix[i][j] = Fixed_ToFloat(matrix->matrix[i][j]);
+    return result;
+}
+
+FixedMatrix4 FixedMatrix4_Add(const FixedMatrix4 *matrix1, const FixedMatrix4 *matrix2)
+{
+    FixedMatrix4 result;
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            result.matrix[i][j] = Fixed_Add(matrix1->matrix[i][j], matrix2->matrix[i][j]);
+    return result;
+}
+
+FixedMatrix4 FixedMatrix4_Multiply(const FixedMatrix4 *matrix, Fixed scalar)
+{
+    FixedMatrix4 result;
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            result.matrix[i][j] = Fixed_Multiply(matrix->matrix[i][j], scalar);
+    return result;
+}
+
+FixedMatrix4 FixedMatrix4_Dot(const FixedMatrix4 *matrix1, const FixedMatrix4 *matrix2)
+{
+    FixedMatrix4 result;
+    FixedMatrix_Dot(&matrix1->matrix[0][0], &matrix2->matrix[0][0], &result.matrix[0][0], 4);
+    return result;
+}
+
+FixedMatrix4 FixedMatrix4_Transpose(const FixedMatrix4 *matrix)
+{
+    FixedMatrix4 result;
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            result.matrix[i][j] = matrix->matrix[j][i];
+    return result;
+}
+
+FixedVector4 FixedMatrix4_MultiplyVector(const FixedMatrix4 *matrix, FixedVector4 vector)
+{
+    Fixed components[4] = {vector.x, vector.y, vector.z, vector.w};
+    Fixed result[4];
+    FixedMatrix_MultiplyVector(&matrix->matrix[0][0], components, result, 4);
+    return (FixedVector4){result[0], result[1], result[2], result[3]};
+}
+
+#pragma endregion FixedMatrix4
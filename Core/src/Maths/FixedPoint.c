@@ -0,0 +1,404 @@
+#include "Maths/FixedPoint.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#pragma region Source Only
+
+// sin(i / FIXED_SINE_TABLE_SIZE * PI / 2) for i in [0, FIXED_SINE_TABLE_SIZE], rounded to Q16.16. One entry more than the size, so the last step interpolates too.
+const Fixed FIXED_SINE_TABLE[FIXED_SINE_TABLE_SIZE + 1] = {
+    0, 402, 804, 1206, 1608, 2010, 2412, 2814, 3216, 3617, 4019, 4420,
+    4821, 5222, 5623, 6023, 6424, 6824, 7224, 7623, 8022, 8421, 8820, 9218,
+    9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391, 12785, 13180, 13573, 13966,
+    14359, 14751, 15143, 15534, 15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+    19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699, 22078, 22457, 22834, 23210,
+    23586, 23961, 24335, 24708, 25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+    28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538, 30893, 31248, 31600, 31952,
+    32303, 32652, 33000, 33347, 33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+    36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716, 39040, 39362, 39683, 40002,
+    40320, 40636, 40951, 41264, 41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+    44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056, 46341, 46624, 46906, 47186,
+    47464, 47741, 48015, 48288, 48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+    50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398, 52639, 52878, 53114, 53349,
+    53581, 53812, 54040, 54267, 54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+    56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607, 57798, 57986, 58172, 58356,
+    58538, 58718, 58896, 59071, 59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+    60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568, 61705, 61839, 61971, 62101,
+    62228, 62353, 62476, 62596, 62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+    63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197, 64277, 64354, 64429, 64501,
+    64571, 64639, 64704, 64766, 64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+    65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436, 65457, 65476, 65492, 65505,
+    65516, 65525, 65531, 65535, 65536,
+};
+
+// atan(i / FIXED_ARC_TANGENT_TABLE_SIZE) for i in [0, FIXED_ARC_TANGENT_TABLE_SIZE], rounded to Q16.16
+const Fixed FIXED_ARC_TANGENT_TABLE[FIXED_ARC_TANGENT_TABLE_SIZE + 1] = {
+    0, 256, 512, 768, 1024, 1280, 1536, 1792, 2047, 2303, 2559, 2814,
+    3070, 3325, 3580, 3836, 4091, 4346, 4600, 4855, 5110, 5364, 5618, 5872,
+    6126, 6380, 6633, 6887, 7140, 7392, 7645, 7898, 8150, 8402, 8653, 8905,
+    9156, 9407, 9657, 9908, 10158, 10408, 10657, 10906, 11155, 11403, 11652, 11899,
+    12147, 12394, 12641, 12887, 13133, 13379, 13624, 13869, 14114, 14358, 14601, 14845,
+    15088, 15330, 15572, 15814, 16055, 16296, 16536, 16776, 17015, 17254, 17492, 17730,
+    17968, 18205, 18441, 18677, 18913, 19148, 19382, 19616, 19850, 20083, 20315, 20547,
+    20779, 21009, 21240, 21469, 21699, 21927, 22156, 22383, 22610, 22836, 23062, 23288,
+    23512, 23737, 23960, 24183, 24406, 24627, 24849, 25069, 25289, 25509, 25727, 25946,
+    26163, 26380, 26597, 26813, 27028, 27242, 27456, 27670, 27882, 28094, 28306, 28517,
+    28727, 28936, 29145, 29354, 29561, 29768, 29975, 30180, 30386, 30590, 30794, 30997,
+    31200, 31402, 31603, 31803, 32003, 32203, 32401, 32600, 32797, 32994, 33190, 33385,
+    33580, 33774, 33968, 34160, 34353, 34544, 34735, 34925, 35115, 35304, 35492, 35680,
+    35867, 36053, 36239, 36424, 36608, 36792, 36975, 37158, 37340, 37521, 37701, 37881,
+    38060, 38239, 38417, 38594, 38771, 38947, 39123, 39297, 39472, 39645, 39818, 39990,
+    40162, 40333, 40503, 40673, 40842, 41010, 41178, 41346, 41512, 41678, 41844, 42008,
+    42172, 42336, 42499, 42661, 42823, 42984, 43145, 43304, 43464, 43622, 43780, 43938,
+    44095, 44251, 44407, 44562, 44716, 44870, 45024, 45176, 45328, 45480, 45631, 45781,
+    45931, 46080, 46229, 46377, 46525, 46672, 46818, 46964, 47109, 47254, 47398, 47542,
+    47685, 47827, 47969, 48111, 48251, 48392, 48531, 48671, 48809, 48947, 49085, 49222,
+    49359, 49495, 49630, 49765, 49899, 50033, 50167, 50299, 50432, 50563, 50695, 50826,
+    50956, 51086, 51215, 51344, 51472,
+};
+
+// Angles are reduced to phases, a full turn is 2^32, so the wrap around is the unsigned overflow. Scales are Q16 multipliers of Q16.16 angles.
+#define FIXED_PHASE_PER_RADIAN 683565276LL // 2^32 / (2 * PI) / 2^16, Q16
+#define FIXED_PHASE_PER_DEGREE 11930465LL  // 2^32 / 360 / 2^16, Q16
+#define FIXED_QUARTER_PHASE 0x40000000u
+#define FIXED_RADIAN_PER_DEGREE 74961321LL // PI / 180, Q32
+#define FIXED_DEGREE_PER_RADIAN 3754936LL  // 180 / PI, Q16
+
+// A phase in a quarter turn has 30 bits, the top 8 select the table entry and the other 22 interpolate
+#define FIXED_SINE_FRACTION_BITS 22
+#define FIXED_ARC_TANGENT_FRACTION_BITS 22
+
+/// @brief Clamps a 32 bit intermediate to the Q1.15 range.
+Fixed15 Fixed15_Saturate(int32_t value)
+{
+    if (value > FIXED15_MAX)
+        return FIXED15_MAX;
+    if (value < FIXED15_MIN)
+        return FIXED15_MIN;
+    return (Fixed15)value;
+}
+
+/// @brief Interpolates between two neighbour entries of a table.
+/// @param table The table.
+/// @param position Position in the table, the entry index above fractionBits and the fraction below.
+/// @param fractionBits Count of the fraction bits of the position.
+Fixed Fixed_Interpolate(const Fixed *table, uint32_t position, int fractionBits)
+{
+    uint32_t index = position >> fractionBits;
+    int64_t fraction = (int64_t)(position & ((1u << fractionBits) - 1));
+
+    Fixed value = table[index];
+    if (fraction == 0)
+    {
+        return value; // also the last entry, which has no neighbour after it
+    }
+
+    return value + (Fixed)(((int64_t)(table[index + 1] - value) * fraction + ((int64_t)1 << (fractionBits - 1))) >> fractionBits);
+}
+
+/// @brief Gets the sine of a phase, a full turn is 2^32.
+Fixed Fixed_SinPhase(uint32_t phase)
+{
+    uint32_t quadrant = phase >> 30;
+    uint32_t position = phase & (FIXED_QUARTER_PHASE - 1);
+
+    // The second and the fourth quadrants mirror the table, the third and the fourth negate it
+    if (quadrant & 1)
+    {
+        position = FIXED_QUARTER_PHASE - position;
+    }
+
+    Fixed sine = Fixed_Interpolate(FIXED_SINE_TABLE, position, FIXED_SINE_FRACTION_BITS);
+    return quadrant & 2 ? -sine : sine;
+}
+
+/// @brief Converts a Q16.16 radian value to a phase.
+uint32_t Fixed_RadianToPhase(Fixed radian)
+{
+    // Conversion to unsigned keeps the value modulo 2^32, the full turns drop out
+    return (uint32_t)(((int64_t)radian * FIXED_PHASE_PER_RADIAN + FIXED_HALF) >> 16);
+}
+
+/// @brief Finds the highest bit set in a value, a single instruction where the compiler offers one.
+/// @param value Value to search, cannot be 0.
+/// @return Index of the highest bit set, 0 for the lowest bit.
+int Fixed_HighestBit(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return (int)index;
+#else
+    int index = 0;
+    while (value >>= 1)
+    {
+        index++;
+    }
+    return index;
+#endif
+}
+
+#pragma endregion Source Only
+
+#pragma region Fixed
+
+Fixed Fixed_Saturate(int64_t value)
+{
+    if (value > FIXED_MAX)
+        return FIXED_MAX;
+    if (value < FIXED_MIN)
+        return FIXED_MIN;
+    return (Fixed)value;
+}
+
+Fixed Fixed_FromFloat(float value)
+{
+    if (value != value)
+        return 0; // NaN
+    if (value >= 32768.0f)
+        return FIXED_MAX;
+    if (value <= -32768.0f)
+        return FIXED_MIN;
+    return Fixed_Saturate((int64_t)(value * 65536.0f + (value < 0.0f ? -0.5f : 0.5f)));
+}
+
+float Fixed_ToFloat(Fixed value)
+{
+    return (float)value * (1.0f / 65536.0f);
+}
+
+Fixed Fixed_FromInt(int value)
+{
+    return Fixed_Saturate((int64_t)value * FIXED_ONE);
+}
+
+int Fixed_ToInt(Fixed value)
+{
+    return (int)(((int64_t)value + FIXED_HALF) >> FIXED_FRACTION_BITS);
+}
+
+Fixed Fixed_Add(Fixed a, Fixed b)
+{
+    return Fixed_Saturate((int64_t)a + b);
+}
+
+Fixed Fixed_Subtract(Fixed a, Fixed b)
+{
+    return Fixed_Saturate((int64_t)a - b);
+}
+
+Fixed Fixed_Multiply(Fixed a, Fixed b)
+{
+    return Fixed_Saturate(((int64_t)a * b + FIXED_HALF) >> FIXED_FRACTION_BITS);
+}
+
+Fixed Fixed_Divide(Fixed a, Fixed b)
+{
+    if (b == 0)
+    {
+        return a > 0 ? FIXED_MAX : (a < 0 ? FIXED_MIN : 0);
+    }
+
+    return Fixed_Saturate((int64_t)a * FIXED_ONE / b);
+}
+
+Fixed Fixed_Abs(Fixed value)
+{
+    return value < 0 ? Fixed_Saturate(-(int64_t)value) : value;
+}
+
+Fixed Fixed_SquareRoot(Fixed value)
+{
+    if (value <= 0)
+    {
+        return 0;
+    }
+
+    // sqrt(value / 2^16) * 2^16 is sqrt(value * 2^16)
+    return (Fixed)Fixed_IntegerSquareRoot((uint64_t)value << FIXED_FRACTION_BITS);
+}
+
+uint32_t Fixed_IntegerSquareRoot(uint64_t value)
+{
+    if (value == 0)
+    {
+        return 0;
+    }
+
+    // Digit by digit, two bits of the value per bit of the root, from the highest even bit set in the value
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t)1 << (Fixed_HighestBit(value) & ~1);
+
+    // Without branches, the outcome of a step is a coin flip the branch predictor cannot learn
+    while (bit != 0)
+    {
+        uint64_t trial = root + bit;
+        uint64_t mask = (uint64_t)0 - (uint64_t)(value >= trial);
+
+        value -= trial & mask;
+        root = (root >> 1) + (bit & mask);
+        bit >>= 2;
+    }
+
+    return (uint32_t)root;
+}
+
+Fixed Fixed_Lerp(Fixed startValue, Fixed endValue, Fixed time)
+{
+    int64_t difference = (int64_t)endValue - startValue;
+    return Fixed_Saturate(startValue + ((difference * time + FIXED_HALF) >> FIXED_FRACTION_BITS));
+}
+
+#pragma endregion Fixed
+
+#pragma region Fixed15
+
+Fixed15 Fixed15_FromFloat(float value)
+{
+    if (value != value)
+        return 0; // NaN
+    if (value >= 1.0f)
+        return FIXED15_MAX;
+    if (value <= -1.0f)
+        return FIXED15_MIN;
+    return Fixed15_Saturate((int32_t)(value * 32768.0f + (value < 0.0f ? -0.5f : 0.5f)));
+}
+
+float Fixed15_ToFloat(Fixed15 value)
+{
+    return (float)value * (1.0f / 32768.0f);
+}
+
+Fixed15 Fixed15_FromFixed(Fixed value)
+{
+    int64_t shifted = ((int64_t)value + 1) >> (FIXED_FRACTION_BITS - FIXED15_FRACTION_BITS);
+    if (shifted > FIXED15_MAX)
+        return FIXED15_MAX;
+    if (shifted < FIXED15_MIN)
+        return FIXED15_MIN;
+    return (Fixed15)shifted;
+}
+
+Fixed Fixed15_ToFixed(Fixed15 value)
+{
+    return (Fixed)value * (1 << (FIXED_FRACTION_BITS - FIXED15_FRACTION_BITS));
+}
+
+Fixed15 Fixed15_Add(Fixed15 a, Fixed15 b)
+{
+    return Fixed15_Saturate((int32_t)a + b);
+}
+
+Fixed15 Fixed15_Subtract(Fixed15 a, Fixed15 b)
+{
+    return Fixed15_Saturate((int32_t)a - b);
+}
+
+Fixed15 Fixed15_Multiply(Fixed15 a, Fixed15 b)
+{
+    return Fixed15_Saturate(((int32_t)a * b + (1 << (FIXED15_FRACTION_BITS - 1))) >> FIXED15_FRACTION_BITS);
+}
+
+Fixed Fixed15_DotArray(const Fixed15 *values, const Fixed15 *coefficients, size_t count)
+{
+    DebugAssert(values != NULL && coefficients != NULL, "Null pointer passed as parameter.");
+
+    // Products are Q2.30, 2^33 of them fit the accumulator
+    int64_t sum = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        sum += (int32_t)values[i] * coefficients[i];
+    }
+
+    int shift = FIXED15_FRACTION_BITS * 2 - FIXED_FRACTION_BITS;
+    return Fixed_Saturate((sum + ((int64_t)1 << (shift - 1))) >> shift);
+}
+
+#pragma endregion Fixed15
+
+#pragma region Trigonometry
+
+Fixed Fixed_Deg2Rad(Fixed degree)
+{
+    return (Fixed)(((int64_t)degree * FIXED_RADIAN_PER_DEGREE + ((int64_t)1 << 31)) >> 32);
+}
+
+Fixed Fixed_Rad2Deg(Fixed radian)
+{
+    return Fixed_Saturate(((int64_t)radian * FIXED_DEGREE_PER_RADIAN + FIXED_HALF) >> FIXED_FRACTION_BITS);
+}
+
+Fixed Fixed_SinRad(Fixed radian)
+{
+    return Fixed_SinPhase(Fixed_RadianToPhase(radian));
+}
+
+Fixed Fixed_CosRad(Fixed radian)
+{
+    return Fixed_SinPhase(Fixed_RadianToPhase(radian) + FIXED_QUARTER_PHASE);
+}
+
+void Fixed_SinCosRad(Fixed radian, Fixed *sine, Fixed *cosine)
+{
+    DebugAssert(sine != NULL && cosine != NULL, "Null pointer passed as parameter.");
+
+    uint32_t phase = Fixed_RadianToPhase(radian);
+    *sine = Fixed_SinPhase(phase);
+    *cosine = Fixed_SinPhase(phase + FIXED_QUARTER_PHASE);
+}
+
+Fixed Fixed_SinDeg(Fixed degree)
+{
+    // Straight to the phase, through radians would lose the resolution of large degree values
+    return Fixed_SinPhase((uint32_t)(((int64_t)degree * FIXED_PHASE_PER_DEGREE) >> 16));
+}
+
+Fixed Fixed_CosDeg(Fixed degree)
+{
+    return Fixed_SinPhase((uint32_t)(((int64_t)degree * FIXED_PHASE_PER_DEGREE) >> 16) + FIXED_QUARTER_PHASE);
+}
+
+Fixed Fixed_TanRad(Fixed radian)
+{
+    Fixed sine;
+    Fixed cosine;
+    Fixed_SinCosRad(radian, &sine, &cosine);
+
+    return Fixed_Divide(sine, cosine);
+}
+
+Fixed Fixed_ArcTan2Rad(Fixed y, Fixed x)
+{
+    // 64 bit absolute values, FIXED_MIN has no 32 bit one
+    int64_t absoluteX = x < 0 ? -(int64_t)x : x;
+    int64_t absoluteY = y < 0 ? -(int64_t)y : y;
+    if (absoluteX == 0 && absoluteY == 0)
+    {
+        return 0;
+    }
+
+    // Ratio of the smaller to the larger in [0, 1] with 30 fraction bits, the angle of the first octant from the table
+    Fixed angle;
+    if (absoluteY <= absoluteX)
+    {
+        uint32_t ratio = (uint32_t)((absoluteY << 30) / absoluteX);
+        angle = Fixed_Interpolate(FIXED_ARC_TANGENT_TABLE, ratio, FIXED_ARC_TANGENT_FRACTION_BITS);
+    }
+    else
+    {
+        uint32_t ratio = (uint32_t)((absoluteX << 30) / absoluteY);
+        angle = FIXED_HALF_PI - Fixed_Interpolate(FIXED_ARC_TANGENT_TABLE, ratio, FIXED_ARC_TANGENT_FRACTION_BITS);
+    }
+
+    if (x < 0)
+    {
+        angle = FIXED_PI - angle;
+    }
+
+    return y < 0 ? -angle : angle;
+}
+
+#pragma endregion Trigonometry
@@ -0,0 +1,186 @@
+#include "Maths/FixedVectors.h"
+
+#pragma region Source Only
+
+/// @brief Gets the square of a component as Q32.32. FIXED_MIN is taken as FIXED_MAX, so four squares fit 64 bits.
+uint64_t FixedVector_Square(Fixed value)
+{
+    uint64_t absolute = value < 0 ? (uint64_t)(value == FIXED_MIN ? FIXED_MAX : -value) : (uint64_t)value;
+    return absolute * absolute;
+}
+
+/// @brief Gets the reciprocal of a magnitude as Q32.32, so a normalization is a single division and a multiplication per component.
+int64_t FixedVector_Reciprocal(Fixed magnitude)
+{
+    return ((int64_t)1 << 48) / magnitude;
+}
+
+/// @brief Multiplies a component by a Q32.32 reciprocal, rounded to Q16.16. Components of a normalized vector are within [-1, 1].
+Fixed FixedVector_Scale(Fixed value, int64_t reciprocal)
+{
+    return (Fixed)(((int64_t)value * reciprocal + ((int64_t)1 << 31)) >> 32);
+}
+
+/// @brief Gets a product rounded to Q16.16 but not saturated, so a dot product saturates only once.
+int64_t FixedVector_Product(Fixed a, Fixed b)
+{
+    return ((int64_t)a * b + FIXED_HALF) >> FIXED_FRACTION_BITS;
+}
+
+#pragma endregion Source Only
+
+#pragma region FixedVector2
+
+FixedVector2 FixedVector2_FromFloat(Vector2 vector)
+{
+    return (FixedVector2){Fixed_FromFloat(vector.x), Fixed_FromFloat(vector.y)};
+}
+
+Vector2 FixedVector2_ToFloat(FixedVector2 vector)
+{
+    return (Vector2){Fixed_ToFloat(vector.x), Fixed_ToFloat(vector.y)};
+}
+
+FixedVector2 FixedVector2_Add(FixedVector2 vector1, FixedVector2 vector2)
+{
+    return (FixedVector2){Fixed_Add(vector1.x, vector2.x), Fixed_Add(vector1.y, vector2.y)};
+}
+
+FixedVector2 FixedVector2_Multiply(FixedVector2 vector, Fixed scalar)
+{
+    return (FixedVector2){Fixed_Multiply(vector.x, scalar), Fixed_Multiply(vector.y, scalar)};
+}
+
+FixedVector2 FixedVector2_Normalized(FixedVector2 vector)
+{
+    Fixed magnitude = FixedVector2_Magnitude(vector);
+    if (magnitude == 0)
+        return (FixedVector2){0};
+
+    int64_t reciprocal = FixedVector_Reciprocal(magnitude);
+    return (FixedVector2){FixedVector_Scale(vector.x, reciprocal), FixedVector_Scale(vector.y, reciprocal)};
+}
+
+Fixed FixedVector2_Magnitude(FixedVector2 vector)
+{
+    return Fixed_Saturate(Fixed_IntegerSquareRoot(FixedVector_Square(vector.x) + FixedVector_Square(vector.y)));
+}
+
+Fixed FixedVector2_Dot(FixedVector2 vector1, FixedVector2 vector2)
+{
+    return Fixed_Saturate(FixedVector_Product(vector1.x, vector2.x) + FixedVector_Product(vector1.y, vector2.y));
+}
+
+FixedVector2 FixedVector2_Lerp(FixedVector2 startVector, FixedVector2 endVector, Fixed time)
+{
+    return (FixedVector2){
+        Fixed_Lerp(startVector.x, endVector.x, time),
+        Fixed_Lerp(startVector.y, endVector.y, time)};
+}
+
+#pragma endregion FixedVector2
+
+#pragma region FixedVector3
+
+FixedVector3 FixedVector3_FromFloat(Vector3 vector)
+{
+    return (FixedVector3){Fixed_FromFloat(vector.x), Fixed_FromFloat(vector.y), Fixed_FromFloat(vector.z)};
+}
+
+Vector3 FixedVector3_ToFloat(FixedVector3 vector)
+{
+    return (Vector3){Fixed_ToFloat(vector.x), Fixed_ToFloat(vector.y), Fixed_ToFloat(vector.z)};
+}
+
+FixedVector3 FixedVector3_Add(FixedVector3 vector1, FixedVector3 vector2)
+{
+    return (FixedVector3){Fixed_Add(vector1.x, vector2.x), Fixed_Add(vector1.y, vector2.y), Fixed_Add(vector1.z, vector2.z)};
+}
+
+FixedVector3 FixedVector3_Multiply(FixedVector3 vector, Fixed scalar)
+{
+    return (FixedVector3){Fixed_Multiply(vector.x, scalar), Fixed_Multiply(vector.y, scalar), Fixed_Multiply(vector.z, scalar)};
+}
+
+FixedVector3 FixedVector3_Normalized(FixedVector3 vector)
+{
+    Fixed magnitude = FixedVector3_Magnitude(vector);
+    if (magnitude == 0)
+        return (FixedVector3){0};
+
+    int64_t reciprocal = FixedVector_Reciprocal(magnitude);
+    return (FixedVector3){FixedVector_Scale(vector.x, reciprocal), FixedVector_Scale(vector.y, reciprocal), FixedVector_Scale(vector.z, reciprocal)};
+}
+
+Fixed FixedVector3_Magnitude(FixedVector3 vector)
+{
+    return Fixed_Saturate(Fixed_IntegerSquareRoot(FixedVector_Square(vector.x) + FixedVector_Square(vector.y) + FixedVector_Square(vector.z)));
+}
+
+Fixed FixedVector3_Dot(FixedVector3 vector1, FixedVector3 vector2)
+{
+    return Fixed_Saturate(FixedVector_Product(vector1.x, vector2.x) + FixedVector_Product(vector1.y, vector2.y) + FixedVector_Product(vector1.z, vector2.z));
+}
+
+FixedVector3 FixedVector3_Lerp(FixedVector3 startVector, FixedVector3 endVector, Fixed time)
+{
+    return (FixedVector3){
+        Fixed_Lerp(startVector.x, endVector.x, time),
+        Fixed_Lerp(startVector.y, endVector.y, time),
+        Fixed_Lerp(startVector.z, endVector.z, time)};
+}
+
+#pragma endregion FixedVector3
+
+#pragma region FixedVector4
+
+FixedVector4 FixedVector4_FromFloat(Vector4 vector)
+{
+    return (FixedVector4){Fixed_FromFloat(vector.x), Fixed_FromFloat(vector.y), Fixed_FromFloat(vector.z), Fixed_FromFloat(vector.w)};
+}
+
+Vector4 FixedVector4_ToFloat(FixedVector4 vector)
+{
+    return (Vector4){Fixed_ToFloat(vector.x), Fixed_ToFloat(vector.y), Fixed_ToFloat(vector.z), Fixed_ToFloat(vector.w)};
+}
+
+FixedVector4 FixedVector4_Add(FixedVector4 vector1, FixedVector4 vector2)
+{
+    return (FixedVector4){Fixed_Add(vector1.x, vector2.x), Fixed_Add(vector1.y, vector2.y), Fixed_Add(vector1.z, vector2.z), Fixed_Add(vector1.w, vector2.w)};
+}
+
+FixedVector4 FixedVector4_Multiply(FixedVector4 vector, Fixed scalar)
+{
+    return (FixedVector4){Fixed_Multiply(vector.x, scalar), Fixed_Multiply(vector.y, scalar), Fixed_Multiply(vector.z, scalar), Fixed_Multiply(vector.w, scalar)};
+}
+
+FixedVector4 FixedVector4_Normalized(FixedVector4 vector)
+{
+    Fixed magnitude = FixedVector4_Magnitude(vector);
+    if (magnitude == 0)
+        return (FixedVector4){0};
+
+    int64_t reciprocal = FixedVector_Reciprocal(magnitude);
+    return (FixedVector4){FixedVector_Scale(vector.x, reciprocal), FixedVector_Scale(vector.y, reciprocal), FixedVector_Scale(vector.z, reciprocal), FixedVector_Scale(vector.w, reciprocal)};
+}
+
+Fixed FixedVector4_Magnitude(FixedVector4 vector)
+{
+    return Fixed_Saturate(Fixed_IntegerSquareRoot(FixedVector_Square(vector.x) + FixedVector_Square(vector.y) + FixedVector_Square(vector.z) + FixedVector_Square(vector.w)));
+}
+
+Fixed FixedVector4_Dot(FixedVector4 vector1, FixedVector4 vector2)
+{
+    return Fixed_Saturate(FixedVector_Product(vector1.x, vector2.x) + FixedVector_Product(vector1.y, vector2.y) + FixedVector_Product(vector1.z, vector2.z) + FixedVector_Product(vector1.w, vector2.w));
+}
+
+FixedVector4 FixedVector4_Lerp(FixedVector4 startVector, FixedVector4 endVector, Fixed time)
+{
+    return (FixedVector4){
+        Fixed_Lerp(startVector.x, endVector.x, time),
+        Fixed_Lerp(startVector.y, endVector.y, time),
+        Fixed_Lerp(startVector.z, endVector.z, time),
+        Fixed_Lerp(startVector.w, endVector.w, time)};
+}
+
+#pragma endregion FixedVector4
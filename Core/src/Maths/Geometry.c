@@ -1 +1,307 @@
 #include "Maths/Geometry.h"
+#include "Maths/Algebra.h"
+
+#include <float.h>
+
+#pragma region Source Only
+
+/// @brief Clips the parameter range [entry, exit] of a line to the slab of one axis of a box.
+void Geometry_ClipSlab(float origin, float direction, float min, float max, float *entry, float *exit)
+{
+    // Parallel to the slab, inside it for the whole line or never, 0 * infinity would give NaN for an origin on a face
+    if (direction == 0.0f)
+    {
+        if (origin < min || origin > max)
+        {
+            *entry = FLT_MAX;
+            *exit = -FLT_MAX;
+        }
+        return;
+    }
+
+    float inverse = 1.0f / direction;
+    float t1 = (min - origin) * inverse;
+    float t2 = (max - origin) * inverse;
+
+    float entering = t1 < t2 ? t1 : t2;
+    float leaving = t1 < t2 ? t2 : t1;
+
+    *entry = entering > *entry ? entering : *entry;
+    *exit = leaving < *exit ? leaving : *exit;
+}
+
+/// @brief Clips the parameter range [entry, exit] of a line to a box, shared by the ray and the segment tests.
+bool Geometry_ClipAABB(Vector3 origin, Vector3 direction, AABB box, float *entry, float *exit)
+{
+    Geometry_ClipSlab(origin.x, direction.x, box.min.x, box.max.x, entry, exit);
+    Geometry_ClipSlab(origin.y, direction.y, box.min.y, box.max.y, entry, exit);
+    Geometry_ClipSlab(origin.z, direction.z, box.min.z, box.max.z, entry, exit);
+
+    return *entry <= *exit;
+}
+
+/// @brief Intersects a line with a sphere, shared by the ray and the segment tests.
+/// @return The parameter of the first hit at or after 0, 0 for an origin inside the sphere, or a negative value for no hit.
+float Geometry_LineSphere(Vector3 origin, Vector3 direction, Sphere sphere)
+{
+    Vector3 offset = {origin.x - sphere.center.x, origin.y - sphere.center.y, origin.z - sphere.center.z};
+    float c = Vector3_Dot(offset, offset) - sphere.radius * sphere.radius;
+    if (c <= 0.0f)
+    {
+        return 0.0f;
+    }
+
+    // The origin is outside and the line points away from the center
+    float b = Vector3_Dot(offset, direction);
+    if (b > 0.0f)
+    {
+        return -1.0f;
+    }
+
+    float a = Vector3_Dot(direction, direction);
+    float discriminant = b * b - a * c;
+    if (discriminant < 0.0f || a == 0.0f)
+    {
+        return -1.0f;
+    }
+
+    return (-b - SquareRoot(discriminant)) / a;
+}
+
+#pragma endregion Source Only
+
+float PerimeterOfCircle(float radius)
+{
+    return 2.0f * PI * radius;
+}
+
+float AreaOfCircle(float radius)
+{
+    return PI * radius * radius;
+}
+
+float SurfaceAreaOfSphere(float radius)
+{
+    return 4.0f * PI * radius * radius;
+}
+
+float VolumeOfSphere(float radius)
+{
+    return 4.0f / 3.0f * PI * radius * radius * radius;
+}
+
+#pragma region AABB
+
+AABB AABB_Empty()
+{
+    return (AABB){{FLT_MAX, FLT_MAX, FLT_MAX}, {-FLT_MAX, -FLT_MAX, -FLT_MAX}};
+}
+
+AABB AABB_FromPoints(const Vector3 *points, size_t count)
+{
+    DebugAssert(points != NULL || count == 0, "Null pointer passed as parameter.");
+
+    AABB box = AABB_Empty();
+    for (size_t i = 0; i < count; i++)
+    {
+        box = AABB_Expand(box, points[i]);
+    }
+
+    return box;
+}
+
+AABB AABB_Expand(AABB box, Vector3 point)
+{
+    box.min.x = point.x < box.min.x ? point.x : box.min.x;
+    box.min.y = point.y < box.min.y ? point.y : box.min.y;
+    box.min.z = point.z < box.min.z ? point.z : box.min.z;
+    box.max.x = point.x > box.max.x ? point.x : box.max.x;
+    box.max.y = point.y > box.max.y ? point.y : box.max.y;
+    box.max.z = point.z > box.max.z ? point.z : box.max.z;
+
+    return box;
+}
+
+AABB AABB_Merge(AABB box1, AABB box2)
+{
+    box1 = AABB_Expand(box1, box2.min);
+    return AABB_Expand(box1, box2.max);
+}
+
+bool AABB_IsEmpty(AABB box)
+{
+    return box.min.x > box.max.x || box.min.y > box.max.y || box.min.z > box.max.z;
+}
+
+Vector3 AABB_Center(AABB box)
+{
+    return (Vector3){(box.min.x + box.max.x) * 0.5f, (box.min.y + box.max.y) * 0.5f, (box.min.z + box.max.z) * 0.5f};
+}
+
+float AABB_SurfaceArea(AABB box)
+{
+    if (AABB_IsEmpty(box))
+    {
+        return 0.0f;
+    }
+
+    float x = box.max.x - box.min.x;
+    float y = box.max.y - box.min.y;
+    float z = box.max.z - box.min.z;
+
+    return 2.0f * (x * y + y * z + z * x);
+}
+
+bool AABB_ContainsPoint(AABB box, Vector3 point)
+{
+    return point.x >= box.min.x && point.x <= box.max.x &&
+           point.y >= box.min.y && point.y <= box.max.y &&
+           point.z >= box.min.z && point.z <= box.max.z;
+}
+
+bool AABB_Intersects(AABB box1, AABB box2)
+{
+    return box1.min.x <= box2.max.x && box2.min.x <= box1.max.x &&
+           box1.min.y <= box2.max.y && box2.min.y <= box1.max.y &&
+           box1.min.z <= box2.max.z && box2.min.z <= box1.max.z;
+}
+
+float AABB_SquaredDistance(AABB box, Vector3 point)
+{
+    // Per axis the distance outside the box, 0 inside it
+    float x = box.min.x - point.x > point.x - box.max.x ? box.min.x - point.x : point.x - box.max.x;
+    float y = box.min.y - point.y > point.y - box.max.y ? box.min.y - point.y : point.y - box.max.y;
+    float z = box.min.z - point.z > point.z - box.max.z ? box.min.z - point.z : point.z - box.max.z;
+    x = x > 0.0f ? x : 0.0f;
+    y = y > 0.0f ? y : 0.0f;
+    z = z > 0.0f ? z : 0.0f;
+
+    return x * x + y * y + z * z;
+}
+
+#pragma endregion AABB
+
+#pragma region Sphere
+
+bool Sphere_ContainsPoint(Sphere sphere, Vector3 point)
+{
+    Vector3 offset = {point.x - sphere.center.x, point.y - sphere.center.y, point.z - sphere.center.z};
+    return Vector3_Dot(offset, offset) <= sphere.radius * sphere.radius;
+}
+
+bool Sphere_Intersects(Sphere sphere1, Sphere sphere2)
+{
+    Vector3 offset = {sphere2.center.x - sphere1.center.x, sphere2.center.y - sphere1.center.y, sphere2.center.z - sphere1.center.z};
+    float radius = sphere1.radius + sphere2.radius;
+    return Vector3_Dot(offset, offset) <= radius * radius;
+}
+
+bool Sphere_IntersectsAABB(Sphere sphere, AABB box)
+{
+    return AABB_SquaredDistance(box, sphere.center) <= sphere.radius * sphere.radius;
+}
+
+#pragma endregion Sphere
+
+#pragma region Ray
+
+Vector3 Ray_At(Ray ray, float distance)
+{
+    return (Vector3){
+        ray.origin.x + ray.direction.x * distance,
+        ray.origin.y + ray.direction.y * distance,
+        ray.origin.z + ray.direction.z * distance};
+}
+
+bool Ray_IntersectAABB(Ray ray, AABB box, float *distance)
+{
+    float entry = 0.0f, exit = FLT_MAX;
+    if (!Geometry_ClipAABB(ray.origin, ray.direction, box, &entry, &exit))
+    {
+        return false;
+    }
+
+    if (distance != NULL)
+    {
+        *distance = entry;
+    }
+    return true;
+}
+
+bool Ray_IntersectSphere(Ray ray, Sphere sphere, float *distance)
+{
+    float hit = Geometry_LineSphere(ray.origin, ray.direction, sphere);
+    if (hit < 0.0f)
+    {
+        return false;
+    }
+
+    if (distance != NULL)
+    {
+        *distance = hit;
+    }
+    return true;
+}
+
+#pragma endregion Ray
+
+#pragma region Segment
+
+Vector3 Segment_ClosestPoint(Segment segment, Vector3 point)
+{
+    Vector3 direction = {segment.end.x - segment.start.x, segment.end.y - segment.start.y, segment.end.z - segment.start.z};
+    Vector3 offset = {point.x - segment.start.x, point.y - segment.start.y, point.z - segment.start.z};
+
+    float squaredLength = Vector3_Dot(direction, direction);
+    float fraction = squaredLength > 0.0f ? Vector3_Dot(offset, direction) / squaredLength : 0.0f;
+    fraction = fraction < 0.0f ? 0.0f : (fraction > 1.0f ? 1.0f : fraction);
+
+    return (Vector3){
+        segment.start.x + direction.x * fraction,
+        segment.start.y + direction.y * fraction,
+        segment.start.z + direction.z * fraction};
+}
+
+float Segment_SquaredDistance(Segment segment, Vector3 point)
+{
+    Vector3 closest = Segment_ClosestPoint(segment, point);
+    Vector3 offset = {point.x - closest.x, point.y - closest.y, point.z - closest.z};
+
+    return Vector3_Dot(offset, offset);
+}
+
+bool Segment_IntersectAABB(Segment segment, AABB box, float *fraction)
+{
+    Vector3 direction = {segment.end.x - segment.start.x, segment.end.y - segment.start.y, segment.end.z - segment.start.z};
+
+    float entry = 0.0f, exit = 1.0f;
+    if (!Geometry_ClipAABB(segment.start, direction, box, &entry, &exit))
+    {
+        return false;
+    }
+
+    if (fraction != NULL)
+    {
+        *fraction = entry;
+    }
+    return true;
+}
+
+bool Segment_IntersectSphere(Segment segment, Sphere sphere, float *fraction)
+{
+    Vector3 direction = {segment.end.x - segment.start.x, segment.end.y - segment.start.y, segment.end.z - segment.start.z};
+
+    float hit = Geometry_LineSphere(segment.start, direction, sphere);
+    if (hit < 0.0f || hit > 1.0f)
+    {
+        return false;
+    }
+
+    if (fraction != NULL)
+    {
+        *fraction = hit;
+    }
+    return true;
+}
+
+#pragma endregion Segment
@@ -1,5 +1,7 @@
 #include "Maths/Matrices.h"
 
+#include "Maths/Simd.h"
+
 #include <math.h>
 
 #pragma region Matrix2
@@ -185,11 +187,8 @@ Matrix4 Matrix4_Multiply(const Matrix4 *matrix, float scalar)
 
 Matrix4 Matrix4_Dot(const Matrix4 *matrix1, const Matrix4 *matrix2)
 {
-    Matrix4 result = {0};
-    for (int i = 0; i < 4; i++)
-        for (int j = 0; j < 4; j++)
-            for (int k = 0; k < 4; k++)
-                result.matrix[i][j] += matrix1->matrix[i][k] * matrix2->matrix[k][j];
+    Matrix4 result;
+    Simd_GetKernels()->matrix4Dot(&matrix1->matrix[0][0], &matrix2->matrix[0][0], &result.matrix[0][0]);
     return result;
 }
 
@@ -204,9 +203,10 @@ Matrix4 Matrix4_Transpose(const Matrix4 *matrix)
 
 Matrix4 Matrix4_Inverse(const Matrix4 *matrix)
 {
-    // Placeholder for 4x4 matrix inversion. This is a complex operation.
-    // TODO: Implement proper inversion logic.
-    return *matrix;
+    Matrix4 result;
+    if (!Simd_GetKernels()->matrix4Inverse(&matrix->matrix[0][0], &result.matrix[0][0]))
+        return (Matrix4){0}; // No inverse exists
+    return result;
 }
 
 Matrix4 Matrix4_Scale(const Matrix4 *matrix, float scaleX, float scaleY, float scaleZ)
@@ -0,0 +1,492 @@
+#include "Maths/MatrixN.h"
+#include "Maths/Algebra.h"
+#include "Maths/Arithmetic.h"
+
+#pragma region Source Only
+
+// Blocks of the product, sized for the caches. A packed block of the right matrix is 256 x 256 floats, 256 KB, kept in the L2 cache
+// while every block of rows of the left matrix goes over it, and a panel of it is 16 KB, kept in the L1 cache by the kernel.
+#define MATRIX_N_BLOCK_DEPTH 256
+#define MATRIX_N_BLOCK_COLUMNS 256
+#define MATRIX_N_BLOCK_ROWS 64 // rows of the left matrix per task of the worker pool
+
+// Multiply-adds below which a product runs on the calling thread, waking the threads up costs more than they save
+#define MATRIX_N_PARALLEL_MIN_WORK (128 * 128 * 128)
+
+/// @brief Block of the product run by MatrixN_DotBlock, a packed block of the right matrix and where it goes.
+typedef struct MatrixNDotBlock
+{
+    const SimdKernels *kernels;
+    const MatrixN *left;
+    MatrixN *result;
+    const float *packedRight;
+    size_t depthStart; // first column of the left matrix, first row of the right one
+    size_t depth;
+    size_t columnStart; // first column of the right matrix and of the result
+    size_t columns;
+} MatrixNDotBlock;
+
+/// @brief Gets the stride of a created matrix, rounded up to whole registers so every row starts aligned.
+size_t MatrixN_GetStride(size_t columns)
+{
+    size_t floatsPerAlignment = SIMD_ALIGNMENT / sizeof(float);
+    return (columns + floatsPerAlignment - 1) / floatsPerAlignment * floatsPerAlignment;
+}
+
+/// @brief Copies a block of the right matrix into panels of SIMD_GEMM_PANEL columns, the layout of the matrixDotAdd kernel.
+void MatrixN_PackPanels(const MatrixN *right, size_t row, size_t column, size_t depth, size_t columns, float *packed)
+{
+    for (size_t j = 0; j < columns; j += SIMD_GEMM_PANEL)
+    {
+        float *panel = packed + j * depth;
+        size_t width = columns - j < SIMD_GEMM_PANEL ? columns - j : SIMD_GEMM_PANEL;
+
+        const float *source = right->data + row * right->stride + column + j;
+        for (size_t k = 0; k < depth; k++, source += right->stride, panel += SIMD_GEMM_PANEL)
+        {
+            memcpy(panel, source, width * sizeof(float));
+            memset(panel + width, 0, (SIMD_GEMM_PANEL - width) * sizeof(float));
+        }
+    }
+}
+
+/// @brief Task of the worker pool, adds the product of a block of rows of the left matrix and a packed block of the right matrix to the result.
+void MatrixN_DotBlock(void *context, size_t index)
+{
+    const MatrixNDotBlock *block = (const MatrixNDotBlock *)context;
+
+    size_t row = index * MATRIX_N_BLOCK_ROWS;
+    size_t rows = block->left->rows - row < MATRIX_N_BLOCK_ROWS ? block->left->rows - row : MATRIX_N_BLOCK_ROWS;
+
+    block->kernels->matrixDotAdd(block->left->data + row * block->left->stride + block->depthStart,
+                                 block->left->stride,
+                                 block->packedRight,
+                                 block->result->data + row * block->result->stride + block->columnStart,
+                                 block->result->stride,
+                                 rows,
+                                 block->columns,
+                                 block->depth);
+}
+
+/// @brief Subtracts a scaled row from a row, the step of the decompositions and the solves.
+void MatrixN_SubtractScaledRow(float *row, const float *source, float scale, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        row[i] -= scale * source[i];
+    }
+}
+
+/// @brief Multiplies a row by a scalar in place.
+void MatrixN_ScaleRow(float *row, float scale, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        row[i] *= scale;
+    }
+}
+
+#pragma endregion Source Only
+
+MatrixN *MatrixN_Create(size_t rows, size_t columns)
+{
+    MatrixN *matrix = (MatrixN *)malloc(sizeof(MatrixN));
+    DebugAssert(matrix != NULL, "Memory allocation failed.");
+
+    matrix->rows = rows;
+    matrix->columns = columns;
+    matrix->stride = MatrixN_GetStride(columns);
+    matrix->data = Simd_AllocateFloats(rows * matrix->stride);
+    memset(matrix->data, 0, rows * matrix->stride * sizeof(float));
+
+    return matrix;
+}
+
+MatrixN *MatrixN_CreateInArena(Arena *arena, size_t rows, size_t columns)
+{
+    DebugAssert(arena != NULL, "Null pointer passed as parameter.");
+
+    size_t mark = Arena_GetUsed(arena);
+    size_t stride = MatrixN_GetStride(columns);
+
+    MatrixN *matrix = (MatrixN *)Arena_Allocate(arena, sizeof(MatrixN), _Alignof(MatrixN));
+    float *data = (float *)Arena_Allocate(arena, rows * stride * sizeof(float), SIMD_ALIGNMENT);
+    if (matrix == NULL || data == NULL)
+    {
+        Arena_Rewind(arena, mark);
+        return NULL;
+    }
+
+    matrix->data = data;
+    matrix->rows = rows;
+    matrix->columns = columns;
+    matrix->stride = stride;
+    memset(matrix->data, 0, rows * stride * sizeof(float));
+
+    return matrix;
+}
+
+void MatrixN_Destroy(MatrixN *matrix)
+{
+    DebugAssert(matrix != NULL, "Null pointer passed as parameter.");
+
+    Simd_Free(matrix->data);
+    matrix->data = NULL;
+    matrix->rows = 0;
+    matrix->columns = 0;
+
+    free(matrix);
+    matrix = NULL;
+}
+
+MatrixN MatrixN_CreateView(const MatrixN *matrix, size_t row, size_t column, size_t rows, size_t columns)
+{
+    DebugAssert(matrix != NULL, "Null pointer passed as parameter.");
+    DebugAssert(row + rows <= matrix->rows && column + columns <= matrix->columns, "View must be inside the matrix.");
+
+    return (MatrixN){matrix->data + row * matrix->stride + column, rows, columns, matrix->stride};
+}
+
+float MatrixN_Get(const MatrixN *matrix, size_t row, size_t column)
+{
+    DebugAssert(matrix != NULL, "Null pointer passed as parameter.");
+    DebugAssert(row < matrix->rows && column < matrix->columns, "Index out of bounds.");
+
+    return matrix->data[row * matrix->stride + column];
+}
+
+void MatrixN_Set(MatrixN *matrix, size_t row, size_t column, float value)
+{
+    DebugAssert(matrix != NULL, "Null pointer passed as parameter.");
+    DebugAssert(row < matrix->rows && column < matrix->columns, "Index out of bounds.");
+
+    matrix->data[row * matrix->stride + column] = value;
+}
+
+void MatrixN_Fill(MatrixN *matrix, float value)
+{
+    DebugAssert(matrix != NULL, "Null pointer passed as parameter.");
+
+    for (size_t i = 0; i < matrix->rows; i++)
+    {
+        float *row = matrix->data + i * matrix->stride;
+        for (size_t j = 0; j < matrix->columns; j++)
+        {
+            row[j] = value;
+        }
+    }
+}
+
+void MatrixN_SetIdentity(MatrixN *matrix)
+{
+    DebugAssert(matrix != NULL, "Null pointer passed as parameter.");
+
+    MatrixN_Fill(matrix, 0.0f);
+    for (size_t i = 0; i < matrix->rows && i < matrix->columns; i++)
+    {
+        matrix->data[i * matrix->stride + i] = 1.0f;
+    }
+}
+
+void MatrixN_Copy(const MatrixN *matrix, MatrixN *result)
+{
+    DebugAssert(matrix != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(matrix->rows == result->rows && matrix->columns == result->columns, "Matrices must be the same size.");
+
+    for (size_t i = 0; i < matrix->rows; i++)
+    {
+        memmove(result->data + i * result->stride, matrix->data + i * matrix->stride, matrix->columns * sizeof(float));
+    }
+}
+
+void MatrixN_Add(const MatrixN *matrix1, const MatrixN *matrix2, MatrixN *result)
+{
+    DebugAssert(matrix1 != NULL && matrix2 != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(matrix1->rows == matrix2->rows && matrix1->columns == matrix2->columns &&
+                    matrix1->rows == result->rows && matrix1->columns == result->columns,
+                "Matrices must be the same size.");
+
+    const SimdKernels *kernels = Simd_GetKernels();
+    for (size_t i = 0; i < result->rows; i++)
+    {
+        kernels->add(matrix1->data + i * matrix1->stride, matrix2->data + i * matrix2->stride, result->data + i * result->stride, result->columns);
+    }
+}
+
+void MatrixN_Multiply(const MatrixN *matrix, float scalar, MatrixN *result)
+{
+    DebugAssert(matrix != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(matrix->rows == result->rows && matrix->columns == result->columns, "Matrices must be the same size.");
+
+    const SimdKernels *kernels = Simd_GetKernels();
+    for (size_t i = 0; i < result->rows; i++)
+    {
+        kernels->multiply(matrix->data + i * matrix->stride, scalar, result->data + i * result->stride, result->columns);
+    }
+}
+
+void MatrixN_Transpose(const MatrixN *matrix, MatrixN *result)
+{
+    DebugAssert(matrix != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(matrix->rows == result->columns && matrix->columns == result->rows, "Result must be columns x rows of the matrix.");
+    DebugAssert(matrix->data != result->data, "Result cannot be the matrix.");
+
+    // Tiles of 16 x 16, so neither the reads nor the writes go down a column of a whole matrix
+    for (size_t i0 = 0; i0 < matrix->rows; i0 += 16)
+    {
+        for (size_t j0 = 0; j0 < matrix->columns; j0 += 16)
+        {
+            size_t iEnd = i0 + 16 < matrix->rows ? i0 + 16 : matrix->rows;
+            size_t jEnd = j0 + 16 < matrix->columns ? j0 + 16 : matrix->columns;
+            for (size_t i = i0; i < iEnd; i++)
+            {
+                for (size_t j = j0; j < jEnd; j++)
+                {
+                    result->data[j * result->stride + i] = matrix->data[i * matrix->stride + j];
+                }
+            }
+        }
+    }
+}
+
+void MatrixN_Dot(const MatrixN *left, const MatrixN *right, MatrixN *result, WorkerPool *pool)
+{
+    DebugAssert(result != NULL, "Null pointer passed as parameter.");
+
+    MatrixN_Fill(result, 0.0f);
+    MatrixN_DotAdd(left, right, result, pool);
+}
+
+void MatrixN_DotAdd(const MatrixN *left, const MatrixN *right, MatrixN *result, WorkerPool *pool)
+{
+    DebugAssert(left != NULL && right != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(left->columns == right->rows && result->rows == left->rows && result->columns == right->columns, "Matrix sizes do not match for the product.");
+    DebugAssert(result->data != left->data && result->data != right->data, "Result cannot be an input matrix.");
+
+    size_t rows = left->rows, columns = right->columns, depth = left->columns;
+    if (rows == 0 || columns == 0 || depth == 0)
+    {
+        return;
+    }
+
+    size_t blockDepth = depth < MATRIX_N_BLOCK_DEPTH ? depth : MATRIX_N_BLOCK_DEPTH;
+    size_t blockColumns = columns < MATRIX_N_BLOCK_COLUMNS ? columns : MATRIX_N_BLOCK_COLUMNS;
+    size_t panelColumns = (blockColumns + SIMD_GEMM_PANEL - 1) / SIMD_GEMM_PANEL * SIMD_GEMM_PANEL;
+    float *packedRight = Simd_AllocateFloats(blockDepth * panelColumns);
+
+    WorkerPool *usedPool = (double)rows * (double)columns * (double)depth >= MATRIX_N_PARALLEL_MIN_WORK ? pool : NULL;
+    size_t rowBlockCount = (rows + MATRIX_N_BLOCK_ROWS - 1) / MATRIX_N_BLOCK_ROWS;
+
+    MatrixNDotBlock block = {Simd_GetKernels(), left, result, packedRight, 0, 0, 0, 0};
+    for (size_t column = 0; column < columns; column += MATRIX_N_BLOCK_COLUMNS)
+    {
+        block.columnStart = column;
+        block.columns = columns - column < MATRIX_N_BLOCK_COLUMNS ? columns - column : MATRIX_N_BLOCK_COLUMNS;
+
+        for (size_t k = 0; k < depth; k += MATRIX_N_BLOCK_DEPTH)
+        {
+            block.depthStart = k;
+            block.depth = depth - k < MATRIX_N_BLOCK_DEPTH ? depth - k : MATRIX_N_BLOCK_DEPTH;
+
+            MatrixN_PackPanels(right, k, column, block.depth, block.columns, packedRight);
+            WorkerPool_ParallelFor(usedPool, rowBlockCount, MatrixN_DotBlock, &block);
+        }
+    }
+
+    Simd_Free(packedRight);
+}
+
+bool MatrixN_DecomposeLU(MatrixN *matrix, size_t *pivots)
+{
+    DebugAssert(matrix != NULL && pivots != NULL, "Null pointer passed as parameter.");
+    DebugAssert(matrix->rows == matrix->columns, "Matrix must be square.");
+
+    size_t size = matrix->rows;
+    for (size_t k = 0; k < size; k++)
+    {
+        // Largest element of the column as the pivot, keeps the multipliers at most 1
+        size_t pivot = k;
+        float largest = Abs(matrix->data[k * matrix->stride + k]);
+        for (size_t i = k + 1; i < size; i++)
+        {
+            float value = Abs(matrix->data[i * matrix->stride + k]);
+            if (value > largest)
+            {
+                largest = value;
+                pivot = i;
+            }
+        }
+
+        pivots[k] = pivot;
+        if (largest == 0.0f)
+        {
+            return false;
+        }
+
+        float *pivotRow = matrix->data + k * matrix->stride;
+        if (pivot != k)
+        {
+            float *swapRow = matrix->data + pivot * matrix->stride;
+            for (size_t j = 0; j < size; j++)
+            {
+                float temp = pivotRow[j];
+                pivotRow[j] = swapRow[j];
+                swapRow[j] = temp;
+            }
+        }
+
+        float inverse = 1.0f / pivotRow[k];
+        for (size_t i = k + 1; i < size; i++)
+        {
+            float *row = matrix->data + i * matrix->stride;
+            row[k] *= inverse;
+            MatrixN_SubtractScaledRow(row + k + 1, pivotRow + k + 1, row[k], size - k - 1);
+        }
+    }
+
+    return true;
+}
+
+void MatrixN_SolveLU(const MatrixN *lu, const size_t *pivots, MatrixN *rightSide)
+{
+    DebugAssert(lu != NULL && pivots != NULL && rightSide != NULL, "Null pointer passed as parameter.");
+    DebugAssert(lu->rows == lu->columns && rightSide->rows == lu->rows, "Matrix sizes do not match for the solve.");
+
+    size_t size = lu->rows, columns = rightSide->columns;
+
+    // Same row swaps with the decomposition
+    for (size_t k = 0; k < size; k++)
+    {
+        if (pivots[k] != k)
+        {
+            float *row = rightSide->data + k * rightSide->stride;
+            float *swapRow = rightSide->data + pivots[k] * rightSide->stride;
+            for (size_t j = 0; j < columns; j++)
+            {
+                float temp = row[j];
+                row[j] = swapRow[j];
+                swapRow[j] = temp;
+            }
+        }
+    }
+
+    // Forward with the lower matrix of ones on the diagonal, whole rows of the right side at a time
+    for (size_t i = 0; i < size; i++)
+    {
+        float *row = rightSide->data + i * rightSide->stride;
+        for (size_t j = 0; j < i; j++)
+        {
+            MatrixN_SubtractScaledRow(row, rightSide->data + j * rightSide->stride, lu->data[i * lu->stride + j], columns);
+        }
+    }
+
+    // Backward with the upper matrix
+    for (size_t i = size; i-- > 0;)
+    {
+        float *row = rightSide->data + i * rightSide->stride;
+        for (size_t j = i + 1; j < size; j++)
+        {
+            MatrixN_SubtractScaledRow(row, rightSide->data + j * rightSide->stride, lu->data[i * lu->stride + j], columns);
+        }
+        MatrixN_ScaleRow(row, 1.0f / lu->data[i * lu->stride + i], columns);
+    }
+}
+
+bool MatrixN_DecomposeCholesky(MatrixN *matrix)
+{
+    DebugAssert(matrix != NULL, "Null pointer passed as parameter.");
+    DebugAssert(matrix->rows == matrix->columns, "Matrix must be square.");
+
+    size_t size = matrix->rows;
+    for (size_t j = 0; j < size; j++)
+    {
+        float *rowJ = matrix->data + j * matrix->stride;
+
+        // Dot products along rows, the lower triangle of a row major matrix is read row by row
+        float diagonal = rowJ[j];
+        for (size_t k = 0; k < j; k++)
+        {
+            diagonal -= rowJ[k] * rowJ[k];
+        }
+
+        if (!(diagonal > 0.0f))
+        {
+            return false;
+        }
+
+        rowJ[j] = SquareRoot(diagonal);
+        float inverse = 1.0f / rowJ[j];
+
+        for (size_t i = j + 1; i < size; i++)
+        {
+            float *rowI = matrix->data + i * matrix->stride;
+            float sum = rowI[j];
+            for (size_t k = 0; k < j; k++)
+            {
+                sum -= rowI[k] * rowJ[k];
+            }
+            rowI[j] = sum * inverse;
+        }
+
+        memset(rowJ + j + 1, 0, (size - j - 1) * sizeof(float));
+    }
+
+    return true;
+}
+
+void MatrixN_SolveCholesky(const MatrixN *lower, MatrixN *rightSide)
+{
+    DebugAssert(lower != NULL && rightSide != NULL, "Null pointer passed as parameter.");
+    DebugAssert(lower->rows == lower->columns && rightSide->rows == lower->rows, "Matrix sizes do not match for the solve.");
+
+    size_t size = lower->rows, columns = rightSide->columns;
+
+    // Forward with L
+    for (size_t i = 0; i < size; i++)
+    {
+        float *row = rightSide->data + i * rightSide->stride;
+        for (size_t j = 0; j < i; j++)
+        {
+            MatrixN_SubtractScaledRow(row, rightSide->data + j * rightSide->stride, lower->data[i * lower->stride + j], columns);
+        }
+        MatrixN_ScaleRow(row, 1.0f / lower->data[i * lower->stride + i], columns);
+    }
+
+    // Backward with the transpose of L, its row i is column i of L
+    for (size_t i = size; i-- > 0;)
+    {
+        float *row = rightSide->data + i * rightSide->stride;
+        for (size_t j = i + 1; j < size; j++)
+        {
+            MatrixN_SubtractScaledRow(row, rightSide->data + j * rightSide->stride, lower->data[j * lower->stride + i], columns);
+        }
+        MatrixN_ScaleRow(row, 1.0f / lower->data[i * lower->stride + i], columns);
+    }
+}
+
+bool MatrixN_SolveLeastSquares(const MatrixN *a, const MatrixN *b, MatrixN *result, WorkerPool *pool)
+{
+    DebugAssert(a != NULL && b != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(a->rows == b->rows && result->rows == a->columns && result->columns == b->columns, "Matrix sizes do not match for the solve.");
+
+    MatrixN *transpose = MatrixN_Create(a->columns, a->rows);
+    MatrixN *normal = MatrixN_Create(a->columns, a->columns);
+    MatrixN *rightSide = MatrixN_Create(a->columns, b->columns);
+
+    MatrixN_Transpose(a, transpose);
+    MatrixN_Dot(transpose, a, normal, pool);
+    MatrixN_Dot(transpose, b, rightSide, pool);
+
+    bool isSolved = MatrixN_DecomposeCholesky(normal);
+    if (isSolved)
+    {
+        MatrixN_SolveCholesky(normal, rightSide);
+        MatrixN_Copy(rightSide, result);
+    }
+
+    MatrixN_Destroy(rightSide);
+    MatrixN_Destroy(normal);
+    MatrixN_Destroy(transpose);
+
+    return isSolved;
+}
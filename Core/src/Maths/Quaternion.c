@@ -0,0 +1,384 @@
+#include "Maths/Quaternion.h"
+#include "Maths/Algebra.h"
+#include "Maths/Trigonometry.h"
+
+#include <math.h>
+
+#pragma region Source Only
+
+// Above this dot product two rotations are less than about 3.6 degrees apart, where slerp divides by a vanishing sine
+#define QUATERNION_SLERP_LINEAR_THRESHOLD 0.9995f
+
+// Below this squared step angle, a step of a quarter radian, the series of Quaternion_Integrate are exact to a float
+#define QUATERNION_INTEGRATE_SERIES_LIMIT 0.0625f
+
+/// @brief Converts a rotation to the 3x3 rotation matrix elements, row major. Shared by the Matrix3 and the Matrix4 conversions.
+void Quaternion_RotationElements(Quaternion quaternion, float elements[3][3])
+{
+    float xx = quaternion.x * quaternion.x;
+    float yy = quaternion.y * quaternion.y;
+    float zz = quaternion.z * quaternion.z;
+    float xy = quaternion.x * quaternion.y;
+    float xz = quaternion.x * quaternion.z;
+    float yz = quaternion.y * quaternion.z;
+    float wx = quaternion.w * quaternion.x;
+    float wy = quaternion.w * quaternion.y;
+    float wz = quaternion.w * quaternion.z;
+
+    elements[0][0] = 1.0f - 2.0f * (yy + zz);
+    elements[0][1] = 2.0f * (xy - wz);
+    elements[0][2] = 2.0f * (xz + wy);
+    elements[1][0] = 2.0f * (xy + wz);
+    elements[1][1] = 1.0f - 2.0f * (xx + zz);
+    elements[1][2] = 2.0f * (yz - wx);
+    elements[2][0] = 2.0f * (xz - wy);
+    elements[2][1] = 2.0f * (yz + wx);
+    elements[2][2] = 1.0f - 2.0f * (xx + yy);
+}
+
+/// @brief Converts the 3x3 rotation matrix elements to a rotation with Shepperd's method, the largest of w, x, y and z is taken from the diagonal, so no division by a small value.
+Quaternion Quaternion_FromRotationElements(float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22)
+{
+    Quaternion result;
+    float trace = m00 + m11 + m22;
+
+    if (trace > 0.0f)
+    {
+        float s = sqrtf(trace + 1.0f) * 2.0f; // 4w
+        result = (Quaternion){(m21 - m12) / s, (m02 - m20) / s, (m10 - m01) / s, 0.25f * s};
+    }
+    else if (m00 > m11 && m00 > m22)
+    {
+        float s = sqrtf(1.0f + m00 - m11 - m22) * 2.0f; // 4x
+        result = (Quaternion){0.25f * s, (m01 + m10) / s, (m02 + m20) / s, (m21 - m12) / s};
+    }
+    else if (m11 > m22)
+    {
+        float s = sqrtf(1.0f + m11 - m00 - m22) * 2.0f; // 4y
+        result = (Quaternion){(m01 + m10) / s, 0.25f * s, (m12 + m21) / s, (m02 - m20) / s};
+    }
+    else
+    {
+        float s = sqrtf(1.0f + m22 - m00 - m11) * 2.0f; // 4z
+        result = (Quaternion){(m02 + m20) / s, (m12 + m21) / s, 0.25f * s, (m10 - m01) / s};
+    }
+
+    // q and -q are the same rotation, a non negative w makes the result unique
+    if (result.w < 0.0f)
+    {
+        result = (Quaternion){-result.x, -result.y, -result.z, -result.w};
+    }
+
+    return Quaternion_Normalized(result);
+}
+
+#pragma endregion Source Only
+
+#pragma region Quaternion
+
+Quaternion Quaternion_Identity()
+{
+    return (Quaternion){0.0f, 0.0f, 0.0f, 1.0f};
+}
+
+Quaternion Quaternion_FromAxisAngle(Vector3 axis, float angle)
+{
+    float magnitude = Vector3_Magnitude(axis);
+    if (magnitude == 0.0f)
+        return Quaternion_Identity(); // No rotation if the axis is zero
+
+    float sine;
+    float cosine;
+    SinCosRad(angle * 0.5f, TrigAccuracy_Precise, &sine, &cosine);
+
+    float scale = sine / magnitude;
+    return (Quaternion){axis.x * scale, axis.y * scale, axis.z * scale, cosine};
+}
+
+Quaternion Quaternion_FromEuler(float roll, float pitch, float yaw)
+{
+    float sinRoll, cosRoll, sinPitch, cosPitch, sinYaw, cosYaw;
+    SinCosRad(roll * 0.5f, TrigAccuracy_Precise, &sinRoll, &cosRoll);
+    SinCosRad(pitch * 0.5f, TrigAccuracy_Precise, &sinPitch, &cosPitch);
+    SinCosRad(yaw * 0.5f, TrigAccuracy_Precise, &sinYaw, &cosYaw);
+
+    return (Quaternion){
+        sinRoll * cosPitch * cosYaw - cosRoll * sinPitch * sinYaw,
+        cosRoll * sinPitch * cosYaw + sinRoll * cosPitch * sinYaw,
+        cosRoll * cosPitch * sinYaw - sinRoll * sinPitch * cosYaw,
+        cosRoll * cosPitch * cosYaw + sinRoll * sinPitch * sinYaw};
+}
+
+Vector3 Quaternion_ToEuler(Quaternion quaternion)
+{
+    float x = quaternion.x, y = quaternion.y, z = quaternion.z, w = quaternion.w;
+
+    // Clamped, rounding can push the sine of the pitch just above 1 near the gimbal lock
+    float sinPitch = 2.0f * (w * y - z * x);
+    sinPitch = sinPitch > 1.0f ? 1.0f : (sinPitch < -1.0f ? -1.0f : sinPitch);
+
+    return (Vector3){
+        atan2f(2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y)),
+        asinf(sinPitch),
+        atan2f(2.0f * (w * z + x * y), 1.0f - 2.0f * (y * y + z * z))};
+}
+
+Quaternion Quaternion_Multiply(Quaternion quaternion1, Quaternion quaternion2)
+{
+    Quaternion a = quaternion1, b = quaternion2;
+    return (Quaternion){
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z};
+}
+
+Quaternion Quaternion_MultiplyNormalized(Quaternion quaternion1, Quaternion quaternion2)
+{
+    return Quaternion_Normalized(Quaternion_Multiply(quaternion1, quaternion2));
+}
+
+Quaternion Quaternion_Conjugate(Quaternion quaternion)
+{
+    return (Quaternion){-quaternion.x, -quaternion.y, -quaternion.z, quaternion.w};
+}
+
+Quaternion Quaternion_Inverse(Quaternion quaternion)
+{
+    float squaredMagnitude = Quaternion_Dot(quaternion, quaternion);
+    if (squaredMagnitude == 0.0f)
+        return (Quaternion){0.0f, 0.0f, 0.0f, 0.0f};
+
+    float inverse = 1.0f / squaredMagnitude;
+    return (Quaternion){-quaternion.x * inverse, -quaternion.y * inverse, -quaternion.z * inverse, quaternion.w * inverse};
+}
+
+float Quaternion_Dot(Quaternion quaternion1, Quaternion quaternion2)
+{
+    return quaternion1.x * quaternion2.x + quaternion1.y * quaternion2.y + quaternion1.z * quaternion2.z + quaternion1.w * quaternion2.w;
+}
+
+float Quaternion_Magnitude(Quaternion quaternion)
+{
+    return SquareRoot(Quaternion_Dot(quaternion, quaternion));
+}
+
+Quaternion Quaternion_Normalized(Quaternion quaternion)
+{
+    float magnitude = Quaternion_Magnitude(quaternion);
+    if (magnitude == 0.0f)
+        return Quaternion_Identity();
+
+    float inverse = 1.0f / magnitude;
+    return (Quaternion){quaternion.x * inverse, quaternion.y * inverse, quaternion.z * inverse, quaternion.w * inverse};
+}
+
+Quaternion Quaternion_Slerp(Quaternion startRotation, Quaternion endRotation, float time)
+{
+    // q and -q are the same rotation, the one with a positive dot product is the shorter arc
+    float dot = Quaternion_Dot(startRotation, endRotation);
+    if (dot < 0.0f)
+    {
+        endRotation = (Quaternion){-endRotation.x, -endRotation.y, -endRotation.z, -endRotation.w};
+        dot = -dot;
+    }
+
+    float startWeight;
+    float endWeight;
+    if (dot > QUATERNION_SLERP_LINEAR_THRESHOLD)
+    {
+        startWeight = 1.0f - time;
+        endWeight = time;
+    }
+    else
+    {
+        float angle = acosf(dot);
+        float inverseSine = 1.0f / sinf(angle);
+        startWeight = sinf((1.0f - time) * angle) * inverseSine;
+        endWeight = sinf(time * angle) * inverseSine;
+    }
+
+    return Quaternion_Normalized((Quaternion){
+        startRotation.x * startWeight + endRotation.x * endWeight,
+        startRotation.y * startWeight + endRotation.y * endWeight,
+        startRotation.z * startWeight + endRotation.z * endWeight,
+        startRotation.w * startWeight + endRotation.w * endWeight});
+}
+
+Vector3 Quaternion_RotateVector3(Quaternion quaternion, Vector3 vector)
+{
+    // v + w * t + u x t with t = 2 * (u x v), u the vector part, 15 multiplications against 27 of q * v * q'
+    Vector3 u = {quaternion.x, quaternion.y, quaternion.z};
+    Vector3 t = {
+        2.0f * (u.y * vector.z - u.z * vector.y),
+        2.0f * (u.z * vector.x - u.x * vector.z),
+        2.0f * (u.x * vector.y - u.y * vector.x)};
+
+    return (Vector3){
+        vector.x + quaternion.w * t.x + (u.y * t.z - u.z * t.y),
+        vector.y + quaternion.w * t.y + (u.z * t.x - u.x * t.z),
+        vector.z + quaternion.w * t.z + (u.x * t.y - u.y * t.x)};
+}
+
+Quaternion Quaternion_Integrate(Quaternion orientation, Vector3 angularVelocity, float deltaTime)
+{
+    // The rotation over the step around the momentary axis, applied in the body frame
+    Vector3 angle = {angularVelocity.x * deltaTime, angularVelocity.y * deltaTime, angularVelocity.z * deltaTime};
+    float squaredMagnitude = angle.x * angle.x + angle.y * angle.y + angle.z * angle.z;
+
+    float scale;
+    float cosine;
+    if (squaredMagnitude < QUATERNION_INTEGRATE_SERIES_LIMIT)
+    {
+        // Taylor series of sin(a / 2) / a and cos(a / 2), no square root and no trigonometry for the small steps of an IMU
+        float h = squaredMagnitude * 0.25f;
+        scale = 0.5f * (1.0f - h * (1.0f / 6.0f) * (1.0f - h * (1.0f / 20.0f)));
+        cosine = 1.0f - h * 0.5f * (1.0f - h * (1.0f / 12.0f));
+    }
+    else
+    {
+        float magnitude = SquareRoot(squaredMagnitude);
+        float sine;
+        SinCosRad(magnitude * 0.5f, TrigAccuracy_Precise, &sine, &cosine);
+        scale = sine / magnitude;
+    }
+
+    Quaternion step = {angle.x * scale, angle.y * scale, angle.z * scale, cosine};
+    Quaternion result = Quaternion_Multiply(orientation, step);
+
+    // The product of two unit quaternions is within a few ulps of 1, a Newton step of the inverse square root around 1 normalizes it
+    float correction = 0.5f * (3.0f - (result.x * result.x + result.y * result.y + result.z * result.z + result.w * result.w));
+    return (Quaternion){result.x * correction, result.y * correction, result.z * correction, result.w * correction};
+}
+
+Matrix3 Quaternion_ToMatrix3(Quaternion quaternion)
+{
+    Matrix3 result;
+    Quaternion_RotationElements(quaternion, result.matrix);
+    return result;
+}
+
+Matrix4 Quaternion_ToMatrix4(Quaternion quaternion)
+{
+    float elements[3][3];
+    Quaternion_RotationElements(quaternion, elements);
+
+    Matrix4 result = Matrix4_Identity();
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            result.matrix[i][j] = elements[i][j];
+    return result;
+}
+
+Quaternion Quaternion_FromMatrix3(const Matrix3 *matrix)
+{
+    DebugAssert(matrix != NULL, "Null pointer passed as parameter.");
+
+    const float(*m)[3] = matrix->matrix;
+    return Quaternion_FromRotationElements(m[0][0], m[0][1], m[0][2], m[1][0], m[1][1], m[1][2], m[2][0], m[2][1], m[2][2]);
+}
+
+Quaternion Quaternion_FromMatrix4(const Matrix4 *matrix)
+{
+    DebugAssert(matrix != NULL, "Null pointer passed as parameter.");
+
+    const float(*m)[4] = matrix->matrix;
+    return Quaternion_FromRotationElements(m[0][0], m[0][1], m[0][2], m[1][0], m[1][1], m[1][2], m[2][0], m[2][1], m[2][2]);
+}
+
+void Quaternion_MultiplyArray(const Quaternion *quaternions1, const Quaternion *quaternions2, Quaternion *results, size_t count)
+{
+    DebugAssert(quaternions1 != NULL && quaternions2 != NULL && results != NULL, "Null pointer passed as parameter.");
+
+    for (size_t i = 0; i < count; i++)
+    {
+        results[i] = Quaternion_MultiplyNormalized(quaternions1[i], quaternions2[i]);
+    }
+}
+
+Quaternion Quaternion_Compose(const Quaternion *rotations, size_t count)
+{
+    DebugAssert(rotations != NULL || count == 0, "Null pointer passed as parameter.");
+
+    // Unit quaternions drift by a few ulps per product, a single normalization at the end is enough for any practical chain
+    Quaternion result = Quaternion_Identity();
+    for (size_t i = 0; i < count; i++)
+    {
+        result = Quaternion_Multiply(result, rotations[i]);
+    }
+
+    return Quaternion_Normalized(result);
+}
+
+void Quaternion_TransformBatch(Quaternion quaternion, const Vector3Batch *batch, Vector3Batch *result)
+{
+    Matrix4 matrix = Quaternion_ToMatrix4(quaternion);
+    Vector3Batch_Transform(batch, &matrix, result);
+}
+
+#pragma endregion Quaternion
+
+#pragma region Transform3D
+
+Transform3D Transform3D_Identity()
+{
+    return (Transform3D){{0.0f, 0.0f, 0.0f}, Quaternion_Identity(), {1.0f, 1.0f, 1.0f}};
+}
+
+Transform3D Transform3D_Compose(const Transform3D *parent, const Transform3D *child)
+{
+    DebugAssert(parent != NULL && child != NULL, "Null pointer passed as parameter.");
+
+    return (Transform3D){
+        Transform3D_TransformPoint(parent, child->position),
+        Quaternion_MultiplyNormalized(parent->rotation, child->rotation),
+        {parent->scale.x * child->scale.x, parent->scale.y * child->scale.y, parent->scale.z * child->scale.z}};
+}
+
+Transform3D Transform3D_Inverse(const Transform3D *transform)
+{
+    DebugAssert(transform != NULL, "Null pointer passed as parameter.");
+
+    Quaternion rotation = Quaternion_Conjugate(transform->rotation);
+    Vector3 scale = {1.0f / transform->scale.x, 1.0f / transform->scale.y, 1.0f / transform->scale.z};
+    Vector3 position = Quaternion_RotateVector3(rotation, transform->position);
+
+    return (Transform3D){{-position.x * scale.x, -position.y * scale.y, -position.z * scale.z}, rotation, scale};
+}
+
+Vector3 Transform3D_TransformPoint(const Transform3D *transform, Vector3 point)
+{
+    DebugAssert(transform != NULL, "Null pointer passed as parameter.");
+
+    Vector3 scaled = {point.x * transform->scale.x, point.y * transform->scale.y, point.z * transform->scale.z};
+    return Vector3_Add(Quaternion_RotateVector3(transform->rotation, scaled), transform->position);
+}
+
+Matrix4 Transform3D_ToMatrix4(const Transform3D *transform)
+{
+    DebugAssert(transform != NULL, "Null pointer passed as parameter.");
+
+    float elements[3][3];
+    Quaternion_RotationElements(transform->rotation, elements);
+
+    // Columns of the rotation scaled, the scale is applied first
+    float scale[3] = {transform->scale.x, transform->scale.y, transform->scale.z};
+    float position[3] = {transform->position.x, transform->position.y, transform->position.z};
+
+    Matrix4 result = Matrix4_Identity();
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+            result.matrix[i][j] = elements[i][j] * scale[j];
+        result.matrix[i][3] = position[i];
+    }
+    return result;
+}
+
+void Transform3D_TransformBatch(const Transform3D *transform, const Vector3Batch *batch, Vector3Batch *result)
+{
+    Matrix4 matrix = Transform3D_ToMatrix4(transform);
+    Vector3Batch_Transform(batch, &matrix, result);
+}
+
+#pragma endregion Transform3D
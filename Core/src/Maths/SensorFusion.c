@@ -0,0 +1,528 @@
+#include "Maths/SensorFusion.h"
+#include "Maths/Algebra.h"
+#include "Maths/Arithmetic.h"
+#include "Maths/Trigonometry.h"
+
+#include <math.h>
+
+#pragma region Source Only
+
+// The cosine of the pitch is kept above this near +-90 degrees, where the Euler angle rates of the complementary filter divide by it
+#define SENSOR_FUSION_MIN_COS_PITCH 0.001f
+
+// Pivots of the innovation covariance below this make it singular for KalmanFilter_Update
+#define KALMAN_FILTER_SINGULAR_LIMIT 1e-12f
+
+/// @brief Normalizes a sample in place, the filters use only the directions of the accelerometer and the magnetometer.
+/// @return False for a zero sample, which is not changed then.
+bool SensorFusion_Normalize(Vector3 *vector)
+{
+    float squaredMagnitude = vector->x * vector->x + vector->y * vector->y + vector->z * vector->z;
+    if (squaredMagnitude == 0.0f)
+    {
+        return false;
+    }
+
+    float inverseMagnitude = 1.0f / SquareRoot(squaredMagnitude);
+    vector->x *= inverseMagnitude;
+    vector->y *= inverseMagnitude;
+    vector->z *= inverseMagnitude;
+    return true;
+}
+
+/// @brief Wraps an angle to [-PI, PI], so the corrections of the complementary filter take the shorter way around.
+float SensorFusion_WrapAngle(float radian)
+{
+    if (radian > PI)
+    {
+        radian -= 2.0f * PI;
+    }
+    else if (radian < -PI)
+    {
+        radian += 2.0f * PI;
+    }
+
+    return radian;
+}
+
+/// @brief Gets the roll and pitch of a normalized accelerometer sample.
+void SensorFusion_TiltAngles(Vector3 accelerometer, float *roll, float *pitch)
+{
+    *roll = atan2f(accelerometer.y, accelerometer.z);
+    *pitch = atan2f(-accelerometer.x, SquareRoot(accelerometer.y * accelerometer.y + accelerometer.z * accelerometer.z));
+}
+
+/// @brief Gets the yaw of a normalized magnetometer sample, rotated back to the horizontal plane by the roll and the pitch first.
+float SensorFusion_Heading(Vector3 magnetometer, float roll, float pitch)
+{
+    float sinRoll = sinf(roll), cosRoll = cosf(roll);
+    float sinPitch = sinf(pitch), cosPitch = cosf(pitch);
+
+    float horizontalX = magnetometer.x * cosPitch + (magnetometer.y * sinRoll + magnetometer.z * cosRoll) * sinPitch;
+    float horizontalY = magnetometer.y * cosRoll - magnetometer.z * sinRoll;
+
+    return atan2f(-horizontalY, horizontalX);
+}
+
+/// @brief Gets the orientation of the first sample of the AHRS filters directly, so they do not converge from identity for seconds.
+Quaternion SensorFusion_InitialOrientation(Vector3 accelerometer, Vector3 magnetometer, bool hasMagnetometer)
+{
+    float roll, pitch;
+    SensorFusion_TiltAngles(accelerometer, &roll, &pitch);
+    float yaw = hasMagnetometer ? SensorFusion_Heading(magnetometer, roll, pitch) : 0.0f;
+
+    return Quaternion_FromEuler(roll, pitch, yaw);
+}
+
+/// @brief Gets the reference direction of the magnetic field in the earth frame, the measured field rotated to the earth frame with its horizontal part moved onto x.
+/// This way the magnetometer corrects only the yaw, the inclination of the field is not needed and does not disturb the roll and the pitch.
+Vector3 SensorFusion_MagneticReference(Quaternion orientation, Vector3 magnetometer)
+{
+    Vector3 earth = Quaternion_RotateVector3(orientation, magnetometer);
+    return (Vector3){SquareRoot(earth.x * earth.x + earth.y * earth.y), 0.0f, earth.z};
+}
+
+/// @brief Multiplies two row major matrices of the filter arrays, result = a b, row by row as sums of the rows of b.
+/// The elements of a row of the result are independent, so they do not wait on each other, and the zeros of a are skipped,
+/// the transition and observation matrices of most models are sparse. The result can not be one of the inputs.
+void KalmanFilter_Multiply(const float *a, int aStride, const float *b, int bStride, float *result, int resultStride, int rows, int inner, int columns)
+{
+    for (int i = 0; i < rows; i++)
+    {
+        float *resultRow = result + i * resultStride;
+        for (int j = 0; j < columns; j++)
+        {
+            resultRow[j] = 0.0f;
+        }
+
+        for (int k = 0; k < inner; k++)
+        {
+            float factor = a[i * aStride + k];
+            if (factor == 0.0f)
+            {
+                continue;
+            }
+
+            const float *bRow = b + k * bStride;
+            for (int j = 0; j < columns; j++)
+            {
+                resultRow[j] += factor * bRow[j];
+            }
+        }
+    }
+}
+
+#pragma endregion Source Only
+
+#pragma region ComplementaryFilter
+
+ComplementaryFilter ComplementaryFilter_CreateStack(float timeConstant)
+{
+    DebugAssert(timeConstant >= 0.0f, "Time constant of a complementary filter must not be negative.");
+
+    return (ComplementaryFilter){{0.0f, 0.0f, 0.0f}, timeConstant, false};
+}
+
+void ComplementaryFilter_Update(ComplementaryFilter *filter, Vector3 gyroscope, Vector3 accelerometer, Vector3 magnetometer, float deltaTime)
+{
+    DebugAssert(filter != NULL, "Null pointer passed as parameter.");
+
+    bool hasAccelerometer = SensorFusion_Normalize(&accelerometer);
+    bool hasMagnetometer = SensorFusion_Normalize(&magnetometer);
+
+    if (!filter->isInitialized && hasAccelerometer)
+    {
+        SensorFusion_TiltAngles(accelerometer, &filter->angles.x, &filter->angles.y);
+        filter->angles.z = hasMagnetometer ? SensorFusion_Heading(magnetometer, filter->angles.x, filter->angles.y) : 0.0f;
+        filter->isInitialized = true;
+        return;
+    }
+
+    // The gyroscope measures around the axes of the body, converted to the rates of the Euler angles
+    float sinRoll = sinf(filter->angles.x), cosRoll = cosf(filter->angles.x);
+    float cosPitch = cosf(filter->angles.y);
+    if (Abs(cosPitch) < SENSOR_FUSION_MIN_COS_PITCH)
+    {
+        cosPitch = cosPitch < 0.0f ? -SENSOR_FUSION_MIN_COS_PITCH : SENSOR_FUSION_MIN_COS_PITCH;
+    }
+    float tanPitch = sinf(filter->angles.y) / cosPitch;
+
+    float rollRate = gyroscope.x + (sinRoll * gyroscope.y + cosRoll * gyroscope.z) * tanPitch;
+    float pitchRate = cosRoll * gyroscope.y - sinRoll * gyroscope.z;
+    float yawRate = (sinRoll * gyroscope.y + cosRoll * gyroscope.z) / cosPitch;
+
+    filter->angles.x += rollRate * deltaTime;
+    filter->angles.y += pitchRate * deltaTime;
+    filter->angles.z += yawRate * deltaTime;
+
+    // First order blend, the gyroscope passes above 1 / timeConstant and the absolute sensors below it
+    float correction = deltaTime / (filter->timeConstant + deltaTime);
+
+    if (hasAccelerometer)
+    {
+        float roll, pitch;
+        SensorFusion_TiltAngles(accelerometer, &roll, &pitch);
+        filter->angles.x += correction * SensorFusion_WrapAngle(roll - filter->angles.x);
+        filter->angles.y += correction * (pitch - filter->angles.y);
+    }
+
+    if (hasMagnetometer)
+    {
+        float yaw = SensorFusion_Heading(magnetometer, filter->angles.x, filter->angles.y);
+        filter->angles.z += correction * SensorFusion_WrapAngle(yaw - filter->angles.z);
+    }
+
+    filter->angles.x = SensorFusion_WrapAngle(filter->angles.x);
+    filter->angles.z = SensorFusion_WrapAngle(filter->angles.z);
+}
+
+Quaternion ComplementaryFilter_GetOrientation(const ComplementaryFilter *filter)
+{
+    DebugAssert(filter != NULL, "Null pointer passed as parameter.");
+
+    return Quaternion_FromEuler(filter->angles.x, filter->angles.y, filter->angles.z);
+}
+
+#pragma endregion ComplementaryFilter
+
+#pragma region MahonyFilter
+
+MahonyFilter MahonyFilter_CreateStack(float proportionalGain, float integralGain)
+{
+    DebugAssert(proportionalGain >= 0.0f && integralGain >= 0.0f, "Gains of a Mahony filter must not be negative.");
+
+    return (MahonyFilter){Quaternion_Identity(), {0.0f, 0.0f, 0.0f}, proportionalGain, integralGain, false};
+}
+
+void MahonyFilter_Update(MahonyFilter *filter, Vector3 gyroscope, Vector3 accelerometer, Vector3 magnetometer, float deltaTime)
+{
+    DebugAssert(filter != NULL, "Null pointer passed as parameter.");
+
+    bool hasAccelerometer = SensorFusion_Normalize(&accelerometer);
+    bool hasMagnetometer = SensorFusion_Normalize(&magnetometer);
+
+    if (!filter->isInitialized && hasAccelerometer)
+    {
+        filter->orientation = SensorFusion_InitialOrientation(accelerometer, magnetometer, hasMagnetometer);
+        filter->isInitialized = true;
+        return;
+    }
+
+    if (hasAccelerometer)
+    {
+        Quaternion inverse = Quaternion_Conjugate(filter->orientation);
+
+        // The error is the rotation from the estimated to the measured direction, the cross product of the two
+        Vector3 gravity = Quaternion_RotateVector3(inverse, (Vector3){0.0f, 0.0f, 1.0f});
+        Vector3 error = {
+            accelerometer.y * gravity.z - accelerometer.z * gravity.y,
+            accelerometer.z * gravity.x - accelerometer.x * gravity.z,
+            accelerometer.x * gravity.y - accelerometer.y * gravity.x};
+
+        if (hasMagnetometer)
+        {
+            Vector3 field = Quaternion_RotateVector3(inverse, SensorFusion_MagneticReference(filter->orientation, magnetometer));
+            error.x += magnetometer.y * field.z - magnetometer.z * field.y;
+            error.y += magnetometer.z * field.x - magnetometer.x * field.z;
+            error.z += magnetometer.x * field.y - magnetometer.y * field.x;
+        }
+
+        if (filter->integralGain > 0.0f)
+        {
+            filter->integralError.x += filter->integralGain * error.x * deltaTime;
+            filter->integralError.y += filter->integralGain * error.y * deltaTime;
+            filter->integralError.z += filter->integralGain * error.z * deltaTime;
+            gyroscope = Vector3_Add(gyroscope, filter->integralError);
+        }
+
+        gyroscope = Vector3_Add(gyroscope, Vector3_Multiply(error, filter->proportionalGain));
+    }
+
+    filter->orientation = Quaternion_Integrate(filter->orientation, gyroscope, deltaTime);
+}
+
+#pragma endregion MahonyFilter
+
+#pragma region MadgwickFilter
+
+MadgwickFilter MadgwickFilter_CreateStack(float beta)
+{
+    DebugAssert(beta >= 0.0f, "Beta of a Madgwick filter must not be negative.");
+
+    return (MadgwickFilter){Quaternion_Identity(), beta, false};
+}
+
+void MadgwickFilter_Update(MadgwickFilter *filter, Vector3 gyroscope, Vector3 accelerometer, Vector3 magnetometer, float deltaTime)
+{
+    DebugAssert(filter != NULL, "Null pointer passed as parameter.");
+
+    bool hasAccelerometer = SensorFusion_Normalize(&accelerometer);
+    bool hasMagnetometer = SensorFusion_Normalize(&magnetometer);
+
+    if (!filter->isInitialized && hasAccelerometer)
+    {
+        filter->orientation = SensorFusion_InitialOrientation(accelerometer, magnetometer, hasMagnetometer);
+        filter->isInitialized = true;
+        return;
+    }
+
+    Quaternion q = filter->orientation;
+
+    // Rate of change of the orientation from the gyroscope, q' = q * (gyroscope, 0) / 2
+    Quaternion rate = Quaternion_Multiply(q, (Quaternion){gyroscope.x * 0.5f, gyroscope.y * 0.5f, gyroscope.z * 0.5f, 0.0f});
+
+    if (hasAccelerometer)
+    {
+        Quaternion inverse = Quaternion_Conjugate(q);
+        float qw = q.w, qx = q.x, qy = q.y, qz = q.z;
+
+        // Gradient J' f of the squared error between the estimated and the measured directions, in w, x, y and z
+        Vector3 gravity = Quaternion_RotateVector3(inverse, (Vector3){0.0f, 0.0f, 1.0f});
+        float fx = gravity.x - accelerometer.x, fy = gravity.y - accelerometer.y, fz = gravity.z - accelerometer.z;
+
+        float gradientW = -2.0f * qy * fx + 2.0f * qx * fy;
+        float gradientX = 2.0f * qz * fx + 2.0f * qw * fy - 4.0f * qx * fz;
+        float gradientY = -2.0f * qw * fx + 2.0f * qz * fy - 4.0f * qy * fz;
+        float gradientZ = 2.0f * qx * fx + 2.0f * qy * fy;
+
+        if (hasMagnetometer)
+        {
+            Vector3 reference = SensorFusion_MagneticReference(q, magnetometer);
+            float bx = reference.x, bz = reference.z;
+
+            Vector3 field = Quaternion_RotateVector3(inverse, reference);
+            fx = field.x - magnetometer.x, fy = field.y - magnetometer.y, fz = field.z - magnetometer.z;
+
+            gradientW += -2.0f * bz * qy * fx + (-2.0f * bx * qz + 2.0f * bz * qx) * fy + 2.0f * bx * qy * fz;
+            gradientX += 2.0f * bz * qz * fx + (2.0f * bx * qy + 2.0f * bz * qw) * fy + (2.0f * bx * qz - 4.0f * bz * qx) * fz;
+            gradientY += (-4.0f * bx * qy - 2.0f * bz * qw) * fx + (2.0f * bx * qx + 2.0f * bz * qz) * fy + (2.0f * bx * qw - 4.0f * bz * qy) * fz;
+            gradientZ += (-4.0f * bx * qz + 2.0f * bz * qx) * fx + (-2.0f * bx * qw + 2.0f * bz * qy) * fy + 2.0f * bx * qx * fz;
+        }
+
+        // A step of beta along the normalized gradient, so beta is the rate the error is removed with
+        float squaredMagnitude = gradientW * gradientW + gradientX * gradientX + gradientY * gradientY + gradientZ * gradientZ;
+        if (squaredMagnitude > 0.0f)
+        {
+            float step = filter->beta / SquareRoot(squaredMagnitude);
+            rate.w -= step * gradientW;
+            rate.x -= step * gradientX;
+            rate.y -= step * gradientY;
+            rate.z -= step * gradientZ;
+        }
+    }
+
+    q.w += rate.w * deltaTime;
+    q.x += rate.x * deltaTime;
+    q.y += rate.y * deltaTime;
+    q.z += rate.z * deltaTime;
+    filter->orientation = Quaternion_Normalized(q);
+}
+
+#pragma endregion MadgwickFilter
+
+#pragma region KalmanFilter
+
+KalmanFilter KalmanFilter_CreateStack(int stateCount, int measurementCount)
+{
+    DebugAssert(stateCount > 0 && stateCount <= KALMAN_FILTER_MAX_STATES, "State count of a Kalman filter out of range.");
+    DebugAssert(measurementCount > 0 && measurementCount <= KALMAN_FILTER_MAX_MEASUREMENTS && measurementCount <= stateCount, "Measurement count of a Kalman filter out of range.");
+
+    KalmanFilter filter = {0};
+    filter.stateCount = stateCount;
+    filter.measurementCount = measurementCount;
+
+    for (int i = 0; i < stateCount; i++)
+    {
+        filter.covariance[i][i] = 1.0f;
+        filter.transition[i][i] = 1.0f;
+    }
+    for (int i = 0; i < measurementCount; i++)
+    {
+        filter.observation[i][i] = 1.0f;
+        filter.measurementNoise[i][i] = 1.0f;
+    }
+
+    return filter;
+}
+
+void KalmanFilter_Predict(KalmanFilter *filter)
+{
+    DebugAssert(filter != NULL, "Null pointer passed as parameter.");
+
+    int n = filter->stateCount;
+    float state[KALMAN_FILTER_MAX_STATES];
+    float product[KALMAN_FILTER_MAX_STATES][KALMAN_FILTER_MAX_STATES];
+    float productTransposed[KALMAN_FILTER_MAX_STATES][KALMAN_FILTER_MAX_STATES];
+
+    // x = F x
+    for (int i = 0; i < n; i++)
+    {
+        float sum = 0.0f;
+        for (int k = 0; k < n; k++)
+        {
+            sum += filter->transition[i][k] * filter->state[k];
+        }
+        state[i] = sum;
+    }
+    memcpy(filter->state, state, n * sizeof(float));
+
+    // F P F' = F (F P)', P is symmetric, so both products skip the zeros of F
+    KalmanFilter_Multiply(&filter->transition[0][0], KALMAN_FILTER_MAX_STATES, &filter->covariance[0][0], KALMAN_FILTER_MAX_STATES,
+                          &product[0][0], KALMAN_FILTER_MAX_STATES, n, n, n);
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            productTransposed[i][j] = product[j][i];
+        }
+    }
+    KalmanFilter_Multiply(&filter->transition[0][0], KALMAN_FILTER_MAX_STATES, &productTransposed[0][0], KALMAN_FILTER_MAX_STATES,
+                          &filter->covariance[0][0], KALMAN_FILTER_MAX_STATES, n, n, n);
+
+    // P = F P F' + Q, the upper triangle mirrored so rounding does not break the symmetry of P over many steps
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = i; j < n; j++)
+        {
+            float sum = filter->covariance[i][j] + filter->processNoise[i][j];
+            filter->covariance[i][j] = sum;
+            filter->covariance[j][i] = sum;
+        }
+    }
+}
+
+bool KalmanFilter_Update(KalmanFilter *filter, const float *measurement)
+{
+    DebugAssert(filter != NULL, "Null pointer passed as parameter.");
+    DebugAssert(measurement != NULL, "Null pointer passed as parameter.");
+
+    int n = filter->stateCount;
+    int m = filter->measurementCount;
+
+    float innovation[KALMAN_FILTER_MAX_MEASUREMENTS];
+    float observationCovariance[KALMAN_FILTER_MAX_MEASUREMENTS][KALMAN_FILTER_MAX_STATES];
+    float covarianceObservation[KALMAN_FILTER_MAX_STATES][KALMAN_FILTER_MAX_MEASUREMENTS];
+    float innovationCovariance[KALMAN_FILTER_MAX_MEASUREMENTS][KALMAN_FILTER_MAX_MEASUREMENTS];
+    float inverse[KALMAN_FILTER_MAX_MEASUREMENTS][KALMAN_FILTER_MAX_MEASUREMENTS];
+    float gain[KALMAN_FILTER_MAX_STATES][KALMAN_FILTER_MAX_MEASUREMENTS];
+    float correction[KALMAN_FILTER_MAX_STATES][KALMAN_FILTER_MAX_STATES];
+
+    // y = z - H x
+    for (int i = 0; i < m; i++)
+    {
+        float sum = measurement[i];
+        for (int k = 0; k < n; k++)
+        {
+            sum -= filter->observation[i][k] * filter->state[k];
+        }
+        innovation[i] = sum;
+    }
+
+    // H P and its transpose P H', P is symmetric
+    KalmanFilter_Multiply(&filter->observation[0][0], KALMAN_FILTER_MAX_STATES, &filter->covariance[0][0], KALMAN_FILTER_MAX_STATES,
+                          &observationCovariance[0][0], KALMAN_FILTER_MAX_STATES, m, n, n);
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < m; j++)
+        {
+            covarianceObservation[i][j] = observationCovariance[j][i];
+        }
+    }
+
+    // S = H (P H') + R
+    KalmanFilter_Multiply(&filter->observation[0][0], KALMAN_FILTER_MAX_STATES, &covarianceObservation[0][0], KALMAN_FILTER_MAX_MEASUREMENTS,
+                          &innovationCovariance[0][0], KALMAN_FILTER_MAX_MEASUREMENTS, m, n, m);
+    for (int i = 0; i < m; i++)
+    {
+        for (int j = 0; j < m; j++)
+        {
+            innovationCovariance[i][j] += filter->measurementNoise[i][j];
+            inverse[i][j] = i == j ? 1.0f : 0.0f;
+        }
+    }
+
+    // Inverse of S by Gauss-Jordan elimination with partial pivoting, S is at most KALMAN_FILTER_MAX_MEASUREMENTS square
+    for (int column = 0; column < m; column++)
+    {
+        int pivot = column;
+        for (int row = column + 1; row < m; row++)
+        {
+            if (Abs(innovationCovariance[row][column]) > Abs(innovationCovariance[pivot][column]))
+            {
+                pivot = row;
+            }
+        }
+
+        if (Abs(innovationCovariance[pivot][column]) < KALMAN_FILTER_SINGULAR_LIMIT)
+        {
+            return false;
+        }
+
+        if (pivot != column)
+        {
+            for (int k = 0; k < m; k++)
+            {
+                float temp = innovationCovariance[column][k];
+                innovationCovariance[column][k] = innovationCovariance[pivot][k];
+                innovationCovariance[pivot][k] = temp;
+
+                temp = inverse[column][k];
+                inverse[column][k] = inverse[pivot][k];
+                inverse[pivot][k] = temp;
+            }
+        }
+
+        float scale = 1.0f / innovationCovariance[column][column];
+        for (int k = 0; k < m; k++)
+        {
+            innovationCovariance[column][k] *= scale;
+            inverse[column][k] *= scale;
+        }
+
+        for (int row = 0; row < m; row++)
+        {
+            float factor = innovationCovariance[row][column];
+            if (row == column || factor == 0.0f)
+            {
+                continue;
+            }
+
+            for (int k = 0; k < m; k++)
+            {
+                innovationCovariance[row][k] -= factor * innovationCovariance[column][k];
+                inverse[row][k] -= factor * inverse[column][k];
+            }
+        }
+    }
+
+    // K = (P H') S^-1
+    KalmanFilter_Multiply(&covarianceObservation[0][0], KALMAN_FILTER_MAX_MEASUREMENTS, &inverse[0][0], KALMAN_FILTER_MAX_MEASUREMENTS,
+                          &gain[0][0], KALMAN_FILTER_MAX_MEASUREMENTS, n, m, m);
+
+    // x = x + K y
+    for (int i = 0; i < n; i++)
+    {
+        float sum = 0.0f;
+        for (int k = 0; k < m; k++)
+        {
+            sum += gain[i][k] * innovation[k];
+        }
+        filter->state[i] += sum;
+    }
+
+    // P = P - K (H P), the upper triangle mirrored so rounding does not break the symmetry of P over many updates
+    KalmanFilter_Multiply(&gain[0][0], KALMAN_FILTER_MAX_MEASUREMENTS, &observationCovariance[0][0], KALMAN_FILTER_MAX_STATES,
+                          &correction[0][0], KALMAN_FILTER_MAX_STATES, n, m, n);
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = i; j < n; j++)
+        {
+            filter->covariance[i][j] -= correction[i][j];
+            filter->covariance[j][i] = filter->covariance[i][j];
+        }
+    }
+
+    return true;
+}
+
+#pragma endregion KalmanFilter
@@ -0,0 +1,460 @@
+#include "Maths/Simd.h"
+
+#include <math.h>
+#include <stdatomic.h>
+
+#if SIMD_ARCHITECTURE_X86 && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#pragma region Source Only
+
+// -1 until the first call detects the level. Detection gives the same result on every thread, so racing first calls are harmless.
+_Atomic int SIMD_LEVEL = -1;
+
+/// @brief Finds the fastest instruction set the CPU and the operating system support.
+/// @return The fastest supported instruction set.
+SimdLevel Simd_Detect()
+{
+#if SIMD_ARCHITECTURE_X86
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        return SimdLevel_AVX2;
+    }
+#elif defined(_MSC_VER)
+    int registers[4];
+    __cpuid(registers, 1);
+    bool hasFma = (registers[2] & (1 << 12)) != 0;
+    bool hasSavedAvxState = (registers[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6; // the OS saves the AVX registers on context switch
+
+    __cpuidex(registers, 7, 0);
+    bool hasAvx2 = (registers[1] & (1 << 5)) != 0;
+
+    if (hasFma && hasAvx2 && hasSavedAvxState)
+    {
+        return SimdLevel_AVX2;
+    }
+#endif
+    return SimdLevel_SSE2;
+#elif SIMD_ARCHITECTURE_ARM
+    return SimdLevel_NEON;
+#else
+    return SimdLevel_Scalar;
+#endif
+}
+
+void SimdScalar_Add(const float *array1, const float *array2, float *result, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        result[i] = array1[i] + array2[i];
+    }
+}
+
+void SimdScalar_Multiply(const float *array, float scalar, float *result, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        result[i] = array[i] * scalar;
+    }
+}
+
+void SimdScalar_Lerp(const float *startArray, const float *endArray, float time, float *result, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        result[i] = startArray[i] + (endArray[i] - startArray[i]) * time;
+    }
+}
+
+void SimdScalar_Dot(const float *const *components1, const float *const *components2, int dimension, float *result, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        float sum = 0.0f;
+        for (int d = 0; d < dimension; d++)
+        {
+            sum += components1[d][i] * components2[d][i];
+        }
+
+        result[i] = sum;
+    }
+}
+
+void SimdScalar_Normalize(const float *const *components, float *const *results, int dimension, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        float squaredMagnitude = 0.0f;
+        for (int d = 0; d < dimension; d++)
+        {
+            squaredMagnitude += components[d][i] * components[d][i];
+        }
+
+        // Zero vectors stay zero, same with Vector3_Normalized.
+        float inverseMagnitude = squaredMagnitude > 0.0f ? 1.0f / sqrtf(squaredMagnitude) : 0.0f;
+        for (int d = 0; d < dimension; d++)
+        {
+            results[d][i] = components[d][i] * inverseMagnitude;
+        }
+    }
+}
+
+void SimdScalar_Matrix4Dot(const float *matrix1, const float *matrix2, float *result)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; k++)
+            {
+                sum += matrix1[i * 4 + k] * matrix2[k * 4 + j];
+            }
+
+            result[i * 4 + j] = sum;
+        }
+    }
+}
+
+bool SimdScalar_Matrix4Inverse(const float *matrix, float *result)
+{
+    const float *m = matrix;
+
+    // 2x2 determinants of the top two rows and of the bottom two rows, shared by the cofactors.
+    float top0 = m[0] * m[5] - m[4] * m[1];
+    float top1 = m[0] * m[6] - m[4] * m[2];
+    float top2 = m[0] * m[7] - m[4] * m[3];
+    float top3 = m[1] * m[6] - m[5] * m[2];
+    float top4 = m[1] * m[7] - m[5] * m[3];
+    float top5 = m[2] * m[7] - m[6] * m[3];
+
+    float bottom0 = m[8] * m[13] - m[12] * m[9];
+    float bottom1 = m[8] * m[14] - m[12] * m[10];
+    float bottom2 = m[8] * m[15] - m[12] * m[11];
+    float bottom3 = m[9] * m[14] - m[13] * m[10];
+    float bottom4 = m[9] * m[15] - m[13] * m[11];
+    float bottom5 = m[10] * m[15] - m[14] * m[11];
+
+    float determinant = top0 * bottom5 - top1 * bottom4 + top2 * bottom3 + top3 * bottom2 - top4 * bottom1 + top5 * bottom0;
+    if (determinant == 0.0f)
+    {
+        return false;
+    }
+
+    float inverseDeterminant = 1.0f / determinant;
+
+    result[0] = (m[5] * bottom5 - m[6] * bottom4 + m[7] * bottom3) * inverseDeterminant;
+    result[1] = (-m[1] * bottom5 + m[2] * bottom4 - m[3] * bottom3) * inverseDeterminant;
+    result[2] = (m[13] * top5 - m[14] * top4 + m[15] * top3) * inverseDeterminant;
+    result[3] = (-m[9] * top5 + m[10] * top4 - m[11] * top3) * inverseDeterminant;
+
+    result[4] = (-m[4] * bottom5 + m[6] * bottom2 - m[7] * bottom1) * inverseDeterminant;
+    result[5] = (m[0] * bottom5 - m[2] * bottom2 + m[3] * bottom1) * inverseDeterminant;
+    result[6] = (-m[12] * top5 + m[14] * top2 - m[15] * top1) * inverseDeterminant;
+    result[7] = (m[8] * top5 - m[10] * top2 + m[11] * top1) * inverseDeterminant;
+
+    result[8] = (m[4] * bottom4 - m[5] * bottom2 + m[7] * bottom0) * inverseDeterminant;
+    result[9] = (-m[0] * bottom4 + m[1] * bottom2 - m[3] * bottom0) * inverseDeterminant;
+    result[10] = (m[12] * top4 - m[13] * top2 + m[15] * top0) * inverseDeterminant;
+    result[11] = (-m[8] * top4 + m[9] * top2 - m[11] * top0) * inverseDeterminant;
+
+    result[12] = (-m[4] * bottom3 + m[5] * bottom1 - m[6] * bottom0) * inverseDeterminant;
+    result[13] = (m[0] * bottom3 - m[1] * bottom1 + m[2] * bottom0) * inverseDeterminant;
+    result[14] = (-m[12] * top3 + m[13] * top1 - m[14] * top0) * inverseDeterminant;
+    result[15] = (m[8] * top3 - m[9] * top1 + m[10] * top0) * inverseDeterminant;
+
+    return true;
+}
+
+void SimdScalar_Transform(const float *matrix, const float *const *components, int dimension, float *const *results, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        float vector[4] = {components[0][i], components[1][i], components[2][i], dimension == 4 ? components[3][i] : 1.0f};
+
+        for (int row = 0; row < dimension; row++)
+        {
+            const float *rowValues = matrix + row * 4;
+            results[row][i] = rowValues[0] * vector[0] + rowValues[1] * vector[1] + rowValues[2] * vector[2] + rowValues[3] * vector[3];
+        }
+    }
+}
+
+void SimdScalar_SinCos(const float *radians, float *sines, float *cosines, TrigAccuracy accuracy, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        float sine, cosine;
+        SinCosRad(radians[i], accuracy, &sine, &cosine);
+
+        if (sines != NULL)
+        {
+            sines[i] = sine;
+        }
+
+        if (cosines != NULL)
+        {
+            cosines[i] = cosine;
+        }
+    }
+}
+
+void SimdScalar_ArcTan2(const float *ys, const float *xs, float *results, TrigAccuracy accuracy, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        results[i] = ArcTan2RadFast(ys[i], xs[i], accuracy);
+    }
+}
+
+void SimdScalar_ComplexMultiply(const float *real1, const float *imaginary1, const float *real2, const float *imaginary2, float *realResult, float *imaginaryResult, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        float real = real1[i] * real2[i] - imaginary1[i] * imaginary2[i];
+        float imaginary = real1[i] * imaginary2[i] + imaginary1[i] * real2[i];
+
+        realResult[i] = real;
+        imaginaryResult[i] = imaginary;
+    }
+}
+
+void SimdScalar_FFTRadix4(float *real, float *imaginary, size_t size, size_t quarter, const float *twiddles)
+{
+    const float *twiddleReal1 = twiddles;
+    const float *twiddleImaginary1 = twiddles + quarter;
+    const float *twiddleReal2 = twiddles + quarter * 2;
+    const float *twiddleImaginary2 = twiddles + quarter * 3;
+    const float *twiddleReal3 = twiddles + quarter * 4;
+    const float *twiddleImaginary3 = twiddles + quarter * 5;
+
+    for (size_t block = 0; block < size; block += quarter * 4)
+    {
+        for (size_t j = 0; j < quarter; j++)
+        {
+            size_t i0 = block + j;
+            size_t i1 = i0 + quarter;
+            size_t i2 = i1 + quarter;
+            size_t i3 = i2 + quarter;
+
+            // Twiddled inputs, the first one has a twiddle of 1
+            float real1 = real[i1] * twiddleReal1[j] - imaginary[i1] * twiddleImaginary1[j];
+            float imaginary1 = real[i1] * twiddleImaginary1[j] + imaginary[i1] * twiddleReal1[j];
+            float real2 = real[i2] * twiddleReal2[j] - imaginary[i2] * twiddleImaginary2[j];
+            float imaginary2 = real[i2] * twiddleImaginary2[j] + imaginary[i2] * twiddleReal2[j];
+            float real3 = real[i3] * twiddleReal3[j] - imaginary[i3] * twiddleImaginary3[j];
+            float imaginary3 = real[i3] * twiddleImaginary3[j] + imaginary[i3] * twiddleReal3[j];
+
+            float sumReal = real[i0] + real1;
+            float sumImaginary = imaginary[i0] + imaginary1;
+            float differenceReal = real[i0] - real1;
+            float differenceImaginary = imaginary[i0] - imaginary1;
+            float oddSumReal = real2 + real3;
+            float oddSumImaginary = imaginary2 + imaginary3;
+            float oddDifferenceReal = real2 - real3;
+            float oddDifferenceImaginary = imaginary2 - imaginary3;
+
+            // The odd difference is multiplied by -i for the second output and by i for the fourth
+            real[i0] = sumReal + oddSumReal;
+            imaginary[i0] = sumImaginary + oddSumImaginary;
+            real[i1] = differenceReal + oddDifferenceImaginary;
+            imaginary[i1] = differenceImaginary - oddDifferenceReal;
+            real[i2] = sumReal - oddSumReal;
+            imaginary[i2] = sumImaginary - oddSumImaginary;
+            real[i3] = differenceReal - oddDifferenceImaginary;
+            imaginary[i3] = differenceImaginary + oddDifferenceReal;
+        }
+    }
+}
+
+void SimdScalar_MatrixDotAdd(const float *left, size_t leftStride, const float *packedRight, float *result, size_t resultStride, size_t rows, size_t columns, size_t depth)
+{
+    for (size_t j = 0; j < columns; j += SIMD_GEMM_PANEL)
+    {
+        const float *panel = packedRight + j * depth;
+        size_t width = columns - j < SIMD_GEMM_PANEL ? columns - j : SIMD_GEMM_PANEL;
+
+        for (size_t i = 0; i < rows; i++)
+        {
+            const float *leftRow = left + i * leftStride;
+            float sums[SIMD_GEMM_PANEL] = {0};
+            for (size_t k = 0; k < depth; k++)
+            {
+                for (size_t c = 0; c < SIMD_GEMM_PANEL; c++)
+                {
+                    sums[c] += leftRow[k] * panel[k * SIMD_GEMM_PANEL + c];
+                }
+            }
+
+            float *resultRow = result + i * resultStride + j;
+            for (size_t c = 0; c < width; c++)
+            {
+                resultRow[c] += sums[c];
+            }
+        }
+    }
+}
+
+float SimdScalar_QuantizedDot(const int8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count)
+{
+    float sum = 0.0f;
+    for (size_t group = 0; group * groupSize < count; group++)
+    {
+        const int8_t *groupWeights = weights + group * groupSize;
+        const int8_t *groupValues = values + group * groupSize;
+
+        // Exact in integers inside a group, 127 * 127 * groupSize fits easily
+        int32_t groupSum = 0;
+        for (size_t i = 0; i < groupSize; i++)
+        {
+            groupSum += (int32_t)groupWeights[i] * (int32_t)groupValues[i];
+        }
+
+        sum += (float)groupSum * weightScales[group] * valueScales[group];
+    }
+
+    return sum;
+}
+
+float SimdScalar_Quantized4Dot(const uint8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count)
+{
+    size_t half = groupSize / 2;
+
+    float sum = 0.0f;
+    for (size_t group = 0; group * groupSize < count; group++)
+    {
+        const uint8_t *groupWeights = weights + group * half;
+        const int8_t *groupValues = values + group * groupSize;
+
+        int32_t groupSum = 0;
+        for (size_t i = 0; i < half; i++)
+        {
+            groupSum += ((int32_t)(groupWeights[i] & 0x0F) - 8) * (int32_t)groupValues[i];
+            groupSum += ((int32_t)(groupWeights[i] >> 4) - 8) * (int32_t)groupValues[half + i];
+        }
+
+        sum += (float)groupSum * weightScales[group] * valueScales[group];
+    }
+
+    return sum;
+}
+
+const SimdKernels SIMD_KERNELS_SCALAR = {
+    .add = SimdScalar_Add,
+    .multiply = SimdScalar_Multiply,
+    .lerp = SimdScalar_Lerp,
+    .dot = SimdScalar_Dot,
+    .normalize = SimdScalar_Normalize,
+    .matrix4Dot = SimdScalar_Matrix4Dot,
+    .matrix4Inverse = SimdScalar_Matrix4Inverse,
+    .transform = SimdScalar_Transform,
+    .sinCos = SimdScalar_SinCos,
+    .arcTan2 = SimdScalar_ArcTan2,
+    .complexMultiply = SimdScalar_ComplexMultiply,
+    .fftRadix4 = SimdScalar_FFTRadix4,
+    .matrixDotAdd = SimdScalar_MatrixDotAdd,
+    .quantizedDot = SimdScalar_QuantizedDot,
+    .quantized4Dot = SimdScalar_Quantized4Dot,
+};
+
+#pragma endregion Source Only
+
+SimdLevel Simd_GetLevel()
+{
+    int level = atomic_load_explicit(&SIMD_LEVEL, memory_order_relaxed);
+    if (level < 0)
+    {
+        level = (int)Simd_Detect();
+        atomic_store_explicit(&SIMD_LEVEL, level, memory_order_relaxed);
+    }
+
+    return (SimdLevel)level;
+}
+
+SimdLevel Simd_SetLevel(SimdLevel level)
+{
+    SimdLevel supportedLevel = Simd_Detect();
+
+    // SSE2 is the only level below AVX2 on the same architecture, NEON has no lower level but scalar.
+    bool isSupported = level == SimdLevel_Scalar || level == supportedLevel || (level == SimdLevel_SSE2 && supportedLevel == SimdLevel_AVX2);
+    if (!isSupported)
+    {
+        DebugWarning("%s is not supported by this CPU, %s is used instead.", Simd_GetLevelName(level), Simd_GetLevelName(supportedLevel));
+        level = supportedLevel;
+    }
+
+    atomic_store_explicit(&SIMD_LEVEL, (int)level, memory_order_relaxed);
+    return level;
+}
+
+const char *Simd_GetLevelName(SimdLevel level)
+{
+    switch (level)
+    {
+    case SimdLevel_Scalar:
+        return "Scalar";
+    case SimdLevel_SSE2:
+        return "SSE2";
+    case SimdLevel_AVX2:
+        return "AVX2";
+    case SimdLevel_NEON:
+        return "NEON";
+    default:
+        return "Unknown";
+    }
+}
+
+const SimdKernels *Simd_GetKernels()
+{
+    const SimdKernels *kernels = NULL;
+
+    switch (Simd_GetLevel())
+    {
+    case SimdLevel_SSE2:
+        kernels = SimdKernels_GetSSE2();
+        break;
+    case SimdLevel_AVX2:
+        kernels = SimdKernels_GetAVX2();
+        break;
+    case SimdLevel_NEON:
+        kernels = SimdKernels_GetNEON();
+        break;
+    default:
+        break;
+    }
+
+    return kernels != NULL ? kernels : &SIMD_KERNELS_SCALAR;
+}
+
+float *Simd_AllocateFloats(size_t count)
+{
+    // Rounded up to whole registers, aligned_alloc needs a multiple of the alignment.
+    size_t size = (count * sizeof(float) + SIMD_ALIGNMENT - 1) & ~(size_t)(SIMD_ALIGNMENT - 1);
+    size = size > 0 ? size : SIMD_ALIGNMENT;
+
+#if PLATFORM_WINDOWS
+    float *array = (float *)_aligned_malloc(size, SIMD_ALIGNMENT);
+#else
+    float *array = (float *)aligned_alloc(SIMD_ALIGNMENT, size);
+#endif
+    DebugAssert(array != NULL, "Memory allocation failed for SIMD array.");
+
+    return array;
+}
+
+void Simd_Free(float *array)
+{
+#if PLATFORM_WINDOWS
+    _aligned_free(array);
+#else
+    free(array);
+#endif
+}
+
+const SimdKernels *SimdKernels_GetScalar()
+{
+    return &SIMD_KERNELS_SCALAR;
+}
@@ -0,0 +1,613 @@
+#include "Maths/Simd.h"
+
+#if SIMD_ARCHITECTURE_ARM
+
+#include <arm_neon.h>
+
+#pragma region Source Only
+
+// Tails are finished with the scalar kernels.
+
+void SimdNEON_Add(const float *array1, const float *array2, float *result, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_f32(result + i, vaddq_f32(vld1q_f32(array1 + i), vld1q_f32(array2 + i)));
+    }
+
+    SimdKernels_GetScalar()->add(array1 + i, array2 + i, result + i, count - i);
+}
+
+void SimdNEON_Multiply(const float *array, float scalar, float *result, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_f32(result + i, vmulq_n_f32(vld1q_f32(array + i), scalar));
+    }
+
+    SimdKernels_GetScalar()->multiply(array + i, scalar, result + i, count - i);
+}
+
+void SimdNEON_Lerp(const float *startArray, const float *endArray, float time, float *result, size_t count)
+{
+    float32x4_t times = vdupq_n_f32(time);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t start = vld1q_f32(startArray + i);
+        float32x4_t end = vld1q_f32(endArray + i);
+        vst1q_f32(result + i, vfmaq_f32(start, vsubq_f32(end, start), times));
+    }
+
+    SimdKernels_GetScalar()->lerp(startArray + i, endArray + i, time, result + i, count - i);
+}
+
+void SimdNEON_Dot(const float *const *components1, const float *const *components2, int dimension, float *result, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for (int d = 0; d < dimension; d++)
+        {
+            sum = vfmaq_f32(sum, vld1q_f32(components1[d] + i), vld1q_f32(components2[d] + i));
+        }
+
+        vst1q_f32(result + i, sum);
+    }
+
+    const float *tail1[4];
+    const float *tail2[4];
+    for (int d = 0; d < dimension; d++)
+    {
+        tail1[d] = components1[d] + i;
+        tail2[d] = components2[d] + i;
+    }
+
+    SimdKernels_GetScalar()->dot(tail1, tail2, dimension, result + i, count - i);
+}
+
+void SimdNEON_Normalize(const float *const *components, float *const *results, int dimension, size_t count)
+{
+    float32x4_t ones = vdupq_n_f32(1.0f);
+    float32x4_t zeros = vdupq_n_f32(0.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t values[4];
+        float32x4_t squaredMagnitude = zeros;
+        for (int d = 0; d < dimension; d++)
+        {
+            values[d] = vld1q_f32(components[d] + i);
+            squaredMagnitude = vfmaq_f32(squaredMagnitude, values[d], values[d]);
+        }
+
+        // Exact square root and division instead of the 8 bit vrsqrte estimate. Zero vectors are masked to zero.
+        float32x4_t inverseMagnitude = vdivq_f32(ones, vsqrtq_f32(squaredMagnitude));
+        uint32x4_t isNonZero = vcgtq_f32(squaredMagnitude, zeros);
+        inverseMagnitude = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(inverseMagnitude), isNonZero));
+
+        for (int d = 0; d < dimension; d++)
+        {
+            vst1q_f32(results[d] + i, vmulq_f32(values[d], inverseMagnitude));
+        }
+    }
+
+    const float *tailComponents[4];
+    float *tailResults[4];
+    for (int d = 0; d < dimension; d++)
+    {
+        tailComponents[d] = components[d] + i;
+        tailResults[d] = results[d] + i;
+    }
+
+    SimdKernels_GetScalar()->normalize(tailComponents, tailResults, dimension, count - i);
+}
+
+void SimdNEON_Matrix4Dot(const float *matrix1, const float *matrix2, float *result)
+{
+    float32x4_t rows2[4];
+    for (int k = 0; k < 4; k++)
+    {
+        rows2[k] = vld1q_f32(matrix2 + k * 4);
+    }
+
+    // A result row is the rows of the second matrix weighted by the lanes of the same row of the first matrix.
+    for (int i = 0; i < 4; i++)
+    {
+        float32x4_t row1 = vld1q_f32(matrix1 + i * 4);
+        float32x4_t row = vmulq_laneq_f32(rows2[0], row1, 0);
+        row = vfmaq_laneq_f32(row, rows2[1], row1, 1);
+        row = vfmaq_laneq_f32(row, rows2[2], row1, 2);
+        row = vfmaq_laneq_f32(row, rows2[3], row1, 3);
+
+        vst1q_f32(result + i * 4, row);
+    }
+}
+
+// Swizzles of the 2x2 blocks stored as (m00, m01, m10, m11) for the block wise inverse, same lanes with _mm_shuffle_ps.
+// NEON has no immediate shuffle, the lanes are picked with table lookups of their bytes.
+#define SIMD_NEON_LANE_BYTES(lane) (uint8_t)(4 * (lane)), (uint8_t)(4 * (lane) + 1), (uint8_t)(4 * (lane) + 2), (uint8_t)(4 * (lane) + 3)
+#define SIMD_NEON_SHUFFLE(vector1, vector2, x, y, z, w)                                                            \
+    vreinterpretq_f32_u8(vqtbl2q_u8((uint8x16x2_t){{vreinterpretq_u8_f32(vector1), vreinterpretq_u8_f32(vector2)}}, \
+                                    vld1q_u8((const uint8_t[16]){SIMD_NEON_LANE_BYTES(x), SIMD_NEON_LANE_BYTES(y),     \
+                                                                 SIMD_NEON_LANE_BYTES((z) + 4), SIMD_NEON_LANE_BYTES((w) + 4)})))
+#define SIMD_NEON_SWIZZLE(vector, x, y, z, w)                                                                  \
+    vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(vector),                                              \
+                                    vld1q_u8((const uint8_t[16]){SIMD_NEON_LANE_BYTES(x), SIMD_NEON_LANE_BYTES(y), \
+                                                                 SIMD_NEON_LANE_BYTES(z), SIMD_NEON_LANE_BYTES(w)})))
+
+/// @brief Multiplies two 2x2 blocks, A * B.
+float32x4_t SimdNEON_Matrix2Dot(float32x4_t block1, float32x4_t block2)
+{
+    return vfmaq_f32(vmulq_f32(block1, SIMD_NEON_SWIZZLE(block2, 0, 3, 0, 3)),
+                     vrev64q_f32(block1), SIMD_NEON_SWIZZLE(block2, 2, 1, 2, 1));
+}
+
+/// @brief Multiplies the adjugate of a 2x2 block with another block, adj(A) * B.
+float32x4_t SimdNEON_Matrix2AdjugateDot(float32x4_t block1, float32x4_t block2)
+{
+    return vfmsq_f32(vmulq_f32(SIMD_NEON_SWIZZLE(block1, 3, 3, 0, 0), block2),
+                     SIMD_NEON_SWIZZLE(block1, 1, 1, 2, 2), vextq_f32(block2, block2, 2));
+}
+
+/// @brief Multiplies a 2x2 block with the adjugate of another block, A * adj(B).
+float32x4_t SimdNEON_Matrix2DotAdjugate(float32x4_t block1, float32x4_t block2)
+{
+    return vfmsq_f32(vmulq_f32(block1, SIMD_NEON_SWIZZLE(block2, 3, 0, 3, 0)),
+                     vrev64q_f32(block1), SIMD_NEON_SWIZZLE(block2, 2, 1, 2, 1));
+}
+
+bool SimdNEON_Matrix4Inverse(const float *matrix, float *result)
+{
+    float32x4_t row0 = vld1q_f32(matrix);
+    float32x4_t row1 = vld1q_f32(matrix + 4);
+    float32x4_t row2 = vld1q_f32(matrix + 8);
+    float32x4_t row3 = vld1q_f32(matrix + 12);
+
+    // The matrix as 2x2 blocks | A B |
+    //                          | C D |
+    float32x4_t a = vcombine_f32(vget_low_f32(row0), vget_low_f32(row1));
+    float32x4_t b = vcombine_f32(vget_high_f32(row0), vget_high_f32(row1));
+    float32x4_t c = vcombine_f32(vget_low_f32(row2), vget_low_f32(row3));
+    float32x4_t d = vcombine_f32(vget_high_f32(row2), vget_high_f32(row3));
+
+    // Determinants of the blocks as (|A|, |B|, |C|, |D|)
+    float32x4_t blockDeterminants = vfmsq_f32(vmulq_f32(SIMD_NEON_SHUFFLE(row0, row2, 0, 2, 0, 2), SIMD_NEON_SHUFFLE(row1, row3, 1, 3, 1, 3)),
+                                              SIMD_NEON_SHUFFLE(row0, row2, 1, 3, 1, 3), SIMD_NEON_SHUFFLE(row1, row3, 0, 2, 0, 2));
+
+    float32x4_t adjugateDC = SimdNEON_Matrix2AdjugateDot(d, c);
+    float32x4_t adjugateAB = SimdNEON_Matrix2AdjugateDot(a, b);
+
+    // Adjugates of the blocks of the inverse | X Y |
+    //                                        | Z W |
+    float32x4_t x = vsubq_f32(vmulq_laneq_f32(a, blockDeterminants, 3), SimdNEON_Matrix2Dot(b, adjugateDC));
+    float32x4_t w = vsubq_f32(vmulq_laneq_f32(d, blockDeterminants, 0), SimdNEON_Matrix2Dot(c, adjugateAB));
+    float32x4_t y = vsubq_f32(vmulq_laneq_f32(c, blockDeterminants, 1), SimdNEON_Matrix2DotAdjugate(d, adjugateAB));
+    float32x4_t z = vsubq_f32(vmulq_laneq_f32(b, blockDeterminants, 2), SimdNEON_Matrix2DotAdjugate(a, adjugateDC));
+
+    // |M| = |A||D| + |B||C| - trace(adj(A) B adj(D) C)
+    float trace = vaddvq_f32(vmulq_f32(adjugateAB, SIMD_NEON_SWIZZLE(adjugateDC, 0, 2, 1, 3)));
+    float determinant = vgetq_lane_f32(blockDeterminants, 0) * vgetq_lane_f32(blockDeterminants, 3) +
+                        vgetq_lane_f32(blockDeterminants, 1) * vgetq_lane_f32(blockDeterminants, 2) - trace;
+    if (determinant == 0.0f)
+    {
+        return false;
+    }
+
+    // Signs of the 2x2 adjugates applied together with the determinant
+    float inverseDeterminant = 1.0f / determinant;
+    float32x4_t signedInverseDeterminant = vmulq_n_f32(vld1q_f32((const float[4]){1.0f, -1.0f, -1.0f, 1.0f}), inverseDeterminant);
+    x = vmulq_f32(x, signedInverseDeterminant);
+    y = vmulq_f32(y, signedInverseDeterminant);
+    z = vmulq_f32(z, signedInverseDeterminant);
+    w = vmulq_f32(w, signedInverseDeterminant);
+
+    // The last swizzle of the adjugates is merged with moving the blocks back to rows.
+    vst1q_f32(result, SIMD_NEON_SHUFFLE(x, y, 3, 1, 3, 1));
+    vst1q_f32(result + 4, SIMD_NEON_SHUFFLE(x, y, 2, 0, 2, 0));
+    vst1q_f32(result + 8, SIMD_NEON_SHUFFLE(z, w, 3, 1, 3, 1));
+    vst1q_f32(result + 12, SIMD_NEON_SHUFFLE(z, w, 2, 0, 2, 0));
+
+    return true;
+}
+
+void SimdNEON_Transform(const float *matrix, const float *const *components, int dimension, float *const *results, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t x = vld1q_f32(components[0] + i);
+        float32x4_t y = vld1q_f32(components[1] + i);
+        float32x4_t z = vld1q_f32(components[2] + i);
+
+        for (int row = 0; row < dimension; row++)
+        {
+            const float *rowElements = matrix + row * 4;
+            float32x4_t value = dimension == 4 ? vmulq_n_f32(vld1q_f32(components[3] + i), rowElements[3]) : vdupq_n_f32(rowElements[3]);
+            value = vfmaq_n_f32(value, x, rowElements[0]);
+            value = vfmaq_n_f32(value, y, rowElements[1]);
+            value = vfmaq_n_f32(value, z, rowElements[2]);
+            vst1q_f32(results[row] + i, value);
+        }
+    }
+
+    const float *tailComponents[4];
+    float *tailResults[4];
+    for (int d = 0; d < dimension; d++)
+    {
+        tailComponents[d] = components[d] + i;
+        tailResults[d] = results[d] + i;
+    }
+
+    SimdKernels_GetScalar()->transform(matrix, tailComponents, dimension, tailResults, count - i);
+}
+
+/// @brief Evaluates a polynomial of broadcast coefficients with Horner's method.
+float32x4_t SimdNEON_Polynomial(const float32x4_t *coefficients, int count, float32x4_t z)
+{
+    float32x4_t result = coefficients[count - 1];
+    for (int i = count - 2; i >= 0; i--)
+    {
+        result = vfmaq_f32(coefficients[i], result, z);
+    }
+
+    return result;
+}
+
+void SimdNEON_SinCos(const float *radians, float *sines, float *cosines, TrigAccuracy accuracy, size_t count)
+{
+    const TrigPolynomials *polynomials = Trig_GetPolynomials(accuracy);
+    if (polynomials == NULL)
+    {
+        SimdKernels_GetScalar()->sinCos(radians, sines, cosines, accuracy, count);
+        return;
+    }
+
+    float32x4_t sineCoefficients[3];
+    float32x4_t cosineCoefficients[3];
+    for (int k = 0; k < polynomials->sineCount; k++)
+    {
+        sineCoefficients[k] = vdupq_n_f32(polynomials->sine[k]);
+    }
+
+    for (int k = 0; k < polynomials->cosineCount; k++)
+    {
+        cosineCoefficients[k] = vdupq_n_f32(polynomials->cosine[k]);
+    }
+
+    int32x4_t ones = vdupq_n_s32(1);
+    int32x4_t twos = vdupq_n_s32(2);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // Same steps with SinCosRad, vcvtnq rounds to the nearest even like lrintf.
+        float32x4_t radian = vld1q_f32(radians + i);
+        int32x4_t quadrant = vcvtnq_s32_f32(vmulq_n_f32(radian, TRIG_TWO_OVER_PI));
+        float32x4_t quadrantValue = vcvtq_f32_s32(quadrant);
+
+        float32x4_t reduced = vfmsq_n_f32(radian, quadrantValue, TRIG_HALF_PI_1);
+        reduced = vfmsq_n_f32(reduced, quadrantValue, TRIG_HALF_PI_2);
+        reduced = vfmsq_n_f32(reduced, quadrantValue, TRIG_HALF_PI_3);
+        float32x4_t z = vmulq_f32(reduced, reduced);
+
+        float32x4_t reducedSine = vfmaq_f32(reduced, vmulq_f32(reduced, z), SimdNEON_Polynomial(sineCoefficients, polynomials->sineCount, z));
+        float32x4_t reducedCosine = vfmaq_f32(vdupq_n_f32(1.0f), z, SimdNEON_Polynomial(cosineCoefficients, polynomials->cosineCount, z));
+
+        // Odd quadrants swap sine and cosine, the quadrant bits moved to the sign bit give the signs.
+        uint32x4_t isSwapped = vtstq_s32(quadrant, ones);
+        uint32x4_t sineSign = vreinterpretq_u32_s32(vshlq_n_s32(vandq_s32(quadrant, twos), 30));
+        uint32x4_t cosineSign = vreinterpretq_u32_s32(vshlq_n_s32(vandq_s32(vaddq_s32(quadrant, ones), twos), 30));
+
+        if (sines != NULL)
+        {
+            uint32x4_t sine = vreinterpretq_u32_f32(vbslq_f32(isSwapped, reducedCosine, reducedSine));
+            vst1q_f32(sines + i, vreinterpretq_f32_u32(veorq_u32(sine, sineSign)));
+        }
+
+        if (cosines != NULL)
+        {
+            uint32x4_t cosine = vreinterpretq_u32_f32(vbslq_f32(isSwapped, reducedSine, reducedCosine));
+            vst1q_f32(cosines + i, vreinterpretq_f32_u32(veorq_u32(cosine, cosineSign)));
+        }
+    }
+
+    SimdKernels_GetScalar()->sinCos(radians + i, sines != NULL ? sines + i : NULL, cosines != NULL ? cosines + i : NULL, accuracy, count - i);
+}
+
+void SimdNEON_ArcTan2(const float *ys, const float *xs, float *results, TrigAccuracy accuracy, size_t count)
+{
+    const TrigPolynomials *polynomials = Trig_GetPolynomials(accuracy);
+    if (polynomials == NULL)
+    {
+        SimdKernels_GetScalar()->arcTan2(ys, xs, results, accuracy, count);
+        return;
+    }
+
+    float32x4_t coefficients[8];
+    for (int k = 0; k < polynomials->arcTangentCount; k++)
+    {
+        coefficients[k] = vdupq_n_f32(polynomials->arcTangent[k]);
+    }
+
+    uint32x4_t signMask = vdupq_n_u32(0x80000000u);
+    float32x4_t zeros = vdupq_n_f32(0.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // Same steps with ArcTan2RadFast, the ratio of a zero point is masked from NaN to zero and the sign bit of x picks the left half.
+        float32x4_t y = vld1q_f32(ys + i);
+        float32x4_t x = vld1q_f32(xs + i);
+        float32x4_t absoluteX = vabsq_f32(x);
+        float32x4_t absoluteY = vabsq_f32(y);
+        float32x4_t maximum = vmaxq_f32(absoluteX, absoluteY);
+        float32x4_t ratio = vdivq_f32(vminq_f32(absoluteX, absoluteY), maximum);
+        ratio = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(ratio), vcgtq_f32(maximum, zeros)));
+
+        float32x4_t angle = vmulq_f32(ratio, SimdNEON_Polynomial(coefficients, polynomials->arcTangentCount, vmulq_f32(ratio, ratio)));
+        angle = vbslq_f32(vcgtq_f32(absoluteY, absoluteX), vsubq_f32(vdupq_n_f32(PI / 2.0f), angle), angle);
+        uint32x4_t isLeft = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_f32(x), 31));
+        angle = vbslq_f32(isLeft, vsubq_f32(vdupq_n_f32(PI), angle), angle);
+
+        vst1q_f32(results + i, vbslq_f32(signMask, y, vabsq_f32(angle)));
+    }
+
+    SimdKernels_GetScalar()->arcTan2(ys + i, xs + i, results + i, accuracy, count - i);
+}
+
+void SimdNEON_ComplexMultiply(const float *real1, const float *imaginary1, const float *real2, const float *imaginary2, float *realResult, float *imaginaryResult, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t r1 = vld1q_f32(real1 + i);
+        float32x4_t i1 = vld1q_f32(imaginary1 + i);
+        float32x4_t r2 = vld1q_f32(real2 + i);
+        float32x4_t i2 = vld1q_f32(imaginary2 + i);
+
+        vst1q_f32(realResult + i, vfmsq_f32(vmulq_f32(r1, r2), i1, i2));
+        vst1q_f32(imaginaryResult + i, vfmaq_f32(vmulq_f32(r1, i2), i1, r2));
+    }
+
+    SimdKernels_GetScalar()->complexMultiply(real1 + i, imaginary1 + i, real2 + i, imaginary2 + i, realResult + i, imaginaryResult + i, count - i);
+}
+
+void SimdNEON_FFTRadix4(float *real, float *imaginary, size_t size, size_t quarter, const float *twiddles)
+{
+    // Quarters are 1 or 2 times a power of 4, the ones below 4 do not fill a register and the others are whole registers.
+    if (quarter < 4)
+    {
+        SimdKernels_GetScalar()->fftRadix4(real, imaginary, size, quarter, twiddles);
+        return;
+    }
+
+    for (size_t block = 0; block < size; block += quarter * 4)
+    {
+        for (size_t j = 0; j < quarter; j += 4)
+        {
+            float *real0 = real + block + j;
+            float *imaginary0 = imaginary + block + j;
+
+            // Twiddled inputs, same steps with the scalar kernel four butterflies at a time
+            float32x4_t twiddleReal = vld1q_f32(twiddles + j);
+            float32x4_t twiddleImaginary = vld1q_f32(twiddles + quarter + j);
+            float32x4_t inputReal = vld1q_f32(real0 + quarter);
+            float32x4_t inputImaginary = vld1q_f32(imaginary0 + quarter);
+            float32x4_t real1 = vfmsq_f32(vmulq_f32(inputReal, twiddleReal), inputImaginary, twiddleImaginary);
+            float32x4_t imaginary1 = vfmaq_f32(vmulq_f32(inputReal, twiddleImaginary), inputImaginary, twiddleReal);
+
+            twiddleReal = vld1q_f32(twiddles + quarter * 2 + j);
+            twiddleImaginary = vld1q_f32(twiddles + quarter * 3 + j);
+            inputReal = vld1q_f32(real0 + quarter * 2);
+            inputImaginary = vld1q_f32(imaginary0 + quarter * 2);
+            float32x4_t real2 = vfmsq_f32(vmulq_f32(inputReal, twiddleReal), inputImaginary, twiddleImaginary);
+            float32x4_t imaginary2 = vfmaq_f32(vmulq_f32(inputReal, twiddleImaginary), inputImaginary, twiddleReal);
+
+            twiddleReal = vld1q_f32(twiddles + quarter * 4 + j);
+            twiddleImaginary = vld1q_f32(twiddles + quarter * 5 + j);
+            inputReal = vld1q_f32(real0 + quarter * 3);
+            inputImaginary = vld1q_f32(imaginary0 + quarter * 3);
+            float32x4_t real3 = vfmsq_f32(vmulq_f32(inputReal, twiddleReal), inputImaginary, twiddleImaginary);
+            float32x4_t imaginary3 = vfmaq_f32(vmulq_f32(inputReal, twiddleImaginary), inputImaginary, twiddleReal);
+
+            float32x4_t real0Value = vld1q_f32(real0);
+            float32x4_t imaginary0Value = vld1q_f32(imaginary0);
+            float32x4_t sumReal = vaddq_f32(real0Value, real1);
+            float32x4_t sumImaginary = vaddq_f32(imaginary0Value, imaginary1);
+            float32x4_t differenceReal = vsubq_f32(real0Value, real1);
+            float32x4_t differenceImaginary = vsubq_f32(imaginary0Value, imaginary1);
+            float32x4_t oddSumReal = vaddq_f32(real2, real3);
+            float32x4_t oddSumImaginary = vaddq_f32(imaginary2, imaginary3);
+            float32x4_t oddDifferenceReal = vsubq_f32(real2, real3);
+            float32x4_t oddDifferenceImaginary = vsubq_f32(imaginary2, imaginary3);
+
+            vst1q_f32(real0, vaddq_f32(sumReal, oddSumReal));
+            vst1q_f32(imaginary0, vaddq_f32(sumImaginary, oddSumImaginary));
+            vst1q_f32(real0 + quarter, vaddq_f32(differenceReal, oddDifferenceImaginary));
+            vst1q_f32(imaginary0 + quarter, vsubq_f32(differenceImaginary, oddDifferenceReal));
+            vst1q_f32(real0 + quarter * 2, vsubq_f32(sumReal, oddSumReal));
+            vst1q_f32(imaginary0 + quarter * 2, vsubq_f32(sumImaginary, oddSumImaginary));
+            vst1q_f32(real0 + quarter * 3, vsubq_f32(differenceReal, oddDifferenceImaginary));
+            vst1q_f32(imaginary0 + quarter * 3, vaddq_f32(differenceImaginary, oddDifferenceReal));
+        }
+    }
+}
+
+/// @brief Adds the sums of a block of matrixDotAdd at the edge of the result, where only part of the block is inside it.
+void SimdNEON_GemmAddTile(const float *tile, size_t tileStride, float *result, size_t resultStride, size_t height, size_t width)
+{
+    for (size_t r = 0; r < height; r++)
+    {
+        for (size_t c = 0; c < width; c++)
+        {
+            result[r * resultStride + c] += tile[r * tileStride + c];
+        }
+    }
+}
+
+void SimdNEON_MatrixDotAdd(const float *left, size_t leftStride, const float *packedRight, float *result, size_t resultStride, size_t rows, size_t columns, size_t depth)
+{
+    for (size_t j = 0; j < columns; j += SIMD_GEMM_PANEL)
+    {
+        const float *panel = packedRight + j * depth;
+        size_t width = columns - j < SIMD_GEMM_PANEL ? columns - j : SIMD_GEMM_PANEL;
+
+        // Blocks of 4 rows by a whole panel, with the sums in 16 of the 32 registers. Rows past the left matrix repeat its last row and are not written.
+        for (size_t i = 0; i < rows; i += 4)
+        {
+            size_t height = rows - i < 4 ? rows - i : 4;
+            const float *leftRows[4];
+            for (size_t r = 0; r < 4; r++)
+            {
+                leftRows[r] = left + (i + (r < height ? r : height - 1)) * leftStride;
+            }
+
+            float32x4_t sums[4][4];
+            for (size_t r = 0; r < 4; r++)
+            {
+                for (size_t c = 0; c < 4; c++)
+                {
+                    sums[r][c] = vdupq_n_f32(0.0f);
+                }
+            }
+
+            const float *right = panel;
+            for (size_t k = 0; k < depth; k++, right += SIMD_GEMM_PANEL)
+            {
+                float32x4_t right0 = vld1q_f32(right);
+                float32x4_t right1 = vld1q_f32(right + 4);
+                float32x4_t right2 = vld1q_f32(right + 8);
+                float32x4_t right3 = vld1q_f32(right + 12);
+
+                for (size_t r = 0; r < 4; r++)
+                {
+                    float value = leftRows[r][k];
+                    sums[r][0] = vfmaq_n_f32(sums[r][0], right0, value);
+                    sums[r][1] = vfmaq_n_f32(sums[r][1], right1, value);
+                    sums[r][2] = vfmaq_n_f32(sums[r][2], right2, value);
+                    sums[r][3] = vfmaq_n_f32(sums[r][3], right3, value);
+                }
+            }
+
+            float *resultBlock = result + i * resultStride + j;
+            if (height == 4 && width == SIMD_GEMM_PANEL)
+            {
+                for (size_t r = 0; r < 4; r++, resultBlock += resultStride)
+                {
+                    for (size_t c = 0; c < 4; c++)
+                    {
+                        vst1q_f32(resultBlock + c * 4, vaddq_f32(vld1q_f32(resultBlock + c * 4), sums[r][c]));
+                    }
+                }
+            }
+            else
+            {
+                float tile[4 * SIMD_GEMM_PANEL];
+                for (size_t r = 0; r < 4; r++)
+                {
+                    for (size_t c = 0; c < 4; c++)
+                    {
+                        vst1q_f32(tile + r * SIMD_GEMM_PANEL + c * 4, sums[r][c]);
+                    }
+                }
+                SimdNEON_GemmAddTile(tile, SIMD_GEMM_PANEL, resultBlock, resultStride, height, width);
+            }
+        }
+    }
+}
+
+/// @brief Multiplies 16 int8 pairs and adds them to 4 int32 sums, through int16 products which cannot overflow.
+int32x4_t SimdNEON_DotInt8(int32x4_t sums, int8x16_t weights, int8x16_t values)
+{
+    sums = vpadalq_s16(sums, vmull_s8(vget_low_s8(weights), vget_low_s8(values)));
+    return vpadalq_s16(sums, vmull_s8(vget_high_s8(weights), vget_high_s8(values)));
+}
+
+float SimdNEON_QuantizedDot(const int8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count)
+{
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    for (size_t group = 0; group * groupSize < count; group++)
+    {
+        const int8_t *groupWeights = weights + group * groupSize;
+        const int8_t *groupValues = values + group * groupSize;
+
+        int32x4_t groupSum = vdupq_n_s32(0);
+        for (size_t i = 0; i < groupSize; i += 16)
+        {
+            groupSum = SimdNEON_DotInt8(groupSum, vld1q_s8(groupWeights + i), vld1q_s8(groupValues + i));
+        }
+
+        sum = vfmaq_n_f32(sum, vcvtq_f32_s32(groupSum), weightScales[group] * valueScales[group]);
+    }
+
+    return vaddvq_f32(sum);
+}
+
+float SimdNEON_Quantized4Dot(const uint8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count)
+{
+    uint8x16_t lowMask = vdupq_n_u8(0x0F);
+    int8x16_t offset = vdupq_n_s8(8);
+    size_t half = groupSize / 2;
+
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    for (size_t group = 0; group * groupSize < count; group++)
+    {
+        const uint8_t *groupWeights = weights + group * half;
+        const int8_t *groupValues = values + group * groupSize;
+
+        int32x4_t groupSum = vdupq_n_s32(0);
+        for (size_t i = 0; i < half; i += 16)
+        {
+            uint8x16_t bytes = vld1q_u8(groupWeights + i);
+            int8x16_t low = vsubq_s8(vreinterpretq_s8_u8(vandq_u8(bytes, lowMask)), offset);
+            int8x16_t high = vsubq_s8(vreinterpretq_s8_u8(vshrq_n_u8(bytes, 4)), offset);
+
+            groupSum = SimdNEON_DotInt8(groupSum, low, vld1q_s8(groupValues + i));
+            groupSum = SimdNEON_DotInt8(groupSum, high, vld1q_s8(groupValues + half + i));
+        }
+
+        sum = vfmaq_n_f32(sum, vcvtq_f32_s32(groupSum), weightScales[group] * valueScales[group]);
+    }
+
+    return vaddvq_f32(sum);
+}
+
+const SimdKernels SIMD_KERNELS_NEON = {
+    .add = SimdNEON_Add,
+    .multiply = SimdNEON_Multiply,
+    .lerp = SimdNEON_Lerp,
+    .dot = SimdNEON_Dot,
+    .normalize = SimdNEON_Normalize,
+    .matrix4Dot = SimdNEON_Matrix4Dot,
+    .matrix4Inverse = SimdNEON_Matrix4Inverse,
+    .transform = SimdNEON_Transform,
+    .sinCos = SimdNEON_SinCos,
+    .arcTan2 = SimdNEON_ArcTan2,
+    .complexMultiply = SimdNEON_ComplexMultiply,
+    .fftRadix4 = SimdNEON_FFTRadix4,
+    .matrixDotAdd = SimdNEON_MatrixDotAdd,
+    .quantizedDot = SimdNEON_QuantizedDot,
+    .quantized4Dot = SimdNEON_Quantized4Dot,
+};
+
+#pragma endregion Source Only
+
+const SimdKernels *SimdKernels_GetNEON()
+{
+    return &SIMD_KERNELS_NEON;
+}
+
+#else
+
+const SimdKernels *SimdKernels_GetNEON()
+{
+    return NULL;
+}
+
+#endif // SIMD_ARCHITECTURE_ARM
@@ -0,0 +1,1127 @@
+#include "Maths/Simd.h"
+
+#if SIMD_ARCHITECTURE_X86
+
+#include <immintrin.h>
+
+#pragma region Source Only
+
+// Loads are unaligned, arrays of Simd_AllocateFloats are aligned and cost nothing extra. Tails are finished with the scalar kernels.
+
+void SimdSSE2_Add(const float *array1, const float *array2, float *result, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(result + i, _mm_add_ps(_mm_loadu_ps(array1 + i), _mm_loadu_ps(array2 + i)));
+    }
+
+    SimdKernels_GetScalar()->add(array1 + i, array2 + i, result + i, count - i);
+}
+
+void SimdSSE2_Multiply(const float *array, float scalar, float *result, size_t count)
+{
+    __m128 scalars = _mm_set1_ps(scalar);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(result + i, _mm_mul_ps(_mm_loadu_ps(array + i), scalars));
+    }
+
+    SimdKernels_GetScalar()->multiply(array + i, scalar, result + i, count - i);
+}
+
+void SimdSSE2_Lerp(const float *startArray, const float *endArray, float time, float *result, size_t count)
+{
+    __m128 times = _mm_set1_ps(time);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 start = _mm_loadu_ps(startArray + i);
+        __m128 end = _mm_loadu_ps(endArray + i);
+        _mm_storeu_ps(result + i, _mm_add_ps(start, _mm_mul_ps(_mm_sub_ps(end, start), times)));
+    }
+
+    SimdKernels_GetScalar()->lerp(startArray + i, endArray + i, time, result + i, count - i);
+}
+
+void SimdSSE2_Dot(const float *const *components1, const float *const *components2, int dimension, float *result, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 sum = _mm_setzero_ps();
+        for (int d = 0; d < dimension; d++)
+        {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(components1[d] + i), _mm_loadu_ps(components2[d] + i)));
+        }
+
+        _mm_storeu_ps(result + i, sum);
+    }
+
+    const float *tail1[4];
+    const float *tail2[4];
+    for (int d = 0; d < dimension; d++)
+    {
+        tail1[d] = components1[d] + i;
+        tail2[d] = components2[d] + i;
+    }
+
+    SimdKernels_GetScalar()->dot(tail1, tail2, dimension, result + i, count - i);
+}
+
+void SimdSSE2_Normalize(const float *const *components, float *const *results, int dimension, size_t count)
+{
+    __m128 ones = _mm_set1_ps(1.0f);
+    __m128 zeros = _mm_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 values[4];
+        __m128 squaredMagnitude = zeros;
+        for (int d = 0; d < dimension; d++)
+        {
+            values[d] = _mm_loadu_ps(components[d] + i);
+            squaredMagnitude = _mm_add_ps(squaredMagnitude, _mm_mul_ps(values[d], values[d]));
+        }
+
+        // Exact square root and division instead of the 12 bit rsqrt estimate. Zero vectors are masked to zero.
+        __m128 inverseMagnitude = _mm_div_ps(ones, _mm_sqrt_ps(squaredMagnitude));
+        inverseMagnitude = _mm_and_ps(inverseMagnitude, _mm_cmpgt_ps(squaredMagnitude, zeros));
+
+        for (int d = 0; d < dimension; d++)
+        {
+            _mm_storeu_ps(results[d] + i, _mm_mul_ps(values[d], inverseMagnitude));
+        }
+    }
+
+    const float *tailComponents[4];
+    float *tailResults[4];
+    for (int d = 0; d < dimension; d++)
+    {
+        tailComponents[d] = components[d] + i;
+        tailResults[d] = results[d] + i;
+    }
+
+    SimdKernels_GetScalar()->normalize(tailComponents, tailResults, dimension, count - i);
+}
+
+void SimdSSE2_Matrix4Dot(const float *matrix1, const float *matrix2, float *result)
+{
+    __m128 rows2[4];
+    for (int k = 0; k < 4; k++)
+    {
+        rows2[k] = _mm_load_ps(matrix2 + k * 4);
+    }
+
+    // A result row is the rows of the second matrix weighted by the elements of the same row of the first matrix.
+    for (int i = 0; i < 4; i++)
+    {
+        __m128 row = _mm_mul_ps(_mm_set1_ps(matrix1[i * 4]), rows2[0]);
+        for (int k = 1; k < 4; k++)
+        {
+            row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(matrix1[i * 4 + k]), rows2[k]));
+        }
+
+        _mm_store_ps(result + i * 4, row);
+    }
+}
+
+// Swizzles of the 2x2 blocks stored as (m00, m01, m10, m11) for the block wise inverse
+#define SIMD_SSE2_SHUFFLE(vector1, vector2, x, y, z, w) _mm_shuffle_ps(vector1, vector2, _MM_SHUFFLE(w, z, y, x))
+#define SIMD_SSE2_SWIZZLE(vector, x, y, z, w) SIMD_SSE2_SHUFFLE(vector, vector, x, y, z, w)
+
+/// @brief Multiplies two 2x2 blocks, A * B.
+__m128 SimdSSE2_Matrix2Dot(__m128 block1, __m128 block2)
+{
+    return _mm_add_ps(_mm_mul_ps(block1, SIMD_SSE2_SWIZZLE(block2, 0, 3, 0, 3)),
+                      _mm_mul_ps(SIMD_SSE2_SWIZZLE(block1, 1, 0, 3, 2), SIMD_SSE2_SWIZZLE(block2, 2, 1, 2, 1)));
+}
+
+/// @brief Multiplies the adjugate of a 2x2 block with another block, adj(A) * B.
+__m128 SimdSSE2_Matrix2AdjugateDot(__m128 block1, __m128 block2)
+{
+    return _mm_sub_ps(_mm_mul_ps(SIMD_SSE2_SWIZZLE(block1, 3, 3, 0, 0), block2),
+                      _mm_mul_ps(SIMD_SSE2_SWIZZLE(block1, 1, 1, 2, 2), SIMD_SSE2_SWIZZLE(block2, 2, 3, 0, 1)));
+}
+
+/// @brief Multiplies a 2x2 block with the adjugate of another block, A * adj(B).
+__m128 SimdSSE2_Matrix2DotAdjugate(__m128 block1, __m128 block2)
+{
+    return _mm_sub_ps(_mm_mul_ps(block1, SIMD_SSE2_SWIZZLE(block2, 3, 0, 3, 0)),
+                      _mm_mul_ps(SIMD_SSE2_SWIZZLE(block1, 1, 0, 3, 2), SIMD_SSE2_SWIZZLE(block2, 2, 1, 2, 1)));
+}
+
+bool SimdSSE2_Matrix4Inverse(const float *matrix, float *result)
+{
+    __m128 row0 = _mm_load_ps(matrix);
+    __m128 row1 = _mm_load_ps(matrix + 4);
+    __m128 row2 = _mm_load_ps(matrix + 8);
+    __m128 row3 = _mm_load_ps(matrix + 12);
+
+    // The matrix as 2x2 blocks | A B |
+    //                          | C D |
+    __m128 a = _mm_movelh_ps(row0, row1);
+    __m128 b = _mm_movehl_ps(row1, row0);
+    __m128 c = _mm_movelh_ps(row2, row3);
+    __m128 d = _mm_movehl_ps(row3, row2);
+
+    // Determinants of the blocks as (|A|, |B|, |C|, |D|)
+    __m128 blockDeterminants = _mm_sub_ps(_mm_mul_ps(SIMD_SSE2_SHUFFLE(row0, row2, 0, 2, 0, 2), SIMD_SSE2_SHUFFLE(row1, row3, 1, 3, 1, 3)),
+                                          _mm_mul_ps(SIMD_SSE2_SHUFFLE(row0, row2, 1, 3, 1, 3), SIMD_SSE2_SHUFFLE(row1, row3, 0, 2, 0, 2)));
+    __m128 determinantA = SIMD_SSE2_SWIZZLE(blockDeterminants, 0, 0, 0, 0);
+    __m128 determinantB = SIMD_SSE2_SWIZZLE(blockDeterminants, 1, 1, 1, 1);
+    __m128 determinantC = SIMD_SSE2_SWIZZLE(blockDeterminants, 2, 2, 2, 2);
+    __m128 determinantD = SIMD_SSE2_SWIZZLE(blockDeterminants, 3, 3, 3, 3);
+
+    __m128 adjugateDC = SimdSSE2_Matrix2AdjugateDot(d, c);
+    __m128 adjugateAB = SimdSSE2_Matrix2AdjugateDot(a, b);
+
+    // Adjugates of the blocks of the inverse | X Y |
+    //                                        | Z W |
+    __m128 x = _mm_sub_ps(_mm_mul_ps(determinantD, a), SimdSSE2_Matrix2Dot(b, adjugateDC));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(determinantA, d), SimdSSE2_Matrix2Dot(c, adjugateAB));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(determinantB, c), SimdSSE2_Matrix2DotAdjugate(d, adjugateAB));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(determinantC, b), SimdSSE2_Matrix2DotAdjugate(a, adjugateDC));
+
+    // |M| = |A||D| + |B||C| - trace(adj(A) B adj(D) C)
+    __m128 trace = _mm_mul_ps(adjugateAB, SIMD_SSE2_SWIZZLE(adjugateDC, 0, 2, 1, 3));
+    trace = _mm_add_ps(trace, SIMD_SSE2_SWIZZLE(trace, 2, 3, 0, 1));
+    trace = _mm_add_ps(trace, SIMD_SSE2_SWIZZLE(trace, 1, 0, 3, 2));
+
+    __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC)), trace);
+    if (_mm_cvtss_f32(determinant) == 0.0f)
+    {
+        return false;
+    }
+
+    // Signs of the 2x2 adjugates applied together with the determinant
+    __m128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+    x = _mm_mul_ps(x, inverseDeterminant);
+    y = _mm_mul_ps(y, inverseDeterminant);
+    z = _mm_mul_ps(z, inverseDeterminant);
+    w = _mm_mul_ps(w, inverseDeterminant);
+
+    // The last swizzle of the adjugates is merged with moving the blocks back to rows.
+    _mm_store_ps(result, SIMD_SSE2_SHUFFLE(x, y, 3, 1, 3, 1));
+    _mm_store_ps(result + 4, SIMD_SSE2_SHUFFLE(x, y, 2, 0, 2, 0));
+    _mm_store_ps(result + 8, SIMD_SSE2_SHUFFLE(z, w, 3, 1, 3, 1));
+    _mm_store_ps(result + 12, SIMD_SSE2_SHUFFLE(z, w, 2, 0, 2, 0));
+
+    return true;
+}
+
+void SimdSSE2_Transform(const float *matrix, const float *const *components, int dimension, float *const *results, size_t count)
+{
+    __m128 elements[16];
+    for (int e = 0; e < 16; e++)
+    {
+        elements[e] = _mm_set1_ps(matrix[e]);
+    }
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(components[0] + i);
+        __m128 y = _mm_loadu_ps(components[1] + i);
+        __m128 z = _mm_loadu_ps(components[2] + i);
+        __m128 w = dimension == 4 ? _mm_loadu_ps(components[3] + i) : _mm_set1_ps(1.0f);
+
+        for (int row = 0; row < dimension; row++)
+        {
+            const __m128 *rowElements = elements + row * 4;
+            __m128 value = _mm_add_ps(_mm_mul_ps(rowElements[0], x), _mm_mul_ps(rowElements[1], y));
+            value = _mm_add_ps(value, _mm_add_ps(_mm_mul_ps(rowElements[2], z), _mm_mul_ps(rowElements[3], w)));
+            _mm_storeu_ps(results[row] + i, value);
+        }
+    }
+
+    const float *tailComponents[4];
+    float *tailResults[4];
+    for (int d = 0; d < dimension; d++)
+    {
+        tailComponents[d] = components[d] + i;
+        tailResults[d] = results[d] + i;
+    }
+
+    SimdKernels_GetScalar()->transform(matrix, tailComponents, dimension, tailResults, count - i);
+}
+
+/// @brief Evaluates a polynomial of broadcast coefficients with Horner's method.
+__m128 SimdSSE2_Polynomial(const __m128 *coefficients, int count, __m128 z)
+{
+    __m128 result = coefficients[count - 1];
+    for (int i = count - 2; i >= 0; i--)
+    {
+        result = _mm_add_ps(_mm_mul_ps(result, z), coefficients[i]);
+    }
+
+    return result;
+}
+
+/// @brief Picks the lanes of the first vector where the mask is set, the lanes of the second vector elsewhere.
+__m128 SimdSSE2_Select(__m128 mask, __m128 vector1, __m128 vector2)
+{
+    return _mm_or_ps(_mm_and_ps(mask, vector1), _mm_andnot_ps(mask, vector2));
+}
+
+void SimdSSE2_SinCos(const float *radians, float *sines, float *cosines, TrigAccuracy accuracy, size_t count)
+{
+    const TrigPolynomials *polynomials = Trig_GetPolynomials(accuracy);
+    if (polynomials == NULL)
+    {
+        SimdKernels_GetScalar()->sinCos(radians, sines, cosines, accuracy, count);
+        return;
+    }
+
+    __m128 sineCoefficients[3];
+    __m128 cosineCoefficients[3];
+    for (int k = 0; k < polynomials->sineCount; k++)
+    {
+        sineCoefficients[k] = _mm_set1_ps(polynomials->sine[k]);
+    }
+
+    for (int k = 0; k < polynomials->cosineCount; k++)
+    {
+        cosineCoefficients[k] = _mm_set1_ps(polynomials->cosine[k]);
+    }
+
+    __m128i ones = _mm_set1_epi32(1);
+    __m128i twos = _mm_set1_epi32(2);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // Same steps with SinCosRad, the quadrant conversion rounds to the nearest even like lrintf.
+        __m128 radian = _mm_loadu_ps(radians + i);
+        __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(radian, _mm_set1_ps(TRIG_TWO_OVER_PI)));
+        __m128 quadrantValue = _mm_cvtepi32_ps(quadrant);
+
+        __m128 reduced = _mm_sub_ps(radian, _mm_mul_ps(quadrantValue, _mm_set1_ps(TRIG_HALF_PI_1)));
+        reduced = _mm_sub_ps(reduced, _mm_mul_ps(quadrantValue, _mm_set1_ps(TRIG_HALF_PI_2)));
+        reduced = _mm_sub_ps(reduced, _mm_mul_ps(quadrantValue, _mm_set1_ps(TRIG_HALF_PI_3)));
+        __m128 z = _mm_mul_ps(reduced, reduced);
+
+        __m128 reducedSine = _mm_add_ps(reduced, _mm_mul_ps(_mm_mul_ps(reduced, z), SimdSSE2_Polynomial(sineCoefficients, polynomials->sineCount, z)));
+        __m128 reducedCosine = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, SimdSSE2_Polynomial(cosineCoefficients, polynomials->cosineCount, z)));
+
+        // Odd quadrants swap sine and cosine, the quadrant bits moved to the sign bit give the signs.
+        __m128 isSwapped = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, ones), ones));
+        __m128 sineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, twos), 30));
+        __m128 cosineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, ones), twos), 30));
+
+        if (sines != NULL)
+        {
+            _mm_storeu_ps(sines + i, _mm_xor_ps(SimdSSE2_Select(isSwapped, reducedCosine, reducedSine), sineSign));
+        }
+
+        if (cosines != NULL)
+        {
+            _mm_storeu_ps(cosines + i, _mm_xor_ps(SimdSSE2_Select(isSwapped, reducedSine, reducedCosine), cosineSign));
+        }
+    }
+
+    SimdKernels_GetScalar()->sinCos(radians + i, sines != NULL ? sines + i : NULL, cosines != NULL ? cosines + i : NULL, accuracy, count - i);
+}
+
+void SimdSSE2_ArcTan2(const float *ys, const float *xs, float *results, TrigAccuracy accuracy, size_t count)
+{
+    const TrigPolynomials *polynomials = Trig_GetPolynomials(accuracy);
+    if (polynomials == NULL)
+    {
+        SimdKernels_GetScalar()->arcTan2(ys, xs, results, accuracy, count);
+        return;
+    }
+
+    __m128 coefficients[8];
+    for (int k = 0; k < polynomials->arcTangentCount; k++)
+    {
+        coefficients[k] = _mm_set1_ps(polynomials->arcTangent[k]);
+    }
+
+    __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 zeros = _mm_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // Same steps with ArcTan2RadFast, the ratio of a zero point is masked from NaN to zero and the sign bit of x picks the left half.
+        __m128 y = _mm_loadu_ps(ys + i);
+        __m128 x = _mm_loadu_ps(xs + i);
+        __m128 absoluteX = _mm_andnot_ps(signMask, x);
+        __m128 absoluteY = _mm_andnot_ps(signMask, y);
+        __m128 maximum = _mm_max_ps(absoluteX, absoluteY);
+        __m128 ratio = _mm_and_ps(_mm_div_ps(_mm_min_ps(absoluteX, absoluteY), maximum), _mm_cmpgt_ps(maximum, zeros));
+
+        __m128 angle = _mm_mul_ps(ratio, SimdSSE2_Polynomial(coefficients, polynomials->arcTangentCount, _mm_mul_ps(ratio, ratio)));
+        angle = SimdSSE2_Select(_mm_cmpgt_ps(absoluteY, absoluteX), _mm_sub_ps(_mm_set1_ps(PI / 2.0f), angle), angle);
+        angle = SimdSSE2_Select(_mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31)), _mm_sub_ps(_mm_set1_ps(PI), angle), angle);
+
+        _mm_storeu_ps(results + i, _mm_or_ps(_mm_andnot_ps(signMask, angle), _mm_and_ps(signMask, y)));
+    }
+
+    SimdKernels_GetScalar()->arcTan2(ys + i, xs + i, results + i, accuracy, count - i);
+}
+
+void SimdSSE2_ComplexMultiply(const float *real1, const float *imaginary1, const float *real2, const float *imaginary2, float *realResult, float *imaginaryResult, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 r1 = _mm_loadu_ps(real1 + i);
+        __m128 i1 = _mm_loadu_ps(imaginary1 + i);
+        __m128 r2 = _mm_loadu_ps(real2 + i);
+        __m128 i2 = _mm_loadu_ps(imaginary2 + i);
+
+        _mm_storeu_ps(realResult + i, _mm_sub_ps(_mm_mul_ps(r1, r2), _mm_mul_ps(i1, i2)));
+        _mm_storeu_ps(imaginaryResult + i, _mm_add_ps(_mm_mul_ps(r1, i2), _mm_mul_ps(i1, r2)));
+    }
+
+    SimdKernels_GetScalar()->complexMultiply(real1 + i, imaginary1 + i, real2 + i, imaginary2 + i, realResult + i, imaginaryResult + i, count - i);
+}
+
+void SimdSSE2_FFTRadix4(float *real, float *imaginary, size_t size, size_t quarter, const float *twiddles)
+{
+    // Quarters are 1 or 2 times a power of 4, the ones below 4 do not fill a register and the others are whole registers.
+    if (quarter < 4)
+    {
+        SimdKernels_GetScalar()->fftRadix4(real, imaginary, size, quarter, twiddles);
+        return;
+    }
+
+    for (size_t block = 0; block < size; block += quarter * 4)
+    {
+        for (size_t j = 0; j < quarter; j += 4)
+        {
+            float *real0 = real + block + j;
+            float *imaginary0 = imaginary + block + j;
+
+            // Twiddled inputs, same steps with the scalar kernel four butterflies at a time
+            __m128 twiddleReal = _mm_loadu_ps(twiddles + j);
+            __m128 twiddleImaginary = _mm_loadu_ps(twiddles + quarter + j);
+            __m128 inputReal = _mm_loadu_ps(real0 + quarter);
+            __m128 inputImaginary = _mm_loadu_ps(imaginary0 + quarter);
+            __m128 real1 = _mm_sub_ps(_mm_mul_ps(inputReal, twiddleReal), _mm_mul_ps(inputImaginary, twiddleImaginary));
+            __m128 imaginary1 = _mm_add_ps(_mm_mul_ps(inputReal, twiddleImaginary), _mm_mul_ps(inputImaginary, twiddleReal));
+
+            twiddleReal = _mm_loadu_ps(twiddles + quarter * 2 + j);
+            twiddleImaginary = _mm_loadu_ps(twiddles + quarter * 3 + j);
+            inputReal = _mm_loadu_ps(real0 + quarter * 2);
+            inputImaginary = _mm_loadu_ps(imaginary0 + quarter * 2);
+            __m128 real2 = _mm_sub_ps(_mm_mul_ps(inputReal, twiddleReal), _mm_mul_ps(inputImaginary, twiddleImaginary));
+            __m128 imaginary2 = _mm_add_ps(_mm_mul_ps(inputReal, twiddleImaginary), _mm_mul_ps(inputImaginary, twiddleReal));
+
+            twiddleReal = _mm_loadu_ps(twiddles + quarter * 4 + j);
+            twiddleImaginary = _mm_loadu_ps(twiddles + quarter * 5 + j);
+            inputReal = _mm_loadu_ps(real0 + quarter * 3);
+            inputImaginary = _mm_loadu_ps(imaginary0 + quarter * 3);
+            __m128 real3 = _mm_sub_ps(_mm_mul_ps(inputReal, twiddleReal), _mm_mul_ps(inputImaginary, twiddleImaginary));
+            __m128 imaginary3 = _mm_add_ps(_mm_mul_ps(inputReal, twiddleImaginary), _mm_mul_ps(inputImaginary, twiddleReal));
+
+            __m128 real0Value = _mm_loadu_ps(real0);
+            __m128 imaginary0Value = _mm_loadu_ps(imaginary0);
+            __m128 sumReal = _mm_add_ps(real0Value, real1);
+            __m128 sumImaginary = _mm_add_ps(imaginary0Value, imaginary1);
+            __m128 differenceReal = _mm_sub_ps(real0Value, real1);
+            __m128 differenceImaginary = _mm_sub_ps(imaginary0Value, imaginary1);
+            __m128 oddSumReal = _mm_add_ps(real2, real3);
+            __m128 oddSumImaginary = _mm_add_ps(imaginary2, imaginary3);
+            __m128 oddDifferenceReal = _mm_sub_ps(real2, real3);
+            __m128 oddDifferenceImaginary = _mm_sub_ps(imaginary2, imaginary3);
+
+            _mm_storeu_ps(real0, _mm_add_ps(sumReal, oddSumReal));
+            _mm_storeu_ps(imaginary0, _mm_add_ps(sumImaginary, oddSumImaginary));
+            _mm_storeu_ps(real0 + quarter, _mm_add_ps(differenceReal, oddDifferenceImaginary));
+            _mm_storeu_ps(imaginary0 + quarter, _mm_sub_ps(differenceImaginary, oddDifferenceReal));
+            _mm_storeu_ps(real0 + quarter * 2, _mm_sub_ps(sumReal, oddSumReal));
+            _mm_storeu_ps(imaginary0 + quarter * 2, _mm_sub_ps(sumImaginary, oddSumImaginary));
+            _mm_storeu_ps(real0 + quarter * 3, _mm_sub_ps(differenceReal, oddDifferenceImaginary));
+            _mm_storeu_ps(imaginary0 + quarter * 3, _mm_add_ps(differenceImaginary, oddDifferenceReal));
+        }
+    }
+}
+
+/// @brief Gets the 4 left rows of a block of matrixDotAdd. Rows past the left matrix repeat its last row, their sums are calculated but not written.
+void SimdX86_GemmRows(const float *left, size_t leftStride, size_t height, const float *rows[4])
+{
+    for (size_t r = 0; r < 4; r++)
+    {
+        rows[r] = left + (r < height ? r : height - 1) * leftStride;
+    }
+}
+
+/// @brief Adds the sums of a block of matrixDotAdd at the edge of the result, where only part of the block is inside it.
+void SimdX86_GemmAddTile(const float *tile, size_t tileStride, float *result, size_t resultStride, size_t height, size_t width)
+{
+    for (size_t r = 0; r < height; r++)
+    {
+        for (size_t c = 0; c < width; c++)
+        {
+            result[r * resultStride + c] += tile[r * tileStride + c];
+        }
+    }
+}
+
+void SimdSSE2_MatrixDotAdd(const float *left, size_t leftStride, const float *packedRight, float *result, size_t resultStride, size_t rows, size_t columns, size_t depth)
+{
+    for (size_t j = 0; j < columns; j += SIMD_GEMM_PANEL)
+    {
+        const float *panel = packedRight + j * depth;
+        size_t width = columns - j < SIMD_GEMM_PANEL ? columns - j : SIMD_GEMM_PANEL;
+
+        // Blocks of 4 rows by 8 columns, half a panel, with the sums in 8 registers
+        for (size_t i = 0; i < rows; i += 4)
+        {
+            size_t height = rows - i < 4 ? rows - i : 4;
+            const float *leftRows[4];
+            SimdX86_GemmRows(left + i * leftStride, leftStride, height, leftRows);
+
+            for (size_t half = 0; half < width; half += 8)
+            {
+                __m128 sum00 = _mm_setzero_ps(), sum01 = _mm_setzero_ps();
+                __m128 sum10 = _mm_setzero_ps(), sum11 = _mm_setzero_ps();
+                __m128 sum20 = _mm_setzero_ps(), sum21 = _mm_setzero_ps();
+                __m128 sum30 = _mm_setzero_ps(), sum31 = _mm_setzero_ps();
+
+                const float *right = panel + half;
+                for (size_t k = 0; k < depth; k++, right += SIMD_GEMM_PANEL)
+                {
+                    __m128 right0 = _mm_loadu_ps(right);
+                    __m128 right1 = _mm_loadu_ps(right + 4);
+
+                    __m128 value = _mm_set1_ps(leftRows[0][k]);
+                    sum00 = _mm_add_ps(sum00, _mm_mul_ps(value, right0));
+                    sum01 = _mm_add_ps(sum01, _mm_mul_ps(value, right1));
+                    value = _mm_set1_ps(leftRows[1][k]);
+                    sum10 = _mm_add_ps(sum10, _mm_mul_ps(value, right0));
+                    sum11 = _mm_add_ps(sum11, _mm_mul_ps(value, right1));
+                    value = _mm_set1_ps(leftRows[2][k]);
+                    sum20 = _mm_add_ps(sum20, _mm_mul_ps(value, right0));
+                    sum21 = _mm_add_ps(sum21, _mm_mul_ps(value, right1));
+                    value = _mm_set1_ps(leftRows[3][k]);
+                    sum30 = _mm_add_ps(sum30, _mm_mul_ps(value, right0));
+                    sum31 = _mm_add_ps(sum31, _mm_mul_ps(value, right1));
+                }
+
+                float *resultBlock = result + i * resultStride + j + half;
+                if (height == 4 && width - half >= 8)
+                {
+                    _mm_storeu_ps(resultBlock, _mm_add_ps(_mm_loadu_ps(resultBlock), sum00));
+                    _mm_storeu_ps(resultBlock + 4, _mm_add_ps(_mm_loadu_ps(resultBlock + 4), sum01));
+                    resultBlock += resultStride;
+                    _mm_storeu_ps(resultBlock, _mm_add_ps(_mm_loadu_ps(resultBlock), sum10));
+                    _mm_storeu_ps(resultBlock + 4, _mm_add_ps(_mm_loadu_ps(resultBlock + 4), sum11));
+                    resultBlock += resultStride;
+                    _mm_storeu_ps(resultBlock, _mm_add_ps(_mm_loadu_ps(resultBlock), sum20));
+                    _mm_storeu_ps(resultBlock + 4, _mm_add_ps(_mm_loadu_ps(resultBlock + 4), sum21));
+                    resultBlock += resultStride;
+                    _mm_storeu_ps(resultBlock, _mm_add_ps(_mm_loadu_ps(resultBlock), sum30));
+                    _mm_storeu_ps(resultBlock + 4, _mm_add_ps(_mm_loadu_ps(resultBlock + 4), sum31));
+                }
+                else
+                {
+                    float tile[4 * 8];
+                    _mm_storeu_ps(tile, sum00);
+                    _mm_storeu_ps(tile + 4, sum01);
+                    _mm_storeu_ps(tile + 8, sum10);
+                    _mm_storeu_ps(tile + 12, sum11);
+                    _mm_storeu_ps(tile + 16, sum20);
+                    _mm_storeu_ps(tile + 20, sum21);
+                    _mm_storeu_ps(tile + 24, sum30);
+                    _mm_storeu_ps(tile + 28, sum31);
+                    SimdX86_GemmAddTile(tile, 8, resultBlock, resultStride, height, width - half < 8 ? width - half : 8);
+                }
+            }
+        }
+    }
+}
+
+/// @brief Multiplies 16 int8 pairs and adds them up into 4 int32 sums, the int8 are sign extended to int16 first as SSE2 has no int8 multiply.
+__m128i SimdSSE2_DotInt8(__m128i weights, __m128i values)
+{
+    __m128i weightsLow = _mm_srai_epi16(_mm_unpacklo_epi8(weights, weights), 8);
+    __m128i weightsHigh = _mm_srai_epi16(_mm_unpackhi_epi8(weights, weights), 8);
+    __m128i valuesLow = _mm_srai_epi16(_mm_unpacklo_epi8(values, values), 8);
+    __m128i valuesHigh = _mm_srai_epi16(_mm_unpackhi_epi8(values, values), 8);
+
+    return _mm_add_epi32(_mm_madd_epi16(weightsLow, valuesLow), _mm_madd_epi16(weightsHigh, valuesHigh));
+}
+
+/// @brief Adds up the 4 lanes of a register.
+float SimdSSE2_Sum(__m128 vector)
+{
+    float lanes[4];
+    _mm_storeu_ps(lanes, vector);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+float SimdSSE2_QuantizedDot(const int8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count)
+{
+    __m128 sum = _mm_setzero_ps();
+    for (size_t group = 0; group * groupSize < count; group++)
+    {
+        const int8_t *groupWeights = weights + group * groupSize;
+        const int8_t *groupValues = values + group * groupSize;
+
+        __m128i groupSum = _mm_setzero_si128();
+        for (size_t i = 0; i < groupSize; i += 16)
+        {
+            groupSum = _mm_add_epi32(groupSum, SimdSSE2_DotInt8(_mm_loadu_si128((const __m128i *)(groupWeights + i)), _mm_loadu_si128((const __m128i *)(groupValues + i))));
+        }
+
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_cvtepi32_ps(groupSum), _mm_set1_ps(weightScales[group] * valueScales[group])));
+    }
+
+    return SimdSSE2_Sum(sum);
+}
+
+float SimdSSE2_Quantized4Dot(const uint8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count)
+{
+    __m128i lowMask = _mm_set1_epi8(0x0F);
+    __m128i offset = _mm_set1_epi8(8);
+    size_t half = groupSize / 2;
+
+    __m128 sum = _mm_setzero_ps();
+    for (size_t group = 0; group * groupSize < count; group++)
+    {
+        const uint8_t *groupWeights = weights + group * half;
+        const int8_t *groupValues = values + group * groupSize;
+
+        __m128i groupSum = _mm_setzero_si128();
+        for (size_t i = 0; i < half; i += 16)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i *)(groupWeights + i));
+            __m128i low = _mm_sub_epi8(_mm_and_si128(bytes, lowMask), offset);
+            __m128i high = _mm_sub_epi8(_mm_and_si128(_mm_srli_epi16(bytes, 4), lowMask), offset);
+
+            groupSum = _mm_add_epi32(groupSum, SimdSSE2_DotInt8(low, _mm_loadu_si128((const __m128i *)(groupValues + i))));
+            groupSum = _mm_add_epi32(groupSum, SimdSSE2_DotInt8(high, _mm_loadu_si128((const __m128i *)(groupValues + half + i))));
+        }
+
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_cvtepi32_ps(groupSum), _mm_set1_ps(weightScales[group] * valueScales[group])));
+    }
+
+    return SimdSSE2_Sum(sum);
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_Add(const float *array1, const float *array2, float *result, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(result + i, _mm256_add_ps(_mm256_loadu_ps(array1 + i), _mm256_loadu_ps(array2 + i)));
+    }
+
+    SimdSSE2_Add(array1 + i, array2 + i, result + i, count - i);
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_Multiply(const float *array, float scalar, float *result, size_t count)
+{
+    __m256 scalars = _mm256_set1_ps(scalar);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(result + i, _mm256_mul_ps(_mm256_loadu_ps(array + i), scalars));
+    }
+
+    SimdSSE2_Multiply(array + i, scalar, result + i, count - i);
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_Lerp(const float *startArray, const float *endArray, float time, float *result, size_t count)
+{
+    __m256 times = _mm256_set1_ps(time);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 start = _mm256_loadu_ps(startArray + i);
+        __m256 end = _mm256_loadu_ps(endArray + i);
+        _mm256_storeu_ps(result + i, _mm256_fmadd_ps(_mm256_sub_ps(end, start), times, start));
+    }
+
+    SimdSSE2_Lerp(startArray + i, endArray + i, time, result + i, count - i);
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_Dot(const float *const *components1, const float *const *components2, int dimension, float *result, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 sum = _mm256_setzero_ps();
+        for (int d = 0; d < dimension; d++)
+        {
+            sum = _mm256_fmadd_ps(_mm256_loadu_ps(components1[d] + i), _mm256_loadu_ps(components2[d] + i), sum);
+        }
+
+        _mm256_storeu_ps(result + i, sum);
+    }
+
+    const float *tail1[4];
+    const float *tail2[4];
+    for (int d = 0; d < dimension; d++)
+    {
+        tail1[d] = components1[d] + i;
+        tail2[d] = components2[d] + i;
+    }
+
+    SimdSSE2_Dot(tail1, tail2, dimension, result + i, count - i);
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_Normalize(const float *const *components, float *const *results, int dimension, size_t count)
+{
+    __m256 ones = _mm256_set1_ps(1.0f);
+    __m256 zeros = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 values[4];
+        __m256 squaredMagnitude = zeros;
+        for (int d = 0; d < dimension; d++)
+        {
+            values[d] = _mm256_loadu_ps(components[d] + i);
+            squaredMagnitude = _mm256_fmadd_ps(values[d], values[d], squaredMagnitude);
+        }
+
+        __m256 inverseMagnitude = _mm256_div_ps(ones, _mm256_sqrt_ps(squaredMagnitude));
+        inverseMagnitude = _mm256_and_ps(inverseMagnitude, _mm256_cmp_ps(squaredMagnitude, zeros, _CMP_GT_OQ));
+
+        for (int d = 0; d < dimension; d++)
+        {
+            _mm256_storeu_ps(results[d] + i, _mm256_mul_ps(values[d], inverseMagnitude));
+        }
+    }
+
+    const float *tailComponents[4];
+    float *tailResults[4];
+    for (int d = 0; d < dimension; d++)
+    {
+        tailComponents[d] = components[d] + i;
+        tailResults[d] = results[d] + i;
+    }
+
+    SimdSSE2_Normalize(tailComponents, tailResults, dimension, count - i);
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_Transform(const float *matrix, const float *const *components, int dimension, float *const *results, size_t count)
+{
+    __m256 elements[16];
+    for (int e = 0; e < 16; e++)
+    {
+        elements[e] = _mm256_set1_ps(matrix[e]);
+    }
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(components[0] + i);
+        __m256 y = _mm256_loadu_ps(components[1] + i);
+        __m256 z = _mm256_loadu_ps(components[2] + i);
+
+        for (int row = 0; row < dimension; row++)
+        {
+            const __m256 *rowElements = elements + row * 4;
+            __m256 value = dimension == 4 ? _mm256_mul_ps(rowElements[3], _mm256_loadu_ps(components[3] + i)) : rowElements[3];
+            value = _mm256_fmadd_ps(rowElements[0], x, value);
+            value = _mm256_fmadd_ps(rowElements[1], y, value);
+            value = _mm256_fmadd_ps(rowElements[2], z, value);
+            _mm256_storeu_ps(results[row] + i, value);
+        }
+    }
+
+    const float *tailComponents[4];
+    float *tailResults[4];
+    for (int d = 0; d < dimension; d++)
+    {
+        tailComponents[d] = components[d] + i;
+        tailResults[d] = results[d] + i;
+    }
+
+    SimdSSE2_Transform(matrix, tailComponents, dimension, tailResults, count - i);
+}
+
+/// @brief Evaluates a polynomial of broadcast coefficients with Horner's method.
+SIMD_TARGET_AVX2 __m256 SimdAVX2_Polynomial(const __m256 *coefficients, int count, __m256 z)
+{
+    __m256 result = coefficients[count - 1];
+    for (int i = count - 2; i >= 0; i--)
+    {
+        result = _mm256_fmadd_ps(result, z, coefficients[i]);
+    }
+
+    return result;
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_SinCos(const float *radians, float *sines, float *cosines, TrigAccuracy accuracy, size_t count)
+{
+    const TrigPolynomials *polynomials = Trig_GetPolynomials(accuracy);
+    if (polynomials == NULL)
+    {
+        SimdKernels_GetScalar()->sinCos(radians, sines, cosines, accuracy, count);
+        return;
+    }
+
+    __m256 sineCoefficients[3];
+    __m256 cosineCoefficients[3];
+    for (int k = 0; k < polynomials->sineCount; k++)
+    {
+        sineCoefficients[k] = _mm256_set1_ps(polynomials->sine[k]);
+    }
+
+    for (int k = 0; k < polynomials->cosineCount; k++)
+    {
+        cosineCoefficients[k] = _mm256_set1_ps(polynomials->cosine[k]);
+    }
+
+    __m256i ones = _mm256_set1_epi32(1);
+    __m256i twos = _mm256_set1_epi32(2);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 radian = _mm256_loadu_ps(radians + i);
+        __m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(radian, _mm256_set1_ps(TRIG_TWO_OVER_PI)));
+        __m256 quadrantValue = _mm256_cvtepi32_ps(quadrant);
+
+        __m256 reduced = _mm256_fnmadd_ps(quadrantValue, _mm256_set1_ps(TRIG_HALF_PI_1), radian);
+        reduced = _mm256_fnmadd_ps(quadrantValue, _mm256_set1_ps(TRIG_HALF_PI_2), reduced);
+        reduced = _mm256_fnmadd_ps(quadrantValue, _mm256_set1_ps(TRIG_HALF_PI_3), reduced);
+        __m256 z = _mm256_mul_ps(reduced, reduced);
+
+        __m256 reducedSine = _mm256_fmadd_ps(_mm256_mul_ps(reduced, z), SimdAVX2_Polynomial(sineCoefficients, polynomials->sineCount, z), reduced);
+        __m256 reducedCosine = _mm256_fmadd_ps(z, SimdAVX2_Polynomial(cosineCoefficients, polynomials->cosineCount, z), _mm256_set1_ps(1.0f));
+
+        __m256 isSwapped = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, ones), ones));
+        __m256 sineSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, twos), 30));
+        __m256 cosineSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, ones), twos), 30));
+
+        if (sines != NULL)
+        {
+            _mm256_storeu_ps(sines + i, _mm256_xor_ps(_mm256_blendv_ps(reducedSine, reducedCosine, isSwapped), sineSign));
+        }
+
+        if (cosines != NULL)
+        {
+            _mm256_storeu_ps(cosines + i, _mm256_xor_ps(_mm256_blendv_ps(reducedCosine, reducedSine, isSwapped), cosineSign));
+        }
+    }
+
+    SimdSSE2_SinCos(radians + i, sines != NULL ? sines + i : NULL, cosines != NULL ? cosines + i : NULL, accuracy, count - i);
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_ArcTan2(const float *ys, const float *xs, float *results, TrigAccuracy accuracy, size_t count)
+{
+    const TrigPolynomials *polynomials = Trig_GetPolynomials(accuracy);
+    if (polynomials == NULL)
+    {
+        SimdKernels_GetScalar()->arcTan2(ys, xs, results, accuracy, count);
+        return;
+    }
+
+    __m256 coefficients[8];
+    for (int k = 0; k < polynomials->arcTangentCount; k++)
+    {
+        coefficients[k] = _mm256_set1_ps(polynomials->arcTangent[k]);
+    }
+
+    __m256 signMask = _mm256_set1_ps(-0.0f);
+    __m256 zeros = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 y = _mm256_loadu_ps(ys + i);
+        __m256 x = _mm256_loadu_ps(xs + i);
+        __m256 absoluteX = _mm256_andnot_ps(signMask, x);
+        __m256 absoluteY = _mm256_andnot_ps(signMask, y);
+        __m256 maximum = _mm256_max_ps(absoluteX, absoluteY);
+        __m256 ratio = _mm256_and_ps(_mm256_div_ps(_mm256_min_ps(absoluteX, absoluteY), maximum), _mm256_cmp_ps(maximum, zeros, _CMP_GT_OQ));
+
+        __m256 angle = _mm256_mul_ps(ratio, SimdAVX2_Polynomial(coefficients, polynomials->arcTangentCount, _mm256_mul_ps(ratio, ratio)));
+        angle = _mm256_blendv_ps(angle, _mm256_sub_ps(_mm256_set1_ps(PI / 2.0f), angle), _mm256_cmp_ps(absoluteY, absoluteX, _CMP_GT_OQ));
+        angle = _mm256_blendv_ps(angle, _mm256_sub_ps(_mm256_set1_ps(PI), angle), x); // blends by the sign bit of x
+
+        _mm256_storeu_ps(results + i, _mm256_or_ps(_mm256_andnot_ps(signMask, angle), _mm256_and_ps(signMask, y)));
+    }
+
+    SimdSSE2_ArcTan2(ys + i, xs + i, results + i, accuracy, count - i);
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_ComplexMultiply(const float *real1, const float *imaginary1, const float *real2, const float *imaginary2, float *realResult, float *imaginaryResult, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 r1 = _mm256_loadu_ps(real1 + i);
+        __m256 i1 = _mm256_loadu_ps(imaginary1 + i);
+        __m256 r2 = _mm256_loadu_ps(real2 + i);
+        __m256 i2 = _mm256_loadu_ps(imaginary2 + i);
+
+        _mm256_storeu_ps(realResult + i, _mm256_fmsub_ps(r1, r2, _mm256_mul_ps(i1, i2)));
+        _mm256_storeu_ps(imaginaryResult + i, _mm256_fmadd_ps(r1, i2, _mm256_mul_ps(i1, r2)));
+    }
+
+    SimdSSE2_ComplexMultiply(real1 + i, imaginary1 + i, real2 + i, imaginary2 + i, realResult + i, imaginaryResult + i, count - i);
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_FFTRadix4(float *real, float *imaginary, size_t size, size_t quarter, const float *twiddles)
+{
+    if (quarter < 8)
+    {
+        SimdSSE2_FFTRadix4(real, imaginary, size, quarter, twiddles);
+        return;
+    }
+
+    for (size_t block = 0; block < size; block += quarter * 4)
+    {
+        for (size_t j = 0; j < quarter; j += 8)
+        {
+            float *real0 = real + block + j;
+            float *imaginary0 = imaginary + block + j;
+
+            __m256 twiddleReal = _mm256_loadu_ps(twiddles + j);
+            __m256 twiddleImaginary = _mm256_loadu_ps(twiddles + quarter + j);
+            __m256 inputReal = _mm256_loadu_ps(real0 + quarter);
+            __m256 inputImaginary = _mm256_loadu_ps(imaginary0 + quarter);
+            __m256 real1 = _mm256_fmsub_ps(inputReal, twiddleReal, _mm256_mul_ps(inputImaginary, twiddleImaginary));
+            __m256 imaginary1 = _mm256_fmadd_ps(inputReal, twiddleImaginary, _mm256_mul_ps(inputImaginary, twiddleReal));
+
+            twiddleReal = _mm256_loadu_ps(twiddles + quarter * 2 + j);
+            twiddleImaginary = _mm256_loadu_ps(twiddles + quarter * 3 + j);
+            inputReal = _mm256_loadu_ps(real0 + quarter * 2);
+            inputImaginary = _mm256_loadu_ps(imaginary0 + quarter * 2);
+            __m256 real2 = _mm256_fmsub_ps(inputReal, twiddleReal, _mm256_mul_ps(inputImaginary, twiddleImaginary));
+            __m256 imaginary2 = _mm256_fmadd_ps(inputReal, twiddleImaginary, _mm256_mul_ps(inputImaginary, twiddleReal));
+
+            twiddleReal = _mm256_loadu_ps(twiddles + quarter * 4 + j);
+            twiddleImaginary = _mm256_loadu_ps(twiddles + quarter * 5 + j);
+            inputReal = _mm256_loadu_ps(real0 + quarter * 3);
+            inputImaginary = _mm256_loadu_ps(imaginary0 + quarter * 3);
+            __m256 real3 = _mm256_fmsub_ps(inputReal, twiddleReal, _mm256_mul_ps(inputImaginary, twiddleImaginary));
+            __m256 imaginary3 = _mm256_fmadd_ps(inputReal, twiddleImaginary, _mm256_mul_ps(inputImaginary, twiddleReal));
+
+            __m256 real0Value = _mm256_loadu_ps(real0);
+            __m256 imaginary0Value = _mm256_loadu_ps(imaginary0);
+            __m256 sumReal = _mm256_add_ps(real0Value, real1);
+            __m256 sumImaginary = _mm256_add_ps(imaginary0Value, imaginary1);
+            __m256 differenceReal = _mm256_sub_ps(real0Value, real1);
+            __m256 differenceImaginary = _mm256_sub_ps(imaginary0Value, imaginary1);
+            __m256 oddSumReal = _mm256_add_ps(real2, real3);
+            __m256 oddSumImaginary = _mm256_add_ps(imaginary2, imaginary3);
+            __m256 oddDifferenceReal = _mm256_sub_ps(real2, real3);
+            __m256 oddDifferenceImaginary = _mm256_sub_ps(imaginary2, imaginary3);
+
+            _mm256_storeu_ps(real0, _mm256_add_ps(sumReal, oddSumReal));
+            _mm256_storeu_ps(imaginary0, _mm256_add_ps(sumImaginary, oddSumImaginary));
+            _mm256_storeu_ps(real0 + quarter, _mm256_add_ps(differenceReal, oddDifferenceImaginary));
+            _mm256_storeu_ps(imaginary0 + quarter, _mm256_sub_ps(differenceImaginary, oddDifferenceReal));
+            _mm256_storeu_ps(real0 + quarter * 2, _mm256_sub_ps(sumReal, oddSumReal));
+            _mm256_storeu_ps(imaginary0 + quarter * 2, _mm256_sub_ps(sumImaginary, oddSumImaginary));
+            _mm256_storeu_ps(real0 + quarter * 3, _mm256_sub_ps(differenceReal, oddDifferenceImaginary));
+            _mm256_storeu_ps(imaginary0 + quarter * 3, _mm256_add_ps(differenceImaginary, oddDifferenceReal));
+        }
+    }
+}
+
+SIMD_TARGET_AVX2 void SimdAVX2_MatrixDotAdd(const float *left, size_t leftStride, const float *packedRight, float *result, size_t resultStride, size_t rows, size_t columns, size_t depth)
+{
+    for (size_t j = 0; j < columns; j += SIMD_GEMM_PANEL)
+    {
+        const float *panel = packedRight + j * depth;
+        size_t width = columns - j < SIMD_GEMM_PANEL ? columns - j : SIMD_GEMM_PANEL;
+
+        // Blocks of 4 rows by a whole panel, with the sums in 8 registers. The panel stays in the L1 cache while the blocks of rows go over it.
+        for (size_t i = 0; i < rows; i += 4)
+        {
+            size_t height = rows - i < 4 ? rows - i : 4;
+            const float *leftRows[4];
+            SimdX86_GemmRows(left + i * leftStride, leftStride, height, leftRows);
+
+            __m256 sum00 = _mm256_setzero_ps(), sum01 = _mm256_setzero_ps();
+            __m256 sum10 = _mm256_setzero_ps(), sum11 = _mm256_setzero_ps();
+            __m256 sum20 = _mm256_setzero_ps(), sum21 = _mm256_setzero_ps();
+            __m256 sum30 = _mm256_setzero_ps(), sum31 = _mm256_setzero_ps();
+
+            const float *right = panel;
+            for (size_t k = 0; k < depth; k++, right += SIMD_GEMM_PANEL)
+            {
+                __m256 right0 = _mm256_loadu_ps(right);
+                __m256 right1 = _mm256_loadu_ps(right + 8);
+
+                __m256 value = _mm256_broadcast_ss(leftRows[0] + k);
+                sum00 = _mm256_fmadd_ps(value, right0, sum00);
+                sum01 = _mm256_fmadd_ps(value, right1, sum01);
+                value = _mm256_broadcast_ss(leftRows[1] + k);
+                sum10 = _mm256_fmadd_ps(value, right0, sum10);
+                sum11 = _mm256_fmadd_ps(value, right1, sum11);
+                value = _mm256_broadcast_ss(leftRows[2] + k);
+                sum20 = _mm256_fmadd_ps(value, right0, sum20);
+                sum21 = _mm256_fmadd_ps(value, right1, sum21);
+                value = _mm256_broadcast_ss(leftRows[3] + k);
+                sum30 = _mm256_fmadd_ps(value, right0, sum30);
+                sum31 = _mm256_fmadd_ps(value, right1, sum31);
+            }
+
+            float *resultBlock = result + i * resultStride + j;
+            if (height == 4 && width == SIMD_GEMM_PANEL)
+            {
+                _mm256_storeu_ps(resultBlock, _mm256_add_ps(_mm256_loadu_ps(resultBlock), sum00));
+                _mm256_storeu_ps(resultBlock + 8, _mm256_add_ps(_mm256_loadu_ps(resultBlock + 8), sum01));
+                resultBlock += resultStride;
+                _mm256_storeu_ps(resultBlock, _mm256_add_ps(_mm256_loadu_ps(resultBlock), sum10));
+                _mm256_storeu_ps(resultBlock + 8, _mm256_add_ps(_mm256_loadu_ps(resultBlock + 8), sum11));
+                resultBlock += resultStride;
+                _mm256_storeu_ps(resultBlock, _mm256_add_ps(_mm256_loadu_ps(resultBlock), sum20));
+                _mm256_storeu_ps(resultBlock + 8, _mm256_add_ps(_mm256_loadu_ps(resultBlock + 8), sum21));
+                resultBlock += resultStride;
+                _mm256_storeu_ps(resultBlock, _mm256_add_ps(_mm256_loadu_ps(resultBlock), sum30));
+                _mm256_storeu_ps(resultBlock + 8, _mm256_add_ps(_mm256_loadu_ps(resultBlock + 8), sum31));
+            }
+            else
+            {
+                float tile[4 * SIMD_GEMM_PANEL];
+                _mm256_storeu_ps(tile, sum00);
+                _mm256_storeu_ps(tile + 8, sum01);
+                _mm256_storeu_ps(tile + 16, sum10);
+                _mm256_storeu_ps(tile + 24, sum11);
+                _mm256_storeu_ps(tile + 32, sum20);
+                _mm256_storeu_ps(tile + 40, sum21);
+                _mm256_storeu_ps(tile + 48, sum30);
+                _mm256_storeu_ps(tile + 56, sum31);
+                SimdX86_GemmAddTile(tile, SIMD_GEMM_PANEL, resultBlock, resultStride, height, width);
+            }
+        }
+    }
+}
+
+/// @brief Multiplies 32 int8 pairs and adds them up into 8 int32 sums. The sign of the weights is moved to the values, so the unsigned by signed multiply of AVX2 can be used.
+/// Values are at most 127 in magnitude, so two products of a pair of lanes fit in the int16 the multiply saturates to.
+SIMD_TARGET_AVX2 __m256i SimdAVX2_DotInt8(__m256i weights, __m256i values)
+{
+    __m256i pairs = _mm256_maddubs_epi16(_mm256_sign_epi8(weights, weights), _mm256_sign_epi8(values, weights));
+    return _mm256_madd_epi16(pairs, _mm256_set1_epi16(1));
+}
+
+/// @brief Adds up the 8 lanes of a register.
+SIMD_TARGET_AVX2 float SimdAVX2_Sum(__m256 vector)
+{
+    return SimdSSE2_Sum(_mm_add_ps(_mm256_castps256_ps128(vector), _mm256_extractf128_ps(vector, 1)));
+}
+
+SIMD_TARGET_AVX2 float SimdAVX2_QuantizedDot(const int8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count)
+{
+    __m256 sum = _mm256_setzero_ps();
+    for (size_t group = 0; group * groupSize < count; group++)
+    {
+        const int8_t *groupWeights = weights + group * groupSize;
+        const int8_t *groupValues = values + group * groupSize;
+
+        __m256i groupSum = _mm256_setzero_si256();
+        for (size_t i = 0; i < groupSize; i += 32)
+        {
+            groupSum = _mm256_add_epi32(groupSum, SimdAVX2_DotInt8(_mm256_loadu_si256((const __m256i *)(groupWeights + i)), _mm256_loadu_si256((const __m256i *)(groupValues + i))));
+        }
+
+        sum = _mm256_fmadd_ps(_mm256_cvtepi32_ps(groupSum), _mm256_set1_ps(weightScales[group] * valueScales[group]), sum);
+    }
+
+    return SimdAVX2_Sum(sum);
+}
+
+SIMD_TARGET_AVX2 float SimdAVX2_Quantized4Dot(const uint8_t *weights, const float *weightScales, const int8_t *values, const float *valueScales, size_t groupSize, size_t count)
+{
+    __m128i lowMask = _mm_set1_epi8(0x0F);
+    __m256i offset = _mm256_set1_epi8(8);
+    size_t half = groupSize / 2;
+
+    __m256 sum = _mm256_setzero_ps();
+    for (size_t group = 0; group * groupSize < count; group++)
+    {
+        const uint8_t *groupWeights = weights + group * half;
+        const int8_t *groupValues = values + group * groupSize;
+
+        __m256i groupSum = _mm256_setzero_si256();
+        for (size_t i = 0; i < half; i += 16)
+        {
+            // 16 bytes unpacked to 32 weights, the low halves for the first half of the group and the high halves for the second one
+            __m128i bytes = _mm_loadu_si128((const __m128i *)(groupWeights + i));
+            __m128i low = _mm_and_si128(bytes, lowMask);
+            __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), lowMask);
+            __m256i unpacked = _mm256_sub_epi8(_mm256_set_m128i(high, low), offset);
+
+            __m256i groupValuesPair = _mm256_set_m128i(_mm_loadu_si128((const __m128i *)(groupValues + half + i)), _mm_loadu_si128((const __m128i *)(groupValues + i)));
+            groupSum = _mm256_add_epi32(groupSum, SimdAVX2_DotInt8(unpacked, groupValuesPair));
+        }
+
+        sum = _mm256_fmadd_ps(_mm256_cvtepi32_ps(groupSum), _mm256_set1_ps(weightScales[group] * valueScales[group]), sum);
+    }
+
+    return SimdAVX2_Sum(sum);
+}
+
+const SimdKernels SIMD_KERNELS_SSE2 = {
+    .add = SimdSSE2_Add,
+    .multiply = SimdSSE2_Multiply,
+    .lerp = SimdSSE2_Lerp,
+    .dot = SimdSSE2_Dot,
+    .normalize = SimdSSE2_Normalize,
+    .matrix4Dot = SimdSSE2_Matrix4Dot,
+    .matrix4Inverse = SimdSSE2_Matrix4Inverse,
+    .transform = SimdSSE2_Transform,
+    .sinCos = SimdSSE2_SinCos,
+    .arcTan2 = SimdSSE2_ArcTan2,
+    .complexMultiply = SimdSSE2_ComplexMultiply,
+    .fftRadix4 = SimdSSE2_FFTRadix4,
+    .matrixDotAdd = SimdSSE2_MatrixDotAdd,
+    .quantizedDot = SimdSSE2_QuantizedDot,
+    .quantized4Dot = SimdSSE2_Quantized4Dot,
+};
+
+const SimdKernels SIMD_KERNELS_AVX2 = {
+    .add = SimdAVX2_Add,
+    .multiply = SimdAVX2_Multiply,
+    .lerp = SimdAVX2_Lerp,
+    .dot = SimdAVX2_Dot,
+    .normalize = SimdAVX2_Normalize,
+    // A single matrix fits in 128 bit registers, the wider registers only pay off over batches.
+    .matrix4Dot = SimdSSE2_Matrix4Dot,
+    .matrix4Inverse = SimdSSE2_Matrix4Inverse,
+    .transform = SimdAVX2_Transform,
+    .sinCos = SimdAVX2_SinCos,
+    .arcTan2 = SimdAVX2_ArcTan2,
+    .complexMultiply = SimdAVX2_ComplexMultiply,
+    .fftRadix4 = SimdAVX2_FFTRadix4,
+    .matrixDotAdd = SimdAVX2_MatrixDotAdd,
+    .quantizedDot = SimdAVX2_QuantizedDot,
+    .quantized4Dot = SimdAVX2_Quantized4Dot,
+};
+
+#pragma endregion Source Only
+
+const SimdKernels *SimdKernels_GetSSE2()
+{
+    return &SIMD_KERNELS_SSE2;
+}
+
+const SimdKernels *SimdKernels_GetAVX2()
+{
+    return &SIMD_KERNELS_AVX2;
+}
+
+#else
+
+const SimdKernels *SimdKernels_GetSSE2()
+{
+    return NULL;
+}
+
+const SimdKernels *SimdKernels_GetAVX2()
+{
+    return NULL;
+}
+
+#endif // SIMD_ARCHITECTURE_X86
@@ -0,0 +1,787 @@
+#include "Maths/SpatialIndex.h"
+#include "Maths/Arithmetic.h"
+
+#include <float.h>
+#include <math.h>
+
+#pragma region Source Only
+
+// Points per cell a SpatialGrid aims for when the cell size is picked automatically
+#define SPATIAL_GRID_TARGET_POINTS_PER_CELL 2.0
+
+// A SpatialGrid has at most this many cells per point, plus a constant for small sets, a larger cell size is used above it
+#define SPATIAL_GRID_MAX_CELLS_PER_POINT 4.0
+#define SPATIAL_GRID_MIN_CELLS 64.0
+
+// Most points in a leaf of a SpatialBVH, scanned as a contiguous run of the sorted batch
+#define SPATIAL_BVH_LEAF_SIZE 8
+
+// Entries of the traversal stacks of the SpatialBVH queries. Median splits keep the depth under log2 of the point count,
+// and a node pushes at most SPATIAL_BVH_WIDTH children, so this covers any count a size_t index can hold.
+#define SPATIAL_BVH_STACK_SIZE (64 * SPATIAL_BVH_WIDTH)
+
+/// @brief Gets the bounds of a range of points of component arrays.
+AABB SpatialIndex_Bounds(const float *x, const float *y, const float *z, size_t start, size_t end)
+{
+    AABB bounds = AABB_Empty();
+    for (size_t i = start; i < end; i++)
+    {
+        bounds = AABB_Expand(bounds, (Vector3){x[i], y[i], z[i]});
+    }
+
+    return bounds;
+}
+
+/// @brief Copies the points of a batch into a new batch in the order of indices.
+Vector3Batch *SpatialIndex_SortedPoints(const Vector3Batch *points, const size_t *indices)
+{
+    Vector3Batch *sorted = Vector3Batch_Create(points->count);
+    for (size_t i = 0; i < points->count; i++)
+    {
+        sorted->x[i] = points->x[indices[i]];
+        sorted->y[i] = points->y[indices[i]];
+        sorted->z[i] = points->z[indices[i]];
+    }
+
+    return sorted;
+}
+
+/// @brief Writes a found point to the results of a query if they have room, the count goes on regardless.
+void SpatialIndex_AddResult(size_t *results, size_t capacity, size_t *found, size_t index)
+{
+    if (results != NULL && *found < capacity)
+    {
+        results[*found] = index;
+    }
+    (*found)++;
+}
+
+/// @brief Gets the cells of a grid along an axis for a cell size, clamped to the range of an int.
+double SpatialGrid_CellsAlong(float extent, float cellSize)
+{
+    double cells = floor((double)extent / (double)cellSize) + 1.0;
+    return cells < (double)INT_MAX ? cells : (double)INT_MAX;
+}
+
+/// @brief Gets the cell coordinate of a position along an axis, clamped into the grid so positions outside map to the border cells.
+int SpatialGrid_CellCoordinate(float position, float origin, float inverseCellSize, int cells)
+{
+    float cell = (position - origin) * inverseCellSize;
+    if (cell < 0.0f)
+    {
+        return 0;
+    }
+
+    return cell < (float)cells ? ((int)cell < cells ? (int)cell : cells - 1) : cells - 1;
+}
+
+/// @brief Gets the first cell of a row of cells along x.
+size_t SpatialGrid_RowCell(const SpatialGrid *grid, int y, int z)
+{
+    return ((size_t)z * (size_t)grid->dimensions.y + (size_t)y) * (size_t)grid->dimensions.x;
+}
+
+/// @brief Scans the points of a run of cells along x for the nearest point, the cells of a row are contiguous in the sorted batch.
+void SpatialGrid_ScanNearest(const SpatialGrid *grid, size_t firstCell, size_t lastCell, Vector3 position, float *bestDistance, size_t *bestIndex)
+{
+    const float *x = grid->points->x, *y = grid->points->y, *z = grid->points->z;
+
+    for (size_t i = grid->cellStarts[firstCell]; i < grid->cellStarts[lastCell + 1]; i++)
+    {
+        float dx = x[i] - position.x, dy = y[i] - position.y, dz = z[i] - position.z;
+        float distance = dx * dx + dy * dy + dz * dz;
+        if (distance < *bestDistance)
+        {
+            *bestDistance = distance;
+            *bestIndex = i;
+        }
+    }
+}
+
+/// @brief Bulk load state of a SpatialBVH, the nodes grow as the recursion needs them.
+/// The points are partitioned in place together with their indices, so every pass of the build reads memory in order.
+typedef struct SpatialBVHBuilder
+{
+    float *components[3];
+    size_t *indices;
+    SpatialBVHNode *nodes;
+    size_t nodeCount;
+    size_t nodeCapacity;
+} SpatialBVHBuilder;
+
+/// @brief Swaps two points of the builder with their indices.
+void SpatialBVH_Swap(SpatialBVHBuilder *builder, size_t i, size_t j)
+{
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float temp = builder->components[axis][i];
+        builder->components[axis][i] = builder->components[axis][j];
+        builder->components[axis][j] = temp;
+    }
+
+    size_t temp = builder->indices[i];
+    builder->indices[i] = builder->indices[j];
+    builder->indices[j] = temp;
+}
+
+/// @brief Partially sorts a range of points by an axis, so the point at nth is in its sorted place, with no greater coordinates before and no smaller after it.
+/// Hoare partitions, linear on average.
+void SpatialBVH_Select(SpatialBVHBuilder *builder, int axis, size_t start, size_t end, size_t nth)
+{
+    const float *keys = builder->components[axis];
+    long long left = (long long)start, right = (long long)end - 1, target = (long long)nth;
+
+    while (left < right)
+    {
+        // Median of three as the pivot, so sorted inputs do not degrade to quadratic time
+        float a = keys[left], b = keys[left + (right - left) / 2], c = keys[right];
+        float pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+
+        long long i = left, j = right;
+        while (i <= j)
+        {
+            while (keys[i] < pivot)
+            {
+                i++;
+            }
+            while (keys[j] > pivot)
+            {
+                j--;
+            }
+            if (i <= j)
+            {
+                SpatialBVH_Swap(builder, (size_t)i, (size_t)j);
+                i++;
+                j--;
+            }
+        }
+
+        // [left, j] is at most the pivot, [i, right] at least the pivot and anything between equals it
+        if (target <= j)
+        {
+            right = j;
+        }
+        else if (target >= i)
+        {
+            left = i;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+/// @brief Adds a node to the builder and returns its index, the nodes are reallocated as they grow.
+uint32_t SpatialBVH_AddNode(SpatialBVHBuilder *builder)
+{
+    if (builder->nodeCount == builder->nodeCapacity)
+    {
+        builder->nodeCapacity *= 2;
+        builder->nodes = (SpatialBVHNode *)realloc(builder->nodes, builder->nodeCapacity * sizeof(SpatialBVHNode));
+        DebugAssert(builder->nodes != NULL, "Memory allocation failed.");
+    }
+
+    SpatialBVHNode *node = &builder->nodes[builder->nodeCount];
+    for (int lane = 0; lane < SPATIAL_BVH_WIDTH; lane++)
+    {
+        node->minX[lane] = node->minY[lane] = node->minZ[lane] = FLT_MAX;
+        node->maxX[lane] = node->maxY[lane] = node->maxZ[lane] = -FLT_MAX;
+        node->children[lane] = 0;
+        node->counts[lane] = 0;
+    }
+
+    return (uint32_t)builder->nodeCount++;
+}
+
+/// @brief Builds the node of a range of points. The range is cut at the median of its widest axis, then the larger parts again,
+/// until there are SPATIAL_BVH_WIDTH parts or all parts fit a leaf. Parts larger than a leaf get nodes of their own.
+uint32_t SpatialBVH_Build(SpatialBVHBuilder *builder, size_t start, size_t end)
+{
+    const float *x = builder->components[0], *y = builder->components[1], *z = builder->components[2];
+    uint32_t nodeIndex = SpatialBVH_AddNode(builder);
+
+    size_t partStarts[SPATIAL_BVH_WIDTH + 1] = {start, end};
+    int partCount = 1;
+
+    while (partCount < SPATIAL_BVH_WIDTH)
+    {
+        int largest = 0;
+        for (int part = 1; part < partCount; part++)
+        {
+            if (partStarts[part + 1] - partStarts[part] > partStarts[largest + 1] - partStarts[largest])
+            {
+                largest = part;
+            }
+        }
+
+        size_t partStart = partStarts[largest], partEnd = partStarts[largest + 1];
+        if (partEnd - partStart <= SPATIAL_BVH_LEAF_SIZE)
+        {
+            break;
+        }
+
+        AABB bounds = SpatialIndex_Bounds(x, y, z, partStart, partEnd);
+        Vector3 extent = {bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y, bounds.max.z - bounds.min.z};
+        int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+
+        size_t middle = partStart + (partEnd - partStart) / 2;
+        SpatialBVH_Select(builder, axis, partStart, partEnd, middle);
+
+        for (int part = partCount; part > largest; part--)
+        {
+            partStarts[part + 1] = partStarts[part];
+        }
+        partStarts[largest + 1] = middle;
+        partCount++;
+    }
+
+    for (int lane = 0; lane < partCount; lane++)
+    {
+        size_t partStart = partStarts[lane], partEnd = partStarts[lane + 1];
+        AABB bounds = SpatialIndex_Bounds(x, y, z, partStart, partEnd);
+
+        uint32_t child;
+        uint32_t count;
+        if (partEnd - partStart <= SPATIAL_BVH_LEAF_SIZE)
+        {
+            child = (uint32_t)partStart;
+            count = (uint32_t)(partEnd - partStart);
+        }
+        else
+        {
+            child = SpatialBVH_Build(builder, partStart, partEnd);
+            count = 0;
+        }
+
+        // The recursion can reallocate the nodes, so the node is looked up after it
+        SpatialBVHNode *node = &builder->nodes[nodeIndex];
+        node->minX[lane] = bounds.min.x;
+        node->minY[lane] = bounds.min.y;
+        node->minZ[lane] = bounds.min.z;
+        node->maxX[lane] = bounds.max.x;
+        node->maxY[lane] = bounds.max.y;
+        node->maxZ[lane] = bounds.max.z;
+        node->children[lane] = child;
+        node->counts[lane] = count;
+    }
+
+    return nodeIndex;
+}
+
+/// @brief Calculates the squared distances from a position to the child bounds of a node, one pass over the lanes the compiler turns into SIMD instructions.
+/// Unused lanes have empty bounds and get an infinite distance.
+void SpatialBVH_LaneDistances(const SpatialBVHNode *node, Vector3 position, float distances[SPATIAL_BVH_WIDTH])
+{
+    for (int lane = 0; lane < SPATIAL_BVH_WIDTH; lane++)
+    {
+        float dx = node->minX[lane] - position.x > position.x - node->maxX[lane] ? node->minX[lane] - position.x : position.x - node->maxX[lane];
+        float dy = node->minY[lane] - position.y > position.y - node->maxY[lane] ? node->minY[lane] - position.y : position.y - node->maxY[lane];
+        float dz = node->minZ[lane] - position.z > position.z - node->maxZ[lane] ? node->minZ[lane] - position.z : position.z - node->maxZ[lane];
+        dx = dx > 0.0f ? dx : 0.0f;
+        dy = dy > 0.0f ? dy : 0.0f;
+        dz = dz > 0.0f ? dz : 0.0f;
+        distances[lane] = dx * dx + dy * dy + dz * dz;
+    }
+}
+
+/// @brief Checks the child bounds of a node against a box, one pass over the lanes. Unused lanes have empty bounds and never overlap.
+void SpatialBVH_LaneOverlaps(const SpatialBVHNode *node, AABB box, int overlaps[SPATIAL_BVH_WIDTH])
+{
+    for (int lane = 0; lane < SPATIAL_BVH_WIDTH; lane++)
+    {
+        overlaps[lane] = (node->minX[lane] <= box.max.x) & (box.min.x <= node->maxX[lane]) &
+                         (node->minY[lane] <= box.max.y) & (box.min.y <= node->maxY[lane]) &
+                         (node->minZ[lane] <= box.max.z) & (box.min.z <= node->maxZ[lane]);
+    }
+}
+
+#pragma endregion Source Only
+
+#pragma region SpatialGrid
+
+SpatialGrid *SpatialGrid_Create(const Vector3Batch *points, float cellSize)
+{
+    DebugAssert(points != NULL, "Null pointer passed as parameter.");
+    DebugAssert(cellSize >= 0.0f, "Cell size of a grid must not be negative.");
+
+    SpatialGrid *grid = (SpatialGrid *)malloc(sizeof(SpatialGrid));
+    DebugAssert(grid != NULL, "Memory allocation failed.");
+
+    size_t count = points->count;
+    AABB bounds = count > 0 ? SpatialIndex_Bounds(points->x, points->y, points->z, 0, count) : (AABB){{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+    Vector3 extent = {bounds.max.x - bounds.min.x, bounds.max.y - bounds.min.y, bounds.max.z - bounds.min.z};
+    float largestExtent = Max(Max(extent.x, extent.y), Max(extent.z, FLT_MIN));
+
+    // The automatic size starts from the cells along the largest axis of a cube and is refined by the real cell count,
+    // which converges for flat and thin point sets too. A given size is only raised when the cells would far outnumber the points.
+    double maximumCells = SPATIAL_GRID_MAX_CELLS_PER_POINT * (double)count + SPATIAL_GRID_MIN_CELLS;
+    double targetCells = fmax((double)count / SPATIAL_GRID_TARGET_POINTS_PER_CELL, 1.0);
+    bool isAutomatic = cellSize == 0.0f;
+    if (isAutomatic)
+    {
+        // Points all at one position fit a single cell of any size
+        cellSize = largestExtent > FLT_MIN ? largestExtent / (float)cbrt(targetCells) : 1.0f;
+        isAutomatic = largestExtent > FLT_MIN;
+    }
+
+    for (int iteration = 0; iteration < 32; iteration++)
+    {
+        double cells = SpatialGrid_CellsAlong(extent.x, cellSize) * SpatialGrid_CellsAlong(extent.y, cellSize) * SpatialGrid_CellsAlong(extent.z, cellSize);
+        bool isTooMany = cells > maximumCells;
+        bool isTooFew = isAutomatic && cells < targetCells * 0.5;
+        if (!isTooMany && !isTooFew)
+        {
+            break;
+        }
+
+        cellSize *= (float)fmax(cbrt(cells / targetCells), isTooMany ? 1.1 : 0.5);
+    }
+
+    grid->origin = bounds.min;
+    grid->cellSize = cellSize;
+    grid->inverseCellSize = 1.0f / cellSize;
+    grid->dimensions = (Vector3Int){
+        (int)SpatialGrid_CellsAlong(extent.x, cellSize),
+        (int)SpatialGrid_CellsAlong(extent.y, cellSize),
+        (int)SpatialGrid_CellsAlong(extent.z, cellSize)};
+    grid->cellCount = (size_t)grid->dimensions.x * (size_t)grid->dimensions.y * (size_t)grid->dimensions.z;
+
+    grid->cellStarts = (size_t *)calloc(grid->cellCount + 1, sizeof(size_t));
+    grid->indices = (size_t *)malloc((count > 0 ? count : 1) * sizeof(size_t));
+    size_t *cells = (size_t *)malloc((count > 0 ? count : 1) * sizeof(size_t));
+    DebugAssert(grid->cellStarts != NULL && grid->indices != NULL && cells != NULL, "Memory allocation failed.");
+
+    // Counting sort by cell, the counts are shifted by one so their prefix sums are the starts of the cells
+    for (size_t i = 0; i < count; i++)
+    {
+        int x = SpatialGrid_CellCoordinate(points->x[i], grid->origin.x, grid->inverseCellSize, grid->dimensions.x);
+        int y = SpatialGrid_CellCoordinate(points->y[i], grid->origin.y, grid->inverseCellSize, grid->dimensions.y);
+        int z = SpatialGrid_CellCoordinate(points->z[i], grid->origin.z, grid->inverseCellSize, grid->dimensions.z);
+        cells[i] = SpatialGrid_RowCell(grid, y, z) + (size_t)x;
+        grid->cellStarts[cells[i] + 1]++;
+    }
+    for (size_t cell = 0; cell < grid->cellCount; cell++)
+    {
+        grid->cellStarts[cell + 1] += grid->cellStarts[cell];
+    }
+
+    // The starts of the cells move one cell down while scattering and are shifted back after
+    for (size_t i = 0; i < count; i++)
+    {
+        grid->indices[grid->cellStarts[cells[i]]++] = i;
+    }
+    memmove(grid->cellStarts + 1, grid->cellStarts, grid->cellCount * sizeof(size_t));
+    grid->cellStarts[0] = 0;
+
+    grid->points = SpatialIndex_SortedPoints(points, grid->indices);
+    free(cells);
+
+    return grid;
+}
+
+void SpatialGrid_Destroy(SpatialGrid *grid)
+{
+    DebugAssert(grid != NULL, "Null pointer passed as parameter.");
+
+    Vector3Batch_Destroy(grid->points);
+    free(grid->indices);
+    free(grid->cellStarts);
+    free(grid);
+}
+
+size_t SpatialGrid_Nearest(const SpatialGrid *grid, Vector3 position, float *squaredDistance)
+{
+    DebugAssert(grid != NULL, "Null pointer passed as parameter.");
+
+    float bestDistance = FLT_MAX;
+    size_t bestIndex = SIZE_MAX;
+
+    if (grid->points->count > 0)
+    {
+        int cellX = SpatialGrid_CellCoordinate(position.x, grid->origin.x, grid->inverseCellSize, grid->dimensions.x);
+        int cellY = SpatialGrid_CellCoordinate(position.y, grid->origin.y, grid->inverseCellSize, grid->dimensions.y);
+        int cellZ = SpatialGrid_CellCoordinate(position.z, grid->origin.z, grid->inverseCellSize, grid->dimensions.z);
+        int maximumRing = grid->dimensions.x > grid->dimensions.y ? grid->dimensions.x : grid->dimensions.y;
+        maximumRing = maximumRing > grid->dimensions.z ? maximumRing : grid->dimensions.z;
+
+        // Shells of cells around the cell of the position. A point of ring r is at least r - 1 cells away from the position clamped into
+        // the grid, and a position outside the grid is farther from every point than its clamped position, so the search ends there.
+        for (int ring = 0; ring <= maximumRing; ring++)
+        {
+            float reach = (float)(ring - 1) * grid->cellSize;
+            if (ring > 0 && bestDistance <= reach * reach)
+            {
+                break;
+            }
+
+            for (int z = cellZ - ring; z <= cellZ + ring; z++)
+            {
+                if (z < 0 || z >= grid->dimensions.z)
+                {
+                    continue;
+                }
+
+                for (int y = cellY - ring; y <= cellY + ring; y++)
+                {
+                    if (y < 0 || y >= grid->dimensions.y)
+                    {
+                        continue;
+                    }
+
+                    size_t row = SpatialGrid_RowCell(grid, y, z);
+                    int firstX = cellX - ring > 0 ? cellX - ring : 0;
+                    int lastX = cellX + ring < grid->dimensions.x - 1 ? cellX + ring : grid->dimensions.x - 1;
+
+                    if (z == cellZ - ring || z == cellZ + ring || y == cellY - ring || y == cellY + ring)
+                    {
+                        // On a face of the shell the whole row belongs to the ring, a single contiguous run
+                        SpatialGrid_ScanNearest(grid, row + (size_t)firstX, row + (size_t)lastX, position, &bestDistance, &bestIndex);
+                    }
+                    else
+                    {
+                        // Inside the shell only the two ends of the row belong to the ring
+                        if (cellX - ring >= 0)
+                        {
+                            SpatialGrid_ScanNearest(grid, row + (size_t)(cellX - ring), row + (size_t)(cellX - ring), position, &bestDistance, &bestIndex);
+                        }
+                        if (cellX + ring < grid->dimensions.x)
+                        {
+                            SpatialGrid_ScanNearest(grid, row + (size_t)(cellX + ring), row + (size_t)(cellX + ring), position, &bestDistance, &bestIndex);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (squaredDistance != NULL)
+    {
+        *squaredDistance = bestDistance;
+    }
+
+    return bestIndex != SIZE_MAX ? grid->indices[bestIndex] : SIZE_MAX;
+}
+
+size_t SpatialGrid_QueryRadius(const SpatialGrid *grid, Vector3 position, float radius, size_t *results, size_t capacity)
+{
+    DebugAssert(grid != NULL, "Null pointer passed as parameter.");
+
+    AABB box = {{position.x - radius, position.y - radius, position.z - radius}, {position.x + radius, position.y + radius, position.z + radius}};
+    AABB gridBox = {grid->origin, {grid->origin.x + grid->cellSize * (float)grid->dimensions.x, grid->origin.y + grid->cellSize * (float)grid->dimensions.y, grid->origin.z + grid->cellSize * (float)grid->dimensions.z}};
+    if (radius < 0.0f || grid->points->count == 0 || !AABB_Intersects(box, gridBox))
+    {
+        return 0;
+    }
+
+    int firstX = SpatialGrid_CellCoordinate(box.min.x, grid->origin.x, grid->inverseCellSize, grid->dimensions.x);
+    int firstY = SpatialGrid_CellCoordinate(box.min.y, grid->origin.y, grid->inverseCellSize, grid->dimensions.y);
+    int firstZ = SpatialGrid_CellCoordinate(box.min.z, grid->origin.z, grid->inverseCellSize, grid->dimensions.z);
+    int lastX = SpatialGrid_CellCoordinate(box.max.x, grid->origin.x, grid->inverseCellSize, grid->dimensions.x);
+    int lastY = SpatialGrid_CellCoordinate(box.max.y, grid->origin.y, grid->inverseCellSize, grid->dimensions.y);
+    int lastZ = SpatialGrid_CellCoordinate(box.max.z, grid->origin.z, grid->inverseCellSize, grid->dimensions.z);
+
+    const float *x = grid->points->x, *y = grid->points->y, *z = grid->points->z;
+    float squaredRadius = radius * radius;
+    size_t found = 0;
+
+    for (int cellZ = firstZ; cellZ <= lastZ; cellZ++)
+    {
+        for (int cellY = firstY; cellY <= lastY; cellY++)
+        {
+            size_t row = SpatialGrid_RowCell(grid, cellY, cellZ);
+            for (size_t i = grid->cellStarts[row + (size_t)firstX]; i < grid->cellStarts[row + (size_t)lastX + 1]; i++)
+            {
+                float dx = x[i] - position.x, dy = y[i] - position.y, dz = z[i] - position.z;
+                if (dx * dx + dy * dy + dz * dz <= squaredRadius)
+                {
+                    SpatialIndex_AddResult(results, capacity, &found, grid->indices[i]);
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+size_t SpatialGrid_QueryBox(const SpatialGrid *grid, AABB box, size_t *results, size_t capacity)
+{
+    DebugAssert(grid != NULL, "Null pointer passed as parameter.");
+
+    AABB gridBox = {grid->origin, {grid->origin.x + grid->cellSize * (float)grid->dimensions.x, grid->origin.y + grid->cellSize * (float)grid->dimensions.y, grid->origin.z + grid->cellSize * (float)grid->dimensions.z}};
+    if (AABB_IsEmpty(box) || grid->points->count == 0 || !AABB_Intersects(box, gridBox))
+    {
+        return 0;
+    }
+
+    int firstX = SpatialGrid_CellCoordinate(box.min.x, grid->origin.x, grid->inverseCellSize, grid->dimensions.x);
+    int firstY = SpatialGrid_CellCoordinate(box.min.y, grid->origin.y, grid->inverseCellSize, grid->dimensions.y);
+    int firstZ = SpatialGrid_CellCoordinate(box.min.z, grid->origin.z, grid->inverseCellSize, grid->dimensions.z);
+    int lastX = SpatialGrid_CellCoordinate(box.max.x, grid->origin.x, grid->inverseCellSize, grid->dimensions.x);
+    int lastY = SpatialGrid_CellCoordinate(box.max.y, grid->origin.y, grid->inverseCellSize, grid->dimensions.y);
+    int lastZ = SpatialGrid_CellCoordinate(box.max.z, grid->origin.z, grid->inverseCellSize, grid->dimensions.z);
+
+    const float *x = grid->points->x, *y = grid->points->y, *z = grid->points->z;
+    size_t found = 0;
+
+    for (int cellZ = firstZ; cellZ <= lastZ; cellZ++)
+    {
+        for (int cellY = firstY; cellY <= lastY; cellY++)
+        {
+            size_t row = SpatialGrid_RowCell(grid, cellY, cellZ);
+            for (size_t i = grid->cellStarts[row + (size_t)firstX]; i < grid->cellStarts[row + (size_t)lastX + 1]; i++)
+            {
+                if (x[i] >= box.min.x && x[i] <= box.max.x && y[i] >= box.min.y && y[i] <= box.max.y && z[i] >= box.min.z && z[i] <= box.max.z)
+                {
+                    SpatialIndex_AddResult(results, capacity, &found, grid->indices[i]);
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+#pragma endregion SpatialGrid
+
+#pragma region SpatialBVH
+
+SpatialBVH *SpatialBVH_Create(const Vector3Batch *points)
+{
+    DebugAssert(points != NULL, "Null pointer passed as parameter.");
+    DebugAssert(points->count < UINT32_MAX, "Too many points for a bounding volume hierarchy.");
+
+    SpatialBVH *bvh = (SpatialBVH *)malloc(sizeof(SpatialBVH));
+    DebugAssert(bvh != NULL, "Memory allocation failed.");
+
+    size_t count = points->count;
+    bvh->points = Vector3Batch_Create(count);
+    memcpy(bvh->points->x, points->x, count * sizeof(float));
+    memcpy(bvh->points->y, points->y, count * sizeof(float));
+    memcpy(bvh->points->z, points->z, count * sizeof(float));
+
+    SpatialBVHBuilder builder = {{bvh->points->x, bvh->points->y, bvh->points->z}, NULL, NULL, 0, count / SPATIAL_BVH_LEAF_SIZE + 1};
+    builder.indices = (size_t *)malloc((count > 0 ? count : 1) * sizeof(size_t));
+    builder.nodes = (SpatialBVHNode *)malloc(builder.nodeCapacity * sizeof(SpatialBVHNode));
+    DebugAssert(builder.indices != NULL && builder.nodes != NULL, "Memory allocation failed.");
+
+    for (size_t i = 0; i < count; i++)
+    {
+        builder.indices[i] = i;
+    }
+
+    if (count > 0)
+    {
+        SpatialBVH_Build(&builder, 0, count);
+    }
+    else
+    {
+        SpatialBVH_AddNode(&builder);
+    }
+
+    bvh->nodes = builder.nodes;
+    bvh->nodeCount = builder.nodeCount;
+    bvh->indices = builder.indices;
+    bvh->bounds = count > 0 ? SpatialIndex_Bounds(points->x, points->y, points->z, 0, count) : AABB_Empty();
+
+    return bvh;
+}
+
+void SpatialBVH_Destroy(SpatialBVH *bvh)
+{
+    DebugAssert(bvh != NULL, "Null pointer passed as parameter.");
+
+    Vector3Batch_Destroy(bvh->points);
+    free(bvh->indices);
+    free(bvh->nodes);
+    free(bvh);
+}
+
+size_t SpatialBVH_Nearest(const SpatialBVH *bvh, Vector3 position, float *squaredDistance)
+{
+    DebugAssert(bvh != NULL, "Null pointer passed as parameter.");
+
+    const float *x = bvh->points->x, *y = bvh->points->y, *z = bvh->points->z;
+    float bestDistance = FLT_MAX;
+    size_t bestIndex = SIZE_MAX;
+
+    uint32_t stackNodes[SPATIAL_BVH_STACK_SIZE];
+    float stackDistances[SPATIAL_BVH_STACK_SIZE];
+    int stackCount = 0;
+
+    stackNodes[stackCount] = 0;
+    stackDistances[stackCount++] = 0.0f;
+
+    while (stackCount > 0)
+    {
+        stackCount--;
+        if (stackDistances[stackCount] >= bestDistance)
+        {
+            continue;
+        }
+
+        const SpatialBVHNode *node = &bvh->nodes[stackNodes[stackCount]];
+        float distances[SPATIAL_BVH_WIDTH];
+        SpatialBVH_LaneDistances(node, position, distances);
+
+        // The lanes closest first, an insertion sort of at most SPATIAL_BVH_WIDTH entries
+        int order[SPATIAL_BVH_WIDTH];
+        for (int lane = 0; lane < SPATIAL_BVH_WIDTH; lane++)
+        {
+            int slot = lane;
+            while (slot > 0 && distances[order[slot - 1]] > distances[lane])
+            {
+                order[slot] = order[slot - 1];
+                slot--;
+            }
+            order[slot] = lane;
+        }
+
+        // Leaves are scanned right away, closest first, so the best distance tightens before the inner children are pushed
+        for (int i = 0; i < SPATIAL_BVH_WIDTH; i++)
+        {
+            int lane = order[i];
+            if (node->counts[lane] == 0 || distances[lane] >= bestDistance)
+            {
+                continue;
+            }
+
+            uint32_t end = node->children[lane] + node->counts[lane];
+            for (uint32_t point = node->children[lane]; point < end; point++)
+            {
+                float dx = x[point] - position.x, dy = y[point] - position.y, dz = z[point] - position.z;
+                float distance = dx * dx + dy * dy + dz * dz;
+                if (distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    bestIndex = point;
+                }
+            }
+        }
+
+        // Inner children pushed farthest first, so the closest is popped next
+        for (int i = SPATIAL_BVH_WIDTH - 1; i >= 0; i--)
+        {
+            int lane = order[i];
+            if (node->counts[lane] != 0 || node->minX[lane] > node->maxX[lane] || distances[lane] >= bestDistance)
+            {
+                continue;
+            }
+
+            DebugAssert(stackCount < SPATIAL_BVH_STACK_SIZE, "Bounding volume hierarchy traversal stack overflow.");
+            stackNodes[stackCount] = node->children[lane];
+            stackDistances[stackCount++] = distances[lane];
+        }
+    }
+
+    if (squaredDistance != NULL)
+    {
+        *squaredDistance = bestDistance;
+    }
+
+    return bestIndex != SIZE_MAX ? bvh->indices[bestIndex] : SIZE_MAX;
+}
+
+size_t SpatialBVH_QueryRadius(const SpatialBVH *bvh, Vector3 position, float radius, size_t *results, size_t capacity)
+{
+    DebugAssert(bvh != NULL, "Null pointer passed as parameter.");
+
+    if (radius < 0.0f)
+    {
+        return 0;
+    }
+
+    const float *x = bvh->points->x, *y = bvh->points->y, *z = bvh->points->z;
+    float squaredRadius = radius * radius;
+    size_t found = 0;
+
+    uint32_t stack[SPATIAL_BVH_STACK_SIZE];
+    int stackCount = 0;
+    stack[stackCount++] = 0;
+
+    while (stackCount > 0)
+    {
+        const SpatialBVHNode *node = &bvh->nodes[stack[--stackCount]];
+        float distances[SPATIAL_BVH_WIDTH];
+        SpatialBVH_LaneDistances(node, position, distances);
+
+        for (int lane = 0; lane < SPATIAL_BVH_WIDTH; lane++)
+        {
+            if (distances[lane] > squaredRadius)
+            {
+                continue;
+            }
+
+            if (node->counts[lane] == 0)
+            {
+                DebugAssert(stackCount < SPATIAL_BVH_STACK_SIZE, "Bounding volume hierarchy traversal stack overflow.");
+                stack[stackCount++] = node->children[lane];
+                continue;
+            }
+
+            uint32_t end = node->children[lane] + node->counts[lane];
+            for (uint32_t point = node->children[lane]; point < end; point++)
+            {
+                float dx = x[point] - position.x, dy = y[point] - position.y, dz = z[point] - position.z;
+                if (dx * dx + dy * dy + dz * dz <= squaredRadius)
+                {
+                    SpatialIndex_AddResult(results, capacity, &found, bvh->indices[point]);
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+size_t SpatialBVH_QueryBox(const SpatialBVH *bvh, AABB box, size_t *results, size_t capacity)
+{
+    DebugAssert(bvh != NULL, "Null pointer passed as parameter.");
+
+    const float *x = bvh->points->x, *y = bvh->points->y, *z = bvh->points->z;
+    size_t found = 0;
+
+    uint32_t stack[SPATIAL_BVH_STACK_SIZE];
+    int stackCount = 0;
+    stack[stackCount++] = 0;
+
+    while (stackCount > 0)
+    {
+        const SpatialBVHNode *node = &bvh->nodes[stack[--stackCount]];
+        int overlaps[SPATIAL_BVH_WIDTH];
+        SpatialBVH_LaneOverlaps(node, box, overlaps);
+
+        for (int lane = 0; lane < SPATIAL_BVH_WIDTH; lane++)
+        {
+            if (!overlaps[lane])
+            {
+                continue;
+            }
+
+            if (node->counts[lane] == 0)
+            {
+                DebugAssert(stackCount < SPATIAL_BVH_STACK_SIZE, "Bounding volume hierarchy traversal stack overflow.");
+                stack[stackCount++] = node->children[lane];
+                continue;
+            }
+
+            // A leaf inside the box is taken whole, without testing its points
+            bool isInside = node->minX[lane] >= box.min.x && node->maxX[lane] <= box.max.x &&
+                            node->minY[lane] >= box.min.y && node->maxY[lane] <= box.max.y &&
+                            node->minZ[lane] >= box.min.z && node->maxZ[lane] <= box.max.z;
+
+            uint32_t end = node->children[lane] + node->counts[lane];
+            for (uint32_t point = node->children[lane]; point < end; point++)
+            {
+                if (isInside || (x[point] >= box.min.x && x[point] <= box.max.x && y[point] >= box.min.y && y[point] <= box.max.y && z[point] >= box.min.z && z[point] <= box.max.z))
+                {
+                    SpatialIndex_AddResult(results, capacity, &found, bvh->indices[point]);
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+#pragma endregion SpatialBVH
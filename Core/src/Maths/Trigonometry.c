@@ -1,7 +1,43 @@
 #include "Maths/Trigonometry.h"
 
+#include "Maths/Simd.h"
+
 #include <math.h>
 
+#pragma region Source Only
+
+const TrigPolynomials TRIG_POLYNOMIALS_PRECISE = {
+    .sine = {-1.6666650669e-01f, 8.3319786625e-03f, -1.9495636168e-04f},
+    .sineCount = 3,
+    .cosine = {-4.9999894781e-01f, 4.1656294581e-02f, -1.3597823141e-03f},
+    .cosineCount = 3,
+    .arcTangent = {9.9999933542e-01f, -3.3329860226e-01f, 1.9946559509e-01f, -1.3908599867e-01f, 9.6421240007e-02f, -5.5911358778e-02f, 2.1862308176e-02f, -4.0543929936e-03f},
+    .arcTangentCount = 8,
+};
+
+const TrigPolynomials TRIG_POLYNOMIALS_FAST = {
+    .sine = {-1.6662833806e-01f, 8.1529923262e-03f},
+    .sineCount = 2,
+    .cosine = {-4.9977630709e-01f, 4.0488935879e-02f},
+    .cosineCount = 2,
+    .arcTangent = {9.9921381288e-01f, -3.2117496949e-01f, 1.4626446180e-01f, -3.8986512412e-02f},
+    .arcTangentCount = 4,
+};
+
+/// @brief Evaluates a polynomial with Horner's method.
+float Trig_Polynomial(const float *coefficients, int count, float z)
+{
+    float result = coefficients[count - 1];
+    for (int i = count - 2; i >= 0; i--)
+    {
+        result = result * z + coefficients[i];
+    }
+
+    return result;
+}
+
+#pragma endregion Source Only
+
 float Rad2Deg(float radian)
 {
     return radian * (180.0f / PI);
@@ -105,3 +141,98 @@ float CscDeg(float degree)
 {
     return 1.0f / SinDeg(degree);
 }
+
+const TrigPolynomials *Trig_GetPolynomials(TrigAccuracy accuracy)
+{
+    switch (accuracy)
+    {
+    case TrigAccuracy_Precise:
+        return &TRIG_POLYNOMIALS_PRECISE;
+    case TrigAccuracy_Fast:
+        return &TRIG_POLYNOMIALS_FAST;
+    default:
+        return NULL;
+    }
+}
+
+float SinRadFast(float radian, TrigAccuracy accuracy)
+{
+    float sine, cosine;
+    SinCosRad(radian, accuracy, &sine, &cosine);
+    return sine;
+}
+
+float CosRadFast(float radian, TrigAccuracy accuracy)
+{
+    float sine, cosine;
+    SinCosRad(radian, accuracy, &sine, &cosine);
+    return cosine;
+}
+
+void SinCosRad(float radian, TrigAccuracy accuracy, float *sine, float *cosine)
+{
+    const TrigPolynomials *polynomials = Trig_GetPolynomials(accuracy);
+    if (polynomials == NULL)
+    {
+        *sine = sinf(radian);
+        *cosine = cosf(radian);
+        return;
+    }
+
+    // Reduced to [-PI / 4, PI / 4] and the quadrant of the angle, rounded to the nearest even same with the SIMD conversions
+    long quadrant = lrintf(radian * TRIG_TWO_OVER_PI);
+    float quadrantValue = (float)quadrant;
+    float reduced = ((radian - quadrantValue * TRIG_HALF_PI_1) - quadrantValue * TRIG_HALF_PI_2) - quadrantValue * TRIG_HALF_PI_3;
+    float z = reduced * reduced;
+
+    float reducedSine = reduced + reduced * z * Trig_Polynomial(polynomials->sine, polynomials->sineCount, z);
+    float reducedCosine = 1.0f + z * Trig_Polynomial(polynomials->cosine, polynomials->cosineCount, z);
+
+    // Odd quadrants swap sine and cosine, the quadrant bits give the signs.
+    bool isSwapped = (quadrant & 1) != 0;
+    float resultSine = isSwapped ? reducedCosine : reducedSine;
+    float resultCosine = isSwapped ? reducedSine : reducedCosine;
+
+    *sine = (quadrant & 2) != 0 ? -resultSine : resultSine;
+    *cosine = ((quadrant + 1) & 2) != 0 ? -resultCosine : resultCosine;
+}
+
+void SinCosDeg(float degree, TrigAccuracy accuracy, float *sine, float *cosine)
+{
+    SinCosRad(Deg2Rad(degree), accuracy, sine, cosine);
+}
+
+float ArcTan2RadFast(float y, float x, TrigAccuracy accuracy)
+{
+    const TrigPolynomials *polynomials = Trig_GetPolynomials(accuracy);
+    if (polynomials == NULL)
+    {
+        return atan2f(y, x);
+    }
+
+    // Reduced to the arc tangent of [0, 1], then moved to the octant of the point
+    float absoluteX = fabsf(x);
+    float absoluteY = fabsf(y);
+    float maximum = fmaxf(absoluteX, absoluteY);
+    float ratio = maximum > 0.0f ? fminf(absoluteX, absoluteY) / maximum : 0.0f;
+
+    float angle = ratio * Trig_Polynomial(polynomials->arcTangent, polynomials->arcTangentCount, ratio * ratio);
+    angle = absoluteY > absoluteX ? PI / 2.0f - angle : angle;
+    angle = signbit(x) ? PI - angle : angle; // sign bit instead of x < 0, atan2f(0, -0) is PI
+
+    return copysignf(angle, y);
+}
+
+void SinCosRadArray(const float *radians, float *sines, float *cosines, size_t count, TrigAccuracy accuracy)
+{
+    DebugAssert(radians != NULL, "Null pointer passed as parameter.");
+
+    Simd_GetKernels()->sinCos(radians, sines, cosines, accuracy, count);
+}
+
+void ArcTan2RadArray(const float *ys, const float *xs, float *results, size_t count, TrigAccuracy accuracy)
+{
+    DebugAssert(ys != NULL && xs != NULL && results != NULL, "Null pointer passed as parameter.");
+
+    Simd_GetKernels()->arcTan2(ys, xs, results, accuracy, count);
+}
@@ -0,0 +1,402 @@
+#include "Maths/VectorsBatch.h"
+
+#pragma region Source Only
+
+/// @brief Allocates the components of a batch as a single block. Every component starts on a SIMD_ALIGNMENT boundary.
+/// @param components Component pointers to set.
+/// @param dimension Count of the components.
+/// @param count Count of the vectors.
+void VectorBatch_AllocateComponents(float **components, int dimension, size_t count)
+{
+    size_t floatsPerAlignment = SIMD_ALIGNMENT / sizeof(float);
+    size_t stride = (count + floatsPerAlignment - 1) / floatsPerAlignment * floatsPerAlignment;
+
+    float *block = Simd_AllocateFloats(stride * (size_t)dimension);
+    memset(block, 0, stride * (size_t)dimension * sizeof(float));
+
+    for (int d = 0; d < dimension; d++)
+    {
+        components[d] = block + stride * (size_t)d;
+    }
+}
+
+/// @brief Adds component arrays pairwise.
+void VectorBatch_Add(float *const *components1, float *const *components2, float *const *results, int dimension, size_t count)
+{
+    const SimdKernels *kernels = Simd_GetKernels();
+    for (int d = 0; d < dimension; d++)
+    {
+        kernels->add(components1[d], components2[d], results[d], count);
+    }
+}
+
+/// @brief Multiplies component arrays by a scalar.
+void VectorBatch_Multiply(float *const *components, float scalar, float *const *results, int dimension, size_t count)
+{
+    const SimdKernels *kernels = Simd_GetKernels();
+    for (int d = 0; d < dimension; d++)
+    {
+        kernels->multiply(components[d], scalar, results[d], count);
+    }
+}
+
+/// @brief Interpolates component arrays pairwise.
+void VectorBatch_Lerp(float *const *startComponents, float *const *endComponents, float time, float *const *results, int dimension, size_t count)
+{
+    const SimdKernels *kernels = Simd_GetKernels();
+    for (int d = 0; d < dimension; d++)
+    {
+        kernels->lerp(startComponents[d], endComponents[d], time, results[d], count);
+    }
+}
+
+#pragma endregion Source Only
+
+#pragma region Vector2Batch
+
+Vector2Batch *Vector2Batch_Create(size_t count)
+{
+    Vector2Batch *batch = (Vector2Batch *)malloc(sizeof(Vector2Batch));
+    DebugAssert(batch != NULL, "Memory allocation failed.");
+
+    float *components[2];
+    VectorBatch_AllocateComponents(components, 2, count);
+
+    batch->x = components[0];
+    batch->y = components[1];
+    batch->count = count;
+
+    return batch;
+}
+
+void Vector2Batch_Destroy(Vector2Batch *batch)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+
+    Simd_Free(batch->x); // start of the single block of all components
+    batch->x = NULL;
+    batch->y = NULL;
+    batch->count = 0;
+
+    free(batch);
+    batch = NULL;
+}
+
+void Vector2Batch_Set(Vector2Batch *batch, size_t index, Vector2 vector)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+    DebugAssert(index < batch->count, "Index %zu is out of the batch with %zu vectors.", index, batch->count);
+
+    batch->x[index] = vector.x;
+    batch->y[index] = vector.y;
+}
+
+Vector2 Vector2Batch_Get(const Vector2Batch *batch, size_t index)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+    DebugAssert(index < batch->count, "Index %zu is out of the batch with %zu vectors.", index, batch->count);
+
+    return (Vector2){batch->x[index], batch->y[index]};
+}
+
+void Vector2Batch_Add(const Vector2Batch *batch1, const Vector2Batch *batch2, Vector2Batch *result)
+{
+    DebugAssert(batch1 != NULL && batch2 != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch1->count == batch2->count && batch1->count == result->count, "Batch counts do not match.");
+
+    float *components1[2] = {batch1->x, batch1->y};
+    float *components2[2] = {batch2->x, batch2->y};
+    float *results[2] = {result->x, result->y};
+
+    VectorBatch_Add(components1, components2, results, 2, batch1->count);
+}
+
+void Vector2Batch_Multiply(const Vector2Batch *batch, float scalar, Vector2Batch *result)
+{
+    DebugAssert(batch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    float *components[2] = {batch->x, batch->y};
+    float *results[2] = {result->x, result->y};
+
+    VectorBatch_Multiply(components, scalar, results, 2, batch->count);
+}
+
+void Vector2Batch_Dot(const Vector2Batch *batch1, const Vector2Batch *batch2, float *results)
+{
+    DebugAssert(batch1 != NULL && batch2 != NULL && results != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch1->count == batch2->count, "Batch counts do not match.");
+
+    const float *components1[2] = {batch1->x, batch1->y};
+    const float *components2[2] = {batch2->x, batch2->y};
+
+    Simd_GetKernels()->dot(components1, components2, 2, results, batch1->count);
+}
+
+void Vector2Batch_Normalize(const Vector2Batch *batch, Vector2Batch *result)
+{
+    DebugAssert(batch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    const float *components[2] = {batch->x, batch->y};
+    float *results[2] = {result->x, result->y};
+
+    Simd_GetKernels()->normalize(components, results, 2, batch->count);
+}
+
+void Vector2Batch_Lerp(const Vector2Batch *startBatch, const Vector2Batch *endBatch, float time, Vector2Batch *result)
+{
+    DebugAssert(startBatch != NULL && endBatch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(startBatch->count == endBatch->count && startBatch->count == result->count, "Batch counts do not match.");
+
+    float *startComponents[2] = {startBatch->x, startBatch->y};
+    float *endComponents[2] = {endBatch->x, endBatch->y};
+    float *results[2] = {result->x, result->y};
+
+    VectorBatch_Lerp(startComponents, endComponents, time, results, 2, startBatch->count);
+}
+
+#pragma endregion Vector2Batch
+
+#pragma region Vector3Batch
+
+Vector3Batch *Vector3Batch_Create(size_t count)
+{
+    Vector3Batch *batch = (Vector3Batch *)malloc(sizeof(Vector3Batch));
+    DebugAssert(batch != NULL, "Memory allocation failed.");
+
+    float *components[3];
+    VectorBatch_AllocateComponents(components, 3, count);
+
+    batch->x = components[0];
+    batch->y = components[1];
+    batch->z = components[2];
+    batch->count = count;
+
+    return batch;
+}
+
+void Vector3Batch_Destroy(Vector3Batch *batch)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+
+    Simd_Free(batch->x); // start of the single block of all components
+    batch->x = NULL;
+    batch->y = NULL;
+    batch->z = NULL;
+    batch->count = 0;
+
+    free(batch);
+    batch = NULL;
+}
+
+void Vector3Batch_Set(Vector3Batch *batch, size_t index, Vector3 vector)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+    DebugAssert(index < batch->count, "Index %zu is out of the batch with %zu vectors.", index, batch->count);
+
+    batch->x[index] = vector.x;
+    batch->y[index] = vector.y;
+    batch->z[index] = vector.z;
+}
+
+Vector3 Vector3Batch_Get(const Vector3Batch *batch, size_t index)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+    DebugAssert(index < batch->count, "Index %zu is out of the batch with %zu vectors.", index, batch->count);
+
+    return (Vector3){batch->x[index], batch->y[index], batch->z[index]};
+}
+
+void Vector3Batch_Add(const Vector3Batch *batch1, const Vector3Batch *batch2, Vector3Batch *result)
+{
+    DebugAssert(batch1 != NULL && batch2 != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch1->count == batch2->count && batch1->count == result->count, "Batch counts do not match.");
+
+    float *components1[3] = {batch1->x, batch1->y, batch1->z};
+    float *components2[3] = {batch2->x, batch2->y, batch2->z};
+    float *results[3] = {result->x, result->y, result->z};
+
+    VectorBatch_Add(components1, components2, results, 3, batch1->count);
+}
+
+void Vector3Batch_Multiply(const Vector3Batch *batch, float scalar, Vector3Batch *result)
+{
+    DebugAssert(batch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    float *components[3] = {batch->x, batch->y, batch->z};
+    float *results[3] = {result->x, result->y, result->z};
+
+    VectorBatch_Multiply(components, scalar, results, 3, batch->count);
+}
+
+void Vector3Batch_Dot(const Vector3Batch *batch1, const Vector3Batch *batch2, float *results)
+{
+    DebugAssert(batch1 != NULL && batch2 != NULL && results != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch1->count == batch2->count, "Batch counts do not match.");
+
+    const float *components1[3] = {batch1->x, batch1->y, batch1->z};
+    const float *components2[3] = {batch2->x, batch2->y, batch2->z};
+
+    Simd_GetKernels()->dot(components1, components2, 3, results, batch1->count);
+}
+
+void Vector3Batch_Normalize(const Vector3Batch *batch, Vector3Batch *result)
+{
+    DebugAssert(batch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    const float *components[3] = {batch->x, batch->y, batch->z};
+    float *results[3] = {result->x, result->y, result->z};
+
+    Simd_GetKernels()->normalize(components, results, 3, batch->count);
+}
+
+void Vector3Batch_Lerp(const Vector3Batch *startBatch, const Vector3Batch *endBatch, float time, Vector3Batch *result)
+{
+    DebugAssert(startBatch != NULL && endBatch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(startBatch->count == endBatch->count && startBatch->count == result->count, "Batch counts do not match.");
+
+    float *startComponents[3] = {startBatch->x, startBatch->y, startBatch->z};
+    float *endComponents[3] = {endBatch->x, endBatch->y, endBatch->z};
+    float *results[3] = {result->x, result->y, result->z};
+
+    VectorBatch_Lerp(startComponents, endComponents, time, results, 3, startBatch->count);
+}
+
+void Vector3Batch_Transform(const Vector3Batch *batch, const Matrix4 *matrix, Vector3Batch *result)
+{
+    DebugAssert(batch != NULL && matrix != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    const float *components[3] = {batch->x, batch->y, batch->z};
+    float *results[3] = {result->x, result->y, result->z};
+
+    Simd_GetKernels()->transform(&matrix->matrix[0][0], components, 3, results, batch->count);
+}
+
+#pragma endregion Vector3Batch
+
+#pragma region Vector4Batch
+
+Vector4Batch *Vector4Batch_Create(size_t count)
+{
+    Vector4Batch *batch = (Vector4Batch *)malloc(sizeof(Vector4Batch));
+    DebugAssert(batch != NULL, "Memory allocation failed.");
+
+    float *components[4];
+    VectorBatch_AllocateComponents(components, 4, count);
+
+    batch->x = components[0];
+    batch->y = components[1];
+    batch->z = components[2];
+    batch->w = components[3];
+    batch->count = count;
+
+    return batch;
+}
+
+void Vector4Batch_Destroy(Vector4Batch *batch)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+
+    Simd_Free(batch->x); // start of the single block of all components
+    batch->x = NULL;
+    batch->y = NULL;
+    batch->z = NULL;
+    batch->w = NULL;
+    batch->count = 0;
+
+    free(batch);
+    batch = NULL;
+}
+
+void Vector4Batch_Set(Vector4Batch *batch, size_t index, Vector4 vector)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+    DebugAssert(index < batch->count, "Index %zu is out of the batch with %zu vectors.", index, batch->count);
+
+    batch->x[index] = vector.x;
+    batch->y[index] = vector.y;
+    batch->z[index] = vector.z;
+    batch->w[index] = vector.w;
+}
+
+Vector4 Vector4Batch_Get(const Vector4Batch *batch, size_t index)
+{
+    DebugAssert(batch != NULL, "Null pointer passed as parameter.");
+    DebugAssert(index < batch->count, "Index %zu is out of the batch with %zu vectors.", index, batch->count);
+
+    return (Vector4){batch->x[index], batch->y[index], batch->z[index], batch->w[index]};
+}
+
+void Vector4Batch_Add(const Vector4Batch *batch1, const Vector4Batch *batch2, Vector4Batch *result)
+{
+    DebugAssert(batch1 != NULL && batch2 != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch1->count == batch2->count && batch1->count == result->count, "Batch counts do not match.");
+
+    float *components1[4] = {batch1->x, batch1->y, batch1->z, batch1->w};
+    float *components2[4] = {batch2->x, batch2->y, batch2->z, batch2->w};
+    float *results[4] = {result->x, result->y, result->z, result->w};
+
+    VectorBatch_Add(components1, components2, results, 4, batch1->count);
+}
+
+void Vector4Batch_Multiply(const Vector4Batch *batch, float scalar, Vector4Batch *result)
+{
+    DebugAssert(batch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    float *components[4] = {batch->x, batch->y, batch->z, batch->w};
+    float *results[4] = {result->x, result->y, result->z, result->w};
+
+    VectorBatch_Multiply(components, scalar, results, 4, batch->count);
+}
+
+void Vector4Batch_Dot(const Vector4Batch *batch1, const Vector4Batch *batch2, float *results)
+{
+    DebugAssert(batch1 != NULL && batch2 != NULL && results != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch1->count == batch2->count, "Batch counts do not match.");
+
+    const float *components1[4] = {batch1->x, batch1->y, batch1->z, batch1->w};
+    const float *components2[4] = {batch2->x, batch2->y, batch2->z, batch2->w};
+
+    Simd_GetKernels()->dot(components1, components2, 4, results, batch1->count);
+}
+
+void Vector4Batch_Normalize(const Vector4Batch *batch, Vector4Batch *result)
+{
+    DebugAssert(batch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    const float *components[4] = {batch->x, batch->y, batch->z, batch->w};
+    float *results[4] = {result->x, result->y, result->z, result->w};
+
+    Simd_GetKernels()->normalize(components, results, 4, batch->count);
+}
+
+void Vector4Batch_Lerp(const Vector4Batch *startBatch, const Vector4Batch *endBatch, float time, Vector4Batch *result)
+{
+    DebugAssert(startBatch != NULL && endBatch != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(startBatch->count == endBatch->count && startBatch->count == result->count, "Batch counts do not match.");
+
+    float *startComponents[4] = {startBatch->x, startBatch->y, startBatch->z, startBatch->w};
+    float *endComponents[4] = {endBatch->x, endBatch->y, endBatch->z, endBatch->w};
+    float *results[4] = {result->x, result->y, result->z, result->w};
+
+    VectorBatch_Lerp(startComponents, endComponents, time, results, 4, startBatch->count);
+}
+
+void Vector4Batch_Transform(const Vector4Batch *batch, const Matrix4 *matrix, Vector4Batch *result)
+{
+    DebugAssert(batch != NULL && matrix != NULL && result != NULL, "Null pointer passed as parameter.");
+    DebugAssert(batch->count == result->count, "Batch counts do not match.");
+
+    const float *components[4] = {batch->x, batch->y, batch->z, batch->w};
+    float *results[4] = {result->x, result->y, result->z, result->w};
+
+    Simd_GetKernels()->transform(&matrix->matrix[0][0], components, 4, results, batch->count);
+}
+
+#pragma endregion Vector4Batch
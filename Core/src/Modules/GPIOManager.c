@@ -1,12 +1,23 @@
+#ifdef __linux__
+#define _GNU_SOURCE // CPU affinity of the waveform player thread
+#endif
+
 #include "Modules/GPIOManager.h"
 
 #if PLATFORM_LINUX
 
+#include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sched.h>
 #include <sys/ioctl.h>
-#include <linux/spi/spidev.h>
+#include <sys/prctl.h>
 #include <gpiod.h>
 
+#include "Utils/RingBuffer.h"
+
 #pragma region Source Only
 
 typedef struct GPIOPin
@@ -27,6 +38,420 @@ typedef struct GPIOChip
     stringHeap chipPath;
 } GPIOChip;
 
+typedef struct GPIOPinGroup
+{
+    struct gpiod_line_bulk bulkHandle;
+    unsigned int lineIndices[GPIO_PIN_GROUP_MAX_PINS];
+    size_t pinCount;
+    stringHeap consumerName;
+
+    GPIOLineDirection lineDirection;
+} GPIOPinGroup;
+
+typedef struct GPIOEventReader
+{
+    GPIOPin *pins[GPIO_EVENT_READER_MAX_PINS];
+    size_t pinCount;
+
+    RingBuffer *events; // Pushed only by the reader thread, popped only by the app.
+    _Atomic unsigned long long eventCount;
+    _Atomic unsigned long long overflowCount;
+
+    pthread_t thread;
+    int stopPipe[2]; // Written on destroy to wake the thread from poll.
+} GPIOEventReader;
+
+/// @brief Thread of the event reader. Waits for edges of all lines with a single poll and pushes them with their kernel timestamps.
+/// @param argument The GPIOEventReader instance.
+/// @return Always NULL.
+void *GPIOEventReader_Run(void *argument)
+{
+    GPIOEventReader *reader = (GPIOEventReader *)argument;
+
+    struct pollfd pollFds[GPIO_EVENT_READER_MAX_PINS + 1];
+    for (size_t i = 0; i < reader->pinCount; i++)
+    {
+        pollFds[i] = (struct pollfd){.fd = gpiod_line_event_get_fd(reader->pins[i]->lineHandle), .events = POLLIN | POLLPRI, .revents = 0};
+    }
+
+    pollFds[reader->pinCount] = (struct pollfd){.fd = reader->stopPipe[0], .events = POLLIN, .revents = 0};
+
+    struct gpiod_line_event lineEvents[GPIO_EVENT_READER_BATCH_SIZE];
+
+    while (true)
+    {
+        if (poll(pollFds, (nfds_t)(reader->pinCount + 1), -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            DebugError("Polling GPIO event lines failed. errno : %d. Event reader thread is stopped.", errno);
+            return NULL;
+        }
+
+        if (pollFds[reader->pinCount].revents != 0)
+        {
+            return NULL;
+        }
+
+        for (size_t i = 0; i < reader->pinCount; i++)
+        {
+            if (pollFds[i].revents == 0)
+            {
+                continue;
+            }
+
+            // All edges queued by the kernel since the last wake up, in a single read.
+            int readCount = gpiod_line_event_read_fd_multiple(pollFds[i].fd, lineEvents, GPIO_EVENT_READER_BATCH_SIZE);
+
+            for (int j = 0; j < readCount; j++)
+            {
+                GPIOEdgeEvent event = {
+                    .pinIndex = i,
+                    .type = lineEvents[j].event_type == GPIOD_LINE_EVENT_RISING_EDGE ? GPIOInputEventType_RisingEdge : GPIOInputEventType_FallingEdge,
+                    .timestamp = (unsigned long long)lineEvents[j].ts.tv_sec * 1000000000ULL + (unsigned long long)lineEvents[j].ts.tv_nsec,
+                };
+
+                if (!RingBuffer_Push(reader->events, &event))
+                {
+                    atomic_fetch_add_explicit(&reader->overflowCount, 1, memory_order_relaxed);
+                }
+            }
+
+            if (readCount > 0)
+            {
+                atomic_fetch_add_explicit(&reader->eventCount, (unsigned long long)readCount, memory_order_relaxed);
+            }
+        }
+    }
+}
+
+typedef struct GPIOPwm
+{
+    GPIOPin *pin;
+    _Atomic unsigned long long periodNanoseconds; // Set by the app, latched by the scheduler on every period start.
+    _Atomic unsigned long long dutyNanoseconds;
+
+    // Owned by the scheduler thread
+    unsigned long long activePeriod;
+    unsigned long long activeDuty;
+    unsigned long long periodStart; // Absolute monotonic time of the running period.
+    unsigned long long nextEdge;    // Absolute monotonic time of the next edge.
+    bool nextIsPeriodStart;
+    bool isHigh;
+} GPIOPwm;
+
+/// @brief Channels of the scheduler. Modified by the app and read by the scheduler, both under the mutex.
+GPIOPwm *GPIO_PWM_CHANNELS[GPIO_PWM_MAX_CHANNELS];
+size_t GPIO_PWM_CHANNEL_COUNT = 0;
+
+pthread_mutex_t GPIO_PWM_MUTEX = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t GPIO_PWM_CONDITION; // Signaled when the channels change and when the scheduler is stopped or joined. Waits on the monotonic clock.
+bool GPIO_PWM_CONDITION_INITIALIZED = false;
+pthread_t GPIO_PWM_THREAD;
+bool GPIO_PWM_THREAD_RUNNING = false;
+bool GPIO_PWM_THREAD_STOP = false; // Set while the scheduler is stopping, until it is joined.
+int GPIO_PWM_REALTIME_PRIORITY = 0;
+
+/// @brief Lateness sum is kept apart from the stats, mean is computed when the stats are got.
+GPIOPwmStats GPIO_PWM_STATS = {0};
+unsigned long long GPIO_PWM_LATENESS_SUM = 0;
+
+/// @brief Gets the monotonic clock in nanoseconds. Same clock the scheduler sleeps with.
+/// @return Current time.
+unsigned long long GPIOPwm_GetTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+/// @brief Applies the scheduling policy of the priority to the scheduler thread.
+/// @param priority Real-time priority or 0 for normal scheduling.
+/// @return True on success.
+bool GPIOPwm_ApplyPriority(int priority)
+{
+    struct sched_param parameter = {.sched_priority = priority};
+    int scheduleReturn = pthread_setschedparam(GPIO_PWM_THREAD, priority > 0 ? SCHED_FIFO : SCHED_OTHER, &parameter);
+
+    if (scheduleReturn != 0)
+    {
+        DebugWarning("Failed to set PWM thread priority to %d, error in pthread_setschedparam function. Return : %d.", priority, scheduleReturn);
+        return false;
+    }
+
+    return true;
+}
+
+/// @brief Writes the edge of a channel and schedules its next edge.
+/// @param pwm Channel to advance.
+/// @param now Current time, late period starts are moved to it.
+void GPIOPwm_Advance(GPIOPwm *pwm, unsigned long long now)
+{
+    bool level;
+
+    if (pwm->nextIsPeriodStart)
+    {
+        // Latched only here, a changed duty or period never cuts a running pulse.
+        pwm->activePeriod = atomic_load_explicit(&pwm->periodNanoseconds, memory_order_relaxed);
+        pwm->activeDuty = atomic_load_explicit(&pwm->dutyNanoseconds, memory_order_relaxed);
+
+        // A late period start is moved to now instead of being written in a burst, new channels start on their first wake up.
+        if (pwm->nextEdge + GPIO_PWM_COALESCE_NANOSECONDS < now)
+        {
+            GPIO_PWM_STATS.missedPeriodCount += pwm->nextEdge == 0 ? 0 : (now - pwm->nextEdge) / pwm->activePeriod;
+            pwm->nextEdge = now;
+        }
+
+        pwm->periodStart = pwm->nextEdge;
+
+        level = pwm->activeDuty > 0;
+        bool fullPeriod = pwm->activeDuty == 0 || pwm->activeDuty >= pwm->activePeriod;
+
+        pwm->nextEdge = pwm->periodStart + (fullPeriod ? pwm->activePeriod : pwm->activeDuty);
+        pwm->nextIsPeriodStart = fullPeriod;
+    }
+    else
+    {
+        level = false;
+        pwm->nextEdge = pwm->periodStart + pwm->activePeriod;
+        pwm->nextIsPeriodStart = true;
+    }
+
+    if (level != pwm->isHigh)
+    {
+        gpiod_line_set_value(pwm->pin->lineHandle, level); // directly, GPIOPin_WriteValue logs every write
+        pwm->isHigh = level;
+        GPIO_PWM_STATS.edgeCount++;
+    }
+}
+
+/// @brief Scheduler thread of all PWM channels. Waits until the earliest edge of all channels with an absolute deadline, so sleep errors do not add up.
+/// The wait is cut short when the channels change or the scheduler is stopped.
+/// @param argument Not used.
+/// @return Always NULL.
+void *GPIOPwm_Run(void *argument)
+{
+    (void)argument;
+
+    prctl(PR_SET_TIMERSLACK, 1UL); // default slack is 50 us, longer than a servo resolution step
+
+    pthread_mutex_lock(&GPIO_PWM_MUTEX);
+
+    while (!GPIO_PWM_THREAD_STOP)
+    {
+        unsigned long long deadline = ULLONG_MAX;
+        for (size_t i = 0; i < GPIO_PWM_CHANNEL_COUNT; i++)
+        {
+            deadline = GPIO_PWM_CHANNELS[i]->nextEdge < deadline ? GPIO_PWM_CHANNELS[i]->nextEdge : deadline;
+        }
+
+        if (deadline == ULLONG_MAX)
+        {
+            pthread_cond_wait(&GPIO_PWM_CONDITION, &GPIO_PWM_MUTEX);
+            continue;
+        }
+
+        unsigned long long now = GPIOPwm_GetTime();
+        if (deadline > now + GPIO_PWM_COALESCE_NANOSECONDS)
+        {
+            // Woken before the deadline when the channels change, the deadline is found again
+            struct timespec wakeTime = {.tv_sec = (time_t)(deadline / 1000000000ULL), .tv_nsec = (long)(deadline % 1000000000ULL)};
+            if (pthread_cond_timedwait(&GPIO_PWM_CONDITION, &GPIO_PWM_MUTEX, &wakeTime) != ETIMEDOUT)
+            {
+                continue;
+            }
+
+            now = GPIOPwm_GetTime();
+        }
+
+        // Deadline 0 is the start of a new channel, not a scheduled edge.
+        if (deadline != 0)
+        {
+            unsigned long long lateness = now > deadline ? now - deadline : 0;
+
+            GPIO_PWM_STATS.wakeCount++;
+            GPIO_PWM_LATENESS_SUM += lateness;
+            GPIO_PWM_STATS.maxLatenessNanoseconds = lateness > GPIO_PWM_STATS.maxLatenessNanoseconds ? lateness : GPIO_PWM_STATS.maxLatenessNanoseconds;
+        }
+
+        // Every channel due now is advanced in the same wake up, a channel can have both edges due if its duty is tiny.
+        for (size_t i = 0; i < GPIO_PWM_CHANNEL_COUNT; i++)
+        {
+            GPIOPwm *pwm = GPIO_PWM_CHANNELS[i];
+            while (pwm->nextEdge <= now + GPIO_PWM_COALESCE_NANOSECONDS)
+            {
+                GPIOPwm_Advance(pwm, now);
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&GPIO_PWM_MUTEX);
+    return NULL;
+}
+
+typedef struct GPIOWaveformPlayer
+{
+    GPIOPinGroup *group;
+
+    // Waveform converted to line values, pin count values per step. Grown when a longer waveform is played.
+    int *lineValues;
+    unsigned long long *delays;
+    size_t stepCount;
+    size_t stepCapacity;
+
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t condition; // Signaled when a waveform is queued, when it ends and when the player stops.
+    bool isPlaying;
+    bool isStopping;
+
+    GPIOWaveformStats stats;
+} GPIOWaveformPlayer;
+
+/// @brief Waits until the deadline. Sleeps until GPIO_WAVEFORM_SPIN_NANOSECONDS before it, then busy-waits, the scheduler would wake the thread too late for short steps.
+/// @param deadline Absolute monotonic time to wait until.
+void GPIOWaveformPlayer_WaitUntil(unsigned long long deadline)
+{
+    unsigned long long now = GPIOPwm_GetTime();
+
+    if (deadline > now + GPIO_WAVEFORM_SPIN_NANOSECONDS)
+    {
+        unsigned long long wakeUp = deadline - GPIO_WAVEFORM_SPIN_NANOSECONDS;
+        struct timespec wakeTime = {.tv_sec = (time_t)(wakeUp / 1000000000ULL), .tv_nsec = (long)(wakeUp % 1000000000ULL)};
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeTime, NULL) == EINTR)
+        {
+        }
+    }
+
+    while (GPIOPwm_GetTime() < deadline)
+    {
+    }
+}
+
+/// @brief Thread of a waveform player. Waits for a waveform, plays it and reports its timing.
+/// @param argument The GPIOWaveformPlayer instance.
+/// @return Always NULL.
+void *GPIOWaveformPlayer_Run(void *argument)
+{
+    GPIOWaveformPlayer *player = (GPIOWaveformPlayer *)argument;
+    size_t pinCount = player->group->pinCount;
+
+    prctl(PR_SET_TIMERSLACK, 1UL);
+
+    pthread_mutex_lock(&player->mutex);
+
+    while (true)
+    {
+        while (!player->isPlaying && !player->isStopping)
+        {
+            pthread_cond_wait(&player->condition, &player->mutex);
+        }
+
+        if (player->isStopping)
+        {
+            break;
+        }
+
+        // The buffers are not touched by the app while playing, the lock is not held during the playback.
+        pthread_mutex_unlock(&player->mutex);
+
+        GPIOWaveformStats stats = {0};
+        unsigned long long errorSum = 0;
+        unsigned long long start = GPIOPwm_GetTime();
+        unsigned long long deadline = start;
+
+        for (size_t i = 0; i < player->stepCount; i++)
+        {
+            GPIOWaveformPlayer_WaitUntil(deadline);
+
+            unsigned long long error = GPIOPwm_GetTime() - deadline;
+            if (gpiod_line_set_value_bulk(&player->group->bulkHandle, player->lineValues + i * pinCount) != 0)
+            {
+                stats.failedWriteCount++;
+            }
+
+            errorSum += error;
+            stats.maxErrorNanoseconds = error > stats.maxErrorNanoseconds ? error : stats.maxErrorNanoseconds;
+            deadline += player->delays[i];
+        }
+
+        GPIOWaveformPlayer_WaitUntil(deadline);
+
+        stats.stepCount = player->stepCount;
+        stats.meanErrorNanoseconds = stats.stepCount > 0 ? errorSum / stats.stepCount : 0;
+        stats.durationNanoseconds = GPIOPwm_GetTime() - start;
+
+        pthread_mutex_lock(&player->mutex);
+
+        player->stats = stats;
+        player->isPlaying = false;
+        pthread_cond_broadcast(&player->condition);
+    }
+
+    pthread_mutex_unlock(&player->mutex);
+    return NULL;
+}
+
+/// @brief Allocates a pin group and gets the line handles of its pins. Lines are not requested yet.
+/// @param chip Chip to get the lines from.
+/// @param indices Indices of the pins.
+/// @param count Count of the pins.
+/// @param consumer Name of the consumer.
+/// @param direction Direction the lines will be requested with.
+/// @return The pin group or NULL if the lines cannot be got.
+GPIOPinGroup *GPIOPinGroup_Create(const GPIOChip *chip, const unsigned char *indices, size_t count, const string consumer, GPIOLineDirection direction)
+{
+    DebugAssert(chip != NULL, "Null pointer passed as parameter.");
+    DebugAssert(indices != NULL, "Null pointer passed as parameter. Indices cannot be NULL.");
+    DebugAssert(consumer != NULL, "Null pointer passed as parameter. Consumer name cannot be NULL.");
+    DebugAssert(count > 0 && count <= GPIO_PIN_GROUP_MAX_PINS, "Invalid pin count %zu passed. Must be between 1 and %d.", count, GPIO_PIN_GROUP_MAX_PINS);
+
+    GPIOPinGroup *group = (GPIOPinGroup *)malloc(sizeof(GPIOPinGroup));
+    DebugAssert(group != NULL, "Memory allocation failed.");
+
+    group->consumerName = StringDuplicate(consumer);
+    group->pinCount = count;
+    group->lineDirection = direction;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        group->lineIndices[i] = indices[i];
+    }
+
+    gpiod_line_bulk_init(&group->bulkHandle);
+
+    int linesGetReturn = gpiod_chip_get_lines(chip->chipHandle, group->lineIndices, (unsigned int)count, &group->bulkHandle);
+    if (linesGetReturn != 0)
+    {
+        DebugError("Failed to get GPIO line handles, error in gpiod_chip_get_lines function with parameters : chip handle '%p', line count '%zu'. Returning NULL.", chip->chipHandle, count);
+
+        free(group->consumerName);
+        group->consumerName = NULL;
+
+        free(group);
+        group = NULL;
+
+        return NULL;
+    }
+
+    return group;
+}
+
+/// @brief Frees a pin group whose lines are not requested.
+/// @param group Group to free.
+void GPIOPinGroup_Free(GPIOPinGroup *group)
+{
+    free(group->consumerName);
+    group->consumerName = NULL;
+
+    free(group);
+    group = NULL;
+}
+
 #pragma endregion Source Only
 
 GPIOChip *GPIOChip_Create(const string chipPath)
@@ -105,7 +530,25 @@ GPIOPin *GPIOPin_ConsumeAsInput(const GPIOChip *chip, unsigned char index, const
         return NULL;
     }
 
-    int lineRequestReturn = gpiod_line_request_input_flags(pin->lineHandle, pin->consumerName, (int)biasType | (int)eventType);
+    // Event types are not request flags, edges are selected by the request function.
+    int requestFlags = biasType == GPIOInputBiasType_Kolpa ? 0 : (int)biasType;
+    int lineRequestReturn;
+    switch (eventType)
+    {
+    case GPIOInputEventType_RisingEdge:
+        lineRequestReturn = gpiod_line_request_rising_edge_events_flags(pin->lineHandle, pin->consumerName, requestFlags);
+        break;
+    case GPIOInputEventType_FallingEdge:
+        lineRequestReturn = gpiod_line_request_falling_edge_events_flags(pin->lineHandle, pin->consumerName, requestFlags);
+        break;
+    case GPIOInputEventType_BothEdges:
+        lineRequestReturn = gpiod_line_request_both_edges_events_flags(pin->lineHandle, pin->consumerName, requestFlags);
+        break;
+    default:
+        lineRequestReturn = gpiod_line_request_input_flags(pin->lineHandle, pin->consumerName, requestFlags);
+        break;
+    }
+
     if (lineRequestReturn != 0)
     {
         DebugError("Failed to request line, error in gpiod_line_request_input function with parameters : line handle '%p', consumer name '%s'. Returning NULL.", pin->lineHandle, pin->consumerName);
@@ -154,10 +597,10 @@ GPIOPin *GPIOPin_ConsumeAsOutput(const GPIOChip *chip, unsigned char index, cons
         return NULL;
     }
 
-    int lineRequestReturn = gpiod_line_request_output_flags(pin->lineHandle, pin->consumerName, initialValue, (int)outputType);
+    int lineRequestReturn = gpiod_line_request_output_flags(pin->lineHandle, pin->consumerName, (int)outputType, initialValue);
     if (lineRequestReturn != 0)
     {
-        DebugError("Failed to request line, error in gpiod_line_request_output function with parameters : line handle '%p', consumer name '%s', initial value '%d'. Returning NULL.", "output", pin->lineHandle, pin->consumerName, initialValue);
+        DebugError("Failed to request line, error in gpiod_line_request_output_flags function with parameters : line handle '%p', consumer name '%s', flags '%d', initial value '%d'. Returning NULL.", (void *)pin->lineHandle, pin->consumerName, (int)outputType, initialValue);
 
         gpiod_line_release(pin->lineHandle);
         free(pin->consumerName);
@@ -178,9 +621,8 @@ void GPIOPin_Release(GPIOPin *pin)
 {
     DebugAssert(pin != NULL, "Null pointer passed as parameter.");
 
-    int tempIndex = pin->lineIndex;
-    char tempConsumerName[strlen(pin->consumerName) + 1];
-    strcpy(tempConsumerName, pin->consumerName);
+    // Logged before the release, the index and the consumer name are freed with the pin
+    DebugInfo("GPIO pin released successfully with index '%d' and consumer name '%s'.", pin->lineIndex, pin->consumerName);
 
     gpiod_line_release(pin->lineHandle);
     free(pin->consumerName);
@@ -189,8 +631,6 @@ void GPIOPin_Release(GPIOPin *pin)
 
     free(pin);
     pin = NULL;
-
-    DebugInfo("GPIO pin released successfully with index '%d' and consumer name '%s'.", tempIndex, tempConsumerName);
 }
 
 int GPIOPin_WriteValue(const GPIOPin *pin, GPIODigitalValue value)
@@ -233,4 +673,614 @@ GPIODigitalValue GPIOPin_ReadValue(const GPIOPin *pin)
     return lineValueSetReturn;
 }
 
+GPIOEventReader *GPIOEventReader_Create(GPIOPin *const *pins, size_t pinCount, size_t capacity)
+{
+    DebugAssert(pins != NULL, "Null pointer passed as parameter. Pins cannot be NULL.");
+    DebugAssert(pinCount > 0 && pinCount <= GPIO_EVENT_READER_MAX_PINS, "Invalid pin count %zu passed. Must be between 1 and %d.", pinCount, GPIO_EVENT_READER_MAX_PINS);
+
+    for (size_t i = 0; i < pinCount; i++)
+    {
+        DebugAssert(pins[i] != NULL && pins[i]->inputEventType != GPIOInputEventType_Kolpa, "Pin %zu of the event reader must be consumed as input with an event type.", i);
+    }
+
+    GPIOEventReader *reader = (GPIOEventReader *)malloc(sizeof(GPIOEventReader));
+    DebugAssert(reader != NULL, "Memory allocation failed.");
+
+    memcpy(reader->pins, pins, pinCount * sizeof(GPIOPin *));
+    reader->pinCount = pinCount;
+    reader->events = RingBuffer_Create(sizeof(GPIOEdgeEvent), capacity);
+    atomic_init(&reader->eventCount, 0);
+    atomic_init(&reader->overflowCount, 0);
+
+    if (pipe(reader->stopPipe) != 0)
+    {
+        DebugError("Failed to create stop pipe of the event reader, error in pipe function. errno : %d. Returning NULL.", errno);
+
+        RingBuffer_Destroy(reader->events);
+        free(reader);
+        return NULL;
+    }
+
+    int threadCreateReturn = pthread_create(&reader->thread, NULL, GPIOEventReader_Run, reader);
+    if (threadCreateReturn != 0)
+    {
+        DebugError("Failed to start the event reader thread, error in pthread_create function. Return : %d. Returning NULL.", threadCreateReturn);
+
+        close(reader->stopPipe[0]);
+        close(reader->stopPipe[1]);
+        RingBuffer_Destroy(reader->events);
+        free(reader);
+        return NULL;
+    }
+
+    DebugInfo("GPIO event reader created successfully with %zu pins, capacity '%zu'.", pinCount, RingBuffer_GetCapacity(reader->events));
+    return reader;
+}
+
+void GPIOEventReader_Destroy(GPIOEventReader *reader)
+{
+    DebugAssert(reader != NULL, "Null pointer passed as parameter.");
+
+    const char stopSignal = 1;
+    if (write(reader->stopPipe[1], &stopSignal, 1) != 1)
+    {
+        DebugWarning("Failed to wake the event reader thread. errno : %d.", errno);
+    }
+
+    pthread_join(reader->thread, NULL);
+
+    close(reader->stopPipe[0]);
+    close(reader->stopPipe[1]);
+    RingBuffer_Destroy(reader->events);
+    reader->events = NULL;
+
+    free(reader);
+    reader = NULL;
+
+    DebugInfo("GPIO event reader destroyed successfully.");
+}
+
+size_t GPIOEventReader_Read(GPIOEventReader *reader, GPIOEdgeEvent *events, size_t maxCount)
+{
+    DebugAssert(reader != NULL, "Null pointer passed as parameter.");
+    DebugAssert(events != NULL, "Null pointer passed as parameter. Events cannot be NULL.");
+
+    return RingBuffer_PopMany(reader->events, events, maxCount);
+}
+
+unsigned long long GPIOEventReader_GetEventCount(const GPIOEventReader *reader)
+{
+    DebugAssert(reader != NULL, "Null pointer passed as parameter.");
+
+    return atomic_load_explicit(&((GPIOEventReader *)reader)->eventCount, memory_order_relaxed);
+}
+
+unsigned long long GPIOEventReader_GetOverflowCount(const GPIOEventReader *reader)
+{
+    DebugAssert(reader != NULL, "Null pointer passed as parameter.");
+
+    return atomic_load_explicit(&((GPIOEventReader *)reader)->overflowCount, memory_order_relaxed);
+}
+
+GPIOPinGroup *GPIOPinGroup_ConsumeAsInput(const GPIOChip *chip, const unsigned char *indices, size_t count, const string consumer, GPIOInputBiasType biasType)
+{
+    GPIOPinGroup *group = GPIOPinGroup_Create(chip, indices, count, consumer, GPIOLineDirection_Input);
+    if (group == NULL)
+    {
+        return NULL;
+    }
+
+    int requestFlags = biasType == GPIOInputBiasType_Kolpa ? 0 : (int)biasType;
+    int lineRequestReturn = gpiod_line_request_bulk_input_flags(&group->bulkHandle, group->consumerName, requestFlags);
+    if (lineRequestReturn != 0)
+    {
+        DebugError("Failed to request lines, error in gpiod_line_request_bulk_input_flags function with parameters : line count '%zu', consumer name '%s'. Returning NULL.", group->pinCount, group->consumerName);
+
+        GPIOPinGroup_Free(group);
+        return NULL;
+    }
+
+    DebugInfo("Input GPIO pin group created successfully with %zu pins, consumer name '%s'.", group->pinCount, group->consumerName);
+    return group;
+}
+
+GPIOPinGroup *GPIOPinGroup_ConsumeAsOutput(const GPIOChip *chip, const unsigned char *indices, size_t count, const string consumer, GPIOOutputType outputType, unsigned long long initialMask)
+{
+    GPIOPinGroup *group = GPIOPinGroup_Create(chip, indices, count, consumer, GPIOLineDirection_Output);
+    if (group == NULL)
+    {
+        return NULL;
+    }
+
+    int initialValues[GPIO_PIN_GROUP_MAX_PINS];
+    for (size_t i = 0; i < group->pinCount; i++)
+    {
+        initialValues[i] = (int)((initialMask >> i) & 1ULL);
+    }
+
+    int lineRequestReturn = gpiod_line_request_bulk_output_flags(&group->bulkHandle, group->consumerName, (int)outputType, initialValues);
+    if (lineRequestReturn != 0)
+    {
+        DebugError("Failed to request lines, error in gpiod_line_request_bulk_output_flags function with parameters : line count '%zu', consumer name '%s', initial mask '%llx'. Returning NULL.", group->pinCount, group->consumerName, initialMask);
+
+        GPIOPinGroup_Free(group);
+        return NULL;
+    }
+
+    DebugInfo("Output GPIO pin group created successfully with %zu pins, consumer name '%s', initial mask '%llx'.", group->pinCount, group->consumerName, initialMask);
+    return group;
+}
+
+void GPIOPinGroup_Release(GPIOPinGroup *group)
+{
+    DebugAssert(group != NULL, "Null pointer passed as parameter.");
+
+    // Logged before the release, the consumer name is freed with the group
+    DebugInfo("GPIO pin group released successfully with %zu pins and consumer name '%s'.", group->pinCount, group->consumerName);
+
+    gpiod_line_release_bulk(&group->bulkHandle);
+    GPIOPinGroup_Free(group);
+}
+
+size_t GPIOPinGroup_GetSize(const GPIOPinGroup *group)
+{
+    DebugAssert(group != NULL, "Null pointer passed as parameter.");
+
+    return group->pinCount;
+}
+
+int GPIOPinGroup_WriteValues(const GPIOPinGroup *group, const GPIODigitalValue *values)
+{
+    DebugAssert(group != NULL, "Null pointer passed as parameter.");
+    DebugAssert(values != NULL, "Null pointer passed as parameter. Values cannot be NULL.");
+
+    unsigned long long mask = 0;
+    for (size_t i = 0; i < group->pinCount; i++)
+    {
+        mask |= (unsigned long long)(values[i] == GPIODigitalValue_High) << i;
+    }
+
+    return GPIOPinGroup_WriteMask(group, mask);
+}
+
+int GPIOPinGroup_ReadValues(const GPIOPinGroup *group, GPIODigitalValue *values)
+{
+    DebugAssert(group != NULL, "Null pointer passed as parameter.");
+    DebugAssert(values != NULL, "Null pointer passed as parameter. Values cannot be NULL.");
+
+    unsigned long long mask = 0;
+    if (GPIOPinGroup_ReadMask(group, &mask) != 0)
+    {
+        for (size_t i = 0; i < group->pinCount; i++)
+        {
+            values[i] = GPIODigitalValue_Kolpa;
+        }
+
+        return -1;
+    }
+
+    for (size_t i = 0; i < group->pinCount; i++)
+    {
+        values[i] = (mask >> i) & 1ULL ? GPIODigitalValue_High : GPIODigitalValue_Low;
+    }
+
+    return 0;
+}
+
+int GPIOPinGroup_WriteMask(const GPIOPinGroup *group, unsigned long long mask)
+{
+    DebugAssert(group != NULL, "Null pointer passed as parameter.");
+
+    if (group->lineDirection != GPIOLineDirection_Output)
+    {
+        DebugError("Pin group to write values to must be created as output.");
+    }
+
+    int lineValues[GPIO_PIN_GROUP_MAX_PINS];
+    for (size_t i = 0; i < group->pinCount; i++)
+    {
+        lineValues[i] = (int)((mask >> i) & 1ULL);
+    }
+
+    // A single ioctl for all lines, the kernel sets them together.
+    int lineValuesSetReturn = gpiod_line_set_value_bulk((struct gpiod_line_bulk *)&group->bulkHandle, lineValues);
+    if (lineValuesSetReturn != 0)
+    {
+        DebugWarning("Failed to set values for output group, error in gpiod_line_set_value_bulk function with parameters : line count '%zu', mask '%llx'. Returning -1.", group->pinCount, mask);
+        return -1;
+    }
+
+    DebugInfo("GPIO pin group values written successfully with consumer name '%s', mask '%llx'.", group->consumerName, mask);
+    return 0;
+}
+
+int GPIOPinGroup_ReadMask(const GPIOPinGroup *group, unsigned long long *mask)
+{
+    DebugAssert(group != NULL, "Null pointer passed as parameter.");
+    DebugAssert(mask != NULL, "Null pointer passed as parameter. Mask cannot be NULL.");
+
+    if (group->lineDirection != GPIOLineDirection_Input)
+    {
+        DebugError("Pin group to read values from must be created as input.");
+    }
+
+    int lineValues[GPIO_PIN_GROUP_MAX_PINS];
+    int lineValuesGetReturn = gpiod_line_get_value_bulk((struct gpiod_line_bulk *)&group->bulkHandle, lineValues);
+    if (lineValuesGetReturn != 0)
+    {
+        DebugWarning("Failed to get values from input group, error in gpiod_line_get_value_bulk function with parameter : line count '%zu'. Returning -1.", group->pinCount);
+        return -1;
+    }
+
+    *mask = 0;
+    for (size_t i = 0; i < group->pinCount; i++)
+    {
+        *mask |= (unsigned long long)(lineValues[i] != 0) << i;
+    }
+
+    DebugInfo("GPIO pin group values read successfully with consumer name '%s', mask '%llx'.", group->consumerName, *mask);
+    return 0;
+}
+
+GPIOPwm *GPIOPwm_Create(GPIOPin *pin, unsigned long long periodNanoseconds, unsigned long long dutyNanoseconds)
+{
+    DebugAssert(pin != NULL, "Null pointer passed as parameter.");
+    DebugAssert(pin->lineDirection == GPIOLineDirection_Output, "Pin of a PWM channel must be created as output.");
+    DebugAssert(periodNanoseconds > GPIO_PWM_COALESCE_NANOSECONDS, "PWM period %llu ns is too short. Must be more than %llu ns.", periodNanoseconds, GPIO_PWM_COALESCE_NANOSECONDS);
+
+    GPIOPwm *pwm = (GPIOPwm *)malloc(sizeof(GPIOPwm));
+    DebugAssert(pwm != NULL, "Memory allocation failed.");
+
+    pwm->pin = pin;
+    atomic_init(&pwm->periodNanoseconds, periodNanoseconds);
+    atomic_init(&pwm->dutyNanoseconds, dutyNanoseconds);
+    pwm->activePeriod = periodNanoseconds;
+    pwm->activeDuty = dutyNanoseconds;
+    pwm->periodStart = 0;
+    pwm->nextEdge = 0; // due at once, started on the next wake up of the scheduler
+    pwm->nextIsPeriodStart = true;
+    pwm->isHigh = false;
+
+    gpiod_line_set_value(pin->lineHandle, 0);
+
+    pthread_mutex_lock(&GPIO_PWM_MUTEX);
+
+    if (!GPIO_PWM_CONDITION_INITIALIZED)
+    {
+        pthread_condattr_t conditionAttributes;
+        pthread_condattr_init(&conditionAttributes);
+        pthread_condattr_setclock(&conditionAttributes, CLOCK_MONOTONIC);
+        pthread_cond_init(&GPIO_PWM_CONDITION, &conditionAttributes);
+        pthread_condattr_destroy(&conditionAttributes);
+        GPIO_PWM_CONDITION_INITIALIZED = true;
+    }
+
+    // A scheduler stopped by the last destroyed channel is joined before a new one is started
+    while (GPIO_PWM_THREAD_STOP)
+    {
+        pthread_cond_wait(&GPIO_PWM_CONDITION, &GPIO_PWM_MUTEX);
+    }
+
+    if (GPIO_PWM_CHANNEL_COUNT == GPIO_PWM_MAX_CHANNELS)
+    {
+        pthread_mutex_unlock(&GPIO_PWM_MUTEX);
+        DebugError("All %d PWM channels are in use. Returning NULL.", GPIO_PWM_MAX_CHANNELS);
+
+        free(pwm);
+        return NULL;
+    }
+
+    GPIO_PWM_CHANNELS[GPIO_PWM_CHANNEL_COUNT++] = pwm;
+
+    if (!GPIO_PWM_THREAD_RUNNING)
+    {
+        int threadCreateReturn = pthread_create(&GPIO_PWM_THREAD, NULL, GPIOPwm_Run, NULL);
+        DebugAssert(threadCreateReturn == 0, "Failed to start the PWM scheduler thread, error in pthread_create function. Return : %d.", threadCreateReturn);
+
+        GPIO_PWM_THREAD_RUNNING = true;
+        if (GPIO_PWM_REALTIME_PRIORITY > 0)
+        {
+            GPIOPwm_ApplyPriority(GPIO_PWM_REALTIME_PRIORITY);
+        }
+    }
+    else
+    {
+        pthread_cond_broadcast(&GPIO_PWM_CONDITION); // the new channel is due at once
+    }
+
+    pthread_mutex_unlock(&GPIO_PWM_MUTEX);
+
+    DebugInfo("PWM channel created successfully on pin with index '%d', period '%llu' ns, duty '%llu' ns.", pin->lineIndex, periodNanoseconds, dutyNanoseconds);
+    return pwm;
+}
+
+GPIOPwm *GPIOPwm_CreateServo(GPIOPin *pin)
+{
+    return GPIOPwm_Create(pin, GPIO_PWM_SERVO_PERIOD_NANOSECONDS, (GPIO_PWM_SERVO_MIN_PULSE_NANOSECONDS + GPIO_PWM_SERVO_MAX_PULSE_NANOSECONDS) / 2);
+}
+
+void GPIOPwm_Destroy(GPIOPwm *pwm)
+{
+    DebugAssert(pwm != NULL, "Null pointer passed as parameter.");
+
+    bool stopThread = false;
+
+    pthread_mutex_lock(&GPIO_PWM_MUTEX);
+
+    for (size_t i = 0; i < GPIO_PWM_CHANNEL_COUNT; i++)
+    {
+        if (GPIO_PWM_CHANNELS[i] == pwm)
+        {
+            GPIO_PWM_CHANNELS[i] = GPIO_PWM_CHANNELS[--GPIO_PWM_CHANNEL_COUNT];
+            break;
+        }
+    }
+
+    if (GPIO_PWM_CHANNEL_COUNT == 0 && GPIO_PWM_THREAD_RUNNING && !GPIO_PWM_THREAD_STOP)
+    {
+        GPIO_PWM_THREAD_STOP = true;
+        stopThread = true;
+    }
+
+    // Wakes the scheduler to stop it, or to find its deadline without the removed channel
+    pthread_cond_broadcast(&GPIO_PWM_CONDITION);
+    pthread_mutex_unlock(&GPIO_PWM_MUTEX);
+
+    if (stopThread)
+    {
+        pthread_join(GPIO_PWM_THREAD, NULL);
+
+        pthread_mutex_lock(&GPIO_PWM_MUTEX);
+        GPIO_PWM_THREAD_RUNNING = false;
+        GPIO_PWM_THREAD_STOP = false;
+        pthread_cond_broadcast(&GPIO_PWM_CONDITION); // a create waiting for the join can start a new scheduler
+        pthread_mutex_unlock(&GPIO_PWM_MUTEX);
+    }
+
+    // Logged before the free, the index is read from the pin of the channel
+    DebugInfo("PWM channel destroyed successfully on pin with index '%d'.", pwm->pin->lineIndex);
+
+    gpiod_line_set_value(pwm->pin->lineHandle, 0);
+
+    pwm->pin = NULL;
+    free(pwm);
+    pwm = NULL;
+}
+
+void GPIOPwm_SetPeriod(GPIOPwm *pwm, unsigned long long periodNanoseconds)
+{
+    DebugAssert(pwm != NULL, "Null pointer passed as parameter.");
+    DebugAssert(periodNanoseconds > GPIO_PWM_COALESCE_NANOSECONDS, "PWM period %llu ns is too short. Must be more than %llu ns.", periodNanoseconds, GPIO_PWM_COALESCE_NANOSECONDS);
+
+    atomic_store_explicit(&pwm->periodNanoseconds, periodNanoseconds, memory_order_relaxed);
+}
+
+void GPIOPwm_SetDuty(GPIOPwm *pwm, unsigned long long dutyNanoseconds)
+{
+    DebugAssert(pwm != NULL, "Null pointer passed as parameter.");
+
+    atomic_store_explicit(&pwm->dutyNanoseconds, dutyNanoseconds, memory_order_relaxed);
+}
+
+void GPIOPwm_SetDutyCycle(GPIOPwm *pwm, float dutyCycle)
+{
+    DebugAssert(pwm != NULL, "Null pointer passed as parameter.");
+
+    dutyCycle = dutyCycle < 0.0f ? 0.0f : (dutyCycle > 1.0f ? 1.0f : dutyCycle);
+    unsigned long long period = atomic_load_explicit(&pwm->periodNanoseconds, memory_order_relaxed);
+
+    GPIOPwm_SetDuty(pwm, (unsigned long long)((double)period * dutyCycle + 0.5));
+}
+
+void GPIOPwm_SetServoPosition(GPIOPwm *pwm, float position)
+{
+    position = position < 0.0f ? 0.0f : (position > 1.0f ? 1.0f : position);
+
+    unsigned long long range = GPIO_PWM_SERVO_MAX_PULSE_NANOSECONDS - GPIO_PWM_SERVO_MIN_PULSE_NANOSECONDS;
+    GPIOPwm_SetDuty(pwm, GPIO_PWM_SERVO_MIN_PULSE_NANOSECONDS + (unsigned long long)((double)range * position + 0.5));
+}
+
+bool GPIOPwm_SetRealtimePriority(int priority)
+{
+    DebugAssert(priority >= 0 && priority <= 99, "Invalid real-time priority %d passed. Must be between 0 and 99.", priority);
+
+    pthread_mutex_lock(&GPIO_PWM_MUTEX);
+
+    bool success = true;
+    if (GPIO_PWM_THREAD_RUNNING)
+    {
+        success = GPIOPwm_ApplyPriority(priority);
+    }
+
+    GPIO_PWM_REALTIME_PRIORITY = success ? priority : GPIO_PWM_REALTIME_PRIORITY;
+
+    pthread_mutex_unlock(&GPIO_PWM_MUTEX);
+    return success;
+}
+
+GPIOPwmStats GPIOPwm_GetStats()
+{
+    pthread_mutex_lock(&GPIO_PWM_MUTEX);
+
+    GPIOPwmStats stats = GPIO_PWM_STATS;
+    stats.meanLatenessNanoseconds = stats.wakeCount > 0 ? GPIO_PWM_LATENESS_SUM / stats.wakeCount : 0;
+
+    pthread_mutex_unlock(&GPIO_PWM_MUTEX);
+    return stats;
+}
+
+void GPIOPwm_ResetStats()
+{
+    pthread_mutex_lock(&GPIO_PWM_MUTEX);
+
+    GPIO_PWM_STATS = (GPIOPwmStats){0};
+    GPIO_PWM_LATENESS_SUM = 0;
+
+    pthread_mutex_unlock(&GPIO_PWM_MUTEX);
+}
+
+GPIOWaveformPlayer *GPIOWaveformPlayer_Create(GPIOPinGroup *group, int cpu, int priority)
+{
+    DebugAssert(group != NULL, "Null pointer passed as parameter.");
+    DebugAssert(group->lineDirection == GPIOLineDirection_Output, "Pin group of a waveform player must be created as output.");
+    DebugAssert(priority >= 0 && priority <= 99, "Invalid real-time priority %d passed. Must be between 0 and 99.", priority);
+
+    GPIOWaveformPlayer *player = (GPIOWaveformPlayer *)malloc(sizeof(GPIOWaveformPlayer));
+    DebugAssert(player != NULL, "Memory allocation failed.");
+
+    player->group = group;
+    player->lineValues = NULL;
+    player->delays = NULL;
+    player->stepCount = 0;
+    player->stepCapacity = 0;
+    player->isPlaying = false;
+    player->isStopping = false;
+    player->stats = (GPIOWaveformStats){0};
+
+    pthread_mutex_init(&player->mutex, NULL);
+    pthread_cond_init(&player->condition, NULL);
+
+    // Pinned before the start, so the thread never runs on another CPU and never migrates in the middle of a waveform.
+    pthread_attr_t threadAttributes;
+    pthread_attr_init(&threadAttributes);
+    if (cpu >= 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        pthread_attr_setaffinity_np(&threadAttributes, sizeof(cpu_set_t), &cpuSet);
+    }
+
+    int threadCreateReturn = pthread_create(&player->thread, &threadAttributes, GPIOWaveformPlayer_Run, player);
+    pthread_attr_destroy(&threadAttributes);
+
+    if (threadCreateReturn != 0)
+    {
+        DebugError("Failed to start waveform player thread, error in pthread_create function with parameters : cpu '%d'. Return : %d. Returning NULL.", cpu, threadCreateReturn);
+
+        pthread_cond_destroy(&player->condition);
+        pthread_mutex_destroy(&player->mutex);
+        player->group = NULL;
+
+        free(player);
+        player = NULL;
+
+        return NULL;
+    }
+
+    if (priority > 0)
+    {
+        struct sched_param parameter = {.sched_priority = priority};
+        int scheduleReturn = pthread_setschedparam(player->thread, SCHED_FIFO, &parameter);
+        if (scheduleReturn != 0)
+        {
+            DebugWarning("Failed to set waveform player thread priority to %d, error in pthread_setschedparam function. Return : %d.", priority, scheduleReturn);
+        }
+    }
+
+    DebugInfo("GPIO waveform player created successfully with consumer name '%s', cpu '%d', priority '%d'.", group->consumerName, cpu, priority);
+    return player;
+}
+
+void GPIOWaveformPlayer_Destroy(GPIOWaveformPlayer *player)
+{
+    DebugAssert(player != NULL, "Null pointer passed as parameter.");
+
+    pthread_mutex_lock(&player->mutex);
+    player->isStopping = true;
+    pthread_cond_broadcast(&player->condition);
+    pthread_mutex_unlock(&player->mutex);
+
+    pthread_join(player->thread, NULL);
+
+    pthread_cond_destroy(&player->condition);
+    pthread_mutex_destroy(&player->mutex);
+
+    free(player->lineValues);
+    free(player->delays);
+    player->lineValues = NULL;
+    player->delays = NULL;
+    player->group = NULL;
+
+    free(player);
+    player = NULL;
+
+    DebugInfo("GPIO waveform player destroyed successfully.");
+}
+
+bool GPIOWaveformPlayer_Play(GPIOWaveformPlayer *player, const GPIOWaveformStep *steps, size_t count)
+{
+    DebugAssert(player != NULL, "Null pointer passed as parameter.");
+    DebugAssert(steps != NULL, "Null pointer passed as parameter. Steps cannot be NULL.");
+
+    pthread_mutex_lock(&player->mutex);
+
+    if (player->isPlaying)
+    {
+        pthread_mutex_unlock(&player->mutex);
+        DebugWarning("Waveform player is still playing, waveform with %zu steps is not played.", count);
+        return false;
+    }
+
+    size_t pinCount = player->group->pinCount;
+
+    if (count > player->stepCapacity)
+    {
+        int *newLineValues = (int *)realloc(player->lineValues, count * pinCount * sizeof(int));
+        DebugAssert(newLineValues != NULL, "Memory reallocation failed.");
+        player->lineValues = newLineValues;
+
+        unsigned long long *newDelays = (unsigned long long *)realloc(player->delays, count * sizeof(unsigned long long));
+        DebugAssert(newDelays != NULL, "Memory reallocation failed.");
+        player->delays = newDelays;
+
+        player->stepCapacity = count;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        for (size_t j = 0; j < pinCount; j++)
+        {
+            player->lineValues[i * pinCount + j] = (int)((steps[i].valueMask >> j) & 1ULL);
+        }
+
+        player->delays[i] = steps[i].delayNanoseconds;
+    }
+
+    player->stepCount = count;
+    player->isPlaying = true;
+    pthread_cond_broadcast(&player->condition);
+
+    pthread_mutex_unlock(&player->mutex);
+    return true;
+}
+
+bool GPIOWaveformPlayer_IsPlaying(GPIOWaveformPlayer *player)
+{
+    DebugAssert(player != NULL, "Null pointer passed as parameter.");
+
+    pthread_mutex_lock(&player->mutex);
+    bool isPlaying = player->isPlaying;
+    pthread_mutex_unlock(&player->mutex);
+
+    return isPlaying;
+}
+
+GPIOWaveformStats GPIOWaveformPlayer_Wait(GPIOWaveformPlayer *player)
+{
+    DebugAssert(player != NULL, "Null pointer passed as parameter.");
+
+    pthread_mutex_lock(&player->mutex);
+
+    while (player->isPlaying)
+    {
+        pthread_cond_wait(&player->condition, &player->mutex);
+    }
+
+    GPIOWaveformStats stats = player->stats;
+
+    pthread_mutex_unlock(&player->mutex);
+    return stats;
+}
+
 #endif // PLATFORM_LINUX
@@ -0,0 +1,388 @@
+#include "Modules/I2CManager.h"
+
+#if PLATFORM_LINUX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#pragma region Source Only
+
+typedef struct I2CBus
+{
+    int fileDescriptor;
+    stringHeap busPath;
+} I2CBus;
+
+/// @brief A polled register block. Its sample is published with a sequence lock, the poller thread is the only writer.
+typedef struct I2CPollerDevice
+{
+    unsigned char address;
+    unsigned char reg;
+    unsigned int length;
+    unsigned long long periodNanoseconds;
+    unsigned long long nextRead; // Owned by the poller thread.
+
+    _Atomic unsigned long long sequence; // Odd while the sample is being written.
+    _Atomic unsigned long long words[I2C_POLLER_MAX_SAMPLE_SIZE / 8];
+    _Atomic unsigned long long timestamp;
+    _Atomic unsigned long long sampleCount;
+} I2CPollerDevice;
+
+typedef struct I2CPoller
+{
+    I2CBus *bus;
+    I2CPollerDevice devices[I2C_POLLER_MAX_DEVICES];
+    size_t deviceCount;
+
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t condition; // Signaled when the poller stops. Waits on the monotonic clock.
+    bool isRunning;
+    bool isStopping; // Read and written under the mutex.
+    _Atomic unsigned long long errorCount;
+} I2CPoller;
+
+/// @brief Gets the monotonic clock in nanoseconds. Same clock the poller waits with.
+/// @return Current time.
+unsigned long long I2CPoller_GetTime()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (unsigned long long)now.tv_sec * 1000000000ULL + (unsigned long long)now.tv_nsec;
+}
+
+/// @brief Publishes a sample of a device. Only called by the poller thread.
+/// @param device Device of the sample.
+/// @param data Register bytes of the sample, I2C_POLLER_MAX_SAMPLE_SIZE long.
+/// @param timestamp Time of the read.
+void I2CPollerDevice_Publish(I2CPollerDevice *device, const unsigned char *data, unsigned long long timestamp)
+{
+    unsigned long long sequence = atomic_load_explicit(&device->sequence, memory_order_relaxed);
+
+    // Release fence keeps the words below from being seen before the odd sequence.
+    atomic_store_explicit(&device->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    for (size_t i = 0; i < I2C_POLLER_MAX_SAMPLE_SIZE / 8; i++)
+    {
+        unsigned long long word;
+        memcpy(&word, data + i * 8, 8);
+        atomic_store_explicit(&device->words[i], word, memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&device->timestamp, timestamp, memory_order_relaxed);
+    atomic_store_explicit(&device->sampleCount, atomic_load_explicit(&device->sampleCount, memory_order_relaxed) + 1, memory_order_relaxed);
+
+    atomic_store_explicit(&device->sequence, sequence + 2, memory_order_release);
+}
+
+/// @brief Thread of a poller. Waits until the earliest read of all devices with an absolute deadline, the wait is cut short when the poller stops.
+/// Reads run without the mutex, so a stop waits for the reads in progress and never leaves a sample half published or the bus in a transaction.
+/// @param argument The I2CPoller instance.
+/// @return Always NULL.
+void *I2CPoller_Run(void *argument)
+{
+    I2CPoller *poller = (I2CPoller *)argument;
+    unsigned char data[I2C_POLLER_MAX_SAMPLE_SIZE];
+
+    pthread_mutex_lock(&poller->mutex);
+
+    while (!poller->isStopping)
+    {
+        unsigned long long deadline = ULLONG_MAX;
+        for (size_t i = 0; i < poller->deviceCount; i++)
+        {
+            deadline = poller->devices[i].nextRead < deadline ? poller->devices[i].nextRead : deadline;
+        }
+
+        unsigned long long now = I2CPoller_GetTime();
+        if (deadline > now)
+        {
+            // Woken early by a stop or spuriously, the stop and the time are checked again
+            if (deadline == ULLONG_MAX)
+            {
+                pthread_cond_wait(&poller->condition, &poller->mutex);
+            }
+            else
+            {
+                struct timespec wakeTime = {.tv_sec = (time_t)(deadline / 1000000000ULL), .tv_nsec = (long)(deadline % 1000000000ULL)};
+                pthread_cond_timedwait(&poller->condition, &poller->mutex, &wakeTime);
+            }
+            continue;
+        }
+
+        pthread_mutex_unlock(&poller->mutex);
+
+        for (size_t i = 0; i < poller->deviceCount; i++)
+        {
+            I2CPollerDevice *device = &poller->devices[i];
+            if (device->nextRead > now)
+            {
+                continue;
+            }
+
+            memset(data, 0, sizeof(data));
+            if (I2CBus_ReadRegisters(poller->bus, device->address, device->reg, data, (unsigned short)device->length))
+            {
+                I2CPollerDevice_Publish(device, data, I2CPoller_GetTime());
+            }
+            else
+            {
+                atomic_fetch_add_explicit(&poller->errorCount, 1, memory_order_relaxed);
+            }
+
+            // A device read too late skips the missed reads instead of reading them in a burst.
+            device->nextRead += device->periodNanoseconds;
+            device->nextRead = device->nextRead <= now ? now + device->periodNanoseconds : device->nextRead;
+        }
+
+        pthread_mutex_lock(&poller->mutex);
+    }
+
+    pthread_mutex_unlock(&poller->mutex);
+    return NULL;
+}
+
+#pragma endregion Source Only
+
+I2CBus *I2CBus_Open(const string busPath)
+{
+    DebugAssert(busPath != NULL, "Null pointer passed as parameter. Bus path cannot be NULL.");
+
+    I2CBus *bus = (I2CBus *)malloc(sizeof(I2CBus));
+    DebugAssert(bus != NULL, "Memory allocation failed.");
+
+    bus->busPath = StringDuplicate(busPath);
+
+    bus->fileDescriptor = open(bus->busPath, O_RDWR | O_CLOEXEC);
+    if (bus->fileDescriptor < 0)
+    {
+        DebugError("Failed to open I2C bus, error in open function with parameter : bus path '%s'. Error : %s. Returning NULL.", bus->busPath, strerror(errno));
+
+        free(bus->busPath);
+        bus->busPath = NULL;
+
+        free(bus);
+        bus = NULL;
+
+        return NULL;
+    }
+
+    DebugInfo("I2C bus opened successfully with path '%s'.", bus->busPath);
+    return bus;
+}
+
+void I2CBus_Close(I2CBus *bus)
+{
+    DebugAssert(bus != NULL, "Null pointer passed as parameter. Bus cannot be NULL.");
+
+    char tempBusPath[strlen(bus->busPath) + 1];
+    strcpy(tempBusPath, bus->busPath);
+
+    close(bus->fileDescriptor);
+    free(bus->busPath);
+    bus->fileDescriptor = -1;
+    bus->busPath = NULL;
+
+    free(bus);
+    bus = NULL;
+
+    DebugInfo("I2C bus closed successfully with path '%s'.", tempBusPath);
+}
+
+bool I2CBus_ReadRegisters(I2CBus *bus, unsigned char address, unsigned char reg, unsigned char *values, unsigned short count)
+{
+    DebugAssert(bus != NULL, "Null pointer passed as parameter. Bus cannot be NULL.");
+    DebugAssert(values != NULL, "Null pointer passed as parameter. Values cannot be NULL.");
+
+    struct i2c_msg messages[2] = {
+        {.addr = address, .flags = 0, .len = 1, .buf = &reg},
+        {.addr = address, .flags = I2C_M_RD, .len = count, .buf = values},
+    };
+    struct i2c_rdwr_ioctl_data transaction = {.msgs = messages, .nmsgs = 2};
+
+    // The poller thread reads through here, failures are counted by the caller instead of being logged on every frame.
+    return ioctl(bus->fileDescriptor, I2C_RDWR, &transaction) == 2;
+}
+
+bool I2CBus_WriteRegisters(I2CBus *bus, unsigned char address, unsigned char reg, const unsigned char *values, unsigned short count)
+{
+    DebugAssert(bus != NULL, "Null pointer passed as parameter. Bus cannot be NULL.");
+    DebugAssert(values != NULL, "Null pointer passed as parameter. Values cannot be NULL.");
+    DebugAssert(count <= I2C_BUS_MAX_WRITE_SIZE, "Invalid register count %u passed. Must be at most %d.", count, I2C_BUS_MAX_WRITE_SIZE);
+
+    unsigned char buffer[I2C_BUS_MAX_WRITE_SIZE + 1];
+    buffer[0] = reg;
+    memcpy(buffer + 1, values, count);
+
+    struct i2c_msg message = {.addr = address, .flags = 0, .len = (unsigned short)(count + 1), .buf = buffer};
+    struct i2c_rdwr_ioctl_data transaction = {.msgs = &message, .nmsgs = 1};
+
+    if (ioctl(bus->fileDescriptor, I2C_RDWR, &transaction) != 1)
+    {
+        DebugError("Failed to write I2C registers, error in ioctl function with parameters : bus path '%s', address '0x%02x', register '0x%02x', count '%u'. Error : %s.", bus->busPath, address, reg, count, strerror(errno));
+        return false;
+    }
+
+    return true;
+}
+
+I2CPoller *I2CPoller_Create(I2CBus *bus)
+{
+    DebugAssert(bus != NULL, "Null pointer passed as parameter. Bus cannot be NULL.");
+
+    I2CPoller *poller = (I2CPoller *)malloc(sizeof(I2CPoller));
+    DebugAssert(poller != NULL, "Memory allocation failed.");
+
+    poller->bus = bus;
+    poller->deviceCount = 0;
+    poller->isRunning = false;
+    poller->isStopping = false;
+    atomic_init(&poller->errorCount, 0);
+
+    pthread_condattr_t conditionAttributes;
+    pthread_condattr_init(&conditionAttributes);
+    pthread_condattr_setclock(&conditionAttributes, CLOCK_MONOTONIC);
+    pthread_mutex_init(&poller->mutex, NULL);
+    pthread_cond_init(&poller->condition, &conditionAttributes);
+    pthread_condattr_destroy(&conditionAttributes);
+
+    DebugInfo("I2C poller created successfully.");
+    return poller;
+}
+
+void I2CPoller_Destroy(I2CPoller *poller)
+{
+    DebugAssert(poller != NULL, "Null pointer passed as parameter. Poller cannot be NULL.");
+
+    // Stopped between reads, a read in progress ends and its sample is published first.
+    if (poller->isRunning)
+    {
+        pthread_mutex_lock(&poller->mutex);
+        poller->isStopping = true;
+        pthread_cond_signal(&poller->condition);
+        pthread_mutex_unlock(&poller->mutex);
+
+        pthread_join(poller->thread, NULL);
+        poller->isRunning = false;
+    }
+
+    pthread_cond_destroy(&poller->condition);
+    pthread_mutex_destroy(&poller->mutex);
+
+    poller->bus = NULL;
+    free(poller);
+    poller = NULL;
+
+    DebugInfo("I2C poller destroyed successfully.");
+}
+
+int I2CPoller_AddDevice(I2CPoller *poller, unsigned char address, unsigned char reg, unsigned int count, unsigned long long periodNanoseconds)
+{
+    DebugAssert(poller != NULL, "Null pointer passed as parameter. Poller cannot be NULL.");
+    DebugAssert(!poller->isRunning, "Devices cannot be added to a started poller.");
+    DebugAssert(count > 0 && count <= I2C_POLLER_MAX_SAMPLE_SIZE, "Invalid register count %u passed. Must be between 1 and %d.", count, I2C_POLLER_MAX_SAMPLE_SIZE);
+    DebugAssert(periodNanoseconds > 0, "Poll period must be more than 0.");
+
+    if (poller->deviceCount == I2C_POLLER_MAX_DEVICES)
+    {
+        DebugWarning("All %d devices of the poller are in use. Returning -1.", I2C_POLLER_MAX_DEVICES);
+        return -1;
+    }
+
+    I2CPollerDevice *device = &poller->devices[poller->deviceCount];
+
+    device->address = address;
+    device->reg = reg;
+    device->length = count;
+    device->periodNanoseconds = periodNanoseconds;
+    device->nextRead = 0;
+
+    atomic_init(&device->sequence, 0);
+    for (size_t i = 0; i < I2C_POLLER_MAX_SAMPLE_SIZE / 8; i++)
+    {
+        atomic_init(&device->words[i], 0);
+    }
+    atomic_init(&device->timestamp, 0);
+    atomic_init(&device->sampleCount, 0);
+
+    return (int)poller->deviceCount++;
+}
+
+bool I2CPoller_Start(I2CPoller *poller)
+{
+    DebugAssert(poller != NULL, "Null pointer passed as parameter. Poller cannot be NULL.");
+    DebugAssert(!poller->isRunning, "Poller is already started.");
+
+    // Every device is read once at the start, then on its own period.
+    unsigned long long now = I2CPoller_GetTime();
+    for (size_t i = 0; i < poller->deviceCount; i++)
+    {
+        poller->devices[i].nextRead = now;
+    }
+
+    int threadCreateReturn = pthread_create(&poller->thread, NULL, I2CPoller_Run, poller);
+    if (threadCreateReturn != 0)
+    {
+        DebugError("Failed to start I2C poller thread, error in pthread_create function. Return : %d.", threadCreateReturn);
+        return false;
+    }
+
+    poller->isRunning = true;
+
+    DebugInfo("I2C poller started successfully with %zu devices.", poller->deviceCount);
+    return true;
+}
+
+bool I2CPoller_GetLatest(const I2CPoller *poller, int deviceIndex, I2CSample *sample)
+{
+    DebugAssert(poller != NULL, "Null pointer passed as parameter. Poller cannot be NULL.");
+    DebugAssert(sample != NULL, "Null pointer passed as parameter. Sample cannot be NULL.");
+    DebugAssert(deviceIndex >= 0 && (size_t)deviceIndex < poller->deviceCount, "Invalid device index %d passed.", deviceIndex);
+
+    I2CPollerDevice *device = (I2CPollerDevice *)&poller->devices[deviceIndex];
+
+    // Copied again if the poller thread published while copying. Retries only when a write overlaps, which is rare at sensor rates.
+    while (true)
+    {
+        unsigned long long sequenceBefore = atomic_load_explicit(&device->sequence, memory_order_acquire);
+        if (sequenceBefore & 1)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < I2C_POLLER_MAX_SAMPLE_SIZE / 8; i++)
+        {
+            unsigned long long word = atomic_load_explicit(&device->words[i], memory_order_relaxed);
+            memcpy(sample->data + i * 8, &word, 8);
+        }
+
+        sample->timestamp = atomic_load_explicit(&device->timestamp, memory_order_relaxed);
+        sample->sampleCount = atomic_load_explicit(&device->sampleCount, memory_order_relaxed);
+
+        // Acquire fence keeps the loads above from moving after the second sequence load.
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&device->sequence, memory_order_relaxed) == sequenceBefore)
+        {
+            break;
+        }
+    }
+
+    sample->length = device->length;
+    return sample->sampleCount > 0;
+}
+
+unsigned long long I2CPoller_GetErrorCount(const I2CPoller *poller)
+{
+    DebugAssert(poller != NULL, "Null pointer passed as parameter. Poller cannot be NULL.");
+
+    return atomic_load_explicit(&((I2CPoller *)poller)->errorCount, memory_order_relaxed);
+}
+
+#endif // PLATFORM_LINUX
@@ -1,10 +1,6 @@
 #include "Modules/InputManager.h"
 
-#ifdef PLATFORM_WINDOWS
-#include <curses.h>
-#else
-#include <ncurses.h>
-#endif
+#include "Modules/RenderBackend.h"
 
 #pragma region Source Only
 
@@ -182,10 +178,7 @@ InputKey INPUT_KEY_FUNCTIONS[INPUT_KEY_FUNCTION_SIZE] = {
 
 void InputManager_Initialize()
 {
-    noecho();              // curses echo disable, no writing while getting input
-    cbreak();              // curses disable line buffering but take CTRL^C commands
-    keypad(stdscr, true);  // curses enable keys like arrow and function
-    nodelay(stdscr, true); // curses disable blocking on getch()
+    // Terminal input modes are set by the renderer backend since they belong to the terminal library.
 }
 
 void InputManager_Terminate()
@@ -213,7 +206,7 @@ void InputManager_PollInputs()
     }
 
     // get inputs
-    while ((character = getch()) != ERR)
+    while ((character = RendererManager_ReadKey(RENDERER_MAIN_WINDOW)) != RENDERER_BACKEND_KEY_NONE)
     {
         if (character >= INPUT_KEY_STANDARD_OFFSET && character < INPUT_KEY_STANDARD_OFFSET + INPUT_KEY_STANDARD_SIZE) // standard keys, 0 offset
         {
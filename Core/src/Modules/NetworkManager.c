@@ -9,6 +9,7 @@
 #pragma region Source Only
 
 NetworkResponseChunkCallback CURRENT_CHUNK_CALLBACK = NULL;
+size_t CURRENT_RESPONSE_CAPACITY = 0;
 
 typedef struct NetworkRequest
 {
@@ -25,18 +26,34 @@ typedef struct NetworkRequest
 /// @param data Received data from the network request. Not null terminated.
 /// @param elementCount Number of elements in the data. (curl says it is always 1)
 /// @param dataSize Size of the data element.
-/// @param userData User data which setted with CURLOPT_WRITEDATA option. Null terminated.
+/// @param userData The response which setted with CURLOPT_WRITEDATA option. Its body is null terminated.
 /// @return Number of bytes processed.
 size_t NetworkManager_WriteCallback(void *data, size_t elementCount, size_t dataSize, void *userData)
 {
+    NetworkResponse *response = (NetworkResponse *)userData;
+    size_t size = elementCount * dataSize;
+
     if (CURRENT_CHUNK_CALLBACK != NULL)
     {
-        CURRENT_CHUNK_CALLBACK(data, elementCount * dataSize, userData);
+        CURRENT_CHUNK_CALLBACK(data, size, response->body);
+    }
+
+    if (response->bodySize + size + 1 > CURRENT_RESPONSE_CAPACITY)
+    {
+        while (response->bodySize + size + 1 > CURRENT_RESPONSE_CAPACITY)
+        {
+            CURRENT_RESPONSE_CAPACITY *= 2;
+        }
+
+        response->body = (stringHeap)realloc(response->body, CURRENT_RESPONSE_CAPACITY);
+        DebugAssert(response->body != NULL, "Memory allocation failed for Network Response body.");
     }
 
-    strncat((string)userData, (string)data, elementCount * dataSize);
+    memcpy(response->body + response->bodySize, data, size);
+    response->bodySize += size;
+    response->body[response->bodySize] = '\0';
 
-    return elementCount * dataSize;
+    return size;
 }
 
 #pragma endregion Source Only
@@ -110,10 +127,15 @@ NetworkResponse *NetworkRequest_Request(NetworkRequest *request, NetworkResponse
     NetworkResponse *response = (NetworkResponse *)malloc(sizeof(NetworkResponse));
     DebugAssert(response != NULL, "Memory allocation failed for Network Response.");
 
-    response->body = (stringHeap)malloc(NETWORK_MANAGER_MAX_RESPONSE_DATA_LENGTH);
+    response->body = (stringHeap)malloc(NETWORK_MANAGER_INITIAL_RESPONSE_CAPACITY);
     DebugAssert(response->body != NULL, "Memory allocation failed for Network Response body.");
 
+    response->body[0] = '\0';
+    response->bodySize = 0;
+    CURRENT_RESPONSE_CAPACITY = NETWORK_MANAGER_INITIAL_RESPONSE_CAPACITY;
+
     response->code = NetworkResponseCode_Kolpa;
+    response->statusCode = 0;
 
     struct curl_slist *headers = NULL;
 
@@ -121,7 +143,7 @@ NetworkResponse *NetworkRequest_Request(NetworkRequest *request, NetworkResponse
     // curl_easy_setopt(requestHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_3);
     curl_easy_setopt(requestHandle, CURLOPT_URL, request->url);
     curl_easy_setopt(requestHandle, CURLOPT_WRITEFUNCTION, NetworkManager_WriteCallback);
-    curl_easy_setopt(requestHandle, CURLOPT_WRITEDATA, response->body);
+    curl_easy_setopt(requestHandle, CURLOPT_WRITEDATA, response);
 
     switch (request->type)
     {
@@ -158,17 +180,15 @@ NetworkResponse *NetworkRequest_Request(NetworkRequest *request, NetworkResponse
         return NULL;
     }
 
-    if (finishCallback != NULL)
-    {
-        CURRENT_CHUNK_CALLBACK = chunkCallback;
-    }
+    CURRENT_CHUNK_CALLBACK = chunkCallback;
 
     DebugInfo("Network request sent to URL : '%s'\nRequest body : '%s'", request->url, (char *)request->data);
     Timer timer = Timer_CreateStack("Network Request Timer");
     Timer_Start(&timer);
     response->code = (NetworkResponseCode)curl_easy_perform(requestHandle);
     Timer_Stop(&timer);
-    DebugInfo("Network response received. Time taken: %f ms, response code: %d", Timer_GetElapsedNanoseconds(&timer) / 1000000.0f, response->code);
+    curl_easy_getinfo(requestHandle, CURLINFO_RESPONSE_CODE, &response->statusCode);
+    DebugInfo("Network response received. Time taken: %f ms, response code: %d, HTTP status: %ld", Timer_GetElapsedNanoseconds(&timer) / 1000000.0f, response->code, response->statusCode);
     DebugWarning("Response from URL : '%s'\nResponse body : '%s'", request->url, response->body);
 
     if (response->code != NetworkResponseCode_Ok)
@@ -181,6 +201,7 @@ NetworkResponse *NetworkRequest_Request(NetworkRequest *request, NetworkResponse
         free(response);
         response = NULL;
 
+        curl_slist_free_all(headers);
         curl_easy_cleanup(requestHandle);
 
         CURRENT_CHUNK_CALLBACK = NULL;
@@ -198,8 +219,6 @@ NetworkResponse *NetworkRequest_Request(NetworkRequest *request, NetworkResponse
     curl_easy_cleanup(requestHandle);
     CURRENT_CHUNK_CALLBACK = NULL;
 
-    response->bodySize = strlen(response->body);
-
     if (finishCallback != NULL)
     {
         finishCallback(response);
@@ -0,0 +1,353 @@
+#include "Modules/RenderBackend.h"
+#include "Modules/InputManager.h"
+
+#if !PLATFORM_WINDOWS
+
+#include <errno.h>
+#include <poll.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+
+#pragma region Source Only
+
+// Key codes of the escape sequences, same values with curses so the input manager tables work for both
+#define RENDERER_ANSI_KEY_DOWN 258
+#define RENDERER_ANSI_KEY_UP 259
+#define RENDERER_ANSI_KEY_LEFT 260
+#define RENDERER_ANSI_KEY_RIGHT 261
+#define RENDERER_ANSI_KEY_F1 265
+
+/// @brief Cells of the screen. Windows are composed into it on refresh and sent on present.
+RendererCellScreen *RENDERER_ANSI_SCREEN = NULL;
+
+/// @brief Frame buffer sized for the worst frame on initialization, so frames never allocate.
+char *RENDERER_ANSI_FRAME = NULL;
+size_t RENDERER_ANSI_FRAME_CAPACITY = 0;
+
+RendererCellWindow *RENDERER_ANSI_SCREEN_WINDOW = NULL;
+RendererBackendStats RENDERER_ANSI_STATS = {0};
+
+/// @brief Terminal modes before initialization, restored on termination.
+struct termios RENDERER_ANSI_ORIGINAL_MODES;
+bool RENDERER_ANSI_MODES_CHANGED = false;
+
+/// @brief Writes all bytes to the terminal. Retries interrupted and partial writes.
+/// @param data Bytes to write.
+/// @param size Count of bytes.
+void RendererAnsi_Write(const char *data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t written = write(STDOUT_FILENO, data, size);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            DebugWarning("Writing %zu bytes to the terminal failed. errno : %d", size, errno);
+            return;
+        }
+
+        data += written;
+        size -= (size_t)written;
+    }
+}
+
+/// @brief Waits for a byte from the terminal and reads it.
+/// @param timeoutMilliseconds Milliseconds to wait. 0 does not wait, -1 waits until a byte comes.
+/// @return The byte or RENDERER_BACKEND_KEY_NONE if no byte came in time.
+int RendererAnsi_ReadByte(int timeoutMilliseconds)
+{
+    struct pollfd input = {.fd = STDIN_FILENO, .events = POLLIN, .revents = 0};
+
+    if (poll(&input, 1, timeoutMilliseconds) <= 0 || !(input.revents & POLLIN))
+    {
+        return RENDERER_BACKEND_KEY_NONE;
+    }
+
+    unsigned char byte;
+    return read(STDIN_FILENO, &byte, 1) == 1 ? byte : RENDERER_BACKEND_KEY_NONE;
+}
+
+/// @brief Gets the color count from the terminal environment since there is no terminfo lookup.
+/// @return Count of colors.
+int RendererAnsi_DetectColorCount()
+{
+    const char *colorTerm = getenv("COLORTERM");
+    const char *term = getenv("TERM");
+
+    if (colorTerm != NULL && (strcmp(colorTerm, "truecolor") == 0 || strcmp(colorTerm, "24bit") == 0))
+    {
+        return 0x1000000;
+    }
+
+    if (term != NULL && strstr(term, "256color") != NULL)
+    {
+        return 256;
+    }
+
+    return 8;
+}
+
+void RendererAnsi_Initialize(RendererBackendCapabilities *capabilities)
+{
+    struct winsize windowSize = {0};
+    bool hasSize = ioctl(STDOUT_FILENO, TIOCGWINSZ, &windowSize) == 0 && windowSize.ws_col > 0 && windowSize.ws_row > 0;
+
+    capabilities->screenSize = hasSize ? NewVector2Int(windowSize.ws_col, windowSize.ws_row) : NewVector2Int(80, 24);
+    capabilities->colorCount = RendererAnsi_DetectColorCount();
+    capabilities->colorPairCount = SHRT_MAX;
+    capabilities->canChangeColor = false;
+
+    // Same modes with curses noecho and cbreak, input is not echoed or line buffered but CTRL^C still works
+    if (tcgetattr(STDIN_FILENO, &RENDERER_ANSI_ORIGINAL_MODES) == 0)
+    {
+        struct termios modes = RENDERER_ANSI_ORIGINAL_MODES;
+        modes.c_lflag &= ~(tcflag_t)(ICANON | ECHO);
+        modes.c_cc[VMIN] = 1;
+        modes.c_cc[VTIME] = 0;
+
+        RENDERER_ANSI_MODES_CHANGED = tcsetattr(STDIN_FILENO, TCSAFLUSH, &modes) == 0;
+    }
+
+    RENDERER_ANSI_SCREEN = RendererCellScreen_Create(capabilities->screenSize, capabilities->colorCount, capabilities->colorPairCount);
+
+    RENDERER_ANSI_FRAME_CAPACITY = RendererCellScreen_GetFrameCapacity(RENDERER_ANSI_SCREEN);
+    RENDERER_ANSI_FRAME = (char *)malloc(RENDERER_ANSI_FRAME_CAPACITY);
+    DebugAssert(RENDERER_ANSI_FRAME != NULL, "Memory allocation failed for ANSI frame of %zu bytes.", RENDERER_ANSI_FRAME_CAPACITY);
+
+    // Alternate screen, reset attributes, clear and home the cursor. The screen starts blank like the front cells.
+    static const char enterSequence[] = "\x1b[?1049h\x1b[0m\x1b[2J\x1b[H";
+    RendererAnsi_Write(enterSequence, sizeof(enterSequence) - 1);
+    RENDERER_ANSI_STATS.bytesEmitted += sizeof(enterSequence) - 1;
+}
+
+void RendererAnsi_Present();
+
+void RendererAnsi_Terminate()
+{
+    RendererAnsi_Present();
+
+    static const char leaveSequence[] = "\x1b[0m\x1b[?25h\x1b[?1049l";
+    RendererAnsi_Write(leaveSequence, sizeof(leaveSequence) - 1);
+
+    if (RENDERER_ANSI_MODES_CHANGED)
+    {
+        tcsetattr(STDIN_FILENO, TCSAFLUSH, &RENDERER_ANSI_ORIGINAL_MODES);
+        RENDERER_ANSI_MODES_CHANGED = false;
+    }
+
+    if (RENDERER_ANSI_SCREEN_WINDOW != NULL)
+    {
+        RendererCellWindow_Destroy(RENDERER_ANSI_SCREEN_WINDOW);
+        RENDERER_ANSI_SCREEN_WINDOW = NULL;
+    }
+
+    RendererCellScreen_Destroy(RENDERER_ANSI_SCREEN);
+    free(RENDERER_ANSI_FRAME);
+    RENDERER_ANSI_SCREEN = NULL;
+    RENDERER_ANSI_FRAME = NULL;
+    RENDERER_ANSI_FRAME_CAPACITY = 0;
+}
+
+void *RendererAnsi_GetScreenWindow()
+{
+    if (RENDERER_ANSI_SCREEN_WINDOW == NULL)
+    {
+        RENDERER_ANSI_SCREEN_WINDOW = RendererCellWindow_Create(NewVector2Int(0, 0), RendererCellScreen_GetSize(RENDERER_ANSI_SCREEN));
+    }
+
+    return RENDERER_ANSI_SCREEN_WINDOW;
+}
+
+void *RendererAnsi_CreateWindow(Vector2Int position, Vector2Int size)
+{
+    return RendererCellWindow_Create(position, size);
+}
+
+void RendererAnsi_DestroyWindow(void *window)
+{
+    RendererCellWindow_Destroy((RendererCellWindow *)window);
+}
+
+void RendererAnsi_SetWindowGeometry(void *window, Vector2Int position, Vector2Int size)
+{
+    RendererCellWindow_SetGeometry((RendererCellWindow *)window, position, size);
+}
+
+Vector2Int RendererAnsi_ResizeScreen()
+{
+    struct winsize windowSize = {0};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &windowSize) != 0 || windowSize.ws_col == 0 || windowSize.ws_row == 0)
+    {
+        return RendererCellScreen_GetSize(RENDERER_ANSI_SCREEN);
+    }
+
+    Vector2Int size = NewVector2Int(windowSize.ws_col, windowSize.ws_row);
+    RendererCellScreen_Resize(RENDERER_ANSI_SCREEN, size);
+
+    // Allocated again only when the screen grows, a smaller frame fits the buffer
+    size_t frameCapacity = RendererCellScreen_GetFrameCapacity(RENDERER_ANSI_SCREEN);
+    if (frameCapacity > RENDERER_ANSI_FRAME_CAPACITY)
+    {
+        free(RENDERER_ANSI_FRAME);
+        RENDERER_ANSI_FRAME_CAPACITY = frameCapacity;
+        RENDERER_ANSI_FRAME = (char *)malloc(RENDERER_ANSI_FRAME_CAPACITY);
+        DebugAssert(RENDERER_ANSI_FRAME != NULL, "Memory allocation failed for ANSI frame of %zu bytes.", RENDERER_ANSI_FRAME_CAPACITY);
+    }
+
+    if (RENDERER_ANSI_SCREEN_WINDOW != NULL)
+    {
+        RendererCellWindow_SetGeometry(RENDERER_ANSI_SCREEN_WINDOW, NewVector2Int(0, 0), size);
+    }
+
+    return size;
+}
+
+void RendererAnsi_InitializeColorPair(int handle, RendererColorPair colorPair)
+{
+    RendererCellScreen_SetColorPair(RENDERER_ANSI_SCREEN, handle, colorPair);
+}
+
+void RendererAnsi_ChangeColor(RendererColor color, Vector3Int colorToChangeTo)
+{
+    (void)color;
+    (void)colorToChangeTo;
+}
+
+void RendererAnsi_SetCursorVisibility(RendererCursorVisibility visibility)
+{
+    RendererCellScreen_SetCursorVisibility(RENDERER_ANSI_SCREEN, visibility);
+}
+
+void RendererAnsi_SetAttribute(void *window, RendererTextAttributeMask mask, int colorPairHandle)
+{
+    RendererCellWindow_SetAttribute((RendererCellWindow *)window, mask, colorPairHandle);
+}
+
+void RendererAnsi_SetCursorPosition(void *window, Vector2Int position)
+{
+    RendererCellWindow_SetCursorPosition((RendererCellWindow *)window, position);
+}
+
+Vector2Int RendererAnsi_GetCursorPosition(void *window)
+{
+    return RendererCellWindow_GetCursorPosition((RendererCellWindow *)window);
+}
+
+void RendererAnsi_PutString(void *window, const char *text, size_t length)
+{
+    RENDERER_ANSI_STATS.cellsWritten += RendererCellWindow_PutString((RendererCellWindow *)window, text, length);
+}
+
+void RendererAnsi_Clear(void *window)
+{
+    RENDERER_ANSI_STATS.cellsWritten += RendererCellWindow_Clear((RendererCellWindow *)window);
+}
+
+void RendererAnsi_DrawBorder(void *window, const int borderChars[8])
+{
+    RENDERER_ANSI_STATS.cellsWritten += RendererCellWindow_DrawBorder((RendererCellWindow *)window, borderChars);
+}
+
+void RendererAnsi_Refresh(void *window)
+{
+    // Only composed here, all refreshes of a frame are sent together on present.
+    RendererCellScreen_Compose(RENDERER_ANSI_SCREEN, (RendererCellWindow *)window);
+    RENDERER_ANSI_STATS.refreshCount++;
+}
+
+void RendererAnsi_Present()
+{
+    size_t length = RendererCellScreen_Encode(RENDERER_ANSI_SCREEN, RENDERER_ANSI_FRAME, RENDERER_ANSI_FRAME_CAPACITY, &RENDERER_ANSI_STATS.cellsChanged);
+
+    if (length > 0)
+    {
+        RendererAnsi_Write(RENDERER_ANSI_FRAME, length);
+        RENDERER_ANSI_STATS.bytesEmitted += length;
+    }
+}
+
+int RendererAnsi_ReadKey(void *window)
+{
+    // Same with curses, only the screen window does not block. Others wait for a key and show the frame before waiting.
+    bool blocking = window != RENDERER_ANSI_SCREEN_WINDOW;
+    if (blocking)
+    {
+        RendererAnsi_Present();
+    }
+
+    int key = RendererAnsi_ReadByte(blocking ? -1 : 0);
+
+    if (key != InputKeyCode_Escape)
+    {
+        return key;
+    }
+
+    int introducer = RendererAnsi_ReadByte(RENDERER_ANSI_ESCAPE_TIMEOUT);
+    if (introducer != '[' && introducer != 'O')
+    {
+        return InputKeyCode_Escape; // the byte after a lone escape is lost, same with curses without keypad timeouts
+    }
+
+    int final = RendererAnsi_ReadByte(RENDERER_ANSI_ESCAPE_TIMEOUT);
+    switch (final)
+    {
+    case 'A':
+        return RENDERER_ANSI_KEY_UP;
+    case 'B':
+        return RENDERER_ANSI_KEY_DOWN;
+    case 'C':
+        return RENDERER_ANSI_KEY_RIGHT;
+    case 'D':
+        return RENDERER_ANSI_KEY_LEFT;
+    case 'P':
+    case 'Q':
+    case 'R':
+    case 'S':
+        return RENDERER_ANSI_KEY_F1 + (final - 'P');
+    default:
+        return InputKeyCode_Kolpa;
+    }
+}
+
+RendererBackendStats RendererAnsi_GetStats()
+{
+    return RENDERER_ANSI_STATS;
+}
+
+const RendererBackend RENDERER_BACKEND_ANSI = {
+    .name = "ANSI",
+    .initialize = RendererAnsi_Initialize,
+    .terminate = RendererAnsi_Terminate,
+    .getScreenWindow = RendererAnsi_GetScreenWindow,
+    .createWindow = RendererAnsi_CreateWindow,
+    .destroyWindow = RendererAnsi_DestroyWindow,
+    .setWindowGeometry = RendererAnsi_SetWindowGeometry,
+    .resizeScreen = RendererAnsi_ResizeScreen,
+    .initializeColorPair = RendererAnsi_InitializeColorPair,
+    .changeColor = RendererAnsi_ChangeColor,
+    .setCursorVisibility = RendererAnsi_SetCursorVisibility,
+    .setAttribute = RendererAnsi_SetAttribute,
+    .setCursorPosition = RendererAnsi_SetCursorPosition,
+    .getCursorPosition = RendererAnsi_GetCursorPosition,
+    .putString = RendererAnsi_PutString,
+    .clear = RendererAnsi_Clear,
+    .drawBorder = RendererAnsi_DrawBorder,
+    .refresh = RendererAnsi_Refresh,
+    .present = RendererAnsi_Present,
+    .readKey = RendererAnsi_ReadKey,
+    .getStats = RendererAnsi_GetStats,
+};
+
+#pragma endregion Source Only
+
+const RendererBackend *RendererBackend_GetAnsi()
+{
+    return &RENDERER_BACKEND_ANSI;
+}
+
+#endif
@@ -0,0 +1,729 @@
+#include "Modules/RenderBackend.h"
+
+#include <stdint.h>
+
+#pragma region Source Only
+
+// SGR parameters of the attribute masks. Standout has no parameter of its own, it is reversed like most terminals show it.
+const struct
+{
+    RendererTextAttributeMask mask;
+    int parameter;
+} RENDERER_CELL_ATTRIBUTE_PARAMETERS[] = {
+    {RendererTextAttributeMask_Bold, 1},
+    {RendererTextAttributeMask_Dim, 2},
+    {RendererTextAttributeMask_Underline, 4},
+    {RendererTextAttributeMask_Blink, 5},
+    {RendererTextAttributeMask_Reversed, 7},
+    {RendererTextAttributeMask_Standout, 7},
+    {RendererTextAttributeMask_Invis, 8},
+};
+
+typedef struct RendererCellWindow
+{
+    Vector2Int position;
+    Vector2Int size;
+    Vector2Int cursor;
+
+    RendererTextAttributeMask mask;
+    int colorPairHandle;
+
+    RendererCell *cells;
+    bool *touchedLines; // Lines written since the last compose. Only these are copied to the screen, like curses.
+} RendererCellWindow;
+
+typedef struct RendererCellScreen
+{
+    Vector2Int size;
+    RendererCell *frontCells; // Cells the terminal shows.
+    RendererCell *backCells;  // Cells composed from the windows, not sent yet.
+    bool *dirtyLines;         // Lines of back cells composed since the last encode.
+
+    int colorCount;
+    int colorPairCapacity;
+    RendererColorPair *colorPairs;
+
+    Vector2Int terminalCursor; // Cursor of the terminal, x is -1 when unknown.
+    RendererTextAttributeMask terminalMask;
+    int terminalColorPairHandle;
+    bool terminalAttributeKnown;
+
+    Vector2Int cursorTarget; // Cursor of the last composed window, the terminal cursor is left there.
+    RendererCursorVisibility cursorVisibility;
+    bool cursorVisibilityChanged;
+
+    bool clearPending; // The terminal content is unknown after a resize, the next frame clears and redraws everything.
+} RendererCellScreen;
+
+/// @brief Creates a cell of a code point.
+/// @param codePoint Code point of the cell, a valid Unicode scalar value.
+/// @param mask Attribute mask of the cell.
+/// @param colorPairHandle Color pair of the cell.
+/// @return The cell with the UTF-8 sequence of the code point.
+RendererCell RendererCell_Create(uint32_t codePoint, RendererTextAttributeMask mask, int colorPairHandle)
+{
+    RendererCell cell = {{0}, mask, colorPairHandle};
+
+    if (codePoint < 0x80)
+    {
+        cell.character[0] = (char)codePoint;
+    }
+    else if (codePoint < 0x800)
+    {
+        cell.character[0] = (char)(0xC0 | (codePoint >> 6));
+        cell.character[1] = (char)(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000)
+    {
+        cell.character[0] = (char)(0xE0 | (codePoint >> 12));
+        cell.character[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        cell.character[2] = (char)(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+        cell.character[0] = (char)(0xF0 | (codePoint >> 18));
+        cell.character[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+        cell.character[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        cell.character[3] = (char)(0x80 | (codePoint & 0x3F));
+    }
+
+    return cell;
+}
+
+/// @brief Decodes the first code point of UTF-8 text.
+/// @param text Text to decode.
+/// @param length Length of the text, at least 1.
+/// @param codePoint Decoded code point. U+FFFD if the sequence is invalid, overlong, a surrogate or cut by the end of the text.
+/// @return Count of bytes the code point takes. 1 for an invalid sequence, so decoding continues with the next byte.
+size_t RendererCell_DecodeUtf8(const char *text, size_t length, uint32_t *codePoint)
+{
+    const unsigned char *bytes = (const unsigned char *)text;
+    *codePoint = 0xFFFD;
+
+    size_t sequenceLength;
+    uint32_t value;
+    uint32_t minimum;
+    if (bytes[0] < 0x80)
+    {
+        *codePoint = bytes[0];
+        return 1;
+    }
+    else if (bytes[0] >= 0xC2 && bytes[0] < 0xE0)
+    {
+        sequenceLength = 2;
+        value = bytes[0] & 0x1F;
+        minimum = 0x80;
+    }
+    else if (bytes[0] >= 0xE0 && bytes[0] < 0xF0)
+    {
+        sequenceLength = 3;
+        value = bytes[0] & 0x0F;
+        minimum = 0x800;
+    }
+    else if (bytes[0] >= 0xF0 && bytes[0] < 0xF5)
+    {
+        sequenceLength = 4;
+        value = bytes[0] & 0x07;
+        minimum = 0x10000;
+    }
+    else
+    {
+        return 1;
+    }
+
+    if (sequenceLength > length)
+    {
+        return 1;
+    }
+
+    for (size_t i = 1; i < sequenceLength; i++)
+    {
+        if ((bytes[i] & 0xC0) != 0x80)
+        {
+            return 1;
+        }
+
+        value = (value << 6) | (bytes[i] & 0x3F);
+    }
+
+    if (value < minimum || value > 0x10FFFF || (value >= 0xD800 && value < 0xE000))
+    {
+        return 1;
+    }
+
+    *codePoint = value;
+    return sequenceLength;
+}
+
+/// @brief Fills cells with blanks of the attribute.
+/// @param cells Cells to fill.
+/// @param count Count of cells.
+/// @param mask Attribute mask of the blanks.
+/// @param colorPairHandle Color pair of the blanks.
+void RendererCell_FillBlank(RendererCell *cells, size_t count, RendererTextAttributeMask mask, int colorPairHandle)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        cells[i] = (RendererCell){{' '}, mask, colorPairHandle};
+    }
+}
+
+/// @brief Compares two cells.
+/// @return True if character and attributes are the same.
+bool RendererCell_IsEqual(const RendererCell *first, const RendererCell *second)
+{
+    return memcmp(first->character, second->character, RENDERER_CELL_MAX_CHARACTER_BYTES) == 0 && first->mask == second->mask && first->colorPairHandle == second->colorPairHandle;
+}
+
+/// @brief Appends formatted text to the frame buffer. Capacity is checked by the callers per cell.
+/// @param buffer Frame buffer.
+/// @param length Used length of the buffer. Updated.
+/// @param format Format of the text.
+void RendererCellScreen_Append(char *buffer, size_t *length, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    *length += (size_t)vsnprintf(buffer + *length, RENDERER_CELL_MAX_SEQUENCE_BYTES, format, args);
+    va_end(args);
+}
+
+/// @brief Appends the UTF-8 sequence of the character of a cell.
+/// @param buffer Frame buffer.
+/// @param length Used length of the buffer. Updated.
+/// @param cell Cell to append the character of.
+void RendererCellScreen_AppendCharacter(char *buffer, size_t *length, const RendererCell *cell)
+{
+    // The first byte is never 0, a cell holds a blank at least
+    buffer[(*length)++] = cell->character[0];
+    for (int i = 1; i < RENDERER_CELL_MAX_CHARACTER_BYTES && cell->character[i] != '\0'; i++)
+    {
+        buffer[(*length)++] = cell->character[i];
+    }
+}
+
+/// @brief Counts the decimal digits of a positive number.
+/// @param value Number to count the digits of.
+/// @return Count of digits.
+size_t RendererCellScreen_CountDigits(int value)
+{
+    size_t digits = 1;
+    for (; value >= 10; value /= 10)
+    {
+        digits++;
+    }
+
+    return digits;
+}
+
+/// @brief Appends the SGR parameters of a color.
+/// @param buffer Frame buffer.
+/// @param length Used length of the buffer. Updated.
+/// @param colorCount Count of colors of the terminal. Colors are packed RGB values for direct color, else palette indices.
+/// @param color Color to append. Negative colors are the terminal default and skipped.
+/// @param base 30 for foreground, 40 for background.
+void RendererCellScreen_AppendColor(char *buffer, size_t *length, int colorCount, int color, int base)
+{
+    if (color < 0)
+    {
+        return;
+    }
+
+    if (colorCount >= 0x1000000) // direct color terminals take the packed RGB value as color
+    {
+        RendererCellScreen_Append(buffer, length, ";%d;2;%d;%d;%d", base + 8, (color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF);
+    }
+    else if (color < 8)
+    {
+        RendererCellScreen_Append(buffer, length, ";%d", base + color);
+    }
+    else if (color < 16)
+    {
+        RendererCellScreen_Append(buffer, length, ";%d", base + 60 + color - 8);
+    }
+    else
+    {
+        RendererCellScreen_Append(buffer, length, ";%d;5;%d", base + 8, color & 0xFF);
+    }
+}
+
+/// @brief Appends a SGR sequence that sets the attributes and colors of the cell. Starts with a reset, so the previous attributes do not matter.
+/// @param screen Screen to get the colors from.
+/// @param buffer Frame buffer.
+/// @param length Used length of the buffer. Updated.
+/// @param cell Cell to set the attributes of.
+void RendererCellScreen_AppendAttribute(RendererCellScreen *screen, char *buffer, size_t *length, const RendererCell *cell)
+{
+    RendererCellScreen_Append(buffer, length, "\x1b[0");
+
+    for (size_t i = 0; i < sizeof(RENDERER_CELL_ATTRIBUTE_PARAMETERS) / sizeof(RENDERER_CELL_ATTRIBUTE_PARAMETERS[0]); i++)
+    {
+        if (cell->mask & RENDERER_CELL_ATTRIBUTE_PARAMETERS[i].mask)
+        {
+            RendererCellScreen_Append(buffer, length, ";%d", RENDERER_CELL_ATTRIBUTE_PARAMETERS[i].parameter);
+        }
+    }
+
+    if (cell->colorPairHandle > 0 && cell->colorPairHandle < screen->colorPairCapacity)
+    {
+        RendererColorPair colorPair = screen->colorPairs[cell->colorPairHandle];
+        RendererCellScreen_AppendColor(buffer, length, screen->colorCount, colorPair.x, 30);
+        RendererCellScreen_AppendColor(buffer, length, screen->colorCount, colorPair.y, 40);
+    }
+
+    buffer[(*length)++] = 'm';
+
+    screen->terminalMask = cell->mask;
+    screen->terminalColorPairHandle = cell->colorPairHandle;
+    screen->terminalAttributeKnown = true;
+}
+
+/// @brief Appends the cheapest way of moving the terminal cursor to the position.
+/// @param screen Screen to move the cursor of.
+/// @param buffer Frame buffer.
+/// @param length Used length of the buffer. Updated.
+/// @param position Position to move to.
+void RendererCellScreen_AppendMove(RendererCellScreen *screen, char *buffer, size_t *length, Vector2Int position)
+{
+    Vector2Int cursor = screen->terminalCursor;
+
+    if (cursor.x == position.x && cursor.y == position.y)
+    {
+        return;
+    }
+
+    if (cursor.x >= 0 && cursor.y == position.y && position.x > cursor.x)
+    {
+        int gap = position.x - cursor.x;
+        const RendererCell *skipped = screen->frontCells + (size_t)cursor.y * screen->size.x + cursor.x;
+
+        // Rewriting a few unchanged cells is cheaper than a cursor sequence if they have the current attributes.
+        bool canRewrite = gap <= RENDERER_CELL_MAX_REWRITE_GAP && screen->terminalAttributeKnown;
+        for (int i = 0; canRewrite && i < gap; i++)
+        {
+            canRewrite = skipped[i].mask == screen->terminalMask && skipped[i].colorPairHandle == screen->terminalColorPairHandle;
+        }
+
+        if (canRewrite)
+        {
+            for (int i = 0; i < gap; i++)
+            {
+                RendererCellScreen_AppendCharacter(buffer, length, &skipped[i]);
+            }
+        }
+        else
+        {
+            RendererCellScreen_Append(buffer, length, "\x1b[%dC", gap);
+        }
+    }
+    else if (cursor.x >= 0 && position.x == 0 && position.y == cursor.y + 1)
+    {
+        RendererCellScreen_Append(buffer, length, "\r\n");
+    }
+    else
+    {
+        RendererCellScreen_Append(buffer, length, "\x1b[%d;%dH", position.y + 1, position.x + 1);
+    }
+
+    screen->terminalCursor = position;
+}
+
+#pragma endregion Source Only
+
+RendererCellWindow *RendererCellWindow_Create(Vector2Int position, Vector2Int size)
+{
+    RendererCellWindow *window = (RendererCellWindow *)malloc(sizeof(RendererCellWindow));
+    DebugAssert(window != NULL, "Memory allocation failed for cell window.");
+
+    window->position = position;
+    window->size = size;
+    window->cursor = NewVector2Int(0, 0);
+    window->mask = RendererTextAttributeMask_Normal;
+    window->colorPairHandle = 0;
+
+    window->cells = (RendererCell *)malloc((size_t)size.x * (size_t)size.y * sizeof(RendererCell));
+    DebugAssert(window->cells != NULL, "Memory allocation failed for cell window cells.");
+    RendererCell_FillBlank(window->cells, (size_t)size.x * (size_t)size.y, RendererTextAttributeMask_Normal, 0);
+
+    window->touchedLines = (bool *)malloc((size_t)size.y * sizeof(bool));
+    DebugAssert(window->touchedLines != NULL, "Memory allocation failed for cell window lines.");
+    memset(window->touchedLines, true, (size_t)size.y * sizeof(bool));
+
+    return window;
+}
+
+void RendererCellWindow_Destroy(RendererCellWindow *window)
+{
+    DebugAssert(window != NULL, "Null pointer passed as parameter. Cell window cannot be NULL.");
+
+    free(window->cells);
+    free(window->touchedLines);
+    window->cells = NULL;
+    window->touchedLines = NULL;
+
+    free(window);
+}
+
+void RendererCellWindow_SetGeometry(RendererCellWindow *window, Vector2Int position, Vector2Int size)
+{
+    DebugAssert(size.x > 0 && size.y > 0, "Invalid cell window size (%d, %d) passed.", size.x, size.y);
+
+    window->position = position;
+
+    if (size.x == window->size.x && size.y == window->size.y)
+    {
+        memset(window->touchedLines, true, (size_t)size.y * sizeof(bool));
+        return;
+    }
+
+    RendererCell *cells = (RendererCell *)malloc((size_t)size.x * (size_t)size.y * sizeof(RendererCell));
+    bool *touchedLines = (bool *)realloc(window->touchedLines, (size_t)size.y * sizeof(bool));
+    DebugAssert(cells != NULL && touchedLines != NULL, "Memory allocation failed for resized cell window.");
+
+    // Same with wresize, the overlapping content is kept and the new cells are blank.
+    RendererCell_FillBlank(cells, (size_t)size.x * (size_t)size.y, RendererTextAttributeMask_Normal, 0);
+
+    int copyColumns = size.x < window->size.x ? size.x : window->size.x;
+    int copyLines = size.y < window->size.y ? size.y : window->size.y;
+    for (int y = 0; y < copyLines; y++)
+    {
+        memcpy(cells + (size_t)y * size.x, window->cells + (size_t)y * window->size.x, (size_t)copyColumns * sizeof(RendererCell));
+    }
+
+    free(window->cells);
+    window->cells = cells;
+    window->touchedLines = touchedLines;
+    window->size = size;
+    memset(window->touchedLines, true, (size_t)size.y * sizeof(bool));
+
+    window->cursor = NewVector2Int(window->cursor.x < size.x ? window->cursor.x : size.x - 1, window->cursor.y < size.y ? window->cursor.y : size.y - 1);
+}
+
+void RendererCellWindow_SetAttribute(RendererCellWindow *window, RendererTextAttributeMask mask, int colorPairHandle)
+{
+    window->mask = mask;
+    window->colorPairHandle = colorPairHandle;
+}
+
+void RendererCellWindow_SetCursorPosition(RendererCellWindow *window, Vector2Int position)
+{
+    if (position.x >= 0 && position.x < window->size.x && position.y >= 0 && position.y < window->size.y)
+    {
+        window->cursor = position;
+    }
+}
+
+Vector2Int RendererCellWindow_GetCursorPosition(const RendererCellWindow *window)
+{
+    return window->cursor;
+}
+
+size_t RendererCellWindow_PutString(RendererCellWindow *window, const char *text, size_t length)
+{
+    Vector2Int cursor = window->cursor;
+    size_t written = 0;
+
+    for (size_t i = 0; i < length && cursor.y < window->size.y;)
+    {
+        RendererCell *line = window->cells + (size_t)cursor.y * (size_t)window->size.x;
+        window->touchedLines[cursor.y] = true;
+
+        if (text[i] == '\n') // same with curses, clears the rest of the line
+        {
+            RendererCell_FillBlank(line + cursor.x, (size_t)(window->size.x - cursor.x), window->mask, window->colorPairHandle);
+            cursor.x = 0;
+            cursor.y++;
+            i++;
+            continue;
+        }
+
+        uint32_t codePoint;
+        i += RendererCell_DecodeUtf8(text + i, length - i, &codePoint);
+
+        // Control characters would move the real cursor, so they are drawn as blanks. C1 controls too, some terminals act on them.
+        if (codePoint < ' ' || (codePoint >= 127 && codePoint < 0xA0))
+        {
+            codePoint = ' ';
+        }
+
+        line[cursor.x] = RendererCell_Create(codePoint, window->mask, window->colorPairHandle);
+        written++;
+
+        if (++cursor.x >= window->size.x)
+        {
+            cursor.x = 0;
+            cursor.y++;
+        }
+    }
+
+    // Cursor stays at the last cell when the window is full, curses does the same without scrolling.
+    window->cursor = cursor.y < window->size.y ? cursor : NewVector2Int(window->size.x - 1, window->size.y - 1);
+
+    return written;
+}
+
+size_t RendererCellWindow_Clear(RendererCellWindow *window)
+{
+    size_t cellCount = (size_t)window->size.x * (size_t)window->size.y;
+
+    RendererCell_FillBlank(window->cells, cellCount, RendererTextAttributeMask_Normal, 0);
+    memset(window->touchedLines, true, (size_t)window->size.y * sizeof(bool));
+    window->cursor = NewVector2Int(0, 0);
+
+    return cellCount;
+}
+
+size_t RendererCellWindow_DrawBorder(RendererCellWindow *window, const int borderChars[8])
+{
+    Vector2Int size = window->size;
+
+    // 0 means default characters like curses, ASCII ones are used instead of the alternate character set.
+    // Curses alternate character set values are not code points and get the defaults too.
+    RendererCell borders[8];
+    static const char defaults[8] = {'|', '|', '-', '-', '+', '+', '+', '+'};
+    for (int i = 0; i < 8; i++)
+    {
+        bool isCodePoint = borderChars[i] >= ' ' && borderChars[i] <= 0x10FFFF && (borderChars[i] < 0xD800 || borderChars[i] >= 0xE000);
+        borders[i] = RendererCell_Create(isCodePoint ? (uint32_t)borderChars[i] : (uint32_t)defaults[i], window->mask, window->colorPairHandle);
+    }
+
+    for (int y = 0; y < size.y; y++)
+    {
+        window->cells[(size_t)y * size.x] = borders[0];
+        window->cells[(size_t)y * size.x + size.x - 1] = borders[1];
+    }
+
+    for (int x = 0; x < size.x; x++)
+    {
+        window->cells[x] = borders[2];
+        window->cells[(size_t)(size.y - 1) * size.x + x] = borders[3];
+    }
+
+    window->cells[0] = borders[4];
+    window->cells[size.x - 1] = borders[5];
+    window->cells[(size_t)(size.y - 1) * size.x] = borders[6];
+    window->cells[(size_t)(size.y - 1) * size.x + size.x - 1] = borders[7];
+    memset(window->touchedLines, true, (size_t)size.y * sizeof(bool));
+
+    return (size_t)(2 * size.x + 2 * size.y);
+}
+
+RendererCellScreen *RendererCellScreen_Create(Vector2Int size, int colorCount, int colorPairCapacity)
+{
+    DebugAssert(size.x > 0 && size.y > 0, "Invalid cell screen size (%d, %d) passed.", size.x, size.y);
+
+    RendererCellScreen *screen = (RendererCellScreen *)calloc(1, sizeof(RendererCellScreen));
+    DebugAssert(screen != NULL, "Memory allocation failed for cell screen.");
+
+    size_t cellCount = (size_t)size.x * (size_t)size.y;
+
+    screen->size = size;
+    screen->frontCells = (RendererCell *)malloc(cellCount * sizeof(RendererCell));
+    screen->backCells = (RendererCell *)malloc(cellCount * sizeof(RendererCell));
+    screen->dirtyLines = (bool *)calloc((size_t)size.y, sizeof(bool));
+    DebugAssert(screen->frontCells != NULL && screen->backCells != NULL && screen->dirtyLines != NULL, "Memory allocation failed for cell screen cells.");
+
+    RendererCell_FillBlank(screen->frontCells, cellCount, RendererTextAttributeMask_Normal, 0);
+    RendererCell_FillBlank(screen->backCells, cellCount, RendererTextAttributeMask_Normal, 0);
+
+    screen->colorCount = colorCount;
+    screen->colorPairCapacity = colorPairCapacity;
+    screen->colorPairs = (RendererColorPair *)malloc((size_t)colorPairCapacity * sizeof(RendererColorPair));
+    DebugAssert(screen->colorPairs != NULL, "Memory allocation failed for cell screen color pairs.");
+
+    for (int i = 0; i < colorPairCapacity; i++)
+    {
+        screen->colorPairs[i] = (RendererColorPair){RendererColor_Kolpa, RendererColor_Kolpa};
+    }
+
+    // The terminal is cleared by the backend before the first frame, so the blank front cells are correct.
+    screen->terminalCursor = NewVector2Int(0, 0);
+    screen->terminalMask = RendererTextAttributeMask_Normal;
+    screen->terminalColorPairHandle = 0;
+    screen->terminalAttributeKnown = true;
+    screen->cursorVisibility = RendererCursorVisibility_Default;
+
+    return screen;
+}
+
+void RendererCellScreen_Destroy(RendererCellScreen *screen)
+{
+    DebugAssert(screen != NULL, "Null pointer passed as parameter. Cell screen cannot be NULL.");
+
+    free(screen->frontCells);
+    free(screen->backCells);
+    free(screen->dirtyLines);
+    free(screen->colorPairs);
+    screen->frontCells = NULL;
+    screen->backCells = NULL;
+    screen->dirtyLines = NULL;
+    screen->colorPairs = NULL;
+
+    free(screen);
+}
+
+void RendererCellScreen_Resize(RendererCellScreen *screen, Vector2Int size)
+{
+    DebugAssert(size.x > 0 && size.y > 0, "Invalid cell screen size (%d, %d) passed.", size.x, size.y);
+
+    size_t cellCount = (size_t)size.x * (size_t)size.y;
+
+    RendererCell *backCells = (RendererCell *)malloc(cellCount * sizeof(RendererCell));
+    RendererCell *frontCells = (RendererCell *)realloc(screen->frontCells, cellCount * sizeof(RendererCell));
+    bool *dirtyLines = (bool *)realloc(screen->dirtyLines, (size_t)size.y * sizeof(bool));
+    DebugAssert(backCells != NULL && frontCells != NULL && dirtyLines != NULL, "Memory allocation failed for resized cell screen.");
+
+    // Composed content is kept where it still fits. The front cells match the cleared terminal of the next frame.
+    RendererCell_FillBlank(backCells, cellCount, RendererTextAttributeMask_Normal, 0);
+    RendererCell_FillBlank(frontCells, cellCount, RendererTextAttributeMask_Normal, 0);
+
+    int copyColumns = size.x < screen->size.x ? size.x : screen->size.x;
+    int copyLines = size.y < screen->size.y ? size.y : screen->size.y;
+    for (int y = 0; y < copyLines; y++)
+    {
+        memcpy(backCells + (size_t)y * size.x, screen->backCells + (size_t)y * screen->size.x, (size_t)copyColumns * sizeof(RendererCell));
+    }
+
+    free(screen->backCells);
+    screen->backCells = backCells;
+    screen->frontCells = frontCells;
+    screen->dirtyLines = dirtyLines;
+    screen->size = size;
+    memset(screen->dirtyLines, true, (size_t)size.y * sizeof(bool));
+
+    screen->cursorTarget = NewVector2Int(screen->cursorTarget.x < size.x ? screen->cursorTarget.x : size.x - 1, screen->cursorTarget.y < size.y ? screen->cursorTarget.y : size.y - 1);
+    screen->clearPending = true;
+}
+
+void RendererCellScreen_SetColorPair(RendererCellScreen *screen, int handle, RendererColorPair colorPair)
+{
+    if (handle > 0 && handle < screen->colorPairCapacity)
+    {
+        screen->colorPairs[handle] = colorPair;
+    }
+}
+
+void RendererCellScreen_SetCursorVisibility(RendererCellScreen *screen, RendererCursorVisibility visibility)
+{
+    screen->cursorVisibilityChanged = screen->cursorVisibilityChanged || screen->cursorVisibility != visibility;
+    screen->cursorVisibility = visibility;
+}
+
+void RendererCellScreen_Compose(RendererCellScreen *screen, RendererCellWindow *window)
+{
+    // Visible columns of the window on the screen
+    int firstColumn = window->position.x < 0 ? -window->position.x : 0;
+    int lastColumn = window->position.x + window->size.x > screen->size.x ? screen->size.x - window->position.x : window->size.x;
+
+    for (int y = 0; y < window->size.y; y++)
+    {
+        int screenY = window->position.y + y;
+        if (!window->touchedLines[y] || screenY < 0 || screenY >= screen->size.y || firstColumn >= lastColumn)
+        {
+            continue;
+        }
+
+        memcpy(screen->backCells + (size_t)screenY * screen->size.x + window->position.x + firstColumn,
+               window->cells + (size_t)y * window->size.x + firstColumn,
+               (size_t)(lastColumn - firstColumn) * sizeof(RendererCell));
+
+        window->touchedLines[y] = false;
+        screen->dirtyLines[screenY] = true;
+    }
+
+    screen->cursorTarget = Vector2Int_Add(window->position, window->cursor);
+}
+
+size_t RendererCellScreen_GetFrameCapacity(const RendererCellScreen *screen)
+{
+    // A changed cell takes at most a cursor move, an SGR sequence and its character. Unchanged cells rewritten instead of a move
+    // are counted as their own characters, so the longest move of a cell is the absolute one to the last line and column.
+    size_t moveBytes = sizeof("\x1b[;H") - 1 + RendererCellScreen_CountDigits(screen->size.y) + RendererCellScreen_CountDigits(screen->size.x);
+
+    // Palette colors above 16 take the 256 color form whatever the color count is
+    size_t colorBytes = screen->colorCount >= 0x1000000 ? sizeof(";38;2;255;255;255") - 1 : sizeof(";38;5;255") - 1;
+    size_t attributeCount = sizeof(RENDERER_CELL_ATTRIBUTE_PARAMETERS) / sizeof(RENDERER_CELL_ATTRIBUTE_PARAMETERS[0]);
+    size_t attributeBytes = sizeof("\x1b[0m") - 1 + attributeCount * (sizeof(";7") - 1) + 2 * colorBytes;
+
+    size_t cellBytes = moveBytes + attributeBytes + RENDERER_CELL_MAX_CHARACTER_BYTES;
+    return (size_t)screen->size.x * (size_t)screen->size.y * cellBytes + RENDERER_CELL_FRAME_EXTRA_BYTES;
+}
+
+size_t RendererCellScreen_Encode(RendererCellScreen *screen, char *buffer, size_t capacity, unsigned long long *cellsChanged)
+{
+    DebugAssert(capacity >= RendererCellScreen_GetFrameCapacity(screen), "Frame buffer of %zu bytes is smaller than the screen needs.", capacity);
+
+    size_t length = 0;
+
+    if (screen->clearPending)
+    {
+        RendererCellScreen_Append(buffer, &length, "\x1b[0m\x1b[2J");
+        screen->terminalCursor = NewVector2Int(-1, -1);
+        screen->terminalMask = RendererTextAttributeMask_Normal;
+        screen->terminalColorPairHandle = 0;
+        screen->terminalAttributeKnown = true;
+        screen->clearPending = false;
+    }
+
+    for (int y = 0; y < screen->size.y; y++)
+    {
+        if (!screen->dirtyLines[y])
+        {
+            continue;
+        }
+
+        screen->dirtyLines[y] = false;
+
+        RendererCell *frontLine = screen->frontCells + (size_t)y * screen->size.x;
+        const RendererCell *backLine = screen->backCells + (size_t)y * screen->size.x;
+
+        for (int x = 0; x < screen->size.x; x++)
+        {
+            if (RendererCell_IsEqual(&frontLine[x], &backLine[x]))
+            {
+                continue;
+            }
+
+            RendererCellScreen_AppendMove(screen, buffer, &length, NewVector2Int(x, y));
+
+            if (!screen->terminalAttributeKnown || screen->terminalMask != backLine[x].mask || screen->terminalColorPairHandle != backLine[x].colorPairHandle)
+            {
+                RendererCellScreen_AppendAttribute(screen, buffer, &length, &backLine[x]);
+            }
+
+            RendererCellScreen_AppendCharacter(buffer, &length, &backLine[x]);
+            frontLine[x] = backLine[x];
+            (*cellsChanged)++;
+
+            // Terminals differ on where the cursor is after writing the last column, so it becomes unknown.
+            screen->terminalCursor = x + 1 < screen->size.x ? NewVector2Int(x + 1, y) : NewVector2Int(-1, -1);
+        }
+    }
+
+    if (length > 0 || screen->cursorVisibilityChanged)
+    {
+        RendererCellScreen_AppendMove(screen, buffer, &length, screen->cursorTarget);
+    }
+
+    if (screen->cursorVisibilityChanged)
+    {
+        RendererCellScreen_Append(buffer, &length, screen->cursorVisibility == RendererCursorVisibility_Invisible ? "\x1b[?25l" : "\x1b[?25h");
+        screen->cursorVisibilityChanged = false;
+    }
+
+    return length;
+}
+
+RendererCell RendererCellScreen_GetCell(const RendererCellScreen *screen, Vector2Int position)
+{
+    if (position.x < 0 || position.x >= screen->size.x || position.y < 0 || position.y >= screen->size.y)
+    {
+        return (RendererCell){{' '}, RendererTextAttributeMask_Normal, 0};
+    }
+
+    return screen->frontCells[(size_t)position.y * screen->size.x + position.x];
+}
+
+Vector2Int RendererCellScreen_GetSize(const RendererCellScreen *screen)
+{
+    return screen->size;
+}
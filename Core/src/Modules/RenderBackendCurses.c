@@ -0,0 +1,185 @@
+#include "Modules/RenderBackend.h"
+
+#if PLATFORM_WINDOWS
+#include <curses.h>
+#else
+#include <ncurses.h>
+#include <sys/ioctl.h>
+#endif
+
+#pragma region Source Only
+
+/// @brief Counters of the curses backend. Bytes are not counted since curses does its own output.
+RendererBackendStats RENDERER_CURSES_STATS = {0};
+
+void RendererCurses_Initialize(RendererBackendCapabilities *capabilities)
+{
+    initscr();     // curses initialize screen
+    start_color(); // curses start the color functionality
+
+    noecho();              // curses echo disable, no writing while getting input
+    cbreak();              // curses disable line buffering but take CTRL^C commands
+    keypad(stdscr, true);  // curses enable keys like arrow and function
+    nodelay(stdscr, true); // curses disable blocking on getch()
+
+    capabilities->screenSize = NewVector2Int(COLS, LINES);
+    capabilities->colorCount = COLORS;
+    capabilities->canChangeColor = can_change_color();
+
+#if defined(NCURSES_EXT_COLORS)
+    capabilities->colorPairCount = COLOR_PAIRS;
+#else
+    capabilities->colorPairCount = COLOR_PAIRS < 256 ? COLOR_PAIRS : 256; // COLOR_PAIR() can only encode 8 bits
+#endif
+}
+
+void RendererCurses_Terminate()
+{
+    endwin(); // ncurses terminate
+}
+
+void *RendererCurses_GetScreenWindow()
+{
+    return stdscr;
+}
+
+void *RendererCurses_CreateWindow(Vector2Int position, Vector2Int size)
+{
+    return newwin(size.y, size.x, position.y, position.x);
+}
+
+void RendererCurses_DestroyWindow(void *window)
+{
+    delwin((WINDOW *)window);
+}
+
+void RendererCurses_SetWindowGeometry(void *window, Vector2Int position, Vector2Int size)
+{
+    // Resized first, so the window fits the screen at the new position and mvwin does not fail.
+    wresize((WINDOW *)window, size.y, size.x);
+
+    if (mvwin((WINDOW *)window, position.y, position.x) == ERR)
+    {
+        DebugWarning("Curses window cannot be moved to (%d, %d) with size (%d, %d).", position.x, position.y, size.x, size.y);
+    }
+}
+
+Vector2Int RendererCurses_ResizeScreen()
+{
+#if PLATFORM_WINDOWS
+    resize_term(0, 0); // PDCurses reads the console size itself
+#else
+    struct winsize windowSize = {0};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &windowSize) == 0 && windowSize.ws_col > 0 && windowSize.ws_row > 0)
+    {
+        resizeterm(windowSize.ws_row, windowSize.ws_col); // resizes stdscr too and repaints everything on next refresh
+    }
+#endif
+
+    return NewVector2Int(COLS, LINES);
+}
+
+void RendererCurses_InitializeColorPair(int handle, RendererColorPair colorPair)
+{
+#if defined(NCURSES_EXT_COLORS)
+    init_extended_pair(handle, colorPair.x, colorPair.y);
+#else
+    init_pair((short)handle, (short)colorPair.x, (short)colorPair.y);
+#endif
+}
+
+void RendererCurses_ChangeColor(RendererColor color, Vector3Int colorToChangeTo)
+{
+    init_color(color, colorToChangeTo.x, colorToChangeTo.y, colorToChangeTo.z);
+}
+
+void RendererCurses_SetCursorVisibility(RendererCursorVisibility visibility)
+{
+    curs_set(visibility);
+}
+
+void RendererCurses_SetAttribute(void *window, RendererTextAttributeMask mask, int colorPairHandle)
+{
+#if defined(NCURSES_EXT_COLORS)
+    wattr_set((WINDOW *)window, (attr_t)mask, 0, &colorPairHandle);
+#else
+    wattr_set((WINDOW *)window, (attr_t)mask, (short)colorPairHandle, NULL);
+#endif
+}
+
+void RendererCurses_SetCursorPosition(void *window, Vector2Int position)
+{
+    wmove((WINDOW *)window, position.y, position.x);
+}
+
+Vector2Int RendererCurses_GetCursorPosition(void *window)
+{
+    int y, x;
+    getyx((WINDOW *)window, y, x);
+
+    return NewVector2Int(x, y);
+}
+
+void RendererCurses_PutString(void *window, const char *text, size_t length)
+{
+    waddnstr((WINDOW *)window, text, (int)length);
+    RENDERER_CURSES_STATS.cellsWritten += length;
+}
+
+void RendererCurses_Clear(void *window)
+{
+    wclear((WINDOW *)window);
+}
+
+void RendererCurses_DrawBorder(void *window, const int borderChars[8])
+{
+    wborder((WINDOW *)window, (chtype)borderChars[0], (chtype)borderChars[1], (chtype)borderChars[2], (chtype)borderChars[3],
+            (chtype)borderChars[4], (chtype)borderChars[5], (chtype)borderChars[6], (chtype)borderChars[7]);
+}
+
+void RendererCurses_Refresh(void *window)
+{
+    wrefresh((WINDOW *)window);
+    RENDERER_CURSES_STATS.refreshCount++;
+}
+
+int RendererCurses_ReadKey(void *window)
+{
+    return wgetch((WINDOW *)window);
+}
+
+RendererBackendStats RendererCurses_GetStats()
+{
+    return RENDERER_CURSES_STATS;
+}
+
+const RendererBackend RENDERER_BACKEND_CURSES = {
+    .name = "Curses",
+    .initialize = RendererCurses_Initialize,
+    .terminate = RendererCurses_Terminate,
+    .getScreenWindow = RendererCurses_GetScreenWindow,
+    .createWindow = RendererCurses_CreateWindow,
+    .destroyWindow = RendererCurses_DestroyWindow,
+    .setWindowGeometry = RendererCurses_SetWindowGeometry,
+    .resizeScreen = RendererCurses_ResizeScreen,
+    .initializeColorPair = RendererCurses_InitializeColorPair,
+    .changeColor = RendererCurses_ChangeColor,
+    .setCursorVisibility = RendererCurses_SetCursorVisibility,
+    .setAttribute = RendererCurses_SetAttribute,
+    .setCursorPosition = RendererCurses_SetCursorPosition,
+    .getCursorPosition = RendererCurses_GetCursorPosition,
+    .putString = RendererCurses_PutString,
+    .clear = RendererCurses_Clear,
+    .drawBorder = RendererCurses_DrawBorder,
+    .refresh = RendererCurses_Refresh,
+    .present = NULL,
+    .readKey = RendererCurses_ReadKey,
+    .getStats = RendererCurses_GetStats,
+};
+
+#pragma endregion Source Only
+
+const RendererBackend *RendererBackend_GetCurses()
+{
+    return &RENDERER_BACKEND_CURSES;
+}
@@ -0,0 +1,263 @@
+#include "Modules/RenderBackend.h"
+
+#pragma region Source Only
+
+Vector2Int RENDERER_HEADLESS_SCREEN_SIZE = {RENDERER_HEADLESS_DEFAULT_SIZE_X, RENDERER_HEADLESS_DEFAULT_SIZE_Y};
+
+/// @brief Cells of the screen. Frames are encoded on every refresh, so the front cells are what a terminal would show.
+RendererCellScreen *RENDERER_HEADLESS_SCREEN = NULL;
+
+/// @brief Encoded frames are written here and dropped, only their size is counted.
+char *RENDERER_HEADLESS_FRAME = NULL;
+size_t RENDERER_HEADLESS_FRAME_CAPACITY = 0;
+
+RendererCellWindow *RENDERER_HEADLESS_SCREEN_WINDOW = NULL;
+RendererBackendStats RENDERER_HEADLESS_STATS = {0};
+
+int RENDERER_HEADLESS_KEY_QUEUE[RENDERER_HEADLESS_KEY_QUEUE_SIZE];
+size_t RENDERER_HEADLESS_KEY_HEAD = 0;
+size_t RENDERER_HEADLESS_KEY_TAIL = 0;
+
+void RendererHeadless_Initialize(RendererBackendCapabilities *capabilities)
+{
+    capabilities->screenSize = RENDERER_HEADLESS_SCREEN_SIZE;
+    capabilities->colorCount = 256;
+    capabilities->colorPairCount = 256;
+    capabilities->canChangeColor = false;
+
+    RENDERER_HEADLESS_SCREEN = RendererCellScreen_Create(capabilities->screenSize, capabilities->colorCount, capabilities->colorPairCount);
+
+    RENDERER_HEADLESS_FRAME_CAPACITY = RendererCellScreen_GetFrameCapacity(RENDERER_HEADLESS_SCREEN);
+    RENDERER_HEADLESS_FRAME = (char *)malloc(RENDERER_HEADLESS_FRAME_CAPACITY);
+    DebugAssert(RENDERER_HEADLESS_FRAME != NULL, "Memory allocation failed for headless frame.");
+}
+
+void RendererHeadless_Terminate()
+{
+    if (RENDERER_HEADLESS_SCREEN_WINDOW != NULL)
+    {
+        RendererCellWindow_Destroy(RENDERER_HEADLESS_SCREEN_WINDOW);
+        RENDERER_HEADLESS_SCREEN_WINDOW = NULL;
+    }
+
+    RendererCellScreen_Destroy(RENDERER_HEADLESS_SCREEN);
+    free(RENDERER_HEADLESS_FRAME);
+    RENDERER_HEADLESS_SCREEN = NULL;
+    RENDERER_HEADLESS_FRAME = NULL;
+    RENDERER_HEADLESS_FRAME_CAPACITY = 0;
+}
+
+void *RendererHeadless_GetScreenWindow()
+{
+    if (RENDERER_HEADLESS_SCREEN_WINDOW == NULL)
+    {
+        RENDERER_HEADLESS_SCREEN_WINDOW = RendererCellWindow_Create(NewVector2Int(0, 0), RENDERER_HEADLESS_SCREEN_SIZE);
+    }
+
+    return RENDERER_HEADLESS_SCREEN_WINDOW;
+}
+
+void *RendererHeadless_CreateWindow(Vector2Int position, Vector2Int size)
+{
+    return RendererCellWindow_Create(position, size);
+}
+
+void RendererHeadless_DestroyWindow(void *window)
+{
+    RendererCellWindow_Destroy((RendererCellWindow *)window);
+}
+
+void RendererHeadless_SetWindowGeometry(void *window, Vector2Int position, Vector2Int size)
+{
+    RendererCellWindow_SetGeometry((RendererCellWindow *)window, position, size);
+}
+
+Vector2Int RendererHeadless_ResizeScreen()
+{
+    RendererCellScreen_Resize(RENDERER_HEADLESS_SCREEN, RENDERER_HEADLESS_SCREEN_SIZE);
+
+    // Allocated again only when the screen grows, a smaller frame fits the buffer
+    size_t frameCapacity = RendererCellScreen_GetFrameCapacity(RENDERER_HEADLESS_SCREEN);
+    if (frameCapacity > RENDERER_HEADLESS_FRAME_CAPACITY)
+    {
+        free(RENDERER_HEADLESS_FRAME);
+        RENDERER_HEADLESS_FRAME_CAPACITY = frameCapacity;
+        RENDERER_HEADLESS_FRAME = (char *)malloc(RENDERER_HEADLESS_FRAME_CAPACITY);
+        DebugAssert(RENDERER_HEADLESS_FRAME != NULL, "Memory allocation failed for headless frame.");
+    }
+
+    if (RENDERER_HEADLESS_SCREEN_WINDOW != NULL)
+    {
+        RendererCellWindow_SetGeometry(RENDERER_HEADLESS_SCREEN_WINDOW, NewVector2Int(0, 0), RENDERER_HEADLESS_SCREEN_SIZE);
+    }
+
+    return RENDERER_HEADLESS_SCREEN_SIZE;
+}
+
+void RendererHeadless_InitializeColorPair(int handle, RendererColorPair colorPair)
+{
+    RendererCellScreen_SetColorPair(RENDERER_HEADLESS_SCREEN, handle, colorPair);
+}
+
+void RendererHeadless_ChangeColor(RendererColor color, Vector3Int colorToChangeTo)
+{
+    (void)color;
+    (void)colorToChangeTo;
+}
+
+void RendererHeadless_SetCursorVisibility(RendererCursorVisibility visibility)
+{
+    RendererCellScreen_SetCursorVisibility(RENDERER_HEADLESS_SCREEN, visibility);
+}
+
+void RendererHeadless_SetAttribute(void *window, RendererTextAttributeMask mask, int colorPairHandle)
+{
+    RendererCellWindow_SetAttribute((RendererCellWindow *)window, mask, colorPairHandle);
+}
+
+void RendererHeadless_SetCursorPosition(void *window, Vector2Int position)
+{
+    RendererCellWindow_SetCursorPosition((RendererCellWindow *)window, position);
+}
+
+Vector2Int RendererHeadless_GetCursorPosition(void *window)
+{
+    return RendererCellWindow_GetCursorPosition((RendererCellWindow *)window);
+}
+
+void RendererHeadless_PutString(void *window, const char *text, size_t length)
+{
+    RENDERER_HEADLESS_STATS.cellsWritten += RendererCellWindow_PutString((RendererCellWindow *)window, text, length);
+}
+
+void RendererHeadless_Clear(void *window)
+{
+    RENDERER_HEADLESS_STATS.cellsWritten += RendererCellWindow_Clear((RendererCellWindow *)window);
+}
+
+void RendererHeadless_DrawBorder(void *window, const int borderChars[8])
+{
+    RENDERER_HEADLESS_STATS.cellsWritten += RendererCellWindow_DrawBorder((RendererCellWindow *)window, borderChars);
+}
+
+void RendererHeadless_Refresh(void *window)
+{
+    // Encoded on every refresh like curses sends on every wrefresh, so the counts match an unbatched terminal.
+    RendererCellScreen_Compose(RENDERER_HEADLESS_SCREEN, (RendererCellWindow *)window);
+    RENDERER_HEADLESS_STATS.bytesEmitted += RendererCellScreen_Encode(RENDERER_HEADLESS_SCREEN, RENDERER_HEADLESS_FRAME, RENDERER_HEADLESS_FRAME_CAPACITY, &RENDERER_HEADLESS_STATS.cellsChanged);
+    RENDERER_HEADLESS_STATS.refreshCount++;
+}
+
+int RendererHeadless_ReadKey(void *window)
+{
+    (void)window;
+
+    if (RENDERER_HEADLESS_KEY_HEAD == RENDERER_HEADLESS_KEY_TAIL)
+    {
+        return RENDERER_BACKEND_KEY_NONE;
+    }
+
+    int key = RENDERER_HEADLESS_KEY_QUEUE[RENDERER_HEADLESS_KEY_HEAD];
+    RENDERER_HEADLESS_KEY_HEAD = (RENDERER_HEADLESS_KEY_HEAD + 1) % RENDERER_HEADLESS_KEY_QUEUE_SIZE;
+
+    return key;
+}
+
+RendererBackendStats RendererHeadless_GetStats()
+{
+    return RENDERER_HEADLESS_STATS;
+}
+
+const RendererBackend RENDERER_BACKEND_HEADLESS = {
+    .name = "Headless",
+    .initialize = RendererHeadless_Initialize,
+    .terminate = RendererHeadless_Terminate,
+    .getScreenWindow = RendererHeadless_GetScreenWindow,
+    .createWindow = RendererHeadless_CreateWindow,
+    .destroyWindow = RendererHeadless_DestroyWindow,
+    .setWindowGeometry = RendererHeadless_SetWindowGeometry,
+    .resizeScreen = RendererHeadless_ResizeScreen,
+    .initializeColorPair = RendererHeadless_InitializeColorPair,
+    .changeColor = RendererHeadless_ChangeColor,
+    .setCursorVisibility = RendererHeadless_SetCursorVisibility,
+    .setAttribute = RendererHeadless_SetAttribute,
+    .setCursorPosition = RendererHeadless_SetCursorPosition,
+    .getCursorPosition = RendererHeadless_GetCursorPosition,
+    .putString = RendererHeadless_PutString,
+    .clear = RendererHeadless_Clear,
+    .drawBorder = RendererHeadless_DrawBorder,
+    .refresh = RendererHeadless_Refresh,
+    .present = NULL,
+    .readKey = RendererHeadless_ReadKey,
+    .getStats = RendererHeadless_GetStats,
+};
+
+#pragma endregion Source Only
+
+const RendererBackend *RendererBackend_GetHeadless()
+{
+    return &RENDERER_BACKEND_HEADLESS;
+}
+
+void RendererHeadless_SetScreenSize(Vector2Int size)
+{
+    DebugAssert(size.x > 0 && size.y > 0, "Invalid headless screen size (%d, %d) passed.", size.x, size.y);
+
+    RENDERER_HEADLESS_SCREEN_SIZE = size;
+
+    // Applied by the renderer on its next resize check, same with a SIGWINCH of a real terminal
+    if (RENDERER_HEADLESS_SCREEN != NULL)
+    {
+        RendererManager_RequestResize();
+    }
+}
+
+RendererCell RendererHeadless_GetCell(Vector2Int position)
+{
+    if (RENDERER_HEADLESS_SCREEN == NULL)
+    {
+        return (RendererCell){{' '}, RendererTextAttributeMask_Normal, 0};
+    }
+
+    return RendererCellScreen_GetCell(RENDERER_HEADLESS_SCREEN, position);
+}
+
+void RendererHeadless_GetLine(int line, char *buffer, size_t bufferSize)
+{
+    DebugAssert(buffer != NULL && bufferSize > 0, "Invalid buffer passed.");
+
+    size_t length = 0;
+    for (int x = 0; x < RENDERER_HEADLESS_SCREEN_SIZE.x; x++)
+    {
+        RendererCell cell = RendererHeadless_GetCell(NewVector2Int(x, line));
+        size_t characterLength = strnlen(cell.character, RENDERER_CELL_MAX_CHARACTER_BYTES);
+        if (length + characterLength >= bufferSize)
+        {
+            break;
+        }
+
+        memcpy(buffer + length, cell.character, characterLength);
+        length += characterLength;
+    }
+
+    buffer[length] = '\0';
+}
+
+void RendererHeadless_PushKey(int key)
+{
+    size_t nextTail = (RENDERER_HEADLESS_KEY_TAIL + 1) % RENDERER_HEADLESS_KEY_QUEUE_SIZE;
+
+    if (nextTail == RENDERER_HEADLESS_KEY_HEAD)
+    {
+        DebugWarning("Headless key queue is full. Key %d is dropped.", key);
+        return;
+    }
+
+    RENDERER_HEADLESS_KEY_QUEUE[RENDERER_HEADLESS_KEY_TAIL] = key;
+    RENDERER_HEADLESS_KEY_TAIL = nextTail;
+}
+
+void RendererHeadless_ResetStats()
+{
+    RENDERER_HEADLESS_STATS = (RendererBackendStats){0};
+}
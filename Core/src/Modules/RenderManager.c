@@ -1,17 +1,19 @@
 #include "Modules/RenderManager.h"
 
 #include "Modules/InputManager.h"
+#include "Modules/RenderBackend.h"
+#include "Utils/HashMap.h"
+#include "Utils/ListArray.h"
 
-#if PLATFORM_WINDOWS
-#include <curses.h>
-#else
-#include <ncurses.h>
-#endif
+#include <signal.h>
 
 #pragma region Source Only
 
-/// @brief Global index for color pairs. Used to assign unique handles to color pairs.
-int COLOR_PAIR_INDEX = 0;
+/// @brief The backend renderer draws with. Curses is used if no backend is selected before initialization.
+const RendererBackend *RENDERER_BACKEND = NULL;
+
+/// @brief Capabilities of the terminal, filled by the backend on initialization.
+RendererBackendCapabilities RENDERER_CAPABILITIES = {0};
 
 /// @brief The main renderer window.
 RendererWindow *RENDERER_MAIN_WINDOW = NULL;
@@ -19,26 +21,73 @@ RendererWindow *RENDERER_MAIN_WINDOW = NULL;
 /// @brief The default text attribute for the renderer.
 RendererTextAttribute *RENDERER_DEFAULT_TEXT_ATTRIBUTE = NULL;
 
+/// @brief Maps color pairs to their curses pair handles. Identical color pairs share a single handle.
+HashMap *RENDERER_COLOR_PAIR_HANDLES = NULL;
+
+/// @brief Reference counts of curses pair handles. Handles with 0 references are kept cached until another pair needs the handle.
+int *RENDERER_COLOR_PAIR_REFERENCES = NULL;
+
+/// @brief Color pairs of curses pair handles. Used to remove the evicted pair from the handle map.
+RendererColorPair *RENDERER_COLOR_PAIR_COLORS = NULL;
+
+/// @brief Count of curses pair handles that can be used. Bounded by COLOR_PAIRS of the terminal.
+int RENDERER_COLOR_PAIR_CAPACITY = 0;
+
+/// @brief Next curses pair handle that was never used. Pair 0 is reserved by curses for terminal defaults.
+int RENDERER_COLOR_PAIR_NEXT = 1;
+
+/// @brief Set by SIGWINCH or RendererManager_RequestResize, the resize is applied on the next core loop.
+volatile sig_atomic_t RENDERER_RESIZE_PENDING = 0;
+
+/// @brief Called after the screen is resized. Used by the layout to place the windows again.
+Core_VoidToVoid RENDERER_RESIZE_CALLBACK = NULL;
+
+#if !PLATFORM_WINDOWS
+/// @brief SIGWINCH handler before the renderer, restored on termination.
+struct sigaction RENDERER_PREVIOUS_RESIZE_ACTION;
+
+/// @brief SIGWINCH handler. Only sets the flag since nothing else is safe in a signal handler.
+void RendererManager_OnResizeSignal(int signalNumber)
+{
+    (void)signalNumber;
+    RENDERER_RESIZE_PENDING = 1;
+}
+#endif
+
+/// @brief Maps interned text attribute keys to their ids.
+HashMap *RENDERER_INTERNED_ATTRIBUTE_IDS = NULL;
+
+/// @brief Interned text attributes. Index is the id of the attribute.
+ListArray *RENDERER_INTERNED_ATTRIBUTES = NULL;
+
 typedef struct RendererTextAttribute
 {
     stringHeap title;
     int colorPairHandle;
+    RendererTextAttributeId id; // Kolpa if the attribute is not interned.
 
     RendererTextAttributeMask mask;
     RendererColorPair colorPair;
 } RendererTextAttribute;
 
+/// @brief Key of an interned text attribute. Zero initialized before use since it is compared byte by byte.
+typedef struct RendererTextAttributeKey
+{
+    RendererTextAttributeMask mask;
+    RendererColorPair colorPair;
+} RendererTextAttributeKey;
+
 typedef struct RendererWindow
 {
     stringHeap title;
-    WINDOW *windowHandle;
+    void *windowHandle; // Owned and interpreted by the backend.
 
     Vector2Int size;
     Vector2Int relativePosition;
     Vector2Int globalPosition;
 
     RendererTextAttribute *defaultAttribute;
-    chtype borderChars[8];
+    int borderChars[8];
 
     struct RendererWindow *parent;
 } RendererWindow;
@@ -47,8 +96,10 @@ typedef struct RendererWindow
 /// @param window Window to destroy handle.
 void RendererWindow_DestroyHandle(RendererWindow *window)
 {
-    wborder(window->windowHandle, ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ');
-    delwin(window->windowHandle);
+    static const int blankBorderChars[8] = {' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
+
+    RENDERER_BACKEND->drawBorder(window->windowHandle, blankBorderChars);
+    RENDERER_BACKEND->destroyWindow(window->windowHandle);
 
     window->windowHandle = NULL;
 }
@@ -57,69 +108,301 @@ void RendererWindow_DestroyHandle(RendererWindow *window)
 /// @param window window to set handle to.
 void RendererWindow_CreateHandle(RendererWindow *window)
 {
-    window->windowHandle = newwin(window->size.y, window->size.x, window->globalPosition.y, window->globalPosition.x);
+    window->windowHandle = RENDERER_BACKEND->createWindow(window->globalPosition, window->size);
     DebugAssert(window->windowHandle != NULL, "Window handle creation failed for '%s'", window->title);
 
-    box(window->windowHandle, '|', '-');
+    RENDERER_BACKEND->drawBorder(window->windowHandle, window->borderChars);
+}
+
+/// @brief Gets a curses pair handle for the color pair. Identical color pairs share the same handle.
+/// @param colorPair Color pair to get the handle for.
+/// @return The curses pair handle. 0 (terminal defaults) if all handles are in use.
+int RendererManager_AcquireColorPair(RendererColorPair colorPair)
+{
+    int *cachedHandle = (int *)HashMap_Get(RENDERER_COLOR_PAIR_HANDLES, &colorPair);
+    if (cachedHandle != NULL)
+    {
+        RENDERER_COLOR_PAIR_REFERENCES[*cachedHandle]++;
+        return *cachedHandle;
+    }
+
+    int handle = -1;
+
+    if (RENDERER_COLOR_PAIR_NEXT < RENDERER_COLOR_PAIR_CAPACITY)
+    {
+        handle = RENDERER_COLOR_PAIR_NEXT++;
+    }
+    else
+    {
+        for (int i = 1; i < RENDERER_COLOR_PAIR_CAPACITY; i++)
+        {
+            if (RENDERER_COLOR_PAIR_REFERENCES[i] == 0)
+            {
+                HashMap_Remove(RENDERER_COLOR_PAIR_HANDLES, &RENDERER_COLOR_PAIR_COLORS[i]);
+                handle = i;
+                break;
+            }
+        }
+    }
+
+    if (handle == -1)
+    {
+        DebugWarning("All %d color pairs are in use. Color pair (%d, %d) will use the terminal default colors.", RENDERER_COLOR_PAIR_CAPACITY, colorPair.x, colorPair.y);
+        return 0;
+    }
+
+    RENDERER_BACKEND->initializeColorPair(handle, colorPair);
+
+    RENDERER_COLOR_PAIR_COLORS[handle] = colorPair;
+    RENDERER_COLOR_PAIR_REFERENCES[handle] = 1;
+    HashMap_Set(RENDERER_COLOR_PAIR_HANDLES, &colorPair, &handle);
+
+    return handle;
+}
+
+/// @brief Releases a curses pair handle got from RendererManager_AcquireColorPair.
+/// @param handle Handle to release.
+void RendererManager_ReleaseColorPair(int handle)
+{
+    if (handle > 0 && handle < RENDERER_COLOR_PAIR_CAPACITY && RENDERER_COLOR_PAIR_REFERENCES[handle] > 0)
+    {
+        RENDERER_COLOR_PAIR_REFERENCES[handle]--;
+    }
 }
 
 /// @brief Enables the text attribute for the specified attribute.
+/// @param window Window to enable the attribute in.
 /// @param attribute Text attribute to enable.
-void RendererTextAttribute_Enable(const RendererTextAttribute *attribute)
+void RendererTextAttribute_Enable(const RendererWindow *window, const RendererTextAttribute *attribute)
 {
-    attron(COLOR_PAIR(attribute->colorPairHandle));
-    attron(attribute->mask);
+    RENDERER_BACKEND->setAttribute(window->windowHandle, attribute->mask, attribute->colorPairHandle);
 }
 
 /// @brief Disables the text attribute for the specified attribute.
+/// @param window Window to disable the attribute in.
 /// @param attribute Text attribute to disable.
-void RendererTextAttribute_Disable(const RendererTextAttribute *attribute)
+void RendererTextAttribute_Disable(const RendererWindow *window, const RendererTextAttribute *attribute)
 {
-    attroff(COLOR_PAIR(attribute->colorPairHandle));
-    attroff(attribute->mask);
+    (void)attribute;
+    RENDERER_BACKEND->setAttribute(window->windowHandle, RendererTextAttributeMask_Normal, 0);
 }
 
 #pragma endregion Source Only
 
 void RendererManager_Initialize()
 {
-    initscr();     // curses initialize screen
-    start_color(); // curses start the color functionality
+    if (RENDERER_BACKEND == NULL)
+    {
+        RENDERER_BACKEND = RendererBackend_GetCurses();
+    }
+
+    RENDERER_BACKEND->initialize(&RENDERER_CAPABILITIES);
+
+    RENDERER_COLOR_PAIR_CAPACITY = RENDERER_CAPABILITIES.colorPairCount < 1 ? 1 : RENDERER_CAPABILITIES.colorPairCount;
+    RENDERER_COLOR_PAIR_NEXT = 1;
+
+    RENDERER_COLOR_PAIR_REFERENCES = (int *)calloc(RENDERER_COLOR_PAIR_CAPACITY, sizeof(int));
+    DebugAssert(RENDERER_COLOR_PAIR_REFERENCES != NULL, "Memory allocation failed for color pair references.");
+
+    RENDERER_COLOR_PAIR_COLORS = (RendererColorPair *)calloc(RENDERER_COLOR_PAIR_CAPACITY, sizeof(RendererColorPair));
+    DebugAssert(RENDERER_COLOR_PAIR_COLORS != NULL, "Memory allocation failed for color pair colors.");
+
+    RENDERER_COLOR_PAIR_HANDLES = HashMap_Create(sizeof(RendererColorPair), sizeof(int), 64);
+    RENDERER_INTERNED_ATTRIBUTE_IDS = HashMap_Create(sizeof(RendererTextAttributeKey), sizeof(RendererTextAttributeId), 64);
+    RENDERER_INTERNED_ATTRIBUTES = ListArray_Create(sizeof(RendererTextAttribute *), 64);
 
     RENDERER_DEFAULT_TEXT_ATTRIBUTE = RendererTextAttribute_Create("Default", RendererTextAttributeMask_Normal, (RendererColorPair){RendererColor_White, RendererColor_Black});
 
     RENDERER_MAIN_WINDOW = (RendererWindow *)malloc(sizeof(RendererWindow));
     DebugAssert(RENDERER_MAIN_WINDOW != NULL, "Memory allocation failed for RENDERER_MAIN_WINDOW.");
 
-    RENDERER_MAIN_WINDOW->windowHandle = stdscr;
+    RENDERER_MAIN_WINDOW->windowHandle = RENDERER_BACKEND->getScreenWindow();
     RENDERER_MAIN_WINDOW->title = "Main Window";
-    RENDERER_MAIN_WINDOW->size = NewVector2Int(COLS, LINES);
+    RENDERER_MAIN_WINDOW->size = RENDERER_CAPABILITIES.screenSize;
     RENDERER_MAIN_WINDOW->relativePosition = NewVector2Int(0, 0);
     RENDERER_MAIN_WINDOW->globalPosition = NewVector2Int(0, 0);
     RENDERER_MAIN_WINDOW->parent = NULL;
 
     RendererWindow_SetDefaultAttribute(RENDERER_MAIN_WINDOW, RENDERER_DEFAULT_TEXT_ATTRIBUTE);
 
-    DebugInfo("Main window created successfully. Terminal size : (%d, %d)", RENDERER_MAIN_WINDOW->size.x, RENDERER_MAIN_WINDOW->size.y);
+#if !PLATFORM_WINDOWS
+    // Replaces the handler of curses too, the screen is resized by RendererManager_HandleResize for every backend.
+    struct sigaction resizeAction = {0};
+    resizeAction.sa_handler = RendererManager_OnResizeSignal;
+    resizeAction.sa_flags = SA_RESTART;
+    sigemptyset(&resizeAction.sa_mask);
+    sigaction(SIGWINCH, &resizeAction, &RENDERER_PREVIOUS_RESIZE_ACTION);
+#endif
+
+    DebugInfo("Main window created successfully. Backend : %s, terminal size : (%d, %d), colors : %d, color pairs : %d", RENDERER_BACKEND->name, RENDERER_MAIN_WINDOW->size.x, RENDERER_MAIN_WINDOW->size.y, RENDERER_CAPABILITIES.colorCount, RENDERER_COLOR_PAIR_CAPACITY);
 }
 
 void RendererManager_Terminate()
 {
-    endwin(); // ncurses terminate
+    if (RENDERER_MAIN_WINDOW == NULL)
+    {
+        return;
+    }
+
+#if !PLATFORM_WINDOWS
+    sigaction(SIGWINCH, &RENDERER_PREVIOUS_RESIZE_ACTION, NULL);
+#endif
+    RENDERER_RESIZE_PENDING = 0;
+    RENDERER_RESIZE_CALLBACK = NULL;
+
+    RENDERER_BACKEND->terminate();
+
+    RendererTextAttribute_Destroy(RENDERER_DEFAULT_TEXT_ATTRIBUTE);
+
+    for (size_t i = 0; i < ListArray_GetSize(RENDERER_INTERNED_ATTRIBUTES); i++)
+    {
+        RendererTextAttribute *attribute = *(RendererTextAttribute **)ListArray_Get(RENDERER_INTERNED_ATTRIBUTES, i);
+        attribute->id = RENDERER_TEXT_ATTRIBUTE_ID_KOLPA;
+        RendererTextAttribute_Destroy(attribute);
+    }
+
+    ListArray_Destroy(RENDERER_INTERNED_ATTRIBUTES);
+    HashMap_Destroy(RENDERER_INTERNED_ATTRIBUTE_IDS);
+    HashMap_Destroy(RENDERER_COLOR_PAIR_HANDLES);
+    free(RENDERER_COLOR_PAIR_REFERENCES);
+    free(RENDERER_COLOR_PAIR_COLORS);
+
+    RENDERER_INTERNED_ATTRIBUTES = NULL;
+    RENDERER_INTERNED_ATTRIBUTE_IDS = NULL;
+    RENDERER_COLOR_PAIR_HANDLES = NULL;
+    RENDERER_COLOR_PAIR_REFERENCES = NULL;
+    RENDERER_COLOR_PAIR_COLORS = NULL;
+
+    free(RENDERER_MAIN_WINDOW);
+    RENDERER_MAIN_WINDOW = NULL;
+    RENDERER_DEFAULT_TEXT_ATTRIBUTE = NULL;
+}
+
+void RendererManager_SelectBackend(const RendererBackend *backend)
+{
+    DebugAssert(backend != NULL, "Null pointer passed as parameter. Backend cannot be NULL.");
+    DebugAssert(RENDERER_MAIN_WINDOW == NULL, "Renderer backend cannot be changed after initialization.");
+
+    RENDERER_BACKEND = backend;
+
+    DebugInfo("Renderer backend '%s' selected.", backend->name);
+}
+
+RendererBackendStats RendererManager_GetBackendStats()
+{
+    DebugAssert(RENDERER_BACKEND != NULL, "Renderer is not initialized.");
+
+    return RENDERER_BACKEND->getStats != NULL ? RENDERER_BACKEND->getStats() : (RendererBackendStats){0};
+}
+
+void RendererManager_Present()
+{
+    // Called by the core loop, applications without a renderer never initialize it
+    if (RENDERER_MAIN_WINDOW == NULL)
+    {
+        return;
+    }
+
+    if (RENDERER_BACKEND->present != NULL)
+    {
+        RENDERER_BACKEND->present();
+    }
+}
+
+void RendererManager_RequestResize()
+{
+    RENDERER_RESIZE_PENDING = 1;
+}
+
+bool RendererManager_HandleResize()
+{
+    if (RENDERER_MAIN_WINDOW == NULL || !RENDERER_RESIZE_PENDING)
+    {
+        return false;
+    }
+
+    RENDERER_RESIZE_PENDING = 0;
+
+    Vector2Int size = RENDERER_BACKEND->resizeScreen();
+    RENDERER_CAPABILITIES.screenSize = size;
+    RENDERER_MAIN_WINDOW->size = size;
+
+    DebugInfo("Terminal resized to (%d, %d).", size.x, size.y);
+
+    if (RENDERER_RESIZE_CALLBACK != NULL)
+    {
+        RENDERER_RESIZE_CALLBACK();
+    }
+
+    return true;
+}
+
+void RendererManager_SetResizeCallback(Core_VoidToVoid callback)
+{
+    RENDERER_RESIZE_CALLBACK = callback;
+}
+
+int RendererManager_ReadKey(const RendererWindow *window)
+{
+    DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
+
+    return RENDERER_BACKEND->readKey(window->windowHandle);
+}
+
+int RendererManager_GetColorCount()
+{
+    return RENDERER_CAPABILITIES.colorCount;
+}
+
+RendererColor RendererManager_GetNearestColor(Vector3Int color)
+{
+    int red = color.x < 0 ? 0 : (color.x > 255 ? 255 : color.x);
+    int green = color.y < 0 ? 0 : (color.y > 255 ? 255 : color.y);
+    int blue = color.z < 0 ? 0 : (color.z > 255 ? 255 : color.z);
+
+    if (RENDERER_CAPABILITIES.colorCount >= 0x1000000) // direct color terminals take the packed RGB value as color
+    {
+        return (RendererColor)((red << 16) | (green << 8) | blue);
+    }
+
+    if (RENDERER_CAPABILITIES.colorCount >= 256) // xterm 256 palette, 6x6x6 color cube from 16 and 24 step gray ramp from 232
+    {
+        static const int cubeLevels[6] = {0, 95, 135, 175, 215, 255};
+
+        int cubeRed = red < 48 ? 0 : (red < 115 ? 1 : (red - 35) / 40);
+        int cubeGreen = green < 48 ? 0 : (green < 115 ? 1 : (green - 35) / 40);
+        int cubeBlue = blue < 48 ? 0 : (blue < 115 ? 1 : (blue - 35) / 40);
+
+        int gray = (red + green + blue) / 3;
+        int grayIndex = gray > 238 ? 23 : (gray < 8 ? 0 : (gray - 3) / 10);
+        int grayLevel = 8 + grayIndex * 10;
+
+        int cubeDistance = (red - cubeLevels[cubeRed]) * (red - cubeLevels[cubeRed]) +
+                           (green - cubeLevels[cubeGreen]) * (green - cubeLevels[cubeGreen]) +
+                           (blue - cubeLevels[cubeBlue]) * (blue - cubeLevels[cubeBlue]);
+        int grayDistance = (red - grayLevel) * (red - grayLevel) +
+                           (green - grayLevel) * (green - grayLevel) +
+                           (blue - grayLevel) * (blue - grayLevel);
+
+        return (RendererColor)(grayDistance < cubeDistance ? 232 + grayIndex : 16 + cubeRed * 36 + cubeGreen * 6 + cubeBlue);
+    }
+
+    // 8 color terminals, curses color numbers are red, green and blue bits
+    return (RendererColor)((red >= 128 ? RendererColor_Red : 0) | (green >= 128 ? RendererColor_Green : 0) | (blue >= 128 ? RendererColor_Blue : 0));
 }
 
 void RendererManager_ChangeColor(RendererColor color, Vector3Int colorToChangeTo)
 {
-    DebugAssert(can_change_color(), "Your terminal doesn't have support for changing colors.");
+    DebugAssert(RENDERER_CAPABILITIES.canChangeColor, "Your terminal doesn't have support for changing colors.");
 
-    init_color(color, colorToChangeTo.x, colorToChangeTo.y, colorToChangeTo.z);
+    RENDERER_BACKEND->changeColor(color, colorToChangeTo);
 
     DebugInfo("Terminal color changed successfully.");
 }
 
 void RendererManager_SetCursorVisibility(RendererCursorVisibility visibility)
 {
-    curs_set(visibility);
+    RENDERER_BACKEND->setCursorVisibility(visibility);
 
     DebugInfo("Cursor visibility set successfully.");
 }
@@ -131,9 +414,9 @@ RendererTextAttribute *RendererTextAttribute_Create(const string title, Renderer
 
     attribute->title = StringDuplicate(title);
     attribute->mask = mask;
-
-    attribute->colorPairHandle = COLOR_PAIR_INDEX++;
-    init_pair(attribute->colorPairHandle, colorPair.x, colorPair.y);
+    attribute->colorPair = colorPair;
+    attribute->id = RENDERER_TEXT_ATTRIBUTE_ID_KOLPA;
+    attribute->colorPairHandle = RendererManager_AcquireColorPair(colorPair);
 
     DebugInfo("Text attribute '%s' created successfully.", attribute->title);
     return attribute;
@@ -143,6 +426,14 @@ void RendererTextAttribute_Destroy(RendererTextAttribute *attribute)
 {
     DebugAssert(attribute != NULL, "Null pointer passed as parameter.");
 
+    if (attribute->id != RENDERER_TEXT_ATTRIBUTE_ID_KOLPA)
+    {
+        DebugWarning("Text attribute '%s' is interned and owned by the renderer. Cannot destroy.", attribute->title);
+        return;
+    }
+
+    RendererManager_ReleaseColorPair(attribute->colorPairHandle);
+
     attribute->colorPairHandle = -1;
     attribute->mask = RendererTextAttributeMask_Kolpa;
     attribute->colorPair = (RendererColorPair){RendererColor_Kolpa, RendererColor_Kolpa};
@@ -163,12 +454,54 @@ void RendererTextAttribute_ChangeColor(RendererTextAttribute *attribute, Rendere
 {
     DebugAssert(attribute != NULL, "Null pointer passed as parameter.");
 
+    if (attribute->id != RENDERER_TEXT_ATTRIBUTE_ID_KOLPA)
+    {
+        DebugWarning("Text attribute '%s' is interned and shared. Cannot change color, intern a new attribute instead.", attribute->title);
+        return;
+    }
+
+    // The old handle may be shared with other attributes, so a handle for the new pair is acquired instead of changing it in place.
+    RendererManager_ReleaseColorPair(attribute->colorPairHandle);
     attribute->colorPair = colorPair;
-    init_pair(attribute->colorPairHandle, colorPair.x, colorPair.y);
+    attribute->colorPairHandle = RendererManager_AcquireColorPair(colorPair);
 
     DebugInfo("Text attribute color changed successfully.");
 }
 
+RendererTextAttributeId RendererTextAttribute_Intern(RendererTextAttributeMask mask, RendererColorPair colorPair)
+{
+    RendererTextAttributeKey key;
+    memset(&key, 0, sizeof(key));
+    key.mask = mask;
+    key.colorPair = colorPair;
+
+    RendererTextAttributeId *cachedId = (RendererTextAttributeId *)HashMap_Get(RENDERER_INTERNED_ATTRIBUTE_IDS, &key);
+    if (cachedId != NULL)
+    {
+        return *cachedId;
+    }
+
+    RendererTextAttributeId id = (RendererTextAttributeId)ListArray_GetSize(RENDERER_INTERNED_ATTRIBUTES);
+
+    char title[64];
+    snprintf(title, sizeof(title), "Interned %d", id);
+
+    RendererTextAttribute *attribute = RendererTextAttribute_Create(title, mask, colorPair);
+    attribute->id = id;
+
+    ListArray_Add(RENDERER_INTERNED_ATTRIBUTES, &attribute);
+    HashMap_Set(RENDERER_INTERNED_ATTRIBUTE_IDS, &key, &id);
+
+    return id;
+}
+
+const RendererTextAttribute *RendererTextAttribute_GetInterned(RendererTextAttributeId id)
+{
+    DebugAssert(id >= 0 && (size_t)id < ListArray_GetSize(RENDERER_INTERNED_ATTRIBUTES), "Invalid interned text attribute id %d.", id);
+
+    return *(RendererTextAttribute **)ListArray_Get(RENDERER_INTERNED_ATTRIBUTES, (size_t)id);
+}
+
 RendererWindow *RendererWindow_Create(const string title, Vector2Int position, Vector2Int size, RendererWindow *parentWindow)
 {
     DebugAssert(title != NULL, "Null pointer passed as parameter. Title cannot be NULL.");
@@ -179,6 +512,9 @@ RendererWindow *RendererWindow_Create(const string title, Vector2Int position, V
 
     window->title = StringDuplicate(title);
 
+    static const int defaultBorderChars[8] = {'|', '|', '-', '-', 0, 0, 0, 0}; // 0 corners are backend defaults
+    memcpy(window->borderChars, defaultBorderChars, sizeof(window->borderChars));
+
     RendererWindow_SetSize(window, size);
     RendererWindow_SetPosition(window, position, false);
     RendererWindow_SetParent(window, parentWindow);
@@ -197,13 +533,14 @@ void RendererWindow_Destroy(RendererWindow *window)
     DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
 
     RendererWindow_DestroyHandle(window);
-    free(window->title);
     window->parent = NULL;
     window->windowHandle = NULL;
     window->defaultAttribute = NULL;
 
     char tempTitle[strlen(window->title) + 1];
     strcpy(tempTitle, window->title);
+
+    free(window->title);
     window->title = NULL;
 
     free(window);
@@ -220,7 +557,7 @@ void RendererWindow_UpdateContent(const RendererWindow *window)
     {
         RendererWindow_UpdateContent(window->parent);
     }
-    wrefresh(window->windowHandle);
+    RENDERER_BACKEND->refresh(window->windowHandle);
 
     DebugInfo("Renderer window '%s' content updated successfully.", window->title);
 }
@@ -232,31 +569,45 @@ void RendererWindow_UpdateAppearance(RendererWindow *window)
 
     window->globalPosition = Vector2Int_Add(window->relativePosition, window->parent->globalPosition);
 
-    if (window->globalPosition.x + window->size.x > COLS ||
-        window->globalPosition.y + window->size.y > LINES)
+    if (window->globalPosition.x + window->size.x > RENDERER_CAPABILITIES.screenSize.x ||
+        window->globalPosition.y + window->size.y > RENDERER_CAPABILITIES.screenSize.y)
     {
         Vector2Int newPosition = NewVector2Int(
-            window->globalPosition.x + window->size.x > COLS ? COLS - window->size.x : window->globalPosition.x,
-            window->globalPosition.y + window->size.y > LINES ? LINES - window->size.y : window->globalPosition.y);
+            window->globalPosition.x + window->size.x > RENDERER_CAPABILITIES.screenSize.x ? RENDERER_CAPABILITIES.screenSize.x - window->size.x : window->globalPosition.x,
+            window->globalPosition.y + window->size.y > RENDERER_CAPABILITIES.screenSize.y ? RENDERER_CAPABILITIES.screenSize.y - window->size.y : window->globalPosition.y);
 
         DebugWarning("Renderer window '%s' has invalid boundaries. (%d, %d) is not allowed. Moving to (%d, %d).",
                      window->title, window->globalPosition.x, window->globalPosition.y, newPosition.x, newPosition.y);
 
-        window->relativePosition = newPosition;
+        window->relativePosition = NewVector2Int(newPosition.x - window->parent->globalPosition.x, newPosition.y - window->parent->globalPosition.y);
+        window->globalPosition = newPosition;
     }
 
-    RendererWindow_DestroyHandle(window);
-    RendererWindow_CreateHandle(window);
+    // Moved and resized in place, recreating the backend window would lose its content and allocate again.
+    // The old border is blanked first, so it does not stay inside the content if the window grows.
+    static const int blankBorderChars[8] = {' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
+    RENDERER_BACKEND->drawBorder(window->windowHandle, blankBorderChars);
+    RENDERER_BACKEND->setWindowGeometry(window->windowHandle, window->globalPosition, window->size);
+    RENDERER_BACKEND->drawBorder(window->windowHandle, window->borderChars);
 
     DebugInfo("Renderer window '%s' appearance updated successfully.", window->title);
 }
 
+void RendererWindow_SetGeometry(RendererWindow *window, Vector2Int position, Vector2Int size)
+{
+    DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
+
+    RendererWindow_SetSize(window, size);
+    RendererWindow_SetPosition(window, position, false);
+    RendererWindow_UpdateAppearance(window);
+}
+
 void RendererWindow_Clear(const RendererWindow *window)
 {
     DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
 
-    wclear(window->windowHandle);
-    box(window->windowHandle, '|', '-');
+    RENDERER_BACKEND->clear(window->windowHandle);
+    RENDERER_BACKEND->drawBorder(window->windowHandle, window->borderChars);
     RendererWindow_UpdateContent(window);
 
     DebugInfo("Renderer window '%s' cleared successfully.", window->title);
@@ -274,7 +625,7 @@ void RendererWindow_SetCursorPosition(const RendererWindow *window, Vector2Int p
         position.y = position.y < 0 ? 0 : (position.y > window->size.y ? window->size.y - 1 : position.y);
     }
 
-    wmove(window->windowHandle, position.y, position.x);
+    RENDERER_BACKEND->setCursorPosition(window->windowHandle, position);
 
     // DebugInfo("Renderer window '%s': Cursor moved to position (%d, %d) successfully.", window->title, position.x, position.y);
 }
@@ -283,11 +634,7 @@ Vector2Int RendererWindow_GetCursorPosition(const RendererWindow *window)
 {
     DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
 
-    int y, x;
-    getyx(window->windowHandle, y, x);
-    Vector2Int cursorPosition = NewVector2Int(x, y);
-
-    return cursorPosition;
+    return RENDERER_BACKEND->getCursorPosition(window->windowHandle);
 }
 
 void RendererWindow_PutCharToPosition(const RendererWindow *window, Vector2Int position, const RendererTextAttribute *attribute, char charToPut)
@@ -295,9 +642,9 @@ void RendererWindow_PutCharToPosition(const RendererWindow *window, Vector2Int p
     DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
 
     RendererWindow_SetCursorPosition(window, position);
-    RendererTextAttribute_Enable(attribute ? attribute : window->defaultAttribute);
-    waddch(window->windowHandle, charToPut);
-    RendererTextAttribute_Disable(attribute ? attribute : window->defaultAttribute);
+    RendererTextAttribute_Enable(window, attribute ? attribute : window->defaultAttribute);
+    RENDERER_BACKEND->putString(window->windowHandle, &charToPut, 1);
+    RendererTextAttribute_Disable(window, attribute ? attribute : window->defaultAttribute);
 
     RendererWindow_UpdateContent(window);
 }
@@ -313,9 +660,9 @@ void RendererWindow_PutStringToPosition(const RendererWindow *window, Vector2Int
     va_end(args);
 
     RendererWindow_SetCursorPosition(window, position);
-    RendererTextAttribute_Enable(attribute ? attribute : window->defaultAttribute);
-    wprintw(window->windowHandle, "%s", buffer);
-    RendererTextAttribute_Disable(attribute ? attribute : window->defaultAttribute);
+    RendererTextAttribute_Enable(window, attribute ? attribute : window->defaultAttribute);
+    RENDERER_BACKEND->putString(window->windowHandle, buffer, strlen(buffer));
+    RendererTextAttribute_Disable(window, attribute ? attribute : window->defaultAttribute);
 
     RendererWindow_UpdateContent(window);
 
@@ -368,12 +715,13 @@ void RendererWindow_DeleteRangeInPosition(const RendererWindow *window, Vector2I
     DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
 
     RendererWindow_SetCursorPosition(window, position);
-    RendererTextAttribute_Enable(window->defaultAttribute);
+    RendererTextAttribute_Enable(window, window->defaultAttribute);
+    char blank = ' ';
     for (size_t i = 0; i < range; i++)
     {
-        waddch(window->windowHandle, ' ');
+        RENDERER_BACKEND->putString(window->windowHandle, &blank, 1);
     }
-    RendererTextAttribute_Disable(window->defaultAttribute);
+    RendererTextAttribute_Disable(window, window->defaultAttribute);
 
     RendererWindow_UpdateContent(window);
 }
@@ -394,7 +742,7 @@ stringHeap RendererManager_GetStringAtPosition(const RendererWindow *window, Vec
 
     RendererWindow_SetCursorPosition(window, cursorPos);
 
-    while ((character = wgetch(window->windowHandle)) != ERR)
+    while ((character = RENDERER_BACKEND->readKey(window->windowHandle)) != RENDERER_BACKEND_KEY_NONE)
     {
         if (inputIndex >= INPUT_STRING_WORD_BUFFER_SIZE - 2 || inputIndex < 0) // error
         {
@@ -583,8 +931,7 @@ void RendererWindow_SetBorderChars(RendererWindow *window, RendererWindowBorders
     window->borderChars[6] = borders.z; // Bottom left corner
     window->borderChars[7] = borders.z; // Bottom right corner
 
-    wborder(window->windowHandle, window->borderChars[0], window->borderChars[1], window->borderChars[2], window->borderChars[3],
-            window->borderChars[4], window->borderChars[5], window->borderChars[6], window->borderChars[7]);
+    RENDERER_BACKEND->drawBorder(window->windowHandle, window->borderChars);
 
     DebugInfo("Renderer window '%s' border characters set successfully.", window->title);
 }
@@ -592,23 +939,21 @@ void RendererWindow_SetBorderChars(RendererWindow *window, RendererWindowBorders
 void RendererWindow_SetSize(RendererWindow *window, Vector2Int newSize)
 {
     DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
-    DebugAssert(newSize.x > 0 && newSize.x <= COLS && newSize.y > 0 && newSize.y <= LINES, "Invalid size (%d, %d) passed.", newSize.x, newSize.y);
+    DebugAssert(newSize.x > 0 && newSize.x <= RENDERER_CAPABILITIES.screenSize.x && newSize.y > 0 && newSize.y <= RENDERER_CAPABILITIES.screenSize.y, "Invalid size (%d, %d) passed.", newSize.x, newSize.y);
 
-    Vector2Int oldSize = window->size;
-    window->size = newSize;
+    DebugInfo("Renderer window '%s' resized from (%d, %d) to (%d, %d)", window->title, window->size.x, window->size.y, newSize.x, newSize.y);
 
-    DebugInfo("Renderer window '%s' resized from (%d, %d) to (%d, %d)", window->title, oldSize.x, oldSize.y, newSize.x, newSize.y);
+    window->size = newSize;
 }
 
 void RendererWindow_SetPosition(RendererWindow *window, Vector2Int newPosition, bool add)
 {
     DebugAssert(window != NULL, "Null pointer passed as parameter. Renderer window cannot be NULL.");
-    DebugAssert(newPosition.x >= 0 && newPosition.x < COLS && newPosition.y >= 0 && newPosition.y < LINES, "Invalid position (%d, %d) passed.", newPosition.x, newPosition.y);
+    DebugAssert(newPosition.x >= 0 && newPosition.x < RENDERER_CAPABILITIES.screenSize.x && newPosition.y >= 0 && newPosition.y < RENDERER_CAPABILITIES.screenSize.y, "Invalid position (%d, %d) passed.", newPosition.x, newPosition.y);
 
-    Vector2Int oldPosition = window->relativePosition;
-    window->relativePosition = add ? Vector2Int_Add(window->relativePosition, newPosition) : newPosition;
+    DebugInfo("Renderer window '%s' moved from (%d, %d) to (%d, %d)", window->title, window->relativePosition.x, window->relativePosition.y, newPosition.x, newPosition.y);
 
-    DebugInfo("Renderer window '%s' moved from (%d, %d) to (%d, %d)", window->title, oldPosition.x, oldPosition.y, newPosition.x, newPosition.y);
+    window->relativePosition = add ? Vector2Int_Add(window->relativePosition, newPosition) : newPosition;
 }
 
 void RendererWindow_SetParent(RendererWindow *window, RendererWindow *parentWindow)
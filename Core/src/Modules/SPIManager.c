@@ -0,0 +1,193 @@
+#include "Modules/SPIManager.h"
+
+#if PLATFORM_LINUX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+
+#pragma region Source Only
+
+typedef struct SPIDevice
+{
+    int fileDescriptor;
+    stringHeap devicePath;
+
+    SPIMode mode;
+    unsigned int speedHz;
+    unsigned char bitsPerWord;
+
+    struct spi_ioc_transfer transferHandles[SPI_DEVICE_MAX_BATCH_TRANSFERS]; // Reused by every batch, only the used part is filled.
+} SPIDevice;
+
+#pragma endregion Source Only
+
+SPIDevice *SPIDevice_Open(const string devicePath, SPIMode mode, unsigned int speedHz, unsigned char bitsPerWord)
+{
+    DebugAssert(devicePath != NULL, "Null pointer passed as parameter. Device path cannot be NULL.");
+
+    SPIDevice *device = (SPIDevice *)malloc(sizeof(SPIDevice));
+    DebugAssert(device != NULL, "Memory allocation failed.");
+
+    device->devicePath = StringDuplicate(devicePath);
+
+    device->fileDescriptor = open(device->devicePath, O_RDWR | O_CLOEXEC);
+    if (device->fileDescriptor < 0)
+    {
+        DebugError("Failed to open SPI device, error in open function with parameter : device path '%s'. Error : %s. Returning NULL.", device->devicePath, strerror(errno));
+
+        free(device->devicePath);
+        device->devicePath = NULL;
+
+        free(device);
+        device = NULL;
+
+        return NULL;
+    }
+
+    if (!SPIDevice_Configure(device, mode, speedHz, bitsPerWord))
+    {
+        DebugError("Failed to configure SPI device, error in SPIDevice_Configure function with parameters : device path '%s', mode '%d', speed '%u' Hz, bits per word '%u'. Returning NULL.", device->devicePath, mode, speedHz, bitsPerWord);
+
+        close(device->fileDescriptor);
+        free(device->devicePath);
+        device->devicePath = NULL;
+
+        free(device);
+        device = NULL;
+
+        return NULL;
+    }
+
+    DebugInfo("SPI device opened successfully with path '%s'.", device->devicePath);
+    return device;
+}
+
+void SPIDevice_Close(SPIDevice *device)
+{
+    DebugAssert(device != NULL, "Null pointer passed as parameter. Device cannot be NULL.");
+
+    char tempDevicePath[strlen(device->devicePath) + 1];
+    strcpy(tempDevicePath, device->devicePath);
+
+    close(device->fileDescriptor);
+    free(device->devicePath);
+    device->fileDescriptor = -1;
+    device->devicePath = NULL;
+
+    free(device);
+    device = NULL;
+
+    DebugInfo("SPI device closed successfully with path '%s'.", tempDevicePath);
+}
+
+bool SPIDevice_Configure(SPIDevice *device, SPIMode mode, unsigned int speedHz, unsigned char bitsPerWord)
+{
+    DebugAssert(device != NULL, "Null pointer passed as parameter. Device cannot be NULL.");
+    DebugAssert(mode >= SPIMode_0 && mode <= SPIMode_3, "Invalid SPI mode %d passed.", mode);
+    DebugAssert(speedHz > 0, "SPI speed must be more than 0.");
+
+    unsigned char modeValue = (unsigned char)mode;
+
+    if (ioctl(device->fileDescriptor, SPI_IOC_WR_MODE, &modeValue) < 0)
+    {
+        DebugError("Failed to set SPI mode, error in ioctl function with parameters : device path '%s', mode '%d'. Error : %s.", device->devicePath, mode, strerror(errno));
+        return false;
+    }
+
+    if (ioctl(device->fileDescriptor, SPI_IOC_WR_BITS_PER_WORD, &bitsPerWord) < 0)
+    {
+        DebugError("Failed to set SPI word size, error in ioctl function with parameters : device path '%s', bits per word '%u'. Error : %s.", device->devicePath, bitsPerWord, strerror(errno));
+        return false;
+    }
+
+    if (ioctl(device->fileDescriptor, SPI_IOC_WR_MAX_SPEED_HZ, &speedHz) < 0)
+    {
+        DebugError("Failed to set SPI speed, error in ioctl function with parameters : device path '%s', speed '%u' Hz. Error : %s.", device->devicePath, speedHz, strerror(errno));
+        return false;
+    }
+
+    device->mode = mode;
+    device->speedHz = speedHz;
+    device->bitsPerWord = bitsPerWord;
+
+    return true;
+}
+
+bool SPIDevice_Transfer(SPIDevice *device, const SPITransfer *transfers, size_t count)
+{
+    DebugAssert(device != NULL, "Null pointer passed as parameter. Device cannot be NULL.");
+    DebugAssert(transfers != NULL, "Null pointer passed as parameter. Transfers cannot be NULL.");
+    DebugAssert(count > 0 && count <= SPI_DEVICE_MAX_BATCH_TRANSFERS, "Invalid transfer count %zu passed. Must be between 1 and %d.", count, SPI_DEVICE_MAX_BATCH_TRANSFERS);
+
+    // Only the used descriptors are cleared, unused fields must be zero for the kernel.
+    memset(device->transferHandles, 0, count * sizeof(struct spi_ioc_transfer));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        struct spi_ioc_transfer *handle = &device->transferHandles[i];
+
+        handle->tx_buf = (unsigned long)transfers[i].transmitBuffer;
+        handle->rx_buf = (unsigned long)transfers[i].receiveBuffer;
+        handle->len = transfers[i].length;
+        handle->speed_hz = transfers[i].speedHz != 0 ? transfers[i].speedHz : device->speedHz;
+        handle->delay_usecs = transfers[i].delayMicroseconds;
+        handle->bits_per_word = device->bitsPerWord;
+        handle->cs_change = transfers[i].changeChipSelect;
+    }
+
+    int transferReturn = ioctl(device->fileDescriptor, SPI_IOC_MESSAGE(count), device->transferHandles);
+    if (transferReturn < 0)
+    {
+        DebugError("Failed to transfer SPI batch, error in ioctl function with parameters : device path '%s', transfer count '%zu'. Error : %s.", device->devicePath, count, strerror(errno));
+        return false;
+    }
+
+    return true;
+}
+
+bool SPIDevice_Exchange(SPIDevice *device, const void *transmitBuffer, void *receiveBuffer, unsigned int length)
+{
+    SPITransfer transfer = {
+        .transmitBuffer = transmitBuffer,
+        .receiveBuffer = receiveBuffer,
+        .length = length,
+    };
+
+    return SPIDevice_Transfer(device, &transfer, 1);
+}
+
+bool SPIDevice_ReadRegisters(SPIDevice *device, unsigned char address, unsigned char *values, unsigned int count)
+{
+    DebugAssert(values != NULL, "Null pointer passed as parameter. Values cannot be NULL.");
+
+    // Chip select stays active between the address and the data, most sensors need both in the same frame.
+    SPITransfer transfers[2] = {
+        {.transmitBuffer = &address, .length = 1},
+        {.receiveBuffer = values, .length = count},
+    };
+
+    return SPIDevice_Transfer(device, transfers, 2);
+}
+
+void *SPIDevice_AllocateBuffer(size_t size)
+{
+    DebugAssert(size > 0, "Buffer size must be more than 0.");
+
+    // Rounded up to whole cache lines, aligned_alloc needs a multiple of the alignment.
+    size_t roundedSize = (size + SPI_DEVICE_BUFFER_ALIGNMENT - 1) & ~(size_t)(SPI_DEVICE_BUFFER_ALIGNMENT - 1);
+
+    void *buffer = aligned_alloc(SPI_DEVICE_BUFFER_ALIGNMENT, roundedSize);
+    DebugAssert(buffer != NULL, "Memory allocation failed for SPI buffer.");
+
+    return buffer;
+}
+
+void SPIDevice_FreeBuffer(void *buffer)
+{
+    free(buffer);
+}
+
+#endif // PLATFORM_LINUX
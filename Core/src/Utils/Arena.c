@@ -0,0 +1,107 @@
+#include "Utils/Arena.h"
+
+#include <stdint.h>
+
+#pragma region Source Only
+
+// Alignment of the block, enough for any allocation up to the SIMD arrays without padding at the start
+#define ARENA_BLOCK_ALIGNMENT 64
+
+typedef struct Arena
+{
+    unsigned char *block;
+    size_t capacity;
+    size_t used;
+} Arena;
+
+#pragma endregion Source Only
+
+Arena *Arena_Create(size_t capacity)
+{
+    DebugAssert(capacity > 0, "Capacity must be more than 0.");
+
+    Arena *arena = (Arena *)malloc(sizeof(Arena));
+    DebugAssert(arena != NULL, "Memory allocation failed for Arena.");
+
+    // aligned_alloc needs a multiple of the alignment
+    size_t size = (capacity + ARENA_BLOCK_ALIGNMENT - 1) & ~(size_t)(ARENA_BLOCK_ALIGNMENT - 1);
+#if PLATFORM_WINDOWS
+    arena->block = (unsigned char *)_aligned_malloc(size, ARENA_BLOCK_ALIGNMENT);
+#else
+    arena->block = (unsigned char *)aligned_alloc(ARENA_BLOCK_ALIGNMENT, size);
+#endif
+    DebugAssert(arena->block != NULL, "Memory allocation failed for Arena block.");
+
+    arena->capacity = size;
+    arena->used = 0;
+
+    DebugInfo("Arena created with capacity %zu.", size);
+    return arena;
+}
+
+void Arena_Destroy(Arena *arena)
+{
+    DebugAssert(arena != NULL, "Null pointer passed as parameter. Arena cannot be NULL.");
+
+#if PLATFORM_WINDOWS
+    _aligned_free(arena->block);
+#else
+    free(arena->block);
+#endif
+    arena->block = NULL;
+
+    free(arena);
+    arena = NULL;
+
+    DebugInfo("Arena destroyed.");
+}
+
+void *Arena_Allocate(Arena *arena, size_t size, size_t alignment)
+{
+    DebugAssert(arena != NULL, "Null pointer passed as parameter. Arena cannot be NULL.");
+    DebugAssert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of 2.");
+
+    // Aligned by the address, so alignments above the one of the block work too
+    uintptr_t address = (uintptr_t)(arena->block + arena->used);
+    size_t padding = (size_t)((alignment - (address & (alignment - 1))) & (alignment - 1));
+
+    if (padding > arena->capacity - arena->used || size > arena->capacity - arena->used - padding)
+    {
+        DebugWarning("Arena is full, %zu bytes requested with %zu of %zu bytes used.", size, arena->used, arena->capacity);
+        return NULL;
+    }
+
+    void *allocation = arena->block + arena->used + padding;
+    arena->used += padding + size;
+
+    return allocation;
+}
+
+void Arena_Reset(Arena *arena)
+{
+    DebugAssert(arena != NULL, "Null pointer passed as parameter. Arena cannot be NULL.");
+
+    arena->used = 0;
+}
+
+size_t Arena_GetUsed(const Arena *arena)
+{
+    DebugAssert(arena != NULL, "Null pointer passed as parameter. Arena cannot be NULL.");
+
+    return arena->used;
+}
+
+void Arena_Rewind(Arena *arena, size_t mark)
+{
+    DebugAssert(arena != NULL, "Null pointer passed as parameter. Arena cannot be NULL.");
+    DebugAssert(mark <= arena->used, "Mark must not be more than the used size of the Arena.");
+
+    arena->used = mark;
+}
+
+size_t Arena_GetCapacity(const Arena *arena)
+{
+    DebugAssert(arena != NULL, "Null pointer passed as parameter. Arena cannot be NULL.");
+
+    return arena->capacity;
+}
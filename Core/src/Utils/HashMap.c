@@ -1 +1,220 @@
-#include <Utils/HashMap.h>
+#include "Utils/HashMap.h"
+
+#pragma region Source Only
+
+typedef struct HashMap
+{
+    unsigned char *slots;
+    bool *occupied;
+    size_t capacity;
+    size_t size;
+    size_t sizeOfKey;
+    size_t sizeOfValue;
+    size_t sizeOfSlot;
+} HashMap;
+
+/// @brief Gets the key location of the slot.
+/// @param map HashMap to get the slot from.
+/// @param index Index of the slot.
+/// @return Pointer to the key of the slot. Value is stored right after the key.
+unsigned char *HashMap_GetSlot(const HashMap *map, size_t index)
+{
+    return map->slots + index * map->sizeOfSlot;
+}
+
+/// @brief Finds the slot of the key or the empty slot the key should be placed in.
+/// @param map HashMap to search in.
+/// @param key Key to search for.
+/// @return Index of the found slot.
+size_t HashMap_FindSlot(const HashMap *map, const void *key)
+{
+    size_t mask = map->capacity - 1;
+    size_t index = (size_t)HashMap_HashBytes(key, map->sizeOfKey) & mask;
+
+    while (map->occupied[index] && memcmp(HashMap_GetSlot(map, index), key, map->sizeOfKey) != 0)
+    {
+        index = (index + 1) & mask;
+    }
+
+    return index;
+}
+
+/// @brief Allocates new slots and moves all the keys into them.
+/// @param map HashMap to resize.
+/// @param newCapacity New slot count. Must be a power of 2 and more than the size.
+void HashMap_Resize(HashMap *map, size_t newCapacity)
+{
+    unsigned char *oldSlots = map->slots;
+    bool *oldOccupied = map->occupied;
+    size_t oldCapacity = map->capacity;
+
+    map->slots = (unsigned char *)malloc(newCapacity * map->sizeOfSlot);
+    DebugAssert(map->slots != NULL, "Memory allocation failed for HashMap slots.");
+
+    map->occupied = (bool *)calloc(newCapacity, sizeof(bool));
+    DebugAssert(map->occupied != NULL, "Memory allocation failed for HashMap occupation flags.");
+
+    map->capacity = newCapacity;
+
+    for (size_t i = 0; i < oldCapacity; i++)
+    {
+        if (oldOccupied[i])
+        {
+            size_t index = HashMap_FindSlot(map, oldSlots + i * map->sizeOfSlot);
+            memcpy(HashMap_GetSlot(map, index), oldSlots + i * map->sizeOfSlot, map->sizeOfSlot);
+            map->occupied[index] = true;
+        }
+    }
+
+    free(oldSlots);
+    free(oldOccupied);
+
+    DebugInfo("HashMap resized from %zu to %zu", oldCapacity, newCapacity);
+}
+
+#pragma endregion Source Only
+
+HashMap *HashMap_Create(size_t sizeOfKey, size_t sizeOfValue, size_t initialCapacity)
+{
+    DebugAssert(sizeOfKey > 0, "Key size of HashMap cannot be 0.");
+
+    HashMap *map = (HashMap *)malloc(sizeof(HashMap));
+    DebugAssert(map != NULL, "Memory allocation failed for HashMap.");
+
+    size_t capacity = 8;
+    while (capacity < initialCapacity)
+    {
+        capacity *= 2;
+    }
+
+    map->sizeOfKey = sizeOfKey;
+    map->sizeOfValue = sizeOfValue;
+    map->sizeOfSlot = sizeOfKey + sizeOfValue;
+    map->capacity = capacity;
+    map->size = 0;
+
+    map->slots = (unsigned char *)malloc(capacity * map->sizeOfSlot);
+    DebugAssert(map->slots != NULL, "Memory allocation failed for HashMap slots.");
+
+    map->occupied = (bool *)calloc(capacity, sizeof(bool));
+    DebugAssert(map->occupied != NULL, "Memory allocation failed for HashMap occupation flags.");
+
+    DebugInfo("HashMap created with initial capacity: %zu, size of key: %zu, size of value: %zu", capacity, sizeOfKey, sizeOfValue);
+    return map;
+}
+
+void HashMap_Destroy(HashMap *map)
+{
+    DebugAssert(map != NULL, "Null pointer passed as parameter. HashMap cannot be NULL.");
+
+    free(map->slots);
+    free(map->occupied);
+    map->slots = NULL;
+    map->occupied = NULL;
+
+    free(map);
+    map = NULL;
+
+    DebugInfo("HashMap destroyed.");
+}
+
+void HashMap_Set(HashMap *map, const void *key, const void *value)
+{
+    DebugAssert(map != NULL, "Null pointer passed as parameter. HashMap cannot be NULL.");
+    DebugAssert(key != NULL, "Null pointer passed as parameter. Key cannot be NULL.");
+
+    size_t index = HashMap_FindSlot(map, key);
+
+    if (!map->occupied[index])
+    {
+        if ((map->size + 1) * 4 > map->capacity * HASH_MAP_MAX_LOAD_QUARTERS)
+        {
+            HashMap_Resize(map, map->capacity * HASH_MAP_RESIZE_MULTIPLIER);
+            index = HashMap_FindSlot(map, key);
+        }
+
+        memcpy(HashMap_GetSlot(map, index), key, map->sizeOfKey);
+        map->occupied[index] = true;
+        map->size++;
+    }
+
+    if (map->sizeOfValue > 0)
+    {
+        memcpy(HashMap_GetSlot(map, index) + map->sizeOfKey, value, map->sizeOfValue);
+    }
+}
+
+void *HashMap_Get(const HashMap *map, const void *key)
+{
+    DebugAssert(map != NULL, "Null pointer passed as parameter. HashMap cannot be NULL.");
+    DebugAssert(key != NULL, "Null pointer passed as parameter. Key cannot be NULL.");
+
+    size_t index = HashMap_FindSlot(map, key);
+
+    return map->occupied[index] ? HashMap_GetSlot(map, index) + map->sizeOfKey : NULL;
+}
+
+bool HashMap_Remove(HashMap *map, const void *key)
+{
+    DebugAssert(map != NULL, "Null pointer passed as parameter. HashMap cannot be NULL.");
+    DebugAssert(key != NULL, "Null pointer passed as parameter. Key cannot be NULL.");
+
+    size_t mask = map->capacity - 1;
+    size_t index = HashMap_FindSlot(map, key);
+
+    if (!map->occupied[index])
+    {
+        return false;
+    }
+
+    // Backward shift deletion, moves the following keys of the probe chain into the hole so no tombstones are needed.
+    size_t hole = index;
+    size_t next = (hole + 1) & mask;
+
+    while (map->occupied[next])
+    {
+        size_t home = (size_t)HashMap_HashBytes(HashMap_GetSlot(map, next), map->sizeOfKey) & mask;
+
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            memcpy(HashMap_GetSlot(map, hole), HashMap_GetSlot(map, next), map->sizeOfSlot);
+            hole = next;
+        }
+
+        next = (next + 1) & mask;
+    }
+
+    map->occupied[hole] = false;
+    map->size--;
+
+    return true;
+}
+
+void HashMap_Clear(HashMap *map)
+{
+    DebugAssert(map != NULL, "Null pointer passed as parameter. HashMap cannot be NULL.");
+
+    memset(map->occupied, 0, map->capacity * sizeof(bool));
+    map->size = 0;
+}
+
+size_t HashMap_GetSize(const HashMap *map)
+{
+    DebugAssert(map != NULL, "Null pointer passed as parameter. HashMap cannot be NULL.");
+
+    return map->size;
+}
+
+unsigned long long HashMap_HashBytes(const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
@@ -83,7 +83,7 @@ void ListLinkedNode_Append(ListLinkedNode *node, ListLinkedNode *nextNode)
 {
     if (node->next == NULL)
     {
-        ListLinkedNode_Connect(node->next, nextNode);
+        ListLinkedNode_Connect(node, nextNode);
     }
     else
     {
@@ -0,0 +1,144 @@
+#include "Utils/RingBuffer.h"
+
+#include <stdatomic.h>
+
+#pragma region Source Only
+
+typedef struct RingBuffer
+{
+    unsigned char *items;
+    size_t sizeOfItem;
+    size_t capacity; // Power of 2, indices are masked instead of wrapped.
+
+    char producerPadding[RING_BUFFER_CACHE_LINE_SIZE];
+    _Atomic size_t writeIndex; // Only written by the producer. Grows forever, masked on use.
+    size_t cachedReadIndex;    // Producer's copy of the read index, reloaded only when the buffer looks full.
+
+    char consumerPadding[RING_BUFFER_CACHE_LINE_SIZE];
+    _Atomic size_t readIndex; // Only written by the consumer. Grows forever, masked on use.
+    size_t cachedWriteIndex;  // Consumer's copy of the write index, reloaded only when the buffer looks empty.
+
+    char endPadding[RING_BUFFER_CACHE_LINE_SIZE];
+} RingBuffer;
+
+/// @brief Gets the item location of the index.
+/// @param buffer RingBuffer to get the item from.
+/// @param index Unmasked index of the item.
+/// @return Pointer to the item inside the RingBuffer.
+unsigned char *RingBuffer_GetItem(const RingBuffer *buffer, size_t index)
+{
+    return buffer->items + (index & (buffer->capacity - 1)) * buffer->sizeOfItem;
+}
+
+#pragma endregion Source Only
+
+RingBuffer *RingBuffer_Create(size_t sizeOfItem, size_t capacity)
+{
+    DebugAssert(sizeOfItem > 0, "Item size must be more than 0.");
+    DebugAssert(capacity > 0, "Capacity must be more than 0.");
+
+    RingBuffer *buffer = (RingBuffer *)malloc(sizeof(RingBuffer));
+    DebugAssert(buffer != NULL, "Memory allocation failed for RingBuffer.");
+
+    size_t roundedCapacity = 1;
+    while (roundedCapacity < capacity)
+    {
+        roundedCapacity <<= 1;
+    }
+
+    buffer->items = (unsigned char *)malloc(roundedCapacity * sizeOfItem);
+    DebugAssert(buffer->items != NULL, "Memory allocation failed for RingBuffer items.");
+
+    buffer->sizeOfItem = sizeOfItem;
+    buffer->capacity = roundedCapacity;
+
+    atomic_init(&buffer->writeIndex, 0);
+    atomic_init(&buffer->readIndex, 0);
+    buffer->cachedReadIndex = 0;
+    buffer->cachedWriteIndex = 0;
+
+    DebugInfo("RingBuffer created with capacity %zu.", roundedCapacity);
+    return buffer;
+}
+
+void RingBuffer_Destroy(RingBuffer *buffer)
+{
+    DebugAssert(buffer != NULL, "Null pointer passed as parameter. RingBuffer cannot be NULL.");
+
+    free(buffer->items);
+    buffer->items = NULL;
+
+    free(buffer);
+    buffer = NULL;
+
+    DebugInfo("RingBuffer destroyed.");
+}
+
+bool RingBuffer_Push(RingBuffer *buffer, const void *item)
+{
+    size_t writeIndex = atomic_load_explicit(&buffer->writeIndex, memory_order_relaxed);
+
+    if (writeIndex - buffer->cachedReadIndex == buffer->capacity)
+    {
+        // Acquire pairs with the release of the consumer, the slot is not read anymore after this.
+        buffer->cachedReadIndex = atomic_load_explicit(&buffer->readIndex, memory_order_acquire);
+
+        if (writeIndex - buffer->cachedReadIndex == buffer->capacity)
+        {
+            return false;
+        }
+    }
+
+    memcpy(RingBuffer_GetItem(buffer, writeIndex), item, buffer->sizeOfItem);
+
+    // Release publishes the copied item before the new index.
+    atomic_store_explicit(&buffer->writeIndex, writeIndex + 1, memory_order_release);
+    return true;
+}
+
+bool RingBuffer_Pop(RingBuffer *buffer, void *item)
+{
+    return RingBuffer_PopMany(buffer, item, 1) == 1;
+}
+
+size_t RingBuffer_PopMany(RingBuffer *buffer, void *items, size_t maxCount)
+{
+    size_t readIndex = atomic_load_explicit(&buffer->readIndex, memory_order_relaxed);
+
+    if (buffer->cachedWriteIndex - readIndex < maxCount)
+    {
+        // Acquire pairs with the release of the producer, so the items are fully copied.
+        buffer->cachedWriteIndex = atomic_load_explicit(&buffer->writeIndex, memory_order_acquire);
+    }
+
+    size_t available = buffer->cachedWriteIndex - readIndex;
+    size_t count = available < maxCount ? available : maxCount;
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    // At most two copies, the part until the end of the storage and the wrapped part.
+    size_t firstSlot = readIndex & (buffer->capacity - 1);
+    size_t firstCount = buffer->capacity - firstSlot < count ? buffer->capacity - firstSlot : count;
+
+    memcpy(items, RingBuffer_GetItem(buffer, readIndex), firstCount * buffer->sizeOfItem);
+    memcpy((unsigned char *)items + firstCount * buffer->sizeOfItem, buffer->items, (count - firstCount) * buffer->sizeOfItem);
+
+    atomic_store_explicit(&buffer->readIndex, readIndex + count, memory_order_release);
+    return count;
+}
+
+size_t RingBuffer_GetSize(const RingBuffer *buffer)
+{
+    size_t readIndex = atomic_load_explicit(&((RingBuffer *)buffer)->readIndex, memory_order_acquire);
+    size_t writeIndex = atomic_load_explicit(&((RingBuffer *)buffer)->writeIndex, memory_order_acquire);
+
+    return writeIndex - readIndex;
+}
+
+size_t RingBuffer_GetCapacity(const RingBuffer *buffer)
+{
+    return buffer->capacity;
+}
@@ -0,0 +1,208 @@
+#include "Utils/WorkerPool.h"
+
+#if !PLATFORM_WINDOWS
+#include <pthread.h>
+#include <stdatomic.h>
+#endif
+
+#pragma region Source Only
+
+#if !PLATFORM_WINDOWS
+
+typedef struct WorkerPool
+{
+    pthread_t *threads;
+    size_t threadCount; // including the thread calling the loops, so threadCount - 1 are started
+    pthread_mutex_t mutex;
+    pthread_cond_t workCondition; // Signaled when a loop starts and when the pool stops.
+    pthread_cond_t doneCondition; // Signaled when the last busy thread leaves a loop.
+
+    // The loop, written under the mutex before the generation changes
+    WorkerPoolTask task;
+    void *context;
+    size_t count;
+    _Atomic size_t nextIndex;
+
+    size_t generation;  // Counts the loops, a thread waits until it differs from the last loop it worked on.
+    size_t busyThreads; // Started threads still working on the current loop.
+    bool isStopping;
+} WorkerPool;
+
+/// @brief Runs the indices of the current loop until none is left, shared by the threads of the pool and the calling thread.
+void WorkerPool_RunIndices(WorkerPool *pool, WorkerPoolTask task, void *context, size_t count)
+{
+    size_t index;
+    while ((index = atomic_fetch_add_explicit(&pool->nextIndex, 1, memory_order_relaxed)) < count)
+    {
+        task(context, index);
+    }
+}
+
+/// @brief Thread function of the pool, waits for loops until the pool stops.
+void *WorkerPool_Run(void *argument)
+{
+    WorkerPool *pool = (WorkerPool *)argument;
+    size_t seenGeneration = 0;
+
+    pthread_mutex_lock(&pool->mutex);
+    while (true)
+    {
+        while (!pool->isStopping && pool->generation == seenGeneration)
+        {
+            pthread_cond_wait(&pool->workCondition, &pool->mutex);
+        }
+
+        if (pool->isStopping)
+        {
+            break;
+        }
+
+        seenGeneration = pool->generation;
+        WorkerPoolTask task = pool->task;
+        void *context = pool->context;
+        size_t count = pool->count;
+        pthread_mutex_unlock(&pool->mutex);
+
+        WorkerPool_RunIndices(pool, task, context, count);
+
+        pthread_mutex_lock(&pool->mutex);
+        pool->busyThreads--;
+        if (pool->busyThreads == 0)
+        {
+            pthread_cond_signal(&pool->doneCondition);
+        }
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+}
+
+#else
+
+typedef struct WorkerPool
+{
+    size_t threadCount;
+} WorkerPool;
+
+#endif
+
+#pragma endregion Source Only
+
+WorkerPool *WorkerPool_Create(size_t threadCount)
+{
+    WorkerPool *pool = (WorkerPool *)malloc(sizeof(WorkerPool));
+    DebugAssert(pool != NULL, "Memory allocation failed for WorkerPool.");
+
+#if !PLATFORM_WINDOWS
+    if (threadCount == 0)
+    {
+        long onlineCount = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = onlineCount > 0 ? (size_t)onlineCount : 1;
+    }
+
+    pool->threads = (pthread_t *)malloc(threadCount * sizeof(pthread_t));
+    DebugAssert(pool->threads != NULL, "Memory allocation failed for WorkerPool threads.");
+
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->workCondition, NULL);
+    pthread_cond_init(&pool->doneCondition, NULL);
+    pool->task = NULL;
+    pool->context = NULL;
+    pool->count = 0;
+    atomic_init(&pool->nextIndex, 0);
+    pool->generation = 0;
+    pool->busyThreads = 0;
+    pool->isStopping = false;
+
+    // Fewer threads than asked are fine, the loops only get slower
+    pool->threadCount = 1;
+    for (size_t i = 0; i + 1 < threadCount; i++)
+    {
+        int threadCreateReturn = pthread_create(&pool->threads[i], NULL, WorkerPool_Run, pool);
+        if (threadCreateReturn != 0)
+        {
+            DebugWarning("Failed to start a WorkerPool thread, error in pthread_create function. Return : %d. Continuing with %zu threads.", threadCreateReturn, pool->threadCount);
+            break;
+        }
+        pool->threadCount++;
+    }
+#else
+    (void)threadCount;
+    pool->threadCount = 1;
+#endif
+
+    DebugInfo("WorkerPool created with %zu threads.", pool->threadCount);
+    return pool;
+}
+
+void WorkerPool_Destroy(WorkerPool *pool)
+{
+    DebugAssert(pool != NULL, "Null pointer passed as parameter. WorkerPool cannot be NULL.");
+
+#if !PLATFORM_WINDOWS
+    pthread_mutex_lock(&pool->mutex);
+    pool->isStopping = true;
+    pthread_cond_broadcast(&pool->workCondition);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (size_t i = 0; i + 1 < pool->threadCount; i++)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->doneCondition);
+    pthread_cond_destroy(&pool->workCondition);
+    pthread_mutex_destroy(&pool->mutex);
+
+    free(pool->threads);
+    pool->threads = NULL;
+#endif
+
+    free(pool);
+    pool = NULL;
+
+    DebugInfo("WorkerPool destroyed.");
+}
+
+void WorkerPool_ParallelFor(WorkerPool *pool, size_t count, WorkerPoolTask task, void *context)
+{
+    DebugAssert(task != NULL, "Null pointer passed as parameter. Task cannot be NULL.");
+
+    if (pool == NULL || pool->threadCount == 1 || count <= 1)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            task(context, i);
+        }
+        return;
+    }
+
+#if !PLATFORM_WINDOWS
+    pthread_mutex_lock(&pool->mutex);
+    pool->task = task;
+    pool->context = context;
+    pool->count = count;
+    atomic_store_explicit(&pool->nextIndex, 0, memory_order_relaxed);
+    pool->busyThreads = pool->threadCount - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->workCondition);
+    pthread_mutex_unlock(&pool->mutex);
+
+    WorkerPool_RunIndices(pool, task, context, count);
+
+    // The loop is done only when every thread has left it, a thread can still be running its last index
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->busyThreads > 0)
+    {
+        pthread_cond_wait(&pool->doneCondition, &pool->mutex);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+#endif
+}
+
+size_t WorkerPool_GetThreadCount(const WorkerPool *pool)
+{
+    DebugAssert(pool != NULL, "Null pointer passed as parameter. WorkerPool cannot be NULL.");
+
+    return pool->threadCount;
+}